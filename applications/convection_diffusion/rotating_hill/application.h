@@ -82,6 +82,21 @@ public:
   {
   }
 
+  void
+  add_parameters(dealii::ParameterHandler & prm)
+  {
+    ApplicationBase<dim, Number>::add_parameters(prm);
+
+    // clang-format off
+    prm.enter_subsection("Application");
+      prm.add_parameter("NRefineLocal",      n_refine_local,       "Number of local refinements of the annulus traversed by the hill (explicit time integration if larger than 0).", dealii::Patterns::Integer(0,10));
+      prm.add_parameter("MaxTimeStepLevels", max_time_step_levels, "Maximum number of time step levels (multirate time integration if larger than 1).", dealii::Patterns::Integer(1,32));
+      prm.add_parameter("OIFSubStepping",    oif_substepping,      "Treat the convective term explicitly by operator-integration-factor splitting.", dealii::Patterns::Bool());
+      prm.add_parameter("CFL",               cfl,                  "CFL number of the BDF time step.", dealii::Patterns::Double(0.0));
+    prm.leave_subsection();
+    // clang-format on
+  }
+
 private:
   void
   set_parameters() final
@@ -109,9 +124,38 @@ private:
     this->param.calculation_of_time_step_size = TimeStepCalculation::CFL;
     this->param.adaptive_time_stepping        = false;
     this->param.time_step_size                = 1.e-2;
-    this->param.cfl                           = 0.25;
+    this->param.cfl                           = cfl;
     this->param.exponent_fe_degree_convection = 1.5;
 
+    // explicit treatment of the convective term by sub-steps of an explicit Runge-Kutta method
+    // within the stability limit cfl_oif, allowing CFL numbers of the BDF time step above one
+    if(oif_substepping)
+    {
+      this->param.treatment_of_convective_term = TreatmentOfConvectiveTerm::ExplicitOIF;
+      this->param.time_integrator_oif          = TimeIntegratorOIF::ExplRK3Stage7Reg2;
+      this->param.cfl_oif                      = 0.25;
+    }
+
+    // explicit Runge-Kutta method of second order on the locally refined grid, either single-rate
+    // or with local time stepping, to compare both approaches for the same spatial discretization
+    if(n_refine_local > 0 or max_time_step_levels > 1)
+    {
+      this->param.temporal_discretization = TemporalDiscretization::ExplRK;
+      this->param.order_time_integrator   = 2;
+      if(max_time_step_levels > 1)
+      {
+        this->param.time_integrator_rk   = TimeIntegratorRK::ExplRKMultirate;
+        this->param.max_time_step_levels = max_time_step_levels;
+      }
+      else
+      {
+        this->param.time_integrator_rk = TimeIntegratorRK::ExplRK2Stage2;
+      }
+      // maximum velocity in the corners of the domain, which determines the time step levels
+      this->param.max_velocity = 2.0 * dealii::numbers::PI * std::sqrt(2.0);
+      this->param.cfl          = 0.1;
+    }
+
     // restart
     this->param.restart_data.write_restart = false;
     this->param.restart_data.filename      = "output_conv_diff/rotating_hill";
@@ -135,6 +179,12 @@ private:
     this->param.preconditioner =
       Preconditioner::Multigrid; // None; //InverseMassMatrix; //PointJacobi;
                                  // //BlockJacobi; //Multigrid;
+    // only the mass matrix remains to be inverted
+    if(oif_substepping)
+    {
+      this->param.solver         = Solver::CG;
+      this->param.preconditioner = Preconditioner::InverseMassMatrix;
+    }
     this->param.update_preconditioner = true;
 
     // BlockJacobi (these parameters are also relevant if used as a smoother in multigrid)
@@ -160,7 +210,7 @@ private:
     this->param.solver_info_data.interval_time = (end_time - start_time) / 20;
 
     // NUMERICAL PARAMETERS
-    this->param.use_cell_based_face_loops               = true;
+    this->param.use_cell_based_face_loops               = max_time_step_levels == 1;
     this->param.store_analytical_velocity_in_dof_vector = false;
   }
 
@@ -170,6 +220,18 @@ private:
     dealii::GridGenerator::hyper_cube(*this->grid->triangulation, left, right);
 
     this->grid->triangulation->refine_global(this->param.grid.n_refine_global);
+
+    // refine the cells in the vicinity of the circle of radius 0.5 on which the hill rotates
+    for(unsigned int i = 0; i < n_refine_local; ++i)
+    {
+      for(auto cell : this->grid->triangulation->active_cell_iterators())
+      {
+        double const radius = cell->center().norm();
+        if(cell->is_locally_owned() and radius > 0.25 and radius < 0.75)
+          cell->set_refine_flag();
+      }
+      this->grid->triangulation->execute_coarsening_and_refinement();
+    }
   }
 
 
@@ -219,6 +281,12 @@ private:
 
   double const left  = -1.0;
   double const right = +1.0;
+
+  unsigned int n_refine_local       = 0;
+  unsigned int max_time_step_levels = 1;
+
+  bool   oif_substepping = false;
+  double cfl             = 0.25;
 };
 
 } // namespace ConvDiff
@@ -115,6 +115,8 @@ public:
       prm.add_parameter("SampleStartTime",      sample_start_time_multiples,  "Start time of sampling in multiples of flow through time.", dealii::Patterns::Integer(0.0,1000.0));
       prm.add_parameter("SampleEveryTimeSteps", sample_every_timesteps,       "Sample every ... time steps.", dealii::Patterns::Integer(1,1000));
       prm.add_parameter("PointsPerLine",        points_per_line,              "Points per line in vertical direction.", dealii::Patterns::Integer(1,10000));
+      prm.add_parameter("UseTurbulenceModel",   use_turbulence_model,         "Use an eddy-viscosity turbulence model.");
+      prm.add_parameter("TurbulenceOnTheFly",   turbulence_model_on_the_fly,  "Compute the turbulent viscosity on the fly.");
     prm.leave_subsection();
     // clang-format on
   }
@@ -185,8 +187,9 @@ private:
     this->param.IP_formulation_viscous = InteriorPenaltyFormulation::SIPG;
 
     // TURBULENCE
-    this->param.use_turbulence_model = false;
-    this->param.turbulence_model     = TurbulenceEddyViscosityModel::Sigma;
+    this->param.use_turbulence_model        = use_turbulence_model;
+    this->param.turbulence_model_on_the_fly = turbulence_model_on_the_fly;
+    this->param.turbulence_model            = TurbulenceEddyViscosityModel::Sigma;
     // Smagorinsky: 0.165
     // Vreman: 0.28
     // WALE: 0.50
@@ -493,6 +496,10 @@ private:
   bool   inviscid = false;
   double Re       = 5600.0; // 700, 1400, 5600, 10595, 19000
 
+  // turbulence model
+  bool use_turbulence_model        = false;
+  bool turbulence_model_on_the_fly = false;
+
   double const H      = 0.028;
   double const width  = 4.5 * H;
   double const length = 9.0 * H;
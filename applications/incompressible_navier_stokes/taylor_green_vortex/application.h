@@ -112,14 +112,15 @@ public:
 
     // clang-format off
     prm.enter_subsection("Application");
-      prm.add_parameter("MeshType",        mesh_type_string,                  "Type of mesh (Cartesian versus curvilinear).", dealii::Patterns::Selection("Cartesian|Curvilinear"));
-      prm.add_parameter("NCoarseCells1D",  n_subdivisions_1d_hypercube,       "Number of cells per direction on coarse grid.", dealii::Patterns::Integer(1,5));
-      prm.add_parameter("ExploitSymmetry", exploit_symmetry,                  "Exploit symmetry and reduce DoFs by a factor of 8?");
-      prm.add_parameter("MovingMesh",      ALE,                               "Moving mesh?");
-      prm.add_parameter("Inviscid",        inviscid,                          "Is this an inviscid simulation?");
-      prm.add_parameter("ReynoldsNumber",  Re,                                "Reynolds number (ignored if Inviscid = true)");
-      prm.add_parameter("WriteRestart",    write_restart,                     "Should restart files be written?");
-      prm.add_parameter("ReadRestart",     read_restart,                      "Is this a restarted simulation?");
+      prm.add_parameter("MeshType",               mesh_type_string,            "Type of mesh (Cartesian versus curvilinear).", dealii::Patterns::Selection("Cartesian|Curvilinear"));
+      prm.add_parameter("NCoarseCells1D",         n_subdivisions_1d_hypercube, "Number of cells per direction on coarse grid.", dealii::Patterns::Integer(1,5));
+      prm.add_parameter("ExploitSymmetry",        exploit_symmetry,            "Exploit symmetry and reduce DoFs by a factor of 8?");
+      prm.add_parameter("MovingMesh",             ALE,                         "Moving mesh?");
+      prm.add_parameter("Inviscid",               inviscid,                    "Is this an inviscid simulation?");
+      prm.add_parameter("ReynoldsNumber",         Re,                          "Reynolds number (ignored if Inviscid = true)");
+      prm.add_parameter("WriteRestart",           write_restart,               "Should restart files be written?");
+      prm.add_parameter("ReadRestart",            read_restart,                "Is this a restarted simulation?");
+      prm.add_parameter("BuildPatchesMatrixFree", build_patches_matrix_free,   "Build the patches of the output with MatrixFree instead of DataOut?");
     prm.leave_subsection();
     // clang-format on
   }
@@ -455,6 +456,10 @@ private:
     pp_data.output_data.write_higher_order        = false;
     pp_data.output_data.degree                    = this->param.degree_u;
 
+    // the wall time of building the patches allows to compare MatrixFree and DataOut
+    pp_data.output_data.build_patches_matrix_free     = build_patches_matrix_free;
+    pp_data.output_data.print_wall_time_build_patches = true;
+
     // calculate div and mass error
     pp_data.mass_data.time_control_data.is_active                = false;
     pp_data.mass_data.time_control_data.start_time               = 0.0;
@@ -519,6 +524,9 @@ private:
   bool write_restart = false;
   bool read_restart  = false;
 
+  // output
+  bool build_patches_matrix_free = false;
+
   double const V_0                 = 1.0;
   double const L                   = 1.0;
   double const p_0                 = 0.0;
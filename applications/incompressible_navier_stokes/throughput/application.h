@@ -61,7 +61,9 @@ public:
 
     // clang-format off
     prm.enter_subsection("Application");
-      prm.add_parameter("MeshType",  mesh_type_string, "Type of mesh (Cartesian versus curvilinear).", dealii::Patterns::Selection("Cartesian|Curvilinear"));
+      prm.add_parameter("MeshType",           mesh_type_string,            "Type of mesh (Cartesian versus curvilinear).", dealii::Patterns::Selection("Cartesian|Curvilinear"));
+      prm.add_parameter("UseTurbulenceModel", use_turbulence_model,        "Use an eddy-viscosity turbulence model.");
+      prm.add_parameter("TurbulenceOnTheFly", turbulence_model_on_the_fly, "Compute the turbulent viscosity on the fly.");
     prm.leave_subsection();
     // clang-format on
   }
@@ -125,8 +127,9 @@ private:
     this->param.apply_penalty_terms_in_postprocessing_step = true;
 
     // TURBULENCE
-    this->param.use_turbulence_model = false;
-    this->param.turbulence_model     = TurbulenceEddyViscosityModel::Sigma;
+    this->param.use_turbulence_model        = use_turbulence_model;
+    this->param.turbulence_model_on_the_fly = turbulence_model_on_the_fly;
+    this->param.turbulence_model            = TurbulenceEddyViscosityModel::Sigma;
     // Smagorinsky: 0.165
     // Vreman: 0.28
     // WALE: 0.50
@@ -233,6 +236,10 @@ private:
 
   std::string mesh_type_string = "Cartesian";
   MeshType    mesh_type        = MeshType::Cartesian;
+
+  // turbulence model
+  bool use_turbulence_model        = false;
+  bool turbulence_model_on_the_fly = false;
 };
 
 } // namespace IncNS
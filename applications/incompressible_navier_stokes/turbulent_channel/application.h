@@ -251,6 +251,20 @@ public:
   {
   }
 
+  void
+  add_parameters(dealii::ParameterHandler & prm) final
+  {
+    ApplicationBase<dim, Number>::add_parameters(prm);
+
+    // clang-format off
+    prm.enter_subsection("Application");
+      prm.add_parameter("UseTurbulenceModel",     use_turbulence_model,        "Use an eddy-viscosity turbulence model.");
+      prm.add_parameter("TurbulenceOnTheFly",     turbulence_model_on_the_fly, "Compute the turbulent viscosity on the fly.");
+      prm.add_parameter("BuildPatchesMatrixFree", build_patches_matrix_free,   "Build the patches of the output with MatrixFree instead of DataOut?");
+    prm.leave_subsection();
+    // clang-format on
+  }
+
 private:
   void
   set_parameters() final
@@ -313,8 +327,9 @@ private:
 
 
     // TURBULENCE
-    this->param.use_turbulence_model = false;
-    this->param.turbulence_model     = TurbulenceEddyViscosityModel::Sigma;
+    this->param.use_turbulence_model        = use_turbulence_model;
+    this->param.turbulence_model_on_the_fly = turbulence_model_on_the_fly;
+    this->param.turbulence_model            = TurbulenceEddyViscosityModel::Sigma;
     // Smagorinsky: 0.165
     // Vreman: 0.28
     // WALE: 0.50
@@ -477,6 +492,10 @@ private:
     pp_data.output_data.degree             = this->param.degree_u;
     pp_data.output_data.write_higher_order = false;
 
+    // the wall time of building the patches allows to compare MatrixFree and DataOut
+    pp_data.output_data.build_patches_matrix_free     = build_patches_matrix_free;
+    pp_data.output_data.print_wall_time_build_patches = true;
+
     // calculate div and mass error
     pp_data.mass_data.time_control_data.is_active                = false; // true;
     pp_data.mass_data.time_control_data.start_time               = START_TIME;
@@ -516,6 +535,13 @@ private:
 
   double const ABS_TOL_LINEAR = 1.e-12;
   double const REL_TOL_LINEAR = 1.e-2;
+
+  // turbulence model
+  bool use_turbulence_model        = false;
+  bool turbulence_model_on_the_fly = false;
+
+  // output
+  bool build_patches_matrix_free = false;
 };
 
 } // namespace IncNS
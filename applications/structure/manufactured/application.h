@@ -303,6 +303,20 @@ public:
   {
   }
 
+  void
+  add_parameters(dealii::ParameterHandler & prm)
+  {
+    ApplicationBase<dim, Number>::add_parameters(prm);
+
+    // clang-format off
+    prm.enter_subsection("Application");
+    prm.add_parameter("CacheLinearization",                cache_linearization,                  "Cache linearization state at quadrature points.");
+    prm.add_parameter("CacheLinearizationSinglePrecision", cache_linearization_single_precision, "Store cached linearization in single precision.");
+    prm.add_parameter("CacheLinearizationSymmetricStress", cache_linearization_symmetric_stress, "Store only symmetric part of cached stresses.");
+    prm.leave_subsection();
+    // clang-format on
+  }
+
 private:
   void
   set_parameters() final
@@ -331,6 +345,10 @@ private:
     this->param.preconditioner      = Preconditioner::Multigrid;
     this->param.multigrid_data.type = MultigridType::phMG;
 
+    this->param.cache_linearization                  = cache_linearization;
+    this->param.cache_linearization_single_precision = cache_linearization_single_precision;
+    this->param.cache_linearization_symmetric_stress = cache_linearization_symmetric_stress;
+
     this->param.update_preconditioner                  = true;
     this->param.update_preconditioner_every_time_steps = 1;
     this->param.update_preconditioner_every_newton_iterations =
@@ -435,6 +453,10 @@ private:
 
   double const density = 1.0;
 
+  bool cache_linearization                  = false;
+  bool cache_linearization_single_precision = false;
+  bool cache_linearization_symmetric_stress = false;
+
   bool const   unsteady         = true;
   double const max_displacement = 0.1 * length;
   double const start_time       = 0.0;
@@ -0,0 +1,243 @@
+/*  ______________________________________________________________________
+ *
+ *  ExaDG - High-Order Discontinuous Galerkin for the Exa-Scale
+ *
+ *  Copyright (C) 2021 by the ExaDG authors
+ *
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *  ______________________________________________________________________
+ */
+
+#ifndef APPLICATIONS_STRUCTURE_THROUGHPUT_APPLICATION_H_
+#define APPLICATIONS_STRUCTURE_THROUGHPUT_APPLICATION_H_
+
+#include <exadg/grid/deformed_cube_manifold.h>
+
+/*
+ * Throughput study of the elasticity operators. Depending on the operator type specified in the
+ * subsection "Throughput" of the input file, the linear elasticity operator (OperatorType =
+ * Linear) or the nonlinear residual and the linearized operator (OperatorType = Nonlinear |
+ * Linearized) with St. Venant-Kirchhoff material are measured.
+ */
+
+namespace ExaDG
+{
+namespace Structure
+{
+enum class MeshType
+{
+  Cartesian,
+  Curvilinear
+};
+
+void
+string_to_enum(MeshType & enum_type, std::string const & string_type)
+{
+  // clang-format off
+  if     (string_type == "Cartesian")   enum_type = MeshType::Cartesian;
+  else if(string_type == "Curvilinear") enum_type = MeshType::Curvilinear;
+  else AssertThrow(false, dealii::ExcMessage("Not implemented."));
+  // clang-format on
+}
+
+template<int dim, typename Number>
+class Application : public ApplicationBase<dim, Number>
+{
+public:
+  Application(std::string input_file, MPI_Comm const & comm)
+    : ApplicationBase<dim, Number>(input_file, comm)
+  {
+  }
+
+  void
+  add_parameters(dealii::ParameterHandler & prm)
+  {
+    ApplicationBase<dim, Number>::add_parameters(prm);
+
+    // clang-format off
+    prm.enter_subsection("Application");
+      prm.add_parameter("MeshType",                          mesh_type_string,                     "Type of mesh (Cartesian versus curvilinear).", dealii::Patterns::Selection("Cartesian|Curvilinear"));
+      prm.add_parameter("CacheLinearization",                cache_linearization,                  "Cache linearization state at quadrature points.");
+      prm.add_parameter("CacheLinearizationSinglePrecision", cache_linearization_single_precision, "Store cached linearization in single precision.");
+      prm.add_parameter("CacheLinearizationSymmetricStress", cache_linearization_symmetric_stress, "Store only symmetric part of cached stresses.");
+    prm.leave_subsection();
+    // clang-format on
+  }
+
+private:
+  void
+  parse_parameters() final
+  {
+    ApplicationBase<dim, Number>::parse_parameters();
+
+    string_to_enum(mesh_type, mesh_type_string);
+
+    // the operator type decides whether the linear or the nonlinear operator is set up
+    ThroughputParameters const throughput(this->parameter_file);
+    large_deformation = (throughput.operator_type != "Linear");
+  }
+
+  void
+  set_parameters() final
+  {
+    // MATHEMATICAL MODEL
+    this->param.problem_type         = ProblemType::Unsteady;
+    this->param.body_force           = false;
+    this->param.large_deformation    = large_deformation;
+    this->param.pull_back_body_force = false;
+    this->param.pull_back_traction   = false;
+
+    // PHYSICAL QUANTITIES
+    this->param.density = 1.0;
+
+    // TEMPORAL DISCRETIZATION
+    this->param.start_time     = 0.0;
+    this->param.end_time       = 1.0;
+    this->param.time_step_size = 1.0e-2;
+    this->param.gen_alpha_type = GenAlphaType::BossakAlpha;
+
+    // SPATIAL DISCRETIZATION
+    this->param.grid.triangulation_type = TriangulationType::Distributed;
+    this->param.grid.mapping_degree     = (mesh_type == MeshType::Curvilinear) ? 3 : 1;
+
+    // SOLVER
+    this->param.newton_solver_data = Newton::SolverData(1e4, 1.e-10, 1.e-10);
+    this->param.solver             = Solver::CG;
+    this->param.solver_data        = SolverData(1e4, 1.e-12, 1.e-6, 100);
+    this->param.preconditioner     = Preconditioner::None;
+
+    this->param.cache_linearization                  = cache_linearization;
+    this->param.cache_linearization_single_precision = cache_linearization_single_precision;
+    this->param.cache_linearization_symmetric_stress = cache_linearization_symmetric_stress;
+  }
+
+  void
+  create_grid() final
+  {
+    double const left = -1.0, right = 1.0;
+    double const deformation = 0.1;
+
+    dealii::GridGenerator::subdivided_hyper_cube(*this->grid->triangulation,
+                                                 this->n_subdivisions_1d_hypercube,
+                                                 left,
+                                                 right);
+
+    if(mesh_type == MeshType::Curvilinear)
+    {
+      unsigned int const               frequency = 2;
+      static DeformedCubeManifold<dim> manifold(left, right, deformation, frequency);
+      this->grid->triangulation->set_all_manifold_ids(1);
+      this->grid->triangulation->set_manifold(1, manifold);
+
+      std::vector<bool> vertex_touched(this->grid->triangulation->n_vertices(), false);
+
+      for(auto const & cell : this->grid->triangulation->cell_iterators())
+      {
+        for(unsigned int const v : cell->vertex_indices())
+        {
+          if(vertex_touched[cell->vertex_index(v)] == false)
+          {
+            dealii::Point<dim> & vertex           = cell->vertex(v);
+            vertex                                = manifold.push_forward(vertex);
+            vertex_touched[cell->vertex_index(v)] = true;
+          }
+        }
+      }
+    }
+
+    // clamped at x = left (boundary_id = 0), traction-free elsewhere (boundary_id = 1)
+    for(auto const & cell : this->grid->triangulation->cell_iterators())
+    {
+      for(unsigned int const f : cell->face_indices())
+      {
+        if(cell->face(f)->at_boundary())
+        {
+          if(std::fabs(cell->face(f)->center()(0) - left) < 1e-12)
+            cell->face(f)->set_boundary_id(0);
+          else
+            cell->face(f)->set_boundary_id(1);
+        }
+      }
+    }
+
+    this->grid->triangulation->refine_global(this->param.grid.n_refine_global);
+  }
+
+  void
+  set_boundary_descriptor() final
+  {
+    typedef typename std::pair<dealii::types::boundary_id, std::shared_ptr<dealii::Function<dim>>>
+                                                                                  pair;
+    typedef typename std::pair<dealii::types::boundary_id, dealii::ComponentMask> pair_mask;
+
+    this->boundary_descriptor->dirichlet_bc.insert(
+      pair(0, new dealii::Functions::ZeroFunction<dim>(dim)));
+    this->boundary_descriptor->dirichlet_bc_component_mask.insert(
+      pair_mask(0, dealii::ComponentMask()));
+
+    this->boundary_descriptor->neumann_bc.insert(
+      pair(1, new dealii::Functions::ZeroFunction<dim>(dim)));
+  }
+
+  void
+  set_material_descriptor() final
+  {
+    typedef std::pair<dealii::types::material_id, std::shared_ptr<MaterialData>> Pair;
+
+    MaterialType const type         = MaterialType::StVenantKirchhoff;
+    double const       E            = 200.0e9;
+    double const       nu           = 0.3;
+    Type2D const       two_dim_type = Type2D::PlaneStrain;
+
+    this->material_descriptor->insert(
+      Pair(0, new StVenantKirchhoffData<dim>(type, E, nu, two_dim_type)));
+  }
+
+  void
+  set_field_functions() final
+  {
+    this->field_functions->right_hand_side.reset(new dealii::Functions::ZeroFunction<dim>(dim));
+    this->field_functions->initial_displacement.reset(
+      new dealii::Functions::ZeroFunction<dim>(dim));
+    this->field_functions->initial_velocity.reset(new dealii::Functions::ZeroFunction<dim>(dim));
+  }
+
+  std::shared_ptr<PostProcessor<dim, Number>>
+  create_postprocessor() final
+  {
+    PostProcessorData<dim> pp_data;
+
+    std::shared_ptr<PostProcessor<dim, Number>> post(
+      new PostProcessor<dim, Number>(pp_data, this->mpi_comm));
+
+    return post;
+  }
+
+  std::string mesh_type_string = "Cartesian";
+  MeshType    mesh_type        = MeshType::Cartesian;
+
+  bool large_deformation = true;
+
+  bool cache_linearization                  = false;
+  bool cache_linearization_single_precision = false;
+  bool cache_linearization_symmetric_stress = false;
+};
+
+} // namespace Structure
+
+} // namespace ExaDG
+
+#include <exadg/structure/user_interface/implement_get_application.h>
+
+#endif /* APPLICATIONS_STRUCTURE_THROUGHPUT_APPLICATION_H_ */
@@ -155,7 +155,7 @@ Driver<dim, Number>::apply_operator(std::string const & operator_type_string,
   string_to_enum(operator_type, operator_type_string);
 
   // Vectors
-  VectorType dst, src;
+  VectorType dst, src, solution;
 
   // initialize vectors
   pde_operator->initialize_dof_vector(src);
@@ -163,6 +163,17 @@ Driver<dim, Number>::apply_operator(std::string const & operator_type_string,
   src = 1.0;
   dst = 1.0;
 
+  if(operator_type == OperatorType::RungeKuttaStage ||
+     operator_type == OperatorType::RungeKuttaStageFused)
+  {
+    pde_operator->initialize_dof_vector(solution);
+    solution = 1.0;
+  }
+
+  // Stage of a low-storage Runge-Kutta method with two registers. The factors of the vector
+  // updates are zero so that the vectors do not change over the repetitions.
+  double const factor_ri = 0.0, factor_solution = 0.0;
+
   const std::function<void(void)> operator_evaluation = [&](void) {
     if(operator_type == OperatorType::ConvectiveTerm)
       pde_operator->evaluate_convective(dst, src, 0.0);
@@ -178,6 +189,16 @@ Driver<dim, Number>::apply_operator(std::string const & operator_type_string,
       dst.sadd(2.0, 1.0, src);
     else if(operator_type == OperatorType::EvaluateOperatorExplicit)
       pde_operator->evaluate(dst, src, 0.0);
+    else if(operator_type == OperatorType::RungeKuttaStage)
+    {
+      pde_operator->evaluate(dst, src, 0.0);
+      src.add(factor_ri, dst);
+      solution = src;
+      solution.add(factor_solution - factor_ri, dst);
+    }
+    else if(operator_type == OperatorType::RungeKuttaStageFused)
+      pde_operator->evaluate_and_update_stage(
+        solution, src, dst, 0.0, factor_ri, factor_solution, true);
     else
       AssertThrow(false, dealii::ExcMessage("Specified operator type not implemented"));
   };
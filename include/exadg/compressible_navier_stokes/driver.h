@@ -47,7 +47,9 @@ enum class OperatorType
   InverseMassOperator,
   InverseMassOperatorDstDst,
   VectorUpdate,
-  EvaluateOperatorExplicit
+  EvaluateOperatorExplicit,
+  RungeKuttaStage,
+  RungeKuttaStageFused
 };
 
 inline std::string
@@ -65,6 +67,8 @@ enum_to_string(OperatorType const enum_type)
     case OperatorType::InverseMassOperatorDstDst: string_type = "InverseMassOperatorDstDst";break;
     case OperatorType::VectorUpdate:              string_type = "VectorUpdate";             break;
     case OperatorType::EvaluateOperatorExplicit:  string_type = "EvaluateOperatorExplicit"; break;
+    case OperatorType::RungeKuttaStage:           string_type = "RungeKuttaStage";          break;
+    case OperatorType::RungeKuttaStageFused:      string_type = "RungeKuttaStageFused";     break;
 
     default:AssertThrow(false, dealii::ExcMessage("Not implemented.")); break;
       // clang-format on
@@ -84,6 +88,8 @@ string_to_enum(OperatorType & enum_type, std::string const string_type)
   else if(string_type == "InverseMassOperatorDstDst") enum_type = OperatorType::InverseMassOperatorDstDst;
   else if(string_type == "VectorUpdate")              enum_type = OperatorType::VectorUpdate;
   else if(string_type == "EvaluateOperatorExplicit")  enum_type = OperatorType::EvaluateOperatorExplicit;
+  else if(string_type == "RungeKuttaStage")           enum_type = OperatorType::RungeKuttaStage;
+  else if(string_type == "RungeKuttaStageFused")      enum_type = OperatorType::RungeKuttaStageFused;
   else AssertThrow(false, dealii::ExcMessage("Unknown operator type. Not implemented."));
   // clang-format on
 }
@@ -40,10 +40,9 @@ write_output(
   VectorType const &                                                    solution_conserved,
   std::vector<dealii::SmartPointer<SolutionField<dim, Number>>> const & additional_fields,
   unsigned int const                                                    output_counter,
+  double const                                                          time,
   MPI_Comm const &                                                      mpi_comm)
 {
-  std::string folder = output_data.directory, file = output_data.filename;
-
   dealii::DataOutBase::VtkFlags flags;
   flags.write_higher_order_cells = output_data.write_higher_order;
 
@@ -97,7 +96,7 @@ write_output(
 
   data_out.build_patches(mapping, output_data.degree, dealii::DataOut<dim>::curved_inner_cells);
 
-  data_out.write_vtu_with_pvtu_record(folder, file, output_counter, mpi_comm, 4);
+  write_patches(data_out, output_data, output_counter, time, mpi_comm);
 }
 
 template<int dim, typename Number>
@@ -141,6 +140,7 @@ OutputGenerator<dim, Number>::setup(dealii::DoFHandler<dim> const & dof_handler_
                          output_data.directory,
                          output_data.filename,
                          time_control.get_counter(),
+                         time,
                          mpi_comm);
     }
 
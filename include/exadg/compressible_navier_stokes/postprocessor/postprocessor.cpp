@@ -38,7 +38,8 @@ PostProcessor<dim, Number>::PostProcessor(PostProcessorData<dim> const & postpro
     lift_and_drag_calculator(comm),
     pressure_difference_calculator(comm),
     kinetic_energy_calculator(comm),
-    kinetic_energy_spectrum_calculator(comm)
+    kinetic_energy_spectrum_calculator(comm),
+    scalar_reductions(comm)
 {
 }
 
@@ -96,6 +97,29 @@ PostProcessor<dim, Number>::do_postprocessing(VectorType const &     solution,
 {
   invalidate_derived_fields();
 
+  /*
+   *  calculation of lift and drag coefficients
+   */
+  if(lift_and_drag_calculator.time_control.needs_evaluation(time, time_step_number))
+    lift_and_drag_calculator.evaluate(velocity.evaluate_get(solution),
+                                      pressure.evaluate_get(solution),
+                                      time,
+                                      scalar_reductions);
+
+  /*
+   *  calculation of kinetic energy
+   */
+  if(kinetic_energy_calculator.time_control.needs_evaluation(time, time_step_number))
+  {
+    kinetic_energy_calculator.evaluate(velocity.evaluate_get(solution),
+                                       time,
+                                       Utilities::is_unsteady_timestep(time_step_number),
+                                       scalar_reductions);
+  }
+
+  // the global reductions of the above quantities overlap with the remaining postprocessing
+  scalar_reductions.start();
+
   /*
    *  write output
    */
@@ -113,6 +137,17 @@ PostProcessor<dim, Number>::do_postprocessing(VectorType const &     solution,
       velocity.evaluate(solution);
       additional_fields_vtu.push_back(&velocity);
     }
+    // compute vorticity and divergence in a single pass over the velocity
+    if(pp_data.output_data.write_vorticity || pp_data.output_data.write_divergence)
+    {
+      std::vector<std::pair<DerivedQuantity, VectorType *>> dst;
+      if(pp_data.output_data.write_vorticity)
+        dst.emplace_back(DerivedQuantity::Vorticity, &vorticity.get_for_evaluation());
+      if(pp_data.output_data.write_divergence)
+        dst.emplace_back(DerivedQuantity::Divergence, &divergence.get_for_evaluation());
+
+      navier_stokes_operator->compute_derived_quantities(dst, velocity.evaluate_get(solution));
+    }
     if(pp_data.output_data.write_vorticity)
     {
       vorticity.evaluate(velocity.evaluate_get(solution));
@@ -150,30 +185,12 @@ PostProcessor<dim, Number>::do_postprocessing(VectorType const &     solution,
   if(error_calculator.time_control.needs_evaluation(time, time_step_number))
     error_calculator.evaluate(solution, time, Utilities::is_unsteady_timestep(time_step_number));
 
-  /*
-   *  calculation of lift and drag coefficients
-   */
-  if(lift_and_drag_calculator.time_control.needs_evaluation(time, time_step_number))
-    lift_and_drag_calculator.evaluate(velocity.evaluate_get(solution),
-                                      pressure.evaluate_get(solution),
-                                      time);
-
   /*
    *  calculation of pressure difference
    */
   if(pressure_difference_calculator.time_control.needs_evaluation(time, time_step_number))
     pressure_difference_calculator.evaluate(pressure.evaluate_get(solution), time);
 
-  /*
-   *  calculation of kinetic energy
-   */
-  if(kinetic_energy_calculator.time_control.needs_evaluation(time, time_step_number))
-  {
-    kinetic_energy_calculator.evaluate(velocity.evaluate_get(solution),
-                                       time,
-                                       Utilities::is_unsteady_timestep(time_step_number));
-  }
-
   /*
    *  calculation of kinetic energy spectrum
    */
@@ -183,6 +200,9 @@ PostProcessor<dim, Number>::do_postprocessing(VectorType const &     solution,
                                                 time,
                                                 Utilities::is_unsteady_timestep(time_step_number));
   }
+
+  // write the results of lift and drag, and kinetic energy
+  scalar_reductions.finish();
 }
 
 template<int dim, typename Number>
@@ -30,6 +30,7 @@
 #include <exadg/postprocessor/kinetic_energy_spectrum.h>
 #include <exadg/postprocessor/lift_and_drag_calculation.h>
 #include <exadg/postprocessor/pressure_difference_calculation.h>
+#include <exadg/utilities/batched_reduction.h>
 
 namespace ExaDG
 {
@@ -92,6 +93,9 @@ private:
   PressureDifferenceCalculator<dim, Number>    pressure_difference_calculator;
   KineticEnergyCalculator<dim, Number>         kinetic_energy_calculator;
   KineticEnergySpectrumCalculator<dim, Number> kinetic_energy_spectrum_calculator;
+
+  // global reductions of the scalar quantities computed in one call to do_postprocessing()
+  BatchedReduction scalar_reductions;
 };
 
 } // namespace CompNS
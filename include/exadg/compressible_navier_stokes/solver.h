@@ -25,6 +25,10 @@
 // driver
 #include <exadg/compressible_navier_stokes/driver.h>
 
+// postprocessor
+#include <exadg/postprocessor/in_transit_analysis.h>
+#include <exadg/postprocessor/kinetic_energy_spectrum.h>
+
 // utilities
 #include <exadg/utilities/general_parameters.h>
 #include <exadg/utilities/resolution_parameters.h>
@@ -122,10 +126,27 @@ main(int argc, char ** argv)
     }
   }
 
-  ExaDG::GeneralParameters            general(input_file);
+  ExaDG::GeneralParameters            general(input_file, true /* supports_in_transit_analysis */);
   ExaDG::SpatialResolutionParameters  spatial(input_file);
   ExaDG::TemporalResolutionParameters temporal(input_file);
 
+  // in-transit analysis: the analysis ranks do not take part in the simulation but process the
+  // data sent by the solver ranks. The communicator of the solver ranks is owned by
+  // InTransitAnalysis and freed in InTransitAnalysis::finalize().
+  MPI_Comm solver_comm = mpi_comm;
+  if(general.n_analysis_ranks > 0)
+  {
+    solver_comm = ExaDG::InTransitAnalysis::setup(mpi_comm, general.n_analysis_ranks);
+
+    if(ExaDG::InTransitAnalysis::is_analysis_rank())
+    {
+      ExaDG::run_kinetic_energy_spectrum_analysis(solver_comm);
+      ExaDG::InTransitAnalysis::finalize();
+
+      return 0;
+    }
+  }
+
   // k-refinement
   for(unsigned int degree = spatial.degree_min; degree <= spatial.degree_max; ++degree)
   {
@@ -142,16 +163,16 @@ main(int argc, char ** argv)
         // run the simulation
         if(general.dim == 2 && general.precision == "float")
           ExaDG::run<2, float>(
-            input_file, degree, refine_space, refine_time, mpi_comm, general.is_test);
+            input_file, degree, refine_space, refine_time, solver_comm, general.is_test);
         else if(general.dim == 2 && general.precision == "double")
           ExaDG::run<2, double>(
-            input_file, degree, refine_space, refine_time, mpi_comm, general.is_test);
+            input_file, degree, refine_space, refine_time, solver_comm, general.is_test);
         else if(general.dim == 3 && general.precision == "float")
           ExaDG::run<3, float>(
-            input_file, degree, refine_space, refine_time, mpi_comm, general.is_test);
+            input_file, degree, refine_space, refine_time, solver_comm, general.is_test);
         else if(general.dim == 3 && general.precision == "double")
           ExaDG::run<3, double>(
-            input_file, degree, refine_space, refine_time, mpi_comm, general.is_test);
+            input_file, degree, refine_space, refine_time, solver_comm, general.is_test);
         else
           AssertThrow(false,
                       dealii::ExcMessage("Only dim = 2|3 and precision=float|double implemented."));
@@ -159,6 +180,8 @@ main(int argc, char ** argv)
     }
   }
 
+  ExaDG::InTransitAnalysis::finalize();
+
   return 0;
 }
 
@@ -64,6 +64,17 @@ public:
   virtual void
   evaluate(VectorType & dst, VectorType const & src, Number const evaluation_time) const = 0;
 
+  // explicit time integration: evaluate operator, apply inverse mass operator, and perform the
+  // vector updates of a stage of a low-storage Runge-Kutta method with two registers
+  virtual void
+  evaluate_and_update_stage(VectorType & solution,
+                            VectorType & vec_ri,
+                            VectorType & vec_ki,
+                            Number const evaluation_time,
+                            double const factor_ri,
+                            double const factor_solution,
+                            bool const   update_ri) const = 0;
+
   // analysis of computational costs
   virtual double
   get_wall_time_operator_evaluation() const = 0;
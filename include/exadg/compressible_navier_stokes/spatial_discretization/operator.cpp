@@ -206,6 +206,39 @@ Operator<dim, Number>::evaluate(VectorType & dst, VectorType const & src, Number
   wall_time_operator_evaluation += timer.wall_time();
 }
 
+template<int dim, typename Number>
+void
+Operator<dim, Number>::evaluate_and_update_stage(VectorType & solution,
+                                                 VectorType & vec_ri,
+                                                 VectorType & vec_ki,
+                                                 Number const time,
+                                                 double const factor_ri,
+                                                 double const factor_solution,
+                                                 bool const   update_ri) const
+{
+  dealii::Timer timer;
+  timer.restart();
+
+  evaluate_convective_and_viscous(vec_ki, vec_ri, time);
+
+  // Shift viscous and convective terms to the right-hand side of the equation. Without body
+  // force, the sign is absorbed into the factors of the vector updates to avoid a separate pass
+  // through the vector.
+  double sign = -1.0;
+
+  if(param.right_hand_side == true)
+  {
+    vec_ki *= -1.0;
+    body_force_operator.evaluate_add(vec_ki, vec_ri, time);
+    sign = 1.0;
+  }
+
+  inverse_mass_all.apply_and_update_stage(
+    solution, vec_ri, vec_ki, sign * factor_ri, sign * factor_solution, update_ri);
+
+  wall_time_operator_evaluation += timer.wall_time();
+}
+
 template<int dim, typename Number>
 void
 Operator<dim, Number>::evaluate_convective(VectorType &       dst,
@@ -401,6 +434,15 @@ Operator<dim, Number>::compute_divergence(VectorType & dst, VectorType const & s
   inverse_mass_scalar.apply(dst, dst);
 }
 
+template<int dim, typename Number>
+void
+Operator<dim, Number>::compute_derived_quantities(
+  std::vector<std::pair<DerivedQuantity, VectorType *>> const & dst,
+  VectorType const &                                            src) const
+{
+  derived_quantities_calculator.compute(dst, src);
+}
+
 template<int dim, typename Number>
 double
 Operator<dim, Number>::get_wall_time_operator_evaluation() const
@@ -545,6 +587,11 @@ Operator<dim, Number>::setup_operators()
                                    get_dof_index_vector(),
                                    get_dof_index_scalar(),
                                    get_quad_index_standard());
+
+  derived_quantities_calculator.initialize(*matrix_free,
+                                           get_dof_index_vector(),
+                                           get_dof_index_scalar(),
+                                           get_quad_index_standard());
 }
 
 template class Operator<2, float>;
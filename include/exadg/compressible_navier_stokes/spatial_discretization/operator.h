@@ -37,6 +37,7 @@
 #include <exadg/grid/grid.h>
 #include <exadg/matrix_free/matrix_free_data.h>
 #include <exadg/operators/inverse_mass_operator.h>
+#include <exadg/postprocessor/derived_quantities_calculator.h>
 
 namespace ExaDG
 {
@@ -90,6 +91,22 @@ public:
   void
   evaluate(VectorType & dst, VectorType const & src, Number const time) const;
 
+  /*
+   *  Fused variant of evaluate() for a stage of a low-storage Runge-Kutta method with two
+   *  registers: vec_ki = M^{-1} (rhs - L(vec_ri)), followed by the vector updates
+   *  vec_ri = solution + factor_ri * vec_ki (only if update_ri == true) and
+   *  solution += factor_solution * vec_ki. The inverse mass operator and the vector updates are
+   *  performed in a single cell loop, see InverseMassOperator::apply_and_update_stage().
+   */
+  void
+  evaluate_and_update_stage(VectorType & solution,
+                            VectorType & vec_ri,
+                            VectorType & vec_ki,
+                            Number const time,
+                            double const factor_ri,
+                            double const factor_solution,
+                            bool const   update_ri) const;
+
   void
   evaluate_convective(VectorType & dst, VectorType const & src, Number const time) const;
 
@@ -152,6 +169,11 @@ public:
   void
   compute_divergence(VectorType & dst, VectorType const & src) const;
 
+  // several derived quantities of the velocity computed in a single pass
+  void
+  compute_derived_quantities(std::vector<std::pair<DerivedQuantity, VectorType *>> const & dst,
+                             VectorType const & src) const;
+
   double
   get_wall_time_operator_evaluation() const;
 
@@ -265,6 +287,8 @@ private:
   VorticityCalculator<dim, Number>  vorticity_calculator;
   DivergenceCalculator<dim, Number> divergence_calculator;
 
+  DerivedQuantitiesCalculator<dim, Number> derived_quantities_calculator;
+
   /*
    * MPI
    */
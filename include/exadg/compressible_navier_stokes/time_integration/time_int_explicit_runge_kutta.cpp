@@ -43,7 +43,8 @@ TimeIntExplRK<Number>::TimeIntExplRK(
                               param_in.restart_data,
                               false, // currently no adaptive time stepping implemented
                               mpi_comm_in,
-                              is_test_in),
+                              is_test_in,
+                              param_in.error_controller_data),
     pde_operator(operator_in),
     param(param_in),
     refine_steps_time(param_in.n_refine_time),
@@ -66,13 +67,13 @@ TimeIntExplRK<Number>::initialize_time_integrator()
   }
   else if(this->param.temporal_discretization == TemporalDiscretization::ExplRK3Stage4Reg2C)
   {
-    rk_time_integrator =
-      std::make_shared<LowStorageRK3Stage4Reg2C<Operator, VectorType>>(pde_operator);
+    rk_time_integrator = std::make_shared<LowStorageRK3Stage4Reg2C<Operator, VectorType>>(
+      pde_operator, param.use_fused_runge_kutta_stages);
   }
   else if(this->param.temporal_discretization == TemporalDiscretization::ExplRK4Stage5Reg2C)
   {
-    rk_time_integrator =
-      std::make_shared<LowStorageRK4Stage5Reg2C<Operator, VectorType>>(pde_operator);
+    rk_time_integrator = std::make_shared<LowStorageRK4Stage5Reg2C<Operator, VectorType>>(
+      pde_operator, param.use_fused_runge_kutta_stages);
   }
   else if(this->param.temporal_discretization == TemporalDiscretization::ExplRK4Stage5Reg3C)
   {
@@ -81,8 +82,8 @@ TimeIntExplRK<Number>::initialize_time_integrator()
   }
   else if(this->param.temporal_discretization == TemporalDiscretization::ExplRK5Stage9Reg2S)
   {
-    rk_time_integrator =
-      std::make_shared<LowStorageRK5Stage9Reg2S<Operator, VectorType>>(pde_operator);
+    rk_time_integrator = std::make_shared<LowStorageRK5Stage9Reg2S<Operator, VectorType>>(
+      pde_operator, param.use_fused_runge_kutta_stages);
   }
   else if(this->param.temporal_discretization == TemporalDiscretization::ExplRK3Stage7Reg2)
   {
@@ -98,6 +99,8 @@ TimeIntExplRK<Number>::initialize_time_integrator()
                                                                        param.order_time_integrator,
                                                                        param.stages);
   }
+
+  this->initialize_error_controller(rk_time_integrator->get_order_embedded());
 }
 
 /*
@@ -241,10 +244,7 @@ TimeIntExplRK<Number>::do_timestep_solve()
   dealii::Timer timer;
   timer.restart();
 
-  rk_time_integrator->solve_timestep(this->solution_np,
-                                     this->solution_n,
-                                     this->time,
-                                     this->time_step);
+  this->solve_timestep(*rk_time_integrator);
 
   if(print_solver_info() and not(this->is_test))
   {
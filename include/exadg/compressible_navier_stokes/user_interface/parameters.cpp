@@ -49,6 +49,8 @@ Parameters::Parameters()
     temporal_discretization(TemporalDiscretization::Undefined),
     order_time_integrator(1),
     stages(1),
+    use_fused_runge_kutta_stages(false),
+    error_controller_data(ErrorControllerData()),
     calculation_of_time_step_size(TimeStepCalculation::Undefined),
     time_step_size(-1.),
     max_number_of_time_steps(std::numeric_limits<unsigned int>::max()),
@@ -113,6 +115,24 @@ Parameters::check() const
     AssertThrow(stages >= 1, dealii::ExcMessage("Specify number of RK stages!"));
   }
 
+  if(use_fused_runge_kutta_stages)
+  {
+    AssertThrow(low_storage_runge_kutta_with_two_registers(),
+                dealii::ExcMessage("Fused Runge-Kutta stages are only implemented for low-storage "
+                                   "Runge-Kutta methods with two registers of type 2R+."));
+  }
+
+  if(error_controller_data.active)
+  {
+    AssertThrow(temporal_discretization == TemporalDiscretization::ExplRK3Stage4Reg2C ||
+                  temporal_discretization == TemporalDiscretization::ExplRK4Stage5Reg2C,
+                dealii::ExcMessage("Error-controlled time stepping is only implemented for the "
+                                   "embedded methods ExplRK3Stage4Reg2C and ExplRK4Stage5Reg2C."));
+    AssertThrow(not use_fused_runge_kutta_stages,
+                dealii::ExcMessage("Error-controlled time stepping is not implemented for fused "
+                                   "Runge-Kutta stages."));
+  }
+
   if(calculation_of_time_step_size == TimeStepCalculation::CFLAndDiffusion)
   {
     AssertThrow(max_velocity >= 0.0, dealii::ExcMessage("Invalid parameter max_velocity."));
@@ -187,6 +207,14 @@ Parameters::print_parameters_physical_quantities(dealii::ConditionalOStream cons
   print_parameter(pcout, "Specific gas constant", specific_gas_constant);
 }
 
+bool
+Parameters::low_storage_runge_kutta_with_two_registers() const
+{
+  return (temporal_discretization == TemporalDiscretization::ExplRK3Stage4Reg2C ||
+          temporal_discretization == TemporalDiscretization::ExplRK4Stage5Reg2C ||
+          temporal_discretization == TemporalDiscretization::ExplRK5Stage9Reg2S);
+}
+
 void
 Parameters::print_parameters_temporal_discretization(dealii::ConditionalOStream const & pcout) const
 {
@@ -205,6 +233,14 @@ Parameters::print_parameters_temporal_discretization(dealii::ConditionalOStream
     print_parameter(pcout, "Number of stages", stages);
   }
 
+  if(low_storage_runge_kutta_with_two_registers())
+  {
+    print_parameter(pcout, "Use fused Runge-Kutta stages", use_fused_runge_kutta_stages);
+  }
+
+  if(error_controller_data.active)
+    error_controller_data.print(pcout);
+
   print_parameter(pcout,
                   "Calculation of time step size",
                   enum_to_string(calculation_of_time_step_size));
@@ -24,6 +24,7 @@
 #include <exadg/compressible_navier_stokes/user_interface/enum_types.h>
 #include <exadg/grid/enum_types.h>
 #include <exadg/grid/grid_data.h>
+#include <exadg/time_integration/error_controller.h>
 #include <exadg/time_integration/restart_data.h>
 #include <exadg/time_integration/solver_info_data.h>
 #include <exadg/utilities/print_functions.h>
@@ -54,6 +55,9 @@ private:
   void
   print_parameters_temporal_discretization(dealii::ConditionalOStream const & pcout) const;
 
+  bool
+  low_storage_runge_kutta_with_two_registers() const;
+
   void
   print_parameters_spatial_discretization(dealii::ConditionalOStream const & pcout) const;
 
@@ -122,6 +126,13 @@ public:
   // number of Runge-Kutta stages
   unsigned int stages;
 
+  // fuse the inverse mass operator and the vector updates of the Runge-Kutta stages into a single
+  // loop (only relevant for low-storage Runge-Kutta methods with two registers of type 2R+)
+  bool use_fused_runge_kutta_stages;
+
+  // error-controlled time stepping based on the embedded method of a low-storage Runge-Kutta method
+  ErrorControllerData error_controller_data;
+
   // calculation of time step size
   TimeStepCalculation calculation_of_time_step_size;
 
@@ -28,6 +28,7 @@
 #include <exadg/convection_diffusion/driver.h>
 #include <exadg/convection_diffusion/time_integration/create_time_integrator.h>
 #include <exadg/grid/get_dynamic_mapping.h>
+#include <exadg/postprocessor/asynchronous_file_writer.h>
 #include <exadg/utilities/print_solver_results.h>
 #include <exadg/utilities/throughput_parameters.h>
 
@@ -60,6 +61,18 @@ Driver<dim, Number>::setup()
 
   application->setup();
 
+  // balance the work of the multirate time integration, i.e. the number of time steps per cell
+  Parameters const & param = application->get_parameters();
+  if(param.temporal_discretization == TemporalDiscretization::ExplRK and
+     param.time_integrator_rk == TimeIntegratorRK::ExplRKMultirate)
+  {
+    balance_time_step_levels<dim>(
+      *application->get_grid()->triangulation,
+      [&](double const h) { return calculate_time_step_of_element_length(param, h); },
+      param.max_time_step_levels,
+      mpi_comm);
+  }
+
   if(application->get_parameters().ale_formulation) // moving mesh
   {
     std::shared_ptr<dealii::Function<dim>> mesh_motion =
@@ -222,6 +235,9 @@ Driver<dim, Number>::solve()
   {
     AssertThrow(false, dealii::ExcMessage("Not implemented"));
   }
+
+  // make sure that all output files have been written
+  AsynchronousFileWriter::get_instance().flush();
 }
 
 template<int dim, typename Number>
@@ -246,6 +262,14 @@ Driver<dim, Number>::print_performance_results(double const total_time) const
     time_integrator_bdf->print_iterations();
   }
 
+  // memory of Krylov solvers with subspace recycling
+  double const memory_linear_solver = dealii::Utilities::MPI::sum(
+    (double)pde_operator->get_memory_consumption_linear_solver(), mpi_comm);
+  if(memory_linear_solver > 0.0)
+    print_solver_memory_consumption(pcout,
+                                    memory_linear_solver,
+                                    pde_operator->get_number_of_dofs());
+
   // wall times
   timer_tree.insert({"Convection-diffusion"}, total_time);
 
@@ -316,12 +340,23 @@ Driver<dim, Number>::apply_operator(std::string const & operator_type_string,
   OperatorType operator_type;
   string_to_enum(operator_type, operator_type_string);
 
-  dealii::LinearAlgebra::distributed::Vector<Number> dst, src;
+  dealii::LinearAlgebra::distributed::Vector<Number> dst, src, solution;
 
   pde_operator->initialize_dof_vector(src);
   src = 1.0;
   pde_operator->initialize_dof_vector(dst);
 
+  if(operator_type == OperatorType::RungeKuttaStage ||
+     operator_type == OperatorType::RungeKuttaStageFused)
+  {
+    pde_operator->initialize_dof_vector(solution);
+    solution = 1.0;
+  }
+
+  // Stage of a low-storage Runge-Kutta method with two registers. The factors of the vector
+  // updates are zero so that the vectors do not change over the repetitions.
+  double const factor_ri = 0.0, factor_solution = 0.0;
+
   dealii::LinearAlgebra::distributed::Vector<Number> velocity;
   if(application->get_parameters().convective_problem())
   {
@@ -348,6 +383,16 @@ Driver<dim, Number>::apply_operator(std::string const & operator_type_string,
       pde_operator->apply_diffusive_term(dst, src);
     else if(operator_type == OperatorType::MassConvectionDiffusionOperator)
       pde_operator->apply_conv_diff_operator(dst, src);
+    else if(operator_type == OperatorType::RungeKuttaStage)
+    {
+      pde_operator->evaluate_explicit_time_int(dst, src, 1.0 /* time */, &velocity);
+      src.add(factor_ri, dst);
+      solution = src;
+      solution.add(factor_solution - factor_ri, dst);
+    }
+    else if(operator_type == OperatorType::RungeKuttaStageFused)
+      pde_operator->evaluate_explicit_time_int_and_update_stage(
+        solution, src, dst, 1.0 /* time */, factor_ri, factor_solution, true, &velocity);
   };
 
   // do the measurements
@@ -57,7 +57,9 @@ enum class OperatorType
   MassOperator,
   ConvectiveOperator,
   DiffusiveOperator,
-  MassConvectionDiffusionOperator
+  MassConvectionDiffusionOperator,
+  RungeKuttaStage,
+  RungeKuttaStageFused
 };
 
 inline std::string
@@ -72,6 +74,8 @@ enum_to_string(OperatorType const enum_type)
     case OperatorType::ConvectiveOperator:              string_type = "ConvectiveOperator";              break;
     case OperatorType::DiffusiveOperator:               string_type = "DiffusiveOperator";               break;
     case OperatorType::MassConvectionDiffusionOperator: string_type = "MassConvectionDiffusionOperator"; break;
+    case OperatorType::RungeKuttaStage:                 string_type = "RungeKuttaStage";                 break;
+    case OperatorType::RungeKuttaStageFused:            string_type = "RungeKuttaStageFused";            break;
     default: AssertThrow(false, dealii::ExcMessage("Not implemented.")); break;
       // clang-format on
   }
@@ -87,6 +91,8 @@ string_to_enum(OperatorType & enum_type, std::string const string_type)
   else if(string_type == "ConvectiveOperator")              enum_type = OperatorType::ConvectiveOperator;
   else if(string_type == "DiffusiveOperator")               enum_type = OperatorType::DiffusiveOperator;
   else if(string_type == "MassConvectionDiffusionOperator") enum_type = OperatorType::MassConvectionDiffusionOperator;
+  else if(string_type == "RungeKuttaStage")                 enum_type = OperatorType::RungeKuttaStage;
+  else if(string_type == "RungeKuttaStageFused")            enum_type = OperatorType::RungeKuttaStageFused;
   else AssertThrow(false, dealii::ExcMessage("Unknown operator type. Not implemented."));
   // clang-format on
 }
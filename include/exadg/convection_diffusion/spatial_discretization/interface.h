@@ -27,6 +27,8 @@
 
 // ExaDG
 #include <exadg/time_integration/interpolate.h>
+#include <exadg/time_integration/multirate_levels.h>
+#include <exadg/time_integration/operator_integration_factor.h>
 
 namespace ExaDG
 {
@@ -55,6 +57,25 @@ public:
                              double const       evaluation_time,
                              VectorType const * velocity = nullptr) const = 0;
 
+  // explicit time integration: evaluate operator, apply inverse mass operator, and perform the
+  // vector updates of a stage of a low-storage Runge-Kutta method with two registers
+  virtual void
+  evaluate_explicit_time_int_and_update_stage(VectorType &       solution,
+                                              VectorType &       vec_ri,
+                                              VectorType &       vec_ki,
+                                              double const       evaluation_time,
+                                              double const       factor_ri,
+                                              double const       factor_solution,
+                                              bool const         update_ri,
+                                              VectorType const * velocity = nullptr) const = 0;
+
+  // operator-integration-factor splitting: evaluate convective term and apply inverse mass operator
+  virtual void
+  evaluate_oif(VectorType &       dst,
+               VectorType const & src,
+               double const       evaluation_time,
+               VectorType const * velocity = nullptr) const = 0;
+
   // implicit time integration: calculate right-hand side of linear system of equations
   virtual void
   rhs(VectorType &       dst,
@@ -103,6 +124,10 @@ public:
   virtual double
   calculate_time_step_diffusion() const = 0;
 
+  // multirate time integration: time step levels of the cells
+  virtual MultirateLevels<Number> const &
+  get_multirate_levels() const = 0;
+
   // needed for ALE-type problems
   virtual void
   move_grid(double const & time) const = 0;
@@ -154,6 +179,35 @@ public:
     }
   }
 
+  void
+  evaluate_and_update_stage(VectorType & solution,
+                            VectorType & vec_ri,
+                            VectorType & vec_ki,
+                            double const evaluation_time,
+                            double const factor_ri,
+                            double const factor_solution,
+                            bool const   update_ri) const
+  {
+    if(numerical_velocity_field)
+    {
+      interpolate(velocity_interpolated, evaluation_time, velocities, times);
+
+      pde_operator->evaluate_explicit_time_int_and_update_stage(solution,
+                                                                vec_ri,
+                                                                vec_ki,
+                                                                evaluation_time,
+                                                                factor_ri,
+                                                                factor_solution,
+                                                                update_ri,
+                                                                &velocity_interpolated);
+    }
+    else
+    {
+      pde_operator->evaluate_explicit_time_int_and_update_stage(
+        solution, vec_ri, vec_ki, evaluation_time, factor_ri, factor_solution, update_ri);
+    }
+  }
+
   void
   initialize_dof_vector(VectorType & src) const
   {
@@ -175,6 +229,75 @@ private:
   VectorType mutable velocity_interpolated;
 };
 
+/*
+ * Operator of the pure convection problem solved by the sub-steps of the
+ * operator-integration-factor splitting.
+ */
+template<typename Number>
+class OperatorOIF
+{
+public:
+  typedef dealii::LinearAlgebra::distributed::Vector<Number> VectorType;
+
+  OperatorOIF(std::shared_ptr<ConvDiff::Interface::Operator<Number>> operator_in,
+              bool const                                             numerical_velocity_field_in)
+    : pde_operator(operator_in), numerical_velocity_field(numerical_velocity_field_in)
+  {
+    if(numerical_velocity_field)
+      pde_operator->initialize_dof_vector_velocity(velocity_interpolated);
+  }
+
+  void
+  set_velocities_and_times(std::vector<VectorType const *> const & velocities_in,
+                           std::vector<double> const &             times_in)
+  {
+    velocities = velocities_in;
+    times      = times_in;
+  }
+
+  void
+  evaluate(VectorType & dst, VectorType const & src, double const evaluation_time) const
+  {
+    if(numerical_velocity_field)
+    {
+      interpolate(velocity_interpolated, evaluation_time, velocities, times);
+
+      pde_operator->evaluate_oif(dst, src, evaluation_time, &velocity_interpolated);
+    }
+    else
+    {
+      pde_operator->evaluate_oif(dst, src, evaluation_time);
+    }
+  }
+
+  void
+  evaluate_and_update_stage(VectorType & solution,
+                            VectorType & vec_ri,
+                            VectorType & vec_ki,
+                            double const evaluation_time,
+                            double const factor_ri,
+                            double const factor_solution,
+                            bool const   update_ri) const
+  {
+    evaluate_and_update_stage_oif(
+      *this, solution, vec_ri, vec_ki, evaluation_time, factor_ri, factor_solution, update_ri);
+  }
+
+  void
+  initialize_dof_vector(VectorType & src) const
+  {
+    pde_operator->initialize_dof_vector(src);
+  }
+
+private:
+  std::shared_ptr<ConvDiff::Interface::Operator<Number>> pde_operator;
+
+  bool                            numerical_velocity_field;
+  std::vector<VectorType const *> velocities;
+  std::vector<double>             times;
+  VectorType mutable velocity_interpolated;
+};
+
 } // namespace ConvDiff
 } // namespace ExaDG
 
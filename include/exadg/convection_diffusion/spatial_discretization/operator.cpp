@@ -38,6 +38,36 @@ namespace ExaDG
 {
 namespace ConvDiff
 {
+double
+calculate_time_step_of_element_length(Parameters const & param, double const h)
+{
+  double time_step = std::numeric_limits<double>::max();
+
+  if(param.calculation_of_time_step_size == TimeStepCalculation::CFL or
+     param.calculation_of_time_step_size == TimeStepCalculation::CFLAndDiffusion)
+  {
+    time_step = std::min(time_step,
+                         param.cfl * ExaDG::calculate_time_step_cfl_global(
+                                       param.max_velocity,
+                                       h,
+                                       param.degree,
+                                       param.exponent_fe_degree_convection));
+  }
+
+  if(param.calculation_of_time_step_size == TimeStepCalculation::Diffusion or
+     param.calculation_of_time_step_size == TimeStepCalculation::CFLAndDiffusion)
+  {
+    time_step = std::min(time_step,
+                         param.diffusion_number * ExaDG::calculate_const_time_step_diff(
+                                                    param.diffusivity,
+                                                    h,
+                                                    param.degree,
+                                                    param.exponent_fe_degree_diffusion));
+  }
+
+  return time_step;
+}
+
 template<int dim, typename Number>
 Operator<dim, Number>::Operator(
   std::shared_ptr<Grid<dim> const>                  grid_in,
@@ -71,6 +101,16 @@ Operator<dim, Number>::Operator(
 
   affine_constraints.close();
 
+  if(param.temporal_discretization == TemporalDiscretization::ExplRK and
+     param.time_integrator_rk == TimeIntegratorRK::ExplRKMultirate)
+  {
+    time_step_levels = calculate_time_step_levels<dim>(
+      *grid->triangulation,
+      [&](double const h) { return calculate_time_step_of_element_length(param, h); },
+      param.max_time_step_levels,
+      mpi_comm);
+  }
+
   pcout << std::endl << "... done!" << std::endl;
 }
 
@@ -121,6 +161,14 @@ Operator<dim, Number>::fill_matrix_free_data(MatrixFreeData<dim, Number> & matri
     matrix_free_data.insert_quadrature(dealii::QGauss<1>(param.degree + (param.degree + 2) / 2),
                                        get_quad_name_overintegration());
   }
+
+  // cell batches must not mix cells of different time step levels
+  if(param.temporal_discretization == TemporalDiscretization::ExplRK and
+     param.time_integrator_rk == TimeIntegratorRK::ExplRKMultirate)
+  {
+    matrix_free_data.data.cell_vectorization_category          = time_step_levels;
+    matrix_free_data.data.cell_vectorization_categories_strict = true;
+  }
 }
 
 template<int dim, typename Number>
@@ -281,6 +329,27 @@ Operator<dim, Number>::setup(std::shared_ptr<dealii::MatrixFree<dim, Number>> ma
                                  diffusive_kernel);
   }
 
+  if(param.temporal_discretization == TemporalDiscretization::ExplRK and
+     param.time_integrator_rk == TimeIntegratorRK::ExplRKMultirate)
+  {
+    multirate_levels.reinit(*matrix_free, get_dof_index(), time_step_levels);
+
+    inverse_mass_operator.set_multirate_levels(&multirate_levels);
+    convective_operator.set_multirate_levels(&multirate_levels);
+    diffusive_operator.set_multirate_levels(&multirate_levels);
+    rhs_operator.set_multirate_levels(&multirate_levels);
+    combined_operator.set_multirate_levels(&multirate_levels);
+
+    pcout << std::endl << "Time step levels:" << std::endl << std::endl;
+    print_parameter(pcout, "Number of time step levels", multirate_levels.get_n_levels());
+    for(unsigned int l = 0; l < multirate_levels.get_n_levels(); ++l)
+    {
+      print_parameter(pcout,
+                      "Number of dofs on level " + std::to_string(l),
+                      dealii::Utilities::MPI::sum(multirate_levels.n_dofs(l), mpi_comm));
+    }
+  }
+
   pcout << std::endl << "... done!" << std::endl;
 }
 
@@ -441,7 +510,8 @@ Operator<dim, Number>::initialize_preconditioner()
   }
   else if(param.preconditioner == Preconditioner::Multigrid)
   {
-    if(param.treatment_of_convective_term == TreatmentOfConvectiveTerm::Explicit)
+    if(param.treatment_of_convective_term == TreatmentOfConvectiveTerm::Explicit ||
+       param.treatment_of_convective_term == TreatmentOfConvectiveTerm::ExplicitOIF)
     {
       AssertThrow(param.mg_operator_type != MultigridOperatorType::ReactionConvection &&
                     param.mg_operator_type != MultigridOperatorType::ReactionConvectionDiffusion,
@@ -553,6 +623,44 @@ Operator<dim, Number>::initialize_solver()
       Krylov::SolverFGMRES<CombinedOperator<dim, Number>, PreconditionerBase<Number>, VectorType>>(
       combined_operator, *preconditioner, solver_data);
   }
+  else if(param.solver == Solver::DeflatedCG)
+  {
+    // initialize solver_data
+    Krylov::SolverDataDeflatedCG solver_data;
+    solver_data.solver_tolerance_abs = param.solver_data.abs_tol;
+    solver_data.solver_tolerance_rel = param.solver_data.rel_tol;
+    solver_data.max_iter             = param.solver_data.max_iter;
+    solver_data.recycle_space_size   = param.solver_data.recycle_space_size;
+    solver_data.max_n_tmp_vectors    = param.solver_data.max_krylov_size;
+
+    if(param.preconditioner != Preconditioner::None)
+      solver_data.use_preconditioner = true;
+
+    // initialize solver
+    typedef Krylov::
+      SolverDeflatedCG<CombinedOperator<dim, Number>, PreconditionerBase<Number>, VectorType>
+        DeflatedCG;
+    iterative_solver =
+      std::make_shared<DeflatedCG>(combined_operator, *preconditioner, solver_data);
+  }
+  else if(param.solver == Solver::GCRODR)
+  {
+    // initialize solver_data
+    Krylov::SolverDataGCRODR solver_data;
+    solver_data.solver_tolerance_abs = param.solver_data.abs_tol;
+    solver_data.solver_tolerance_rel = param.solver_data.rel_tol;
+    solver_data.max_iter             = param.solver_data.max_iter;
+    solver_data.recycle_space_size   = param.solver_data.recycle_space_size;
+    solver_data.max_n_tmp_vectors    = param.solver_data.max_krylov_size;
+
+    if(param.preconditioner != Preconditioner::None)
+      solver_data.use_preconditioner = true;
+
+    // initialize solver
+    iterative_solver = std::make_shared<
+      Krylov::SolverGCRODR<CombinedOperator<dim, Number>, PreconditionerBase<Number>, VectorType>>(
+      combined_operator, *preconditioner, solver_data);
+  }
   else
   {
     AssertThrow(false, dealii::ExcMessage("Specified solver is not implemented!"));
@@ -629,6 +737,57 @@ Operator<dim, Number>::evaluate_explicit_time_int(VectorType &       dst,
                                                   VectorType const & src,
                                                   double const       time,
                                                   VectorType const * velocity) const
+{
+  evaluate_convective_and_diffusive_terms(dst, src, time, velocity);
+
+  // shift diffusive and convective term to the rhs of the equation
+  dst *= -1.0;
+
+  if(param.right_hand_side == true)
+  {
+    rhs_operator.evaluate_add(dst, time);
+  }
+
+  // apply inverse mass operator
+  inverse_mass_operator.apply(dst, dst);
+}
+
+template<int dim, typename Number>
+void
+Operator<dim, Number>::evaluate_explicit_time_int_and_update_stage(
+  VectorType &       solution,
+  VectorType &       vec_ri,
+  VectorType &       vec_ki,
+  double const       time,
+  double const       factor_ri,
+  double const       factor_solution,
+  bool const         update_ri,
+  VectorType const * velocity) const
+{
+  evaluate_convective_and_diffusive_terms(vec_ki, vec_ri, time, velocity);
+
+  // Shift diffusive and convective term to the rhs of the equation. Without right-hand side
+  // term, the sign is absorbed into the factors of the vector updates to avoid a separate pass
+  // through the vector.
+  double sign = -1.0;
+
+  if(param.right_hand_side == true)
+  {
+    vec_ki *= -1.0;
+    rhs_operator.evaluate_add(vec_ki, time);
+    sign = 1.0;
+  }
+
+  inverse_mass_operator.apply_and_update_stage(
+    solution, vec_ri, vec_ki, sign * factor_ri, sign * factor_solution, update_ri);
+}
+
+template<int dim, typename Number>
+void
+Operator<dim, Number>::evaluate_convective_and_diffusive_terms(VectorType &       dst,
+                                                               VectorType const & src,
+                                                               double const       time,
+                                                               VectorType const * velocity) const
 {
   // evaluate each operator separately
   if(param.use_combined_operator == false)
@@ -656,14 +815,6 @@ Operator<dim, Number>::evaluate_explicit_time_int(VectorType &       dst,
       convective_operator.set_time(time);
       convective_operator.evaluate_add(dst, src);
     }
-
-    // shift diffusive and convective term to the rhs of the equation
-    dst *= -1.0;
-
-    if(param.right_hand_side == true)
-    {
-      rhs_operator.evaluate_add(dst, time);
-    }
   }
   else // param.use_combined_operator == true
   {
@@ -683,18 +834,7 @@ Operator<dim, Number>::evaluate_explicit_time_int(VectorType &       dst,
 
     combined_operator.set_time(time);
     combined_operator.evaluate(dst, src);
-
-    // shift diffusive and convective term to the rhs of the equation
-    dst *= -1.0;
-
-    if(param.right_hand_side == true)
-    {
-      rhs_operator.evaluate_add(dst, time);
-    }
   }
-
-  // apply inverse mass operator
-  inverse_mass_operator.apply(dst, dst);
 }
 
 template<int dim, typename Number>
@@ -715,6 +855,21 @@ Operator<dim, Number>::evaluate_convective_term(VectorType &       dst,
   convective_operator.evaluate(dst, src);
 }
 
+template<int dim, typename Number>
+void
+Operator<dim, Number>::evaluate_oif(VectorType &       dst,
+                                    VectorType const & src,
+                                    double const       time,
+                                    VectorType const * velocity) const
+{
+  evaluate_convective_term(dst, src, time, velocity);
+
+  // shift convective term to the rhs of the equation
+  dst *= -1.0;
+
+  inverse_mass_operator.apply(dst, dst);
+}
+
 template<int dim, typename Number>
 void
 Operator<dim, Number>::rhs(VectorType & dst, double const time, VectorType const * velocity) const
@@ -907,6 +1062,13 @@ Operator<dim, Number>::calculate_time_step_diffusion() const
                                                param.exponent_fe_degree_diffusion);
 }
 
+template<int dim, typename Number>
+MultirateLevels<Number> const &
+Operator<dim, Number>::get_multirate_levels() const
+{
+  return multirate_levels;
+}
+
 template<int dim, typename Number>
 double
 Operator<dim, Number>::calculate_time_step_cfl_numerical_velocity(VectorType const & velocity) const
@@ -974,6 +1136,16 @@ Operator<dim, Number>::get_number_of_dofs() const
   return dof_handler.n_dofs();
 }
 
+template<int dim, typename Number>
+std::size_t
+Operator<dim, Number>::get_memory_consumption_linear_solver() const
+{
+  if(iterative_solver.get() != 0)
+    return iterative_solver->memory_consumption();
+  else
+    return 0;
+}
+
 template<int dim, typename Number>
 dealii::MatrixFree<dim, Number> const &
 Operator<dim, Number>::get_matrix_free() const
@@ -44,6 +44,14 @@ namespace ExaDG
 {
 namespace ConvDiff
 {
+/*
+ * Time step size admissible for an element of length h according to the CFL condition and/or the
+ * diffusion number, depending on calculation_of_time_step_size. This function is used to assign the
+ * cells to the time step levels of the multirate Runge-Kutta method.
+ */
+double
+calculate_time_step_of_element_length(Parameters const & param, double const h);
+
 template<int dim, typename Number>
 class Operator : public dealii::Subscriptor, public Interface::Operator<Number>
 {
@@ -126,6 +134,23 @@ public:
                              double const       evaluation_time,
                              VectorType const * velocity = nullptr) const;
 
+  /*
+   * Fused variant of evaluate_explicit_time_int() for a stage of a low-storage Runge-Kutta method
+   * with two registers: vec_ki = M^{-1} (rhs - L(vec_ri)), followed by the vector updates
+   * vec_ri = solution + factor_ri * vec_ki (only if update_ri == true) and
+   * solution += factor_solution * vec_ki. The inverse mass operator and the vector updates are
+   * performed in a single cell loop, see InverseMassOperator::apply_and_update_stage().
+   */
+  void
+  evaluate_explicit_time_int_and_update_stage(VectorType &       solution,
+                                              VectorType &       vec_ri,
+                                              VectorType &       vec_ki,
+                                              double const       evaluation_time,
+                                              double const       factor_ri,
+                                              double const       factor_solution,
+                                              bool const         update_ri,
+                                              VectorType const * velocity = nullptr) const;
+
   /*
    * This function evaluates the convective term which is needed when using an explicit formulation
    * for the convective term.
@@ -136,6 +161,17 @@ public:
                            double const       evaluation_time,
                            VectorType const * velocity = nullptr) const;
 
+  /*
+   * This function is used in case of operator-integration-factor splitting: it evaluates the
+   * convective term, shifts it to the right-hand side of the equations, and applies the inverse
+   * mass operator.
+   */
+  void
+  evaluate_oif(VectorType &       dst,
+               VectorType const & src,
+               double const       evaluation_time,
+               VectorType const * velocity = nullptr) const;
+
   /*
    * This function calculates the inhomogeneous parts of all operators arising e.g. from
    * inhomogeneous boundary conditions or the solution at previous instants of time occurring in the
@@ -260,6 +296,10 @@ public:
   double
   calculate_time_step_diffusion() const;
 
+  // time step levels of the cells in case of multirate time integration
+  MultirateLevels<Number> const &
+  get_multirate_levels() const;
+
 public:
   /*
    * Setters and getters.
@@ -277,6 +317,10 @@ public:
   dealii::types::global_dof_index
   get_number_of_dofs() const;
 
+  // memory consumption in bytes of the vectors kept by the linear solver between solves
+  std::size_t
+  get_memory_consumption_linear_solver() const;
+
   std::string
   get_dof_name() const;
 
@@ -290,6 +334,16 @@ public:
   get_mapping() const;
 
 private:
+  /*
+   * Evaluates the convective and diffusive terms, dst = L(src), as needed for explicit time
+   * integration.
+   */
+  void
+  evaluate_convective_and_diffusive_terms(VectorType &       dst,
+                                          VectorType const & src,
+                                          double const       evaluation_time,
+                                          VectorType const * velocity) const;
+
   /*
    * Calculates maximum velocity (required for global CFL criterion).
    */
@@ -412,6 +466,12 @@ private:
    */
   CombinedOperator<dim, Number> combined_operator;
 
+  /*
+   * Time step levels for multirate time integration (indexed by the active cell index).
+   */
+  std::vector<unsigned int> time_step_levels;
+  MultirateLevels<Number>   multirate_levels;
+
   /*
    * Solvers and preconditioners
    */
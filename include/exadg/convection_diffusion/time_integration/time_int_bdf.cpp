@@ -23,6 +23,7 @@
 #include <exadg/convection_diffusion/spatial_discretization/operator.h>
 #include <exadg/convection_diffusion/time_integration/time_int_bdf.h>
 #include <exadg/convection_diffusion/user_interface/parameters.h>
+#include <exadg/time_integration/operator_integration_factor.h>
 #include <exadg/time_integration/push_back_vectors.h>
 #include <exadg/time_integration/time_step_calculation.h>
 #include <exadg/utilities/print_solver_results.h>
@@ -46,14 +47,17 @@ TimeIntBDF<dim, Number>::TimeIntBDF(
                            param_in.adaptive_time_stepping,
                            param_in.restart_data,
                            mpi_comm_in,
-                           is_test_in),
+                           is_test_in,
+                           param_in.error_controller_data),
     pde_operator(operator_in),
     param(param_in),
     refine_steps_time(param_in.n_refine_time),
     cfl(param.cfl / std::pow(2.0, refine_steps_time)),
+    cfl_oif(param_in.cfl_oif / std::pow(2.0, refine_steps_time)),
     solution(param_in.order_time_integrator),
     vec_convective_term(param_in.order_time_integrator),
     iterations({0, 0}),
+    time_step_preconditioner(-1.0),
     postprocessor(postprocessor_in),
     vec_grid_coordinates(param_in.order_time_integrator)
 {
@@ -97,6 +101,12 @@ TimeIntBDF<dim, Number>::setup_derived()
       initialize_vec_convective_term();
     }
   }
+
+  if(param.convective_problem() &&
+     param.treatment_of_convective_term == TreatmentOfConvectiveTerm::ExplicitOIF)
+  {
+    initialize_oif();
+  }
 }
 
 template<int dim, typename Number>
@@ -177,6 +187,21 @@ TimeIntBDF<dim, Number>::initialize_vec_convective_term()
   }
 }
 
+template<int dim, typename Number>
+void
+TimeIntBDF<dim, Number>::initialize_oif()
+{
+  bool const numerical_velocity_field =
+    (param.get_type_velocity_field() == TypeVelocityField::DoFVector);
+
+  convective_operator_oif =
+    std::make_shared<OperatorOIF<Number>>(pde_operator, numerical_velocity_field);
+
+  time_integrator_oif =
+    create_time_integrator_oif<OperatorOIF<Number>, VectorType>(param.time_integrator_oif,
+                                                                convective_operator_oif);
+}
+
 template<int dim, typename Number>
 double
 TimeIntBDF<dim, Number>::calculate_time_step_size()
@@ -270,9 +295,15 @@ template<int dim, typename Number>
 double
 TimeIntBDF<dim, Number>::recalculate_time_step_size() const
 {
-  AssertThrow(param.calculation_of_time_step_size == TimeStepCalculation::CFL,
-              dealii::ExcMessage(
-                "Adaptive time step is not implemented for this type of time step calculation."));
+  if(param.calculation_of_time_step_size != TimeStepCalculation::CFL)
+  {
+    AssertThrow(param.error_controller_data.active,
+                dealii::ExcMessage(
+                  "Adaptive time step is not implemented for this type of time step calculation."));
+
+    // the time step size is determined by the error controller only
+    return std::numeric_limits<double>::max();
+  }
 
   double new_time_step_size = std::numeric_limits<double>::max();
   if(param.analytical_velocity_field)
@@ -308,6 +339,20 @@ TimeIntBDF<dim, Number>::recalculate_time_step_size() const
   return new_time_step_size;
 }
 
+template<int dim, typename Number>
+typename TimeIntBDF<dim, Number>::VectorType const &
+TimeIntBDF<dim, Number>::get_solution_np_error_estimation() const
+{
+  return solution_np;
+}
+
+template<int dim, typename Number>
+typename TimeIntBDF<dim, Number>::VectorType const &
+TimeIntBDF<dim, Number>::get_solution_error_estimation(unsigned int const i) const
+{
+  return solution[i];
+}
+
 template<int dim, typename Number>
 void
 TimeIntBDF<dim, Number>::prepare_vectors_for_next_timestep()
@@ -485,9 +530,26 @@ TimeIntBDF<dim, Number>::do_timestep_solve()
   }
 
   VectorType sum_alphai_ui(solution[0]);
-  sum_alphai_ui.equ(this->bdf.get_alpha(0) / this->get_time_step_size(), solution[0]);
-  for(unsigned int i = 1; i < solution.size(); ++i)
-    sum_alphai_ui.add(this->bdf.get_alpha(i) / this->get_time_step_size(), solution[i]);
+  if(param.convective_problem() &&
+     param.treatment_of_convective_term == TreatmentOfConvectiveTerm::ExplicitOIF)
+  {
+    // the former solutions are transported to t_{n+1} by the sub-steps of the explicit time
+    // integrator, which replaces the evaluation of the convective term
+    convective_operator_oif->set_velocities_and_times(velocities, times);
+
+    std::vector<VectorType const *> solutions(solution.size());
+    for(unsigned int i = 0; i < solution.size(); ++i)
+      solutions[i] = &solution[i];
+
+    this->calculate_sum_alphai_ui_oif_substepping(
+      sum_alphai_ui, *time_integrator_oif, solutions, cfl, cfl_oif);
+  }
+  else
+  {
+    sum_alphai_ui.equ(this->bdf.get_alpha(0) / this->get_time_step_size(), solution[0]);
+    for(unsigned int i = 1; i < solution.size(); ++i)
+      sum_alphai_ui.add(this->bdf.get_alpha(i) / this->get_time_step_size(), solution[i]);
+  }
 
   // apply mass operator to sum_alphai_ui and add to rhs_vector
   pde_operator->apply_mass_operator_add(rhs_vector, sum_alphai_ui);
@@ -498,9 +560,11 @@ TimeIntBDF<dim, Number>::do_timestep_solve()
     solution_np.add(this->extra.get_beta(i), solution[i]);
 
   // solve the linear system of equations
+  bool const regular_update =
+    (this->time_step_number % this->param.update_preconditioner_every_time_steps == 0);
   bool const update_preconditioner =
     this->param.update_preconditioner &&
-    (this->time_step_number % this->param.update_preconditioner_every_time_steps == 0);
+    this->preconditioner_update_required(regular_update, time_step_preconditioner);
 
   unsigned int const N_iter =
     pde_operator->solve(solution_np,
@@ -26,6 +26,7 @@
 #include <deal.II/lac/la_parallel_vector.h>
 
 // ExaDG
+#include <exadg/convection_diffusion/spatial_discretization/interface.h>
 #include <exadg/time_integration/time_int_bdf_base.h>
 
 namespace ExaDG
@@ -82,12 +83,21 @@ private:
   void
   initialize_vec_convective_term();
 
+  void
+  initialize_oif();
+
   double
   calculate_time_step_size() final;
 
   double
   recalculate_time_step_size() const final;
 
+  VectorType const &
+  get_solution_np_error_estimation() const final;
+
+  VectorType const &
+  get_solution_error_estimation(unsigned int const i) const final;
+
   void
   prepare_vectors_for_next_timestep() final;
 
@@ -117,6 +127,13 @@ private:
 
   double const cfl;
 
+  // operator-integration-factor splitting
+  double const cfl_oif;
+
+  std::shared_ptr<OperatorOIF<Number>> convective_operator_oif;
+
+  std::shared_ptr<ExplicitTimeIntegrator<OperatorOIF<Number>, VectorType>> time_integrator_oif;
+
   // solution vectors
   VectorType              solution_np;
   std::vector<VectorType> solution;
@@ -132,6 +149,9 @@ private:
   // iteration counts
   std::pair<unsigned int /* calls */, unsigned long long /* iteration counts */> iterations;
 
+  // time step size of the last update of the preconditioner
+  double time_step_preconditioner;
+
   // postprocessor
   std::shared_ptr<PostProcessorInterface<Number>> postprocessor;
 
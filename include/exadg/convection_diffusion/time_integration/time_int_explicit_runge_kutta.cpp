@@ -44,7 +44,8 @@ TimeIntExplRK<Number>::TimeIntExplRK(
                               param_in.restart_data,
                               param_in.adaptive_time_stepping,
                               mpi_comm_in,
-                              is_test_in),
+                              is_test_in,
+                              param_in.error_controller_data),
     pde_operator(operator_in),
     param(param_in),
     refine_steps_time(param_in.n_refine_time),
@@ -207,6 +208,17 @@ TimeIntExplRK<Number>::calculate_time_step_size()
     AssertThrow(false,
                 dealii::ExcMessage("Specified type of time step calculation is not implemented."));
   }
+
+  if(param.time_integrator_rk == TimeIntegratorRK::ExplRKMultirate)
+  {
+    // the time step size calculated above is the one of the finest time step level
+    this->time_step *= pde_operator->get_multirate_levels().get_time_step_ratio();
+
+    this->time_step =
+      adjust_time_step_to_hit_end_time(this->start_time, this->end_time, this->time_step);
+
+    print_parameter(this->pcout, "Time step size (coarsest level)", this->time_step);
+  }
 }
 
 template<typename Number>
@@ -294,13 +306,13 @@ TimeIntExplRK<Number>::initialize_time_integrator()
   {
     rk_time_integrator =
       std::make_shared<LowStorageRK3Stage4Reg2C<OperatorExplRK<Number>, VectorType>>(
-        expl_rk_operator);
+        expl_rk_operator, param.use_fused_runge_kutta_stages);
   }
   else if(param.time_integrator_rk == TimeIntegratorRK::ExplRK4Stage5Reg2C)
   {
     rk_time_integrator =
       std::make_shared<LowStorageRK4Stage5Reg2C<OperatorExplRK<Number>, VectorType>>(
-        expl_rk_operator);
+        expl_rk_operator, param.use_fused_runge_kutta_stages);
   }
   else if(param.time_integrator_rk == TimeIntegratorRK::ExplRK4Stage5Reg3C)
   {
@@ -312,7 +324,7 @@ TimeIntExplRK<Number>::initialize_time_integrator()
   {
     rk_time_integrator =
       std::make_shared<LowStorageRK5Stage9Reg2S<OperatorExplRK<Number>, VectorType>>(
-        expl_rk_operator);
+        expl_rk_operator, param.use_fused_runge_kutta_stages);
   }
   else if(param.time_integrator_rk == TimeIntegratorRK::ExplRK3Stage7Reg2)
   {
@@ -324,10 +336,18 @@ TimeIntExplRK<Number>::initialize_time_integrator()
     rk_time_integrator =
       std::make_shared<LowStorageRKTD<OperatorExplRK<Number>, VectorType>>(expl_rk_operator, 4, 8);
   }
+  else if(param.time_integrator_rk == TimeIntegratorRK::ExplRKMultirate)
+  {
+    rk_time_integrator =
+      std::make_shared<MultirateRungeKutta<OperatorExplRK<Number>, VectorType>>(
+        param.order_time_integrator, expl_rk_operator, pde_operator->get_multirate_levels());
+  }
   else
   {
     AssertThrow(false, dealii::ExcMessage("Not implemented."));
   }
+
+  this->initialize_error_controller(rk_time_integrator->get_order_embedded());
 }
 
 template<typename Number>
@@ -354,10 +374,7 @@ TimeIntExplRK<Number>::do_timestep_solve()
     }
   }
 
-  rk_time_integrator->solve_timestep(this->solution_np,
-                                     this->solution_n,
-                                     this->time,
-                                     this->time_step);
+  this->solve_timestep(*rk_time_integrator);
 
   if(print_solver_info() and not(this->is_test))
   {
@@ -161,6 +161,9 @@ enum_to_string(TreatmentOfConvectiveTerm const enum_type)
     case TreatmentOfConvectiveTerm::Explicit:
       string_type = "Explicit";
       break;
+    case TreatmentOfConvectiveTerm::ExplicitOIF:
+      string_type = "ExplicitOIF";
+      break;
     case TreatmentOfConvectiveTerm::Implicit:
       string_type = "Implicit";
       break;
@@ -212,6 +215,9 @@ enum_to_string(TimeIntegratorRK const enum_type)
     case TimeIntegratorRK::ExplRK5Stage9Reg2S:
       string_type = "ExplRK5Stage9Reg2S";
       break;
+    case TimeIntegratorRK::ExplRKMultirate:
+      string_type = "ExplRKMultirate";
+      break;
     default:
       AssertThrow(false, dealii::ExcMessage("Not implemented."));
       break;
@@ -305,6 +311,12 @@ enum_to_string(Solver const enum_type)
     case Solver::FGMRES:
       string_type = "FGMRES";
       break;
+    case Solver::DeflatedCG:
+      string_type = "DeflatedCG";
+      break;
+    case Solver::GCRODR:
+      string_type = "GCRODR";
+      break;
     default:
       AssertThrow(false, dealii::ExcMessage("Not implemented."));
       break;
@@ -125,7 +125,8 @@ enum_to_string(TemporalDiscretization const enum_type);
 enum class TreatmentOfConvectiveTerm
 {
   Undefined,
-  Explicit, // additive decomposition (IMEX)
+  Explicit,    // additive decomposition (IMEX)
+  ExplicitOIF, // operator-integration-factor splitting (Maday et al. 1990)
   Implicit
 };
 
@@ -149,7 +150,8 @@ enum class TimeIntegratorRK
   ExplRK4Stage5Reg2C,
   ExplRK4Stage8Reg2, // optimized for maximum time step sizes in DG context
   ExplRK4Stage5Reg3C,
-  ExplRK5Stage9Reg2S
+  ExplRK5Stage9Reg2S,
+  ExplRKMultirate // specify order and maximum number of time step levels
 };
 
 std::string
@@ -198,13 +200,18 @@ enum_to_string(NumericalFluxConvectiveOperator const enum_type);
 
 /*
  *   Solver for linear system of equations
+ *
+ *   DeflatedCG and GCRODR recycle a subspace from one linear solve to the next, which reduces
+ *   the number of iterations for sequences of similar linear systems (e.g. time steps).
  */
 enum class Solver
 {
   Undefined,
   CG,
   GMRES,
-  FGMRES // flexible GMRES
+  FGMRES,     // flexible GMRES
+  DeflatedCG, // CG with recycled deflation space
+  GCRODR      // flexible GCRO-DR with recycled subspace
 };
 
 std::string
@@ -44,9 +44,13 @@ Parameters::Parameters()
     // TEMPORAL DISCRETIZATION
     temporal_discretization(TemporalDiscretization::Undefined),
     time_integrator_rk(TimeIntegratorRK::Undefined),
+    use_fused_runge_kutta_stages(false),
+    max_time_step_levels(1),
+    error_controller_data(ErrorControllerData()),
     order_time_integrator(1),
     start_with_low_order(true),
     treatment_of_convective_term(TreatmentOfConvectiveTerm::Undefined),
+    time_integrator_oif(TimeIntegratorOIF::Undefined),
     calculation_of_time_step_size(TimeStepCalculation::Undefined),
     adaptive_time_stepping(false),
     adaptive_time_stepping_limiting_factor(1.2),
@@ -56,6 +60,7 @@ Parameters::Parameters()
     max_number_of_time_steps(std::numeric_limits<unsigned int>::max()),
     n_refine_time(0),
     cfl(-1.),
+    cfl_oif(-1.),
     max_velocity(std::numeric_limits<double>::min()),
     diffusion_number(-1.),
     c_eff(-1.),
@@ -245,11 +250,87 @@ Parameters::check() const
                   dealii::ExcMessage("Specified order of time integrator ExplRK not implemented!"));
     }
 
+    if(temporal_discretization == TemporalDiscretization::ExplRK and
+       time_integrator_rk == TimeIntegratorRK::ExplRKMultirate)
+    {
+      // the coupling between time step levels is limited to second order accuracy
+      AssertThrow(order_time_integrator >= 1 && order_time_integrator <= 2,
+                  dealii::ExcMessage("The multirate Runge-Kutta method ExplRKMultirate is only "
+                                     "implemented for orders 1-2, since the coupling between time "
+                                     "step levels is limited to second order accuracy."));
+      AssertThrow(max_time_step_levels >= 1 && max_time_step_levels <= 32,
+                  dealii::ExcMessage("Invalid parameter max_time_step_levels."));
+      AssertThrow(calculation_of_time_step_size == TimeStepCalculation::CFL ||
+                    calculation_of_time_step_size == TimeStepCalculation::Diffusion ||
+                    calculation_of_time_step_size == TimeStepCalculation::CFLAndDiffusion,
+                  dealii::ExcMessage("The multirate Runge-Kutta method requires a time step size "
+                                     "calculated from the CFL condition and/or diffusion number."));
+      AssertThrow(adaptive_time_stepping == false,
+                  dealii::ExcMessage("Adaptive time stepping is not implemented for the "
+                                     "multirate Runge-Kutta method."));
+      AssertThrow(use_cell_based_face_loops == false,
+                  dealii::ExcMessage("The multirate Runge-Kutta method defines its own cell "
+                                     "categories and cannot be used with cell-based face loops."));
+    }
+
+    if(use_fused_runge_kutta_stages)
+    {
+      AssertThrow(low_storage_runge_kutta_with_two_registers(),
+                  dealii::ExcMessage("Fused Runge-Kutta stages are only implemented for "
+                                     "low-storage Runge-Kutta methods with two registers of type "
+                                     "2R+."));
+    }
+
+    if(error_controller_data.active and temporal_discretization == TemporalDiscretization::ExplRK)
+    {
+      AssertThrow(time_integrator_rk == TimeIntegratorRK::ExplRK3Stage4Reg2C ||
+                    time_integrator_rk == TimeIntegratorRK::ExplRK4Stage5Reg2C,
+                  dealii::ExcMessage("Error-controlled time stepping is only implemented for the "
+                                     "embedded methods ExplRK3Stage4Reg2C and "
+                                     "ExplRK4Stage5Reg2C."));
+      AssertThrow(not use_fused_runge_kutta_stages,
+                  dealii::ExcMessage("Error-controlled time stepping is not implemented for fused "
+                                     "Runge-Kutta stages."));
+      AssertThrow(adaptive_time_stepping == false,
+                  dealii::ExcMessage("Error-controlled time stepping replaces the CFL-based "
+                                     "adaptive time stepping. Do not use both."));
+    }
+
+    if(error_controller_data.active and temporal_discretization == TemporalDiscretization::BDF)
+    {
+      // a rejected time step would have to be repeated on a different mesh
+      AssertThrow(ale_formulation == false,
+                  dealii::ExcMessage("Error-controlled time stepping is not implemented for the "
+                                     "ALE formulation."));
+    }
+
     if(temporal_discretization == TemporalDiscretization::BDF)
     {
       AssertThrow(order_time_integrator >= 1 && order_time_integrator <= 4,
                   dealii::ExcMessage("Specified order of time integrator BDF not implemented!"));
     }
+
+    if(temporal_discretization == TemporalDiscretization::BDF and convective_problem() and
+       treatment_of_convective_term == TreatmentOfConvectiveTerm::ExplicitOIF)
+    {
+      AssertThrow(time_integrator_oif != TimeIntegratorOIF::Undefined,
+                  dealii::ExcMessage("parameter must be defined"));
+
+      AssertThrow(cfl_oif > 0., dealii::ExcMessage("parameter must be defined"));
+
+      AssertThrow(calculation_of_time_step_size == TimeStepCalculation::CFL,
+                  dealii::ExcMessage("The size of the sub-steps of the operator-integration-factor "
+                                     "splitting is derived from the CFL condition. Use "
+                                     "TimeStepCalculation::CFL."));
+
+      // the sub-steps would require a projection of the velocity field in every stage
+      if(analytical_velocity_field)
+      {
+        AssertThrow(store_analytical_velocity_in_dof_vector == false,
+                    dealii::ExcMessage("Operator-integration-factor splitting is not implemented "
+                                       "for an analytical velocity field stored in a DoF vector."));
+      }
+    }
   }
 
   // SPATIAL DISCRETIZATION
@@ -270,6 +351,10 @@ Parameters::check() const
   {
     AssertThrow(solver != Solver::Undefined, dealii::ExcMessage("parameter must be defined"));
 
+    if(solver == Solver::DeflatedCG || solver == Solver::GCRODR)
+      AssertThrow(solver_data.recycle_space_size > 0,
+                  dealii::ExcMessage("Size of recycle space has to be larger than zero."));
+
     AssertThrow(preconditioner != Preconditioner::Undefined,
                 dealii::ExcMessage("parameter must be defined"));
 
@@ -278,7 +363,8 @@ Parameters::check() const
       AssertThrow(mg_operator_type != MultigridOperatorType::Undefined,
                   dealii::ExcMessage("parameter must be defined"));
 
-      if(treatment_of_convective_term == TreatmentOfConvectiveTerm::Explicit)
+      if(treatment_of_convective_term == TreatmentOfConvectiveTerm::Explicit ||
+         treatment_of_convective_term == TreatmentOfConvectiveTerm::ExplicitOIF)
       {
         AssertThrow(mg_operator_type != MultigridOperatorType::ReactionConvection &&
                       mg_operator_type != MultigridOperatorType::ReactionConvectionDiffusion,
@@ -310,6 +396,12 @@ Parameters::check() const
                 dealii::ExcMessage("Not implemented"));
   }
 
+  if(linear_system_has_to_be_solved() and preconditioner == Preconditioner::Multigrid)
+  {
+    multigrid_data.cycle_data.check(solver == Solver::FGMRES or solver == Solver::GCRODR,
+                                    false /* full_multigrid_supported */);
+  }
+
   if(implement_block_diagonal_preconditioner_matrix_free)
   {
     AssertThrow(
@@ -450,6 +542,15 @@ Parameters::print_parameters_physical_quantities(dealii::ConditionalOStream cons
   }
 }
 
+bool
+Parameters::low_storage_runge_kutta_with_two_registers() const
+{
+  return (temporal_discretization == TemporalDiscretization::ExplRK &&
+          (time_integrator_rk == TimeIntegratorRK::ExplRK3Stage4Reg2C ||
+           time_integrator_rk == TimeIntegratorRK::ExplRK4Stage5Reg2C ||
+           time_integrator_rk == TimeIntegratorRK::ExplRK5Stage9Reg2S));
+}
+
 void
 Parameters::print_parameters_temporal_discretization(dealii::ConditionalOStream const & pcout) const
 {
@@ -460,8 +561,20 @@ Parameters::print_parameters_temporal_discretization(dealii::ConditionalOStream
   if(temporal_discretization == TemporalDiscretization::ExplRK)
   {
     print_parameter(pcout, "Explicit time integrator", enum_to_string(time_integrator_rk));
+
+    if(low_storage_runge_kutta_with_two_registers())
+      print_parameter(pcout, "Use fused Runge-Kutta stages", use_fused_runge_kutta_stages);
+
+    if(time_integrator_rk == TimeIntegratorRK::ExplRKMultirate)
+    {
+      print_parameter(pcout, "Order of time integrator", order_time_integrator);
+      print_parameter(pcout, "Maximum number of time step levels", max_time_step_levels);
+    }
   }
 
+  if(error_controller_data.active)
+    error_controller_data.print(pcout);
+
   print_parameter(pcout, "Maximum number of time steps", max_number_of_time_steps);
 
   print_parameter(pcout, "Temporal refinements", n_refine_time);
@@ -473,6 +586,14 @@ Parameters::print_parameters_temporal_discretization(dealii::ConditionalOStream
     print_parameter(pcout,
                     "Treatment of convective term",
                     enum_to_string(treatment_of_convective_term));
+
+    if(treatment_of_convective_term == TreatmentOfConvectiveTerm::ExplicitOIF)
+    {
+      print_parameter(pcout,
+                      "Time integrator for OIF splitting",
+                      enum_to_string(time_integrator_oif));
+      print_parameter(pcout, "CFL number for OIF splitting", cfl_oif);
+    }
   }
 
   print_parameter(pcout,
@@ -34,6 +34,7 @@
 #include <exadg/solvers_and_preconditioners/solvers/enum_types.h>
 #include <exadg/solvers_and_preconditioners/solvers/solver_data.h>
 #include <exadg/time_integration/enum_types.h>
+#include <exadg/time_integration/error_controller.h>
 #include <exadg/time_integration/restart_data.h>
 #include <exadg/time_integration/solver_info_data.h>
 
@@ -83,6 +84,9 @@ private:
   void
   print_parameters_temporal_discretization(dealii::ConditionalOStream const & pcout) const;
 
+  bool
+  low_storage_runge_kutta_with_two_registers() const;
+
   void
   print_parameters_spatial_discretization(dealii::ConditionalOStream const & pcout) const;
 
@@ -146,7 +150,21 @@ public:
   // description: see enum declaration (only relevant for explicit time integration)
   TimeIntegratorRK time_integrator_rk;
 
-  // order of time integration scheme (only relevant for BDF time integration)
+  // fuse the inverse mass operator and the vector updates of the Runge-Kutta stages into a single
+  // loop (only relevant for low-storage Runge-Kutta methods with two registers of type 2R+)
+  bool use_fused_runge_kutta_stages;
+
+  // maximum number of time step levels of the multirate Runge-Kutta method: the cells are grouped
+  // into levels whose time step sizes differ by factors of two (only relevant for ExplRKMultirate)
+  unsigned int max_time_step_levels;
+
+  // error-controlled time stepping based on the embedded method of a low-storage Runge-Kutta method
+  // or, for BDF time integration, on the difference between the solution and the extrapolated
+  // predictor
+  ErrorControllerData error_controller_data;
+
+  // order of time integration scheme (only relevant for BDF time integration and the multirate
+  // Runge-Kutta method ExplRKMultirate)
   unsigned int order_time_integrator;
 
   // start with low order (only relevant for BDF time integration)
@@ -157,6 +175,10 @@ public:
   // a purely diffusive problem, one also does not have to specify this parameter.
   TreatmentOfConvectiveTerm treatment_of_convective_term;
 
+  // explicit Runge-Kutta method used for the sub-steps of the operator-integration-factor
+  // splitting (only relevant for TreatmentOfConvectiveTerm::ExplicitOIF)
+  TimeIntegratorOIF time_integrator_oif;
+
   // calculation of time step size
   TimeStepCalculation calculation_of_time_step_size;
 
@@ -194,6 +216,11 @@ public:
   // of operator-integration-factor splitting)
   double cfl;
 
+  // cfl number of the explicit Runge-Kutta method used for the sub-steps of the
+  // operator-integration-factor splitting, which has to be smaller than the critical CFL number of
+  // this method. The ratio cfl/cfl_oif determines the number of sub-steps per time step.
+  double cfl_oif;
+
   // estimation of maximum velocity required for CFL condition
   double max_velocity;
 
@@ -22,6 +22,7 @@
 // ExaDG
 #include <exadg/fluid_structure_interaction/driver.h>
 #include <exadg/grid/marked_vertices.h>
+#include <exadg/postprocessor/asynchronous_file_writer.h>
 #include <exadg/utilities/print_general_infos.h>
 
 namespace ExaDG
@@ -330,6 +331,9 @@ Driver<dim, Number>::solve() const
     if(application->fluid->get_parameters().adaptive_time_stepping)
       synchronize_time_step_size();
   }
+
+  // make sure that all output files have been written
+  AsynchronousFileWriter::get_instance().flush();
 }
 
 template<int dim, typename Number>
@@ -24,6 +24,7 @@
 
 // Structure
 #include <exadg/structure/spatial_discretization/operator.h>
+#include <exadg/structure/time_integration/time_int_central_difference.h>
 #include <exadg/structure/time_integration/time_int_gen_alpha.h>
 
 // application
@@ -91,12 +92,22 @@ SolverStructure<dim, Number>::setup(
   postprocessor->setup(pde_operator->get_dof_handler(), *application->get_grid()->mapping);
 
   // initialize time integrator
-  time_integrator = std::make_shared<Structure::TimeIntGenAlpha<dim, Number>>(
-    pde_operator, postprocessor, application->get_parameters(), mpi_comm, is_test);
+  if(application->get_parameters().temporal_discretization ==
+     Structure::TemporalDiscretization::CentralDifference)
+  {
+    time_integrator = std::make_shared<Structure::TimeIntCentralDifference<dim, Number>>(
+      pde_operator, postprocessor, application->get_parameters(), mpi_comm, is_test);
+  }
+  else
+  {
+    time_integrator = std::make_shared<Structure::TimeIntGenAlpha<dim, Number>>(
+      pde_operator, postprocessor, application->get_parameters(), mpi_comm, is_test);
+  }
 
   time_integrator->setup(application->get_parameters().restarted_simulation);
 
-  pde_operator->setup_solver();
+  if(not(application->get_parameters().involves_explicit_time_integration()))
+    pde_operator->setup_solver();
 }
 
 } // namespace FSI
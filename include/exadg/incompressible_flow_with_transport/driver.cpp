@@ -24,6 +24,7 @@
 #include <exadg/incompressible_flow_with_transport/driver.h>
 #include <exadg/incompressible_navier_stokes/spatial_discretization/create_operator.h>
 #include <exadg/incompressible_navier_stokes/time_integration/create_time_integrator.h>
+#include <exadg/postprocessor/asynchronous_file_writer.h>
 #include <exadg/utilities/print_solver_results.h>
 
 namespace ExaDG
@@ -616,6 +617,9 @@ Driver<dim, Number>::solve() const
 
     ++N_time_steps;
   }
+
+  // make sure that all output files have been written
+  AsynchronousFileWriter::get_instance().flush();
 }
 
 template<int dim, typename Number>
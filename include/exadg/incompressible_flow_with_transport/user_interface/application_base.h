@@ -88,6 +88,11 @@ public:
         dealii::ExcMessage(
           "The option adaptive_time_stepping has to be consistent for fluid and scalar transport solvers."));
 
+      AssertThrow(not(scalar_param[i].error_controller_data.active or
+                      this->param.error_controller_data.active),
+                  dealii::ExcMessage("Error-controlled time stepping is not implemented for "
+                                     "coupled flow and transport solvers."));
+
       scalar_param[i].print(this->pcout,
                             "List of parameters for scalar quantity " +
                               dealii::Utilities::to_string(i) + ":");
@@ -19,6 +19,9 @@
  *  ______________________________________________________________________
  */
 
+// C/C++
+#include <cmath>
+
 // likwid
 #ifdef EXADG_WITH_LIKWID
 #  include <likwid.h>
@@ -29,6 +32,7 @@
 #include <exadg/incompressible_navier_stokes/driver.h>
 #include <exadg/incompressible_navier_stokes/spatial_discretization/create_operator.h>
 #include <exadg/incompressible_navier_stokes/time_integration/create_time_integrator.h>
+#include <exadg/postprocessor/asynchronous_file_writer.h>
 #include <exadg/utilities/print_solver_results.h>
 #include <exadg/utilities/throughput_parameters.h>
 
@@ -291,6 +295,9 @@ Driver<dim, Number>::solve() const
   {
     AssertThrow(false, dealii::ExcMessage("Not implemented."));
   }
+
+  // make sure that all output files have been written
+  AsynchronousFileWriter::get_instance().flush();
 }
 
 template<int dim, typename Number>
@@ -312,6 +319,19 @@ Driver<dim, Number>::print_performance_results(double const total_time) const
     time_integrator->print_iterations();
   }
 
+  // memory of Krylov solvers with subspace recycling (only available for the coupled solver)
+  std::shared_ptr<OperatorCoupled<dim, Number>> operator_coupled =
+    std::dynamic_pointer_cast<OperatorCoupled<dim, Number>>(pde_operator);
+  if(operator_coupled.get() != 0)
+  {
+    double const memory_linear_solver = dealii::Utilities::MPI::sum(
+      (double)operator_coupled->get_memory_consumption_linear_solver(), mpi_comm);
+    if(memory_linear_solver > 0.0)
+      print_solver_memory_consumption(pcout,
+                                      memory_linear_solver,
+                                      pde_operator->get_number_of_dofs());
+  }
+
   // Wall times
   timer_tree.insert({"Incompressible flow"}, total_time);
 
@@ -420,6 +440,19 @@ Driver<dim, Number>::apply_operator(std::string const & operator_type_string,
   velocity = 1.0;
   pde_operator->set_velocity_ptr(velocity);
 
+  // The turbulent viscosity vanishes for a constant velocity field. To measure the realistic
+  // costs of the turbulence model, the turbulent viscosity is computed from a velocity field with
+  // non-vanishing gradients.
+  if(application->get_parameters().use_turbulence_model)
+  {
+    dealii::LinearAlgebra::distributed::Vector<Number> velocity_turbulence_model;
+    pde_operator->initialize_vector_velocity(velocity_turbulence_model);
+    for(unsigned int i = 0; i < velocity_turbulence_model.locally_owned_size(); ++i)
+      velocity_turbulence_model.local_element(i) = std::sin(double(i));
+
+    pde_operator->update_turbulence_model(velocity_turbulence_model);
+  }
+
   // initialize vectors
   if(application->get_parameters().temporal_discretization ==
      TemporalDiscretization::BDFCoupledSolution)
@@ -22,6 +22,7 @@
 #include <exadg/incompressible_navier_stokes/driver_precursor.h>
 #include <exadg/incompressible_navier_stokes/spatial_discretization/create_operator.h>
 #include <exadg/incompressible_navier_stokes/time_integration/create_time_integrator.h>
+#include <exadg/postprocessor/asynchronous_file_writer.h>
 #include <exadg/time_integration/time_step_calculation.h>
 #include <exadg/utilities/print_solver_results.h>
 
@@ -230,6 +231,9 @@ DriverPrecursor<dim, Number>::solve() const
     if(use_adaptive_time_stepping == true)
       synchronize_time_step_size();
   } while(!time_integrator_pre->finished() || !time_integrator->finished());
+
+  // make sure that all output files have been written
+  AsynchronousFileWriter::get_instance().flush();
 }
 
 template<int dim, typename Number>
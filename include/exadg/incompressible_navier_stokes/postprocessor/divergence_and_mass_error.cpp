@@ -69,21 +69,42 @@ DivergenceAndMassErrorCalculator<dim, Number>::evaluate(VectorType const & veloc
                                                         double const       time,
                                                         const bool         unsteady)
 {
-  if(unsteady)
-    analyze_div_and_mass_error_unsteady(velocity, time);
-  else
-    analyze_div_and_mass_error_steady(velocity);
+  BatchedReduction reductions(mpi_comm);
+
+  evaluate(velocity, time, unsteady, reductions);
+
+  reductions.resolve();
 }
 
 template<int dim, typename Number>
 void
+DivergenceAndMassErrorCalculator<dim, Number>::evaluate(VectorType const & velocity,
+                                                        double const       time,
+                                                        bool const         unsteady,
+                                                        BatchedReduction & reductions)
+{
+  // calculate divergence and mass error
+  unsigned int const index = do_evaluate(*matrix_free, velocity, reductions);
+
+  reductions.on_completion([this, index, time, unsteady](BatchedReduction const & result) {
+    if(unsteady)
+      analyze_div_and_mass_error_unsteady(time,
+                                          result.get(index),
+                                          result.get(index + 1),
+                                          result.get(index + 2),
+                                          result.get(index + 3));
+    else
+      analyze_div_and_mass_error_steady(
+        result.get(index), result.get(index + 1), result.get(index + 2), result.get(index + 3));
+  });
+}
+
+template<int dim, typename Number>
+unsigned int
 DivergenceAndMassErrorCalculator<dim, Number>::do_evaluate(
   dealii::MatrixFree<dim, Number> const & matrix_free,
   VectorType const &                      velocity,
-  Number &                                div_error,
-  Number &                                div_error_reference,
-  Number &                                mass_error,
-  Number &                                mass_error_reference)
+  BatchedReduction &                      reductions)
 {
   std::vector<Number> dst(4, 0.0);
   matrix_free.loop(&This::local_compute_div,
@@ -93,10 +114,7 @@ DivergenceAndMassErrorCalculator<dim, Number>::do_evaluate(
                    dst,
                    velocity);
 
-  div_error            = dealii::Utilities::MPI::sum(dst.at(0), mpi_comm);
-  div_error_reference  = dealii::Utilities::MPI::sum(dst.at(1), mpi_comm);
-  mass_error           = dealii::Utilities::MPI::sum(dst.at(2), mpi_comm);
-  mass_error_reference = dealii::Utilities::MPI::sum(dst.at(3), mpi_comm);
+  return reductions.add({dst.at(0), dst.at(1), dst.at(2), dst.at(3)});
 }
 
 template<int dim, typename Number>
@@ -201,15 +219,12 @@ DivergenceAndMassErrorCalculator<dim, Number>::local_compute_div_boundary_face(
 template<int dim, typename Number>
 void
 DivergenceAndMassErrorCalculator<dim, Number>::analyze_div_and_mass_error_unsteady(
-  VectorType const & velocity,
-  double const       time)
+  double const time,
+  Number const div_error,
+  Number const div_error_reference,
+  Number const mass_error,
+  Number const mass_error_reference)
 {
-  Number div_error = 1.0, div_error_reference = 1.0, mass_error = 1.0, mass_error_reference = 1.0;
-
-  // calculate divergence and mass error
-  do_evaluate(
-    *matrix_free, velocity, div_error, div_error_reference, mass_error, mass_error_reference);
-
   Number div_error_normalized  = div_error / div_error_reference;
   Number mass_error_normalized = 1.0;
   if(mass_error_reference > 1.e-12)
@@ -273,14 +288,11 @@ DivergenceAndMassErrorCalculator<dim, Number>::analyze_div_and_mass_error_unstea
 template<int dim, typename Number>
 void
 DivergenceAndMassErrorCalculator<dim, Number>::analyze_div_and_mass_error_steady(
-  VectorType const & velocity)
+  Number const div_error,
+  Number const div_error_reference,
+  Number const mass_error,
+  Number const mass_error_reference)
 {
-  Number div_error = 1.0, div_error_reference = 1.0, mass_error = 1.0, mass_error_reference = 1.0;
-
-  // calculate divergence and mass error
-  do_evaluate(
-    *matrix_free, velocity, div_error, div_error_reference, mass_error, mass_error_reference);
-
   Number div_error_normalized  = div_error / div_error_reference;
   Number mass_error_normalized = 1.0;
   if(mass_error_reference > 1.e-12)
@@ -28,6 +28,7 @@
 // ExaDG
 #include <exadg/matrix_free/integrators.h>
 #include <exadg/postprocessor/time_control.h>
+#include <exadg/utilities/batched_reduction.h>
 #include <exadg/utilities/print_functions.h>
 
 namespace ExaDG
@@ -84,6 +85,16 @@ public:
   void
   evaluate(VectorType const & velocity, double const time, bool const unsteady);
 
+  /*
+   * Same as above, but the global reduction is deferred to the batch of reductions, i.e., the
+   * results are written once reductions.finish() has been called.
+   */
+  void
+  evaluate(VectorType const & velocity,
+           double const       time,
+           bool const         unsteady,
+           BatchedReduction & reductions);
+
   TimeControl time_control;
 
 private:
@@ -98,14 +109,14 @@ private:
    *
    *  Mass error: (1,|(um - up)*n|)_dOmegaI
    *  Reference value for mass error: (1,|0.5(um + up)*n|)_dOmegaI
+   *
+   *  The process-local contributions are registered for the global reduction in the order
+   *  given above. Returns the index of the first value.
    */
-  void
+  unsigned int
   do_evaluate(dealii::MatrixFree<dim, Number> const & matrix_free,
               VectorType const &                      velocity,
-              Number &                                div_error,
-              Number &                                div_error_reference,
-              Number &                                mass_error,
-              Number &                                mass_error_reference);
+              BatchedReduction &                      reductions);
 
   void
   local_compute_div(dealii::MatrixFree<dim, Number> const &       data,
@@ -127,10 +138,17 @@ private:
                                   const std::pair<unsigned int, unsigned int> &);
 
   void
-  analyze_div_and_mass_error_unsteady(VectorType const & velocity, double const time);
+  analyze_div_and_mass_error_unsteady(double const time,
+                                      Number const div_error,
+                                      Number const div_error_reference,
+                                      Number const mass_error,
+                                      Number const mass_error_reference);
 
   void
-  analyze_div_and_mass_error_steady(VectorType const & velocity);
+  analyze_div_and_mass_error_steady(Number const div_error,
+                                    Number const div_error_reference,
+                                    Number const mass_error,
+                                    Number const mass_error_reference);
 
   MPI_Comm const mpi_comm;
 
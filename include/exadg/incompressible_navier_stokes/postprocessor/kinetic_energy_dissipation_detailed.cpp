@@ -54,6 +54,20 @@ void
 KineticEnergyCalculatorDetailed<dim, Number>::evaluate(VectorType const & velocity,
                                                        double const       time,
                                                        bool const         unsteady)
+{
+  BatchedReduction reductions(this->mpi_comm);
+
+  evaluate(velocity, time, unsteady, reductions);
+
+  reductions.resolve();
+}
+
+template<int dim, typename Number>
+void
+KineticEnergyCalculatorDetailed<dim, Number>::evaluate(VectorType const & velocity,
+                                                       double const       time,
+                                                       bool const         unsteady,
+                                                       BatchedReduction & reductions)
 {
   AssertThrow(unsteady,
               dealii::ExcMessage(
@@ -62,7 +76,7 @@ KineticEnergyCalculatorDetailed<dim, Number>::evaluate(VectorType const & veloci
   if(this->data.evaluate_individual_terms)
     calculate_detailed(velocity, time);
   else
-    this->calculate_basic(velocity, time);
+    this->calculate_basic(velocity, time, reductions);
 }
 
 template<int dim, typename Number>
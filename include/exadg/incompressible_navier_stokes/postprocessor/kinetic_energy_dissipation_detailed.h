@@ -52,6 +52,16 @@ public:
   void
   evaluate(VectorType const & velocity, double const time, bool const unsteady);
 
+  /*
+   * Same as above, but the global reductions of the basic quantities are deferred to the given
+   * batch. The detailed analysis of individual terms is always evaluated immediately.
+   */
+  void
+  evaluate(VectorType const & velocity,
+           double const       time,
+           bool const         unsteady,
+           BatchedReduction & reductions);
+
 private:
   void
   calculate_detailed(VectorType const & velocity, double const time);
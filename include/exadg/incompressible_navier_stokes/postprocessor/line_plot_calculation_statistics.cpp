@@ -19,11 +19,15 @@
  *  ______________________________________________________________________
  */
 
+// C/C++
+#include <sstream>
+
 // deal.II
 #include <deal.II/grid/grid_tools.h>
 
 // ExaDG
 #include <exadg/incompressible_navier_stokes/postprocessor/line_plot_calculation_statistics.h>
+#include <exadg/time_integration/restart.h>
 #include <exadg/utilities/create_directories.h>
 #include <exadg/vector_tools/interpolate_solution.h>
 
@@ -65,8 +69,8 @@ LinePlotCalculatorStatistics<dim, Number>::setup(LinePlotDataStatistics<dim> con
     AssertThrow(data.lines.size() > 0, dealii::ExcMessage("Empty data"));
 
     // allocate data structures
-    velocity_global.resize(data.lines.size());
-    pressure_global.resize(data.lines.size());
+    velocity_statistics.resize(data.lines.size());
+    pressure_statistics.resize(data.lines.size());
     global_points.resize(data.lines.size());
     cells_global_velocity.resize(data.lines.size());
     cells_global_pressure.resize(data.lines.size());
@@ -77,8 +81,8 @@ LinePlotCalculatorStatistics<dim, Number>::setup(LinePlotDataStatistics<dim> con
         ++line, ++line_iterator)
     {
       // Resize global variables for number of points on line
-      velocity_global[line_iterator].resize((*line)->n_points);
-      pressure_global[line_iterator].resize((*line)->n_points);
+      velocity_statistics[line_iterator].reinit((*line)->n_points, dim);
+      pressure_statistics[line_iterator].reinit((*line)->n_points, 1);
 
       // initialize global_points: use/assume equidistant points along line
       for(unsigned int i = 0; i < (*line)->n_points; ++i)
@@ -93,6 +97,9 @@ LinePlotCalculatorStatistics<dim, Number>::setup(LinePlotDataStatistics<dim> con
     }
 
     create_directories(data.directory, mpi_comm);
+
+    if(data.time_control_data_statistics.read_restart)
+      read_restart();
   }
 }
 
@@ -326,13 +333,6 @@ LinePlotCalculatorStatistics<dim, Number>::do_evaluate_velocity(VectorType const
                                                                 Line<dim> const &  line,
                                                                 unsigned int const line_iterator)
 {
-  // Local variables for the current line:
-
-  // for all points along the line: velocity vector
-  std::vector<dealii::Tensor<1, dim, Number>> velocity_vector_local(line.n_points);
-  // for all points along the line: counter
-  std::vector<unsigned int> counter_vector_local(line.n_points);
-
   for(unsigned int p = 0; p < line.n_points; ++p)
   {
     auto & adjacent_cells(cells_global_velocity[line_iterator][p]);
@@ -340,9 +340,6 @@ LinePlotCalculatorStatistics<dim, Number>::do_evaluate_velocity(VectorType const
     // loop over all adjacent, locally owned cells for the current point
     for(auto iter = adjacent_cells.begin(); iter != adjacent_cells.end(); ++iter)
     {
-      // increment counter (because this is a locally owned cell)
-      counter_vector_local[p] += 1;
-
       for(typename std::vector<std::shared_ptr<Quantity>>::const_iterator quantity =
             line.quantities.begin();
           quantity != line.quantities.end();
@@ -354,8 +351,14 @@ LinePlotCalculatorStatistics<dim, Number>::do_evaluate_velocity(VectorType const
           dealii::Tensor<1, dim, Number> velocity_value = Interpolator<1, dim, Number>::value(
             dof_handler_velocity, velocity, iter->first, iter->second);
 
-          // add result to array with velocity values
-          velocity_vector_local[p] += velocity_value;
+          // Accumulate instantaneous values of all adjacent cells with the same weight. This gives
+          // the average over all adjacent cells and time samples. Cells are distributed over
+          // processors, the contributions of all processors are summed when writing the output.
+          double values[dim];
+          for(unsigned int d = 0; d < dim; ++d)
+            values[d] = velocity_value[d];
+
+          velocity_statistics[line_iterator].add_sample(p, values);
         }
         else
         {
@@ -364,47 +367,6 @@ LinePlotCalculatorStatistics<dim, Number>::do_evaluate_velocity(VectorType const
       }
     }
   }
-
-  // Cells are distributed over processors, therefore we need
-  // to sum the contributions of every single processor.
-  dealii::Utilities::MPI::sum(counter_vector_local, mpi_comm, counter_vector_local);
-
-  // Perform MPI communcation as well as averaging for all quantities of the current line.
-  for(typename std::vector<std::shared_ptr<Quantity>>::const_iterator quantity =
-        line.quantities.begin();
-      quantity != line.quantities.end();
-      ++quantity)
-  {
-    if((*quantity)->type == QuantityType::Velocity)
-    {
-      dealii::Utilities::MPI::sum(dealii::ArrayView<Number const>(&velocity_vector_local[0][0],
-                                                                  dim *
-                                                                    velocity_vector_local.size()),
-                                  mpi_comm,
-                                  dealii::ArrayView<Number>(&velocity_vector_local[0][0],
-                                                            dim * velocity_vector_local.size()));
-
-      // Accumulate instantaneous values into global vector.
-      // When writing the output files, we calculate the time-averaged values
-      // by dividing the global (accumulated) values by the number of samples.
-      for(unsigned int p = 0; p < line.n_points; ++p)
-      {
-        // Take average value over all adjacent cells for a given point.
-        for(unsigned int d = 0; d < dim; ++d)
-        {
-          if(counter_vector_local[p] > 0)
-          {
-            velocity_global[line_iterator][p][d] +=
-              velocity_vector_local[p][d] / counter_vector_local[p];
-          }
-        }
-      }
-    }
-    else
-    {
-      AssertThrow(false, dealii::ExcMessage("Not implemented."));
-    }
-  }
 }
 
 template<int dim, typename Number>
@@ -413,13 +375,6 @@ LinePlotCalculatorStatistics<dim, Number>::do_evaluate_pressure(VectorType const
                                                                 Line<dim> const &  line,
                                                                 unsigned int const line_iterator)
 {
-  // Local variables for the current line:
-
-  // for all points along the line: pressure value
-  std::vector<Number> pressure_vector_local(line.n_points);
-  // for all points along the line: counter
-  std::vector<unsigned int> counter_vector_local(line.n_points);
-
   for(unsigned int p = 0; p < line.n_points; ++p)
   {
     auto & adjacent_cells(cells_global_pressure[line_iterator][p]);
@@ -427,9 +382,6 @@ LinePlotCalculatorStatistics<dim, Number>::do_evaluate_pressure(VectorType const
     // loop over all adjacent, locally owned cells for the current point
     for(auto iter = adjacent_cells.begin(); iter != adjacent_cells.end(); ++iter)
     {
-      // increment counter (because this is a locally owned cell)
-      counter_vector_local[p] += 1;
-
       for(typename std::vector<std::shared_ptr<Quantity>>::const_iterator quantity =
             line.quantities.begin();
           quantity != line.quantities.end();
@@ -438,13 +390,13 @@ LinePlotCalculatorStatistics<dim, Number>::do_evaluate_pressure(VectorType const
         if((*quantity)->type == QuantityType::Pressure)
         {
           // interpolate solution using the precomputed shape values and the global dof index
-          Number pressure_value = Interpolator<0, dim, Number>::value(dof_handler_pressure,
-                                                                      pressure,
-                                                                      iter->first,
-                                                                      iter->second);
+          double const pressure_value = Interpolator<0, dim, Number>::value(dof_handler_pressure,
+                                                                            pressure,
+                                                                            iter->first,
+                                                                            iter->second);
 
-          // add result to array with pressure values
-          pressure_vector_local[p] += pressure_value;
+          // accumulate instantaneous values of all adjacent cells (see above)
+          pressure_statistics[line_iterator].add_sample(p, &pressure_value);
         }
         else
         {
@@ -453,46 +405,29 @@ LinePlotCalculatorStatistics<dim, Number>::do_evaluate_pressure(VectorType const
       }
     }
   }
-
-  // Cells are distributed over processors, therefore we need
-  // to sum the contributions of every single processor.
-  dealii::Utilities::MPI::sum(counter_vector_local, mpi_comm, counter_vector_local);
-
-  // Perform MPI communcation as well as averaging for all quantities of the current line.
-  for(typename std::vector<std::shared_ptr<Quantity>>::const_iterator quantity =
-        line.quantities.begin();
-      quantity != line.quantities.end();
-      ++quantity)
-  {
-    if((*quantity)->type == QuantityType::Pressure)
-    {
-      dealii::Utilities::MPI::sum(pressure_vector_local, mpi_comm, pressure_vector_local);
-
-      // Accumulate instantaneous values into global vector.
-      // When writing the output files, we calculate the time-averaged values
-      // by dividing the global (accumulated) values by the number of samples.
-      for(unsigned int p = 0; p < line.n_points; ++p)
-      {
-        // Take average value over all adjacent cells for a given point.
-        if(counter_vector_local[p] > 0)
-        {
-          pressure_global[line_iterator][p] += pressure_vector_local[p] / counter_vector_local[p];
-        }
-      }
-    }
-    else
-    {
-      AssertThrow(false, dealii::ExcMessage("Not implemented."));
-    }
-  }
 }
 
 template<int dim, typename Number>
 void
 LinePlotCalculatorStatistics<dim, Number>::do_write_output() const
 {
+  // Cells are distributed over processors, therefore we need to merge the contributions of every
+  // single processor. This is done for all lines and quantities at once.
+  std::vector<MomentAccumulator const *> statistics_local;
+  for(unsigned int i = 0; i < data.lines.size(); ++i)
+  {
+    statistics_local.push_back(&velocity_statistics[i]);
+    statistics_local.push_back(&pressure_statistics[i]);
+  }
+
+  std::vector<MomentAccumulator> const statistics =
+    MomentAccumulator::reduce(statistics_local, mpi_comm);
+
   if(dealii::Utilities::MPI::this_mpi_process(mpi_comm) == 0)
   {
+    if(data.time_control_data_statistics.write_restart)
+      write_restart(statistics);
+
     unsigned int const precision = data.precision;
 
     // Iterator for lines
@@ -503,6 +438,9 @@ LinePlotCalculatorStatistics<dim, Number>::do_write_output() const
     {
       std::string filename_prefix = data.directory + (*line)->name;
 
+      MomentAccumulator const & velocity = statistics[2 * line_iterator];
+      MomentAccumulator const & pressure = statistics[2 * line_iterator + 1];
+
       for(typename std::vector<std::shared_ptr<Quantity>>::const_iterator quantity =
             (*line)->quantities.begin();
           quantity != (*line)->quantities.end();
@@ -542,10 +480,9 @@ LinePlotCalculatorStatistics<dim, Number>::do_write_output() const
             for(unsigned int d = 0; d < dim; ++d)
               f << std::setw(precision + 8) << std::left << global_points[line_iterator][p][d];
 
-            // write velocity and average over time
+            // write velocity averaged over time
             for(unsigned int d = 0; d < dim; ++d)
-              f << std::setw(precision + 8) << std::left
-                << velocity_global[line_iterator][p][d] / number_of_samples;
+              f << std::setw(precision + 8) << std::left << velocity.mean(p, d);
 
             f << std::endl;
           }
@@ -594,8 +531,7 @@ LinePlotCalculatorStatistics<dim, Number>::do_write_output() const
             for(unsigned int d = 0; d < dim; ++d)
               f << std::setw(precision + 8) << std::left << global_points[line_iterator][p][d];
 
-            f << std::setw(precision + 8) << std::left
-              << pressure_global[line_iterator][p] / number_of_samples;
+            f << std::setw(precision + 8) << std::left << pressure.mean(p, 0);
 
             f << std::endl;
           }
@@ -611,6 +547,59 @@ LinePlotCalculatorStatistics<dim, Number>::do_write_output() const
   }
 }
 
+template<int dim, typename Number>
+std::string
+LinePlotCalculatorStatistics<dim, Number>::get_restart_filename() const
+{
+  return data.directory + "line_plot_statistics.restart";
+}
+
+template<int dim, typename Number>
+void
+LinePlotCalculatorStatistics<dim, Number>::write_restart(
+  std::vector<MomentAccumulator> const & statistics_global) const
+{
+  std::string const filename = get_restart_filename();
+
+  rename_restart_files(filename);
+
+  std::ostringstream              oss;
+  boost::archive::binary_oarchive oa(oss);
+
+  oa & number_of_samples;
+  for(unsigned int i = 0; i < statistics_global.size(); ++i)
+    statistics_global[i].write_restart(oa);
+
+  write_restart_file(oss, filename);
+}
+
+/*
+ *  The global statistics are read on the first processor only and merged with the data of all
+ *  other processors when writing the output.
+ */
+template<int dim, typename Number>
+void
+LinePlotCalculatorStatistics<dim, Number>::read_restart()
+{
+  if(dealii::Utilities::MPI::this_mpi_process(mpi_comm) == 0)
+  {
+    std::string const filename = get_restart_filename();
+    std::ifstream     in(filename);
+    AssertThrow(in, dealii::ExcMessage("File " + filename + " does not exist."));
+
+    boost::archive::binary_iarchive ia(in);
+
+    ia & number_of_samples;
+    for(unsigned int i = 0; i < data.lines.size(); ++i)
+    {
+      velocity_statistics[i].read_restart(ia);
+      pressure_statistics[i].read_restart(ia);
+    }
+  }
+
+  number_of_samples = dealii::Utilities::MPI::max(number_of_samples, mpi_comm);
+}
+
 template class LinePlotCalculatorStatistics<2, float>;
 template class LinePlotCalculatorStatistics<3, float>;
 
@@ -32,6 +32,7 @@
 
 // ExaDG
 #include <exadg/incompressible_navier_stokes/postprocessor/line_plot_data.h>
+#include <exadg/postprocessor/moment_accumulator.h>
 #include <exadg/postprocessor/time_control.h>
 
 namespace ExaDG
@@ -57,6 +58,9 @@ namespace IncNS
  *    circle, and that the other points in circumferential direction can be constructed by rotating
  *    the vector from the center of the circle (line.begin) to the current point along the line
  *    around the normal vector.
+ *
+ * The samples are accumulated on each processor and only reduced over all processors when writing
+ * the output.
  */
 
 template<int dim, typename Number>
@@ -111,6 +115,15 @@ private:
   void
   do_write_output() const;
 
+  std::string
+  get_restart_filename() const;
+
+  void
+  write_restart(std::vector<MomentAccumulator> const & statistics_global) const;
+
+  void
+  read_restart();
+
   mutable bool clear_files;
 
   dealii::DoFHandler<dim> const & dof_handler_velocity;
@@ -141,12 +154,12 @@ private:
   unsigned int number_of_samples;
 
   // Velocity quantities
-  // For all lines: for all points along the line
-  std::vector<std::vector<dealii::Tensor<1, dim, Number>>> velocity_global;
+  // For all lines: process-local moments for all points along the line
+  std::vector<MomentAccumulator> velocity_statistics;
 
   // Pressure quantities
-  // For all lines: for all points along the line
-  std::vector<std::vector<Number>> pressure_global;
+  // For all lines: process-local moments for all points along the line
+  std::vector<MomentAccumulator> pressure_statistics;
 
   bool write_final_output;
 };
@@ -19,11 +19,15 @@
  *  ______________________________________________________________________
  */
 
+// C/C++
+#include <sstream>
+
 // deal.II
 #include <deal.II/fe/fe_values.h>
 
 // ExaDG
 #include <exadg/incompressible_navier_stokes/postprocessor/line_plot_calculation_statistics_homogeneous.h>
+#include <exadg/time_integration/restart.h>
 #include <exadg/utilities/create_directories.h>
 
 namespace ExaDG
@@ -70,11 +74,10 @@ LinePlotCalculatorStatisticsHomogeneous<dim, Number>::setup(
     cells_and_ref_points_pressure.resize(data.lines.size());
     cells_and_ref_points_ref_pressure.resize(data.lines.size());
 
-    velocity_global.resize(data.lines.size());
-    wall_shear_global.resize(data.lines.size());
-    reynolds_global.resize(data.lines.size());
-    pressure_global.resize(data.lines.size());
-    reference_pressure_global.resize(data.lines.size());
+    velocity_statistics.resize(data.lines.size());
+    wall_shear_statistics.resize(data.lines.size());
+    pressure_statistics.resize(data.lines.size());
+    reference_pressure_statistics.resize(data.lines.size());
 
     // make sure that line type is correct
     std::shared_ptr<LineHomogeneousAveraging<dim>> line_hom =
@@ -102,10 +105,10 @@ LinePlotCalculatorStatisticsHomogeneous<dim, Number>::setup(
                   dealii::ExcMessage("All lines must use the same averaging direction."));
 
       // Resize global variables for # of points on line
-      velocity_global[line_iterator].resize((*line)->n_points);
-      pressure_global[line_iterator].resize((*line)->n_points);
-      wall_shear_global[line_iterator].resize((*line)->n_points);
-      reynolds_global[line_iterator].resize((*line)->n_points);
+      velocity_statistics[line_iterator].reinit((*line)->n_points, dim);
+      pressure_statistics[line_iterator].reinit((*line)->n_points, 1);
+      wall_shear_statistics[line_iterator].reinit((*line)->n_points, 1);
+      reference_pressure_statistics[line_iterator].reinit(1, 1);
       cells_and_ref_points_velocity[line_iterator].resize((*line)->n_points);
       cells_and_ref_points_pressure[line_iterator].resize((*line)->n_points);
 
@@ -317,6 +320,9 @@ LinePlotCalculatorStatisticsHomogeneous<dim, Number>::setup(
     }
 
     create_directories(data.directory, mpi_comm);
+
+    if(data.time_control_data_statistics.read_restart)
+      read_restart();
   }
 }
 
@@ -400,11 +406,24 @@ LinePlotCalculatorStatisticsHomogeneous<dim, Number>::do_evaluate_velocity(
   Line<dim> const &  line,
   unsigned int const line_iterator)
 {
-  // Local variables for specific line
-  std::vector<double>                         length_local(line.n_points);
-  std::vector<dealii::Tensor<1, dim, double>> velocity_local(line.n_points);
-  std::vector<double>                         wall_shear_local(line.n_points);
-  std::vector<dealii::Tensor<2, dim, double>> reynolds_local(line.n_points);
+  // find out which quantities have to be evaluated
+  bool                                       evaluate_velocity      = false;
+  std::shared_ptr<QuantitySkinFriction<dim>> quantity_skin_friction = nullptr;
+  for(typename std::vector<std::shared_ptr<Quantity>>::const_iterator quantity =
+        line.quantities.begin();
+      quantity != line.quantities.end();
+      ++quantity)
+  {
+    if((*quantity)->type == QuantityType::Velocity ||
+       (*quantity)->type == QuantityType::ReynoldsStresses)
+    {
+      evaluate_velocity = true;
+    }
+    else if((*quantity)->type == QuantityType::SkinFriction)
+    {
+      quantity_skin_friction = std::dynamic_pointer_cast<QuantitySkinFriction<dim>>(*quantity);
+    }
+  }
 
   unsigned int const scalar_dofs_per_cell =
     dof_handler_velocity.get_fe().base_element(0).dofs_per_cell;
@@ -455,122 +474,51 @@ LinePlotCalculatorStatisticsHomogeneous<dim, Number>::do_evaluate_velocity(
           velocity_vector[comp.second][comp.first] = velocity(dof_indices[j]);
       }
 
-      // perform averaging in homogeneous direction
+      // perform averaging in homogeneous direction: the values in all quadrature points are
+      // accumulated with weight JxW, which gives the average over the homogeneous direction and
+      // time. Cells are distributed over processors, the contributions of all processors are
+      // merged when writing the output.
       for(unsigned int q = 0; q < fe_values.n_quadrature_points; ++q)
       {
         double det = std::abs(fe_values.jacobian(q)[averaging_direction][averaging_direction]);
         double JxW = det * fe_values.get_quadrature().weight(q);
 
-        // calculate integrals in homogeneous direction
-        length_local[p] += JxW;
-
-        for(typename std::vector<std::shared_ptr<Quantity>>::const_iterator quantity =
-              line.quantities.begin();
-            quantity != line.quantities.end();
-            ++quantity)
+        // mean velocity and Reynolds stresses
+        if(evaluate_velocity)
         {
+          // evaluate velocity solution in current quadrature points
           dealii::Tensor<1, dim> velocity;
+          for(unsigned int j = 0; j < velocity_vector.size(); ++j)
+            velocity += fe_values.shape_value(j, q) * velocity_vector[j];
 
-          if((*quantity)->type == QuantityType::Velocity ||
-             (*quantity)->type == QuantityType::ReynoldsStresses)
-          {
-            // evaluate velocity solution in current quadrature points
-            for(unsigned int j = 0; j < velocity_vector.size(); ++j)
-              velocity += fe_values.shape_value(j, q) * velocity_vector[j];
-          }
-
-          if((*quantity)->type == QuantityType::Velocity)
-          {
-            for(unsigned int i = 0; i < dim; ++i)
-              velocity_local[p][i] += velocity[i] * JxW;
-          }
-          else if((*quantity)->type == QuantityType::ReynoldsStresses)
-          {
-            for(unsigned int i = 0; i < dim; ++i)
-            {
-              for(unsigned int j = 0; j < dim; ++j)
-              {
-                reynolds_local[p][i][j] += velocity[i] * velocity[j] * JxW;
-              }
-            }
-          }
-          else if((*quantity)->type == QuantityType::SkinFriction)
-          {
-            dealii::Tensor<2, dim> velocity_gradient;
-            for(unsigned int j = 0; j < velocity_vector.size(); ++j)
-              velocity_gradient += outer_product(velocity_vector[j], fe_values.shape_grad(j, q));
-
-            std::shared_ptr<QuantitySkinFriction<dim>> quantity_skin_friction =
-              std::dynamic_pointer_cast<QuantitySkinFriction<dim>>(*quantity);
-
-            dealii::Tensor<1, dim, double> normal  = quantity_skin_friction->normal_vector;
-            dealii::Tensor<1, dim, double> tangent = quantity_skin_friction->tangent_vector;
+          double values[dim];
+          for(unsigned int i = 0; i < dim; ++i)
+            values[i] = velocity[i];
 
-            for(unsigned int i = 0; i < dim; ++i)
-              for(unsigned int j = 0; j < dim; ++j)
-                wall_shear_local[p] += tangent[i] * velocity_gradient[i][j] * normal[j] * JxW;
-          }
+          velocity_statistics[line_iterator].add_sample(p, values, JxW);
         }
-      }
-    }
-  }
 
-  dealii::Utilities::MPI::sum(length_local, mpi_comm, length_local);
+        if(quantity_skin_friction)
+        {
+          dealii::Tensor<2, dim> velocity_gradient;
+          for(unsigned int j = 0; j < velocity_vector.size(); ++j)
+            velocity_gradient += outer_product(velocity_vector[j], fe_values.shape_grad(j, q));
 
-  for(typename std::vector<std::shared_ptr<Quantity>>::const_iterator quantity =
-        line.quantities.begin();
-      quantity != line.quantities.end();
-      ++quantity)
-  {
-    // Cells are distributed over processors, therefore we need
-    // to sum the contributions of every single processor.
-    if((*quantity)->type == QuantityType::Velocity)
-    {
-      dealii::Utilities::MPI::sum(
-        dealii::ArrayView<double const>(&velocity_local[0][0], dim * velocity_local.size()),
-        mpi_comm,
-        dealii::ArrayView<double>(&velocity_local[0][0], dim * velocity_local.size()));
+          dealii::Tensor<1, dim, double> normal  = quantity_skin_friction->normal_vector;
+          dealii::Tensor<1, dim, double> tangent = quantity_skin_friction->tangent_vector;
 
-      for(unsigned int p = 0; p < line.n_points; ++p)
-      {
-        for(unsigned int d = 0; d < dim; ++d)
-        {
-          velocity_global[line_iterator][p][d] += velocity_local[p][d] / length_local[p];
-        }
-      }
-    }
-    else if((*quantity)->type == QuantityType::ReynoldsStresses)
-    {
-      dealii::Utilities::MPI::sum(
-        dealii::ArrayView<double const>(&reynolds_local[0][0][0],
-                                        dim * dim * reynolds_local.size()),
-        mpi_comm,
-        dealii::ArrayView<double>(&reynolds_local[0][0][0], dim * dim * reynolds_local.size()));
+          double wall_shear = 0.0;
+          for(unsigned int i = 0; i < dim; ++i)
+            for(unsigned int j = 0; j < dim; ++j)
+              wall_shear += tangent[i] * velocity_gradient[i][j] * normal[j];
 
-      for(unsigned int p = 0; p < line.n_points; ++p)
-      {
-        for(unsigned int i = 0; i < dim; ++i)
-        {
-          for(unsigned int j = 0; j < dim; ++j)
-          {
-            reynolds_global[line_iterator][p][i][j] += reynolds_local[p][i][j] / length_local[p];
-          }
+          wall_shear_statistics[line_iterator].add_sample(p, &wall_shear, JxW);
         }
       }
     }
-    else if((*quantity)->type == QuantityType::SkinFriction)
-    {
-      dealii::Utilities::MPI::sum(wall_shear_local, mpi_comm, wall_shear_local);
-
-      for(unsigned int p = 0; p < line.n_points; ++p)
-      {
-        wall_shear_global[line_iterator][p] += wall_shear_local[p] / length_local[p];
-      }
-    }
   }
 }
 
-
 template<int dim, typename Number>
 void
 LinePlotCalculatorStatisticsHomogeneous<dim, Number>::do_evaluate_pressure(
@@ -585,47 +533,21 @@ LinePlotCalculatorStatisticsHomogeneous<dim, Number>::do_evaluate_pressure(
   {
     if((*quantity)->type == QuantityType::Pressure)
     {
-      // Local variables for specific line
-      std::vector<double> length_local(line.n_points);
-      std::vector<double> pressure_local(line.n_points);
-
       for(unsigned int p = 0; p < line.n_points; ++p)
       {
-        TYPE vector_cells_and_ref_points = cells_and_ref_points_pressure[line_iterator][p];
-
         average_pressure_for_given_point(pressure,
-                                         vector_cells_and_ref_points,
-                                         length_local[p],
-                                         pressure_local[p]);
+                                         cells_and_ref_points_pressure[line_iterator][p],
+                                         pressure_statistics[line_iterator],
+                                         p);
       }
-
-      // MPI communication
-      dealii::Utilities::MPI::sum(length_local, mpi_comm, length_local);
-      dealii::Utilities::MPI::sum(pressure_local, mpi_comm, pressure_local);
-
-      // averaging in space (over homogeneous direction)
-      for(unsigned int p = 0; p < line.n_points; ++p)
-        pressure_global[line_iterator][p] += pressure_local[p] / length_local[p];
     }
 
     if((*quantity)->type == QuantityType::PressureCoefficient)
     {
-      double length_local   = 0.0;
-      double pressure_local = 0.0;
-
-      TYPE vector_cells_and_ref_points = cells_and_ref_points_ref_pressure[line_iterator];
-
       average_pressure_for_given_point(pressure,
-                                       vector_cells_and_ref_points,
-                                       length_local,
-                                       pressure_local);
-
-      // MPI communication
-      length_local   = dealii::Utilities::MPI::sum(length_local, mpi_comm);
-      pressure_local = dealii::Utilities::MPI::sum(pressure_local, mpi_comm);
-
-      // averaging in space (over homogeneous direction)
-      reference_pressure_global[line_iterator] += pressure_local / length_local;
+                                       cells_and_ref_points_ref_pressure[line_iterator],
+                                       reference_pressure_statistics[line_iterator],
+                                       0);
     }
   }
 }
@@ -633,10 +555,10 @@ LinePlotCalculatorStatisticsHomogeneous<dim, Number>::do_evaluate_pressure(
 template<int dim, typename Number>
 void
 LinePlotCalculatorStatisticsHomogeneous<dim, Number>::average_pressure_for_given_point(
-  VectorType const & pressure,
-  TYPE const &       vector_cells_and_ref_points,
-  double &           length_local,
-  double &           pressure_local)
+  VectorType const &  pressure,
+  TYPE const &        vector_cells_and_ref_points,
+  MomentAccumulator & statistics,
+  unsigned int const  location)
 {
   unsigned int const scalar_dofs_per_cell =
     dof_handler_pressure.get_fe().base_element(0).dofs_per_cell;
@@ -685,8 +607,7 @@ LinePlotCalculatorStatisticsHomogeneous<dim, Number>::average_pressure_for_given
       double det = std::abs(fe_values.jacobian(q)[averaging_direction][averaging_direction]);
       double JxW = det * fe_values.get_quadrature().weight(q);
 
-      length_local += JxW;
-      pressure_local += p * JxW;
+      statistics.add_sample(location, &p, JxW);
     }
   }
 }
@@ -717,8 +638,25 @@ template<int dim, typename Number>
 void
 LinePlotCalculatorStatisticsHomogeneous<dim, Number>::do_write_output() const
 {
+  // Cells are distributed over processors, therefore we need to merge the contributions of every
+  // single processor. This is done for all lines and quantities at once.
+  std::vector<MomentAccumulator const *> statistics_local;
+  for(unsigned int i = 0; i < data.lines.size(); ++i)
+  {
+    statistics_local.push_back(&velocity_statistics[i]);
+    statistics_local.push_back(&wall_shear_statistics[i]);
+    statistics_local.push_back(&pressure_statistics[i]);
+    statistics_local.push_back(&reference_pressure_statistics[i]);
+  }
+
+  std::vector<MomentAccumulator> const statistics =
+    MomentAccumulator::reduce(statistics_local, mpi_comm);
+
   if(dealii::Utilities::MPI::this_mpi_process(mpi_comm) == 0)
   {
+    if(data.time_control_data_statistics.write_restart)
+      write_restart(statistics);
+
     unsigned int const precision = data.precision;
 
     // Iterator for lines
@@ -729,6 +667,11 @@ LinePlotCalculatorStatisticsHomogeneous<dim, Number>::do_write_output() const
     {
       std::string filename_prefix = data.directory + (*line)->name;
 
+      MomentAccumulator const & velocity           = statistics[4 * line_iterator];
+      MomentAccumulator const & wall_shear         = statistics[4 * line_iterator + 1];
+      MomentAccumulator const & pressure           = statistics[4 * line_iterator + 2];
+      MomentAccumulator const & reference_pressure = statistics[4 * line_iterator + 3];
+
       for(typename std::vector<std::shared_ptr<Quantity>>::const_iterator quantity =
             (*line)->quantities.begin();
           quantity != (*line)->quantities.end();
@@ -767,10 +710,9 @@ LinePlotCalculatorStatisticsHomogeneous<dim, Number>::do_write_output() const
             for(unsigned int d = 0; d < dim; ++d)
               f << std::setw(precision + 8) << std::left << global_points[line_iterator][p][d];
 
-            // write velocity and average over time
+            // write velocity averaged over time
             for(unsigned int d = 0; d < dim; ++d)
-              f << std::setw(precision + 8) << std::left
-                << velocity_global[line_iterator][p][d] / number_of_samples;
+              f << std::setw(precision + 8) << std::left << velocity.mean(p, d);
 
             f << std::endl;
           }
@@ -819,11 +761,8 @@ LinePlotCalculatorStatisticsHomogeneous<dim, Number>::do_write_output() const
             {
               for(unsigned int j = 0; j < dim; ++j)
               {
-                // equation <u_i' u_j'> = <u_i*u_j> - <u_i> * <u_j>
-                f << std::setw(precision + 8) << std::left
-                  << reynolds_global[line_iterator][p][i][j] / number_of_samples -
-                       (velocity_global[line_iterator][p][i] / number_of_samples) *
-                         (velocity_global[line_iterator][p][j] / number_of_samples);
+                // <u_i' u_j'>
+                f << std::setw(precision + 8) << std::left << velocity.covariance(p, i, j);
               }
             }
 
@@ -867,8 +806,7 @@ LinePlotCalculatorStatisticsHomogeneous<dim, Number>::do_write_output() const
 
             // tau_w -> C_f = tau_w / (1/2 rho u²)
             double const viscosity = averaging_quantity->viscosity;
-            f << std::setw(precision + 8) << std::left
-              << viscosity * wall_shear_global[line_iterator][p] / number_of_samples;
+            f << std::setw(precision + 8) << std::left << viscosity * wall_shear.mean(p, 0);
 
             f << std::endl;
           }
@@ -910,15 +848,12 @@ LinePlotCalculatorStatisticsHomogeneous<dim, Number>::do_write_output() const
             for(unsigned int d = 0; d < dim; ++d)
               f << std::setw(precision + 8) << std::left << global_points[line_iterator][p][d];
 
-            f << std::setw(precision + 8) << std::left
-              << pressure_global[line_iterator][p] / number_of_samples;
+            f << std::setw(precision + 8) << std::left << pressure.mean(p, 0);
 
             if((*quantity)->type == QuantityType::PressureCoefficient)
             {
               // p - p_ref -> C_p = (p - p_ref) / (1/2 rho u²)
-              f << std::left
-                << (pressure_global[line_iterator][p] - reference_pressure_global[line_iterator]) /
-                     number_of_samples;
+              f << std::left << pressure.mean(p, 0) - reference_pressure.mean(0, 0);
             }
             f << std::endl;
           }
@@ -929,6 +864,61 @@ LinePlotCalculatorStatisticsHomogeneous<dim, Number>::do_write_output() const
   }
 }
 
+template<int dim, typename Number>
+std::string
+LinePlotCalculatorStatisticsHomogeneous<dim, Number>::get_restart_filename() const
+{
+  return data.directory + "line_plot_statistics_homogeneous.restart";
+}
+
+template<int dim, typename Number>
+void
+LinePlotCalculatorStatisticsHomogeneous<dim, Number>::write_restart(
+  std::vector<MomentAccumulator> const & statistics_global) const
+{
+  std::string const filename = get_restart_filename();
+
+  rename_restart_files(filename);
+
+  std::ostringstream              oss;
+  boost::archive::binary_oarchive oa(oss);
+
+  oa & number_of_samples;
+  for(unsigned int i = 0; i < statistics_global.size(); ++i)
+    statistics_global[i].write_restart(oa);
+
+  write_restart_file(oss, filename);
+}
+
+/*
+ *  The global statistics are read on the first processor only and merged with the data of all
+ *  other processors when writing the output.
+ */
+template<int dim, typename Number>
+void
+LinePlotCalculatorStatisticsHomogeneous<dim, Number>::read_restart()
+{
+  if(dealii::Utilities::MPI::this_mpi_process(mpi_comm) == 0)
+  {
+    std::string const filename = get_restart_filename();
+    std::ifstream     in(filename);
+    AssertThrow(in, dealii::ExcMessage("File " + filename + " does not exist."));
+
+    boost::archive::binary_iarchive ia(in);
+
+    ia & number_of_samples;
+    for(unsigned int i = 0; i < data.lines.size(); ++i)
+    {
+      velocity_statistics[i].read_restart(ia);
+      wall_shear_statistics[i].read_restart(ia);
+      pressure_statistics[i].read_restart(ia);
+      reference_pressure_statistics[i].read_restart(ia);
+    }
+  }
+
+  number_of_samples = dealii::Utilities::MPI::max(number_of_samples, mpi_comm);
+}
+
 template class LinePlotCalculatorStatisticsHomogeneous<2, float>;
 template class LinePlotCalculatorStatisticsHomogeneous<3, float>;
 
@@ -32,6 +32,7 @@
 
 // ExaDG
 #include <exadg/incompressible_navier_stokes/postprocessor/line_plot_data.h>
+#include <exadg/postprocessor/moment_accumulator.h>
 #include <exadg/postprocessor/time_control.h>
 
 namespace ExaDG
@@ -45,6 +46,9 @@ namespace IncNS
  *
  * NOTE: This function just works for geometries/meshes for which the cells are aligned with the
  * coordinate axis.
+ *
+ * The samples are accumulated on each processor and only reduced over all processors when writing
+ * the output.
  */
 
 // TODO Adapt code to geometries whose elements are not aligned with the coordinate axis.
@@ -93,10 +97,10 @@ private:
                        unsigned int const line_iterator);
 
   void
-  average_pressure_for_given_point(VectorType const & pressure,
-                                   TYPE const &       vector_cells_and_ref_points,
-                                   double &           length_local,
-                                   double &           pressure_local);
+  average_pressure_for_given_point(VectorType const &  pressure,
+                                   TYPE const &        vector_cells_and_ref_points,
+                                   MomentAccumulator & statistics,
+                                   unsigned int const  location);
 
   void
   find_points_and_weights(dealii::Point<dim> const &        point_in_ref_coord,
@@ -108,6 +112,15 @@ private:
   void
   do_write_output() const;
 
+  std::string
+  get_restart_filename() const;
+
+  void
+  write_restart(std::vector<MomentAccumulator> const & statistics_global) const;
+
+  void
+  read_restart();
+
   mutable bool clear_files;
 
   dealii::DoFHandler<dim> const & dof_handler_velocity;
@@ -144,23 +157,19 @@ private:
   // homogeneous direction for averaging in space
   unsigned int averaging_direction;
 
-  // Velocity quantities
-  // For all lines: for all points along the line
-  std::vector<std::vector<dealii::Tensor<1, dim, double>>> velocity_global;
+  // Velocity quantities (mean velocity and Reynolds stresses)
+  // For all lines: process-local moments for all points along the line
+  std::vector<MomentAccumulator> velocity_statistics;
 
   // Skin Friction quantities
-  // For all lines: for all points along the line
-  std::vector<std::vector<double>> wall_shear_global;
-
-  // Reynolds Stress quantities
-  // For all lines: for all points along the line
-  std::vector<std::vector<dealii::Tensor<2, dim, double>>> reynolds_global;
+  // For all lines: process-local moments for all points along the line
+  std::vector<MomentAccumulator> wall_shear_statistics;
 
   // Pressure quantities
-  // For all lines: for all points along the line
-  std::vector<std::vector<double>> pressure_global;
-  // For all lines
-  std::vector<double> reference_pressure_global;
+  // For all lines: process-local moments for all points along the line
+  std::vector<MomentAccumulator> pressure_statistics;
+  // For all lines: process-local moments of the reference pressure
+  std::vector<MomentAccumulator> reference_pressure_statistics;
 
   // write final output
   bool write_final_output;
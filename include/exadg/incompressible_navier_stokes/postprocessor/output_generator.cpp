@@ -20,9 +20,11 @@
  */
 
 // C/C++
+#include <algorithm>
 #include <fstream>
 
 // deal.II
+#include <deal.II/base/timer.h>
 #include <deal.II/grid/grid_tools.h>
 #include <deal.II/numerics/data_out.h>
 
@@ -30,11 +32,24 @@
 #include <exadg/incompressible_navier_stokes/postprocessor/output_generator.h>
 #include <exadg/postprocessor/write_output.h>
 #include <exadg/utilities/create_directories.h>
+#include <exadg/utilities/print_solver_results.h>
 
 namespace ExaDG
 {
 namespace IncNS
 {
+void
+print_wall_time_build_patches(std::string const & method,
+                              double const        wall_time,
+                              MPI_Comm const &    mpi_comm)
+{
+  dealii::ConditionalOStream pcout(std::cout,
+                                   dealii::Utilities::MPI::this_mpi_process(mpi_comm) == 0);
+
+  pcout << std::endl << "Build patches (" << method << "):";
+  print_wall_time(pcout, dealii::Utilities::MPI::max(wall_time, mpi_comm));
+}
+
 template<int dim, typename Number>
 void
 write_output(
@@ -46,9 +61,10 @@ write_output(
   dealii::LinearAlgebra::distributed::Vector<Number> const &            pressure,
   std::vector<dealii::SmartPointer<SolutionField<dim, Number>>> const & additional_fields,
   unsigned int const                                                    output_counter,
+  double const                                                          time,
   MPI_Comm const &                                                      mpi_comm)
 {
-  std::string folder = output_data.directory, file = output_data.filename;
+  dealii::Timer timer;
 
   dealii::DataOutBase::VtkFlags flags;
   flags.write_higher_order_cells = output_data.write_higher_order;
@@ -111,7 +127,114 @@ write_output(
 
   data_out.build_patches(mapping, output_data.degree, dealii::DataOut<dim>::curved_inner_cells);
 
-  data_out.write_vtu_with_pvtu_record(folder, file, output_counter, mpi_comm, 4);
+  if(output_data.print_wall_time_build_patches)
+    print_wall_time_build_patches("DataOut", timer.wall_time(), mpi_comm);
+
+  write_patches(data_out, output_data, output_counter, time, mpi_comm);
+}
+
+/*
+ * Same as write_output() above, but the patches are built with the sum-factorization kernels of
+ * MatrixFree, see PatchBuilder.
+ */
+template<int dim, typename Number>
+void
+write_output_matrix_free(
+  OutputData const &                                                    output_data,
+  PatchBuilder<dim, Number> &                                           patch_builder,
+  dealii::DoFHandler<dim> const &                                       dof_handler_velocity,
+  dealii::DoFHandler<dim> const &                                       dof_handler_pressure,
+  dealii::Mapping<dim> const &                                          mapping,
+  dealii::LinearAlgebra::distributed::Vector<Number> const &            velocity,
+  dealii::LinearAlgebra::distributed::Vector<Number> const &            pressure,
+  std::vector<dealii::SmartPointer<SolutionField<dim, Number>>> const & additional_fields,
+  unsigned int const                                                    output_counter,
+  double const                                                          time,
+  MPI_Comm const &                                                      mpi_comm)
+{
+  dealii::Timer timer;
+
+  dealii::DataOutBase::VtkFlags flags;
+  flags.write_higher_order_cells = output_data.write_higher_order;
+  patch_builder.set_flags(flags);
+
+  std::vector<dealii::DoFHandler<dim> const *> dof_handlers = {&dof_handler_velocity,
+                                                               &dof_handler_pressure};
+  for(auto & additional_field : additional_fields)
+  {
+    if(additional_field->get_type() != SolutionFieldType::cellwise and
+       std::find(dof_handlers.begin(),
+                 dof_handlers.end(),
+                 &additional_field->get_dof_handler()) == dof_handlers.end())
+    {
+      dof_handlers.push_back(&additional_field->get_dof_handler());
+    }
+  }
+
+  // the MatrixFree object is only set up in the first output step, afterwards only the mapping is
+  // updated in order to support moving meshes
+  patch_builder.reinit(mapping, dof_handlers, output_data.degree);
+  patch_builder.clear_data_vectors();
+
+  std::vector<std::string> velocity_names(dim, "velocity");
+  std::vector<dealii::DataComponentInterpretation::DataComponentInterpretation>
+    velocity_component_interpretation(
+      dim, dealii::DataComponentInterpretation::component_is_part_of_vector);
+
+  patch_builder.add_data_vector(velocity,
+                                patch_builder.get_dof_index(dof_handler_velocity),
+                                velocity_names,
+                                velocity_component_interpretation);
+
+  patch_builder.add_data_vector(pressure, patch_builder.get_dof_index(dof_handler_pressure), "p");
+
+  if(output_data.write_aspect_ratio)
+  {
+    patch_builder.add_cell_data_vector(
+      dealii::GridTools::compute_aspect_ratio_of_cells(mapping,
+                                                       dof_handler_velocity.get_triangulation(),
+                                                       dealii::QGauss<dim>(4)),
+      "aspect_ratio");
+  }
+
+  for(auto & additional_field : additional_fields)
+  {
+    if(additional_field->get_type() == SolutionFieldType::scalar)
+    {
+      patch_builder.add_data_vector(additional_field->get(),
+                                    patch_builder.get_dof_index(
+                                      additional_field->get_dof_handler()),
+                                    additional_field->get_name());
+    }
+    else if(additional_field->get_type() == SolutionFieldType::cellwise)
+    {
+      patch_builder.add_cell_data_vector(additional_field->get(), additional_field->get_name());
+    }
+    else if(additional_field->get_type() == SolutionFieldType::vector)
+    {
+      std::vector<std::string> names(dim, additional_field->get_name());
+      std::vector<dealii::DataComponentInterpretation::DataComponentInterpretation>
+        component_interpretation(dim,
+                                 dealii::DataComponentInterpretation::component_is_part_of_vector);
+
+      patch_builder.add_data_vector(additional_field->get(),
+                                    patch_builder.get_dof_index(
+                                      additional_field->get_dof_handler()),
+                                    names,
+                                    component_interpretation);
+    }
+    else
+    {
+      AssertThrow(false, dealii::ExcMessage("Not implemented."));
+    }
+  }
+
+  patch_builder.build_patches();
+
+  if(output_data.print_wall_time_build_patches)
+    print_wall_time_build_patches("MatrixFree", timer.wall_time(), mpi_comm);
+
+  write_patches(patch_builder, output_data, output_counter, time, mpi_comm);
 }
 
 template<int dim, typename Number>
@@ -135,6 +258,11 @@ OutputGenerator<dim, Number>::setup(dealii::DoFHandler<dim> const & dof_handler_
 
   if(output_data.time_control_data.is_active)
   {
+    AssertThrow(not(output_data.build_patches_matrix_free) or
+                  dof_handler_velocity->get_fe().n_dofs_per_face() == 0,
+                dealii::ExcMessage("Building the patches with MatrixFree is only supported for "
+                                   "discontinuous velocity spaces, not for HDIV."));
+
     create_directories(output_data.directory, mpi_comm);
 
     // Visualize boundary IDs:
@@ -191,15 +319,33 @@ OutputGenerator<dim, Number>::evaluate(
 {
   print_write_output_time(time, time_control.get_counter(), unsteady, mpi_comm);
 
-  write_output<dim>(output_data,
-                    *dof_handler_velocity,
-                    *dof_handler_pressure,
-                    *mapping,
-                    velocity,
-                    pressure,
-                    additional_fields,
-                    time_control.get_counter(),
-                    mpi_comm);
+  if(output_data.build_patches_matrix_free)
+  {
+    write_output_matrix_free<dim>(output_data,
+                                  patch_builder,
+                                  *dof_handler_velocity,
+                                  *dof_handler_pressure,
+                                  *mapping,
+                                  velocity,
+                                  pressure,
+                                  additional_fields,
+                                  time_control.get_counter(),
+                                  time,
+                                  mpi_comm);
+  }
+  else
+  {
+    write_output<dim>(output_data,
+                      *dof_handler_velocity,
+                      *dof_handler_pressure,
+                      *mapping,
+                      velocity,
+                      pressure,
+                      additional_fields,
+                      time_control.get_counter(),
+                      time,
+                      mpi_comm);
+  }
 }
 
 template class OutputGenerator<2, float>;
@@ -23,6 +23,7 @@
 #define INCLUDE_EXADG_INCOMPRESSIBLE_NAVIER_STOKES_POSTPROCESSOR_OUTPUT_GENERATOR_H_
 
 #include <exadg/postprocessor/output_data_base.h>
+#include <exadg/postprocessor/patch_builder.h>
 #include <exadg/postprocessor/solution_field.h>
 #include <exadg/postprocessor/time_control.h>
 
@@ -41,7 +42,9 @@ struct OutputData : public OutputDataBase
       write_q_criterion(false),
       mean_velocity(TimeControlData()),
       write_cfl(false),
-      write_aspect_ratio(false)
+      write_aspect_ratio(false),
+      build_patches_matrix_free(false),
+      print_wall_time_build_patches(false)
   {
   }
 
@@ -58,6 +61,11 @@ struct OutputData : public OutputDataBase
     print_parameter(pcout, "Write Q criterion", write_q_criterion);
 
     mean_velocity.print(pcout, unsteady);
+
+    if(build_patches_matrix_free)
+      print_parameter(pcout, "Build patches with MatrixFree", build_patches_matrix_free);
+    if(print_wall_time_build_patches)
+      print_parameter(pcout, "Print wall time build patches", print_wall_time_build_patches);
   }
 
   // write vorticity of velocity field
@@ -96,6 +104,15 @@ struct OutputData : public OutputDataBase
 
   // write aspect ratio
   bool write_aspect_ratio;
+
+  // evaluate the output fields in the subdivision points with the sum-factorization kernels of
+  // MatrixFree (see PatchBuilder) instead of dealii::DataOut, which is significantly faster for
+  // high polynomial degrees of the output
+  bool build_patches_matrix_free;
+
+  // print the wall time needed to build the patches in every output step, e.g., to compare
+  // dealii::DataOut and PatchBuilder
+  bool print_wall_time_build_patches;
 };
 
 template<int dim, typename Number>
@@ -132,6 +149,8 @@ private:
   dealii::SmartPointer<dealii::DoFHandler<dim> const> dof_handler_velocity;
   dealii::SmartPointer<dealii::DoFHandler<dim> const> dof_handler_pressure;
   dealii::SmartPointer<dealii::Mapping<dim> const>    mapping;
+
+  PatchBuilder<dim, Number> patch_builder;
 };
 
 } // namespace IncNS
@@ -38,7 +38,11 @@ PostProcessor<dim, Number>::PostProcessor(PostProcessorData<dim> const & postpro
     div_and_mass_error_calculator(comm),
     kinetic_energy_calculator(comm),
     kinetic_energy_spectrum_calculator(comm),
-    line_plot_calculator(comm)
+    line_plot_calculator(comm),
+    in_situ_extractor(comm),
+    pod_calculator_u(comm),
+    pod_calculator_p(comm),
+    scalar_reductions(comm)
 {
 }
 
@@ -100,6 +104,26 @@ PostProcessor<dim, Number>::setup(Operator const & pde_operator)
                              pde_operator.get_dof_handler_p(),
                              *pde_operator.get_mapping(),
                              pp_data.line_plot_data);
+
+  in_situ_extractor.setup(pde_operator.get_dof_handler_u().get_triangulation(),
+                          *pde_operator.get_mapping(),
+                          pp_data.in_situ_extraction_data);
+
+  pod_calculator_u.setup(pde_operator.get_matrix_free(),
+                         pde_operator.get_constraint_u(),
+                         pde_operator.get_dof_index_velocity(),
+                         pde_operator.get_quad_index_velocity_linear(),
+                         pde_operator.get_dof_handler_u(),
+                         *pde_operator.get_mapping(),
+                         pp_data.pod_data_u);
+
+  pod_calculator_p.setup(pde_operator.get_matrix_free(),
+                         pde_operator.get_constraint_p(),
+                         pde_operator.get_dof_index_pressure(),
+                         pde_operator.get_quad_index_pressure(),
+                         pde_operator.get_dof_handler_p(),
+                         *pde_operator.get_mapping(),
+                         pp_data.pod_data_p);
 }
 
 template<int dim, typename Number>
@@ -123,6 +147,40 @@ PostProcessor<dim, Number>::do_postprocessing(VectorType const &     velocity,
     mean_velocity.evaluate(velocity);
   }
 
+  evaluate_derived_fields(velocity,
+                          output_generator.time_control.needs_evaluation(time, time_step_number),
+                          in_situ_extractor.time_control.needs_evaluation(time, time_step_number));
+
+  /*
+   *  calculation of lift and drag coefficients
+   */
+  if(lift_and_drag_calculator.time_control.needs_evaluation(time, time_step_number))
+    lift_and_drag_calculator.evaluate(velocity, pressure, time, scalar_reductions);
+
+  /*
+   *  Analysis of divergence and mass error
+   */
+  if(div_and_mass_error_calculator.time_control.needs_evaluation(time, time_step_number))
+  {
+    div_and_mass_error_calculator.evaluate(velocity,
+                                           time,
+                                           Utilities::is_unsteady_timestep(time_step_number),
+                                           scalar_reductions);
+  }
+
+  /*
+   *  calculation of kinetic energy
+   */
+  if(kinetic_energy_calculator.time_control.needs_evaluation(time, time_step_number))
+  {
+    kinetic_energy_calculator.evaluate(velocity,
+                                       time,
+                                       Utilities::is_unsteady_timestep(time_step_number),
+                                       scalar_reductions);
+  }
+
+  // the global reductions of the above quantities overlap with the remaining postprocessing
+  scalar_reductions.start();
 
   /*
    *  write output
@@ -185,38 +243,12 @@ PostProcessor<dim, Number>::do_postprocessing(VectorType const &     velocity,
   if(error_calculator_p.time_control.needs_evaluation(time, time_step_number))
     error_calculator_p.evaluate(pressure, time, Utilities::is_unsteady_timestep(time_step_number));
 
-  /*
-   *  calculation of lift and drag coefficients
-   */
-  if(lift_and_drag_calculator.time_control.needs_evaluation(time, time_step_number))
-    lift_and_drag_calculator.evaluate(velocity, pressure, time);
-
   /*
    *  calculation of pressure difference
    */
   if(pressure_difference_calculator.time_control.needs_evaluation(time, time_step_number))
     pressure_difference_calculator.evaluate(pressure, time);
 
-  /*
-   *  Analysis of divergence and mass error
-   */
-  if(div_and_mass_error_calculator.time_control.needs_evaluation(time, time_step_number))
-  {
-    div_and_mass_error_calculator.evaluate(velocity,
-                                           time,
-                                           Utilities::is_unsteady_timestep(time_step_number));
-  }
-
-  /*
-   *  calculation of kinetic energy
-   */
-  if(kinetic_energy_calculator.time_control.needs_evaluation(time, time_step_number))
-  {
-    kinetic_energy_calculator.evaluate(velocity,
-                                       time,
-                                       Utilities::is_unsteady_timestep(time_step_number));
-  }
-
   /*
    *  calculation of kinetic energy spectrum
    */
@@ -232,6 +264,45 @@ PostProcessor<dim, Number>::do_postprocessing(VectorType const &     velocity,
    */
   if(line_plot_calculator.time_control.needs_evaluation(time, time_step_number))
     line_plot_calculator.evaluate(velocity, pressure);
+
+  /*
+   *  In-situ extraction of slices, clips, and iso-surfaces
+   */
+  if(in_situ_extractor.time_control.needs_evaluation(time, time_step_number))
+  {
+    std::vector<ExtractionField<dim, Number>> fields = {
+      {"velocity", &navier_stokes_operator->get_dof_handler_u(), &velocity},
+      {"p", &navier_stokes_operator->get_dof_handler_p(), &pressure}};
+
+    for(SolutionField<dim, Number> * field :
+        {&vorticity, &divergence, &velocity_magnitude, &q_criterion})
+    {
+      // derived fields are only initialized if required, see initialize_derived_fields()
+      if(pp_data.in_situ_extraction_data.requires_field(field->get_name()))
+      {
+        fields.push_back(
+          {field->get_name(), &field->get_dof_handler(), &field->evaluate_get(velocity)});
+      }
+    }
+
+    in_situ_extractor.evaluate(fields, time, Utilities::is_unsteady_timestep(time_step_number));
+  }
+
+  /*
+   *  Incremental POD of velocity and pressure, the results are written at the end time
+   */
+  if(pod_calculator_u.time_control.needs_evaluation(time, time_step_number))
+    pod_calculator_u.evaluate(velocity, time, Utilities::is_unsteady_timestep(time_step_number));
+  if(pod_calculator_u.time_control.reached_end_time())
+    pod_calculator_u.write_output();
+
+  if(pod_calculator_p.time_control.needs_evaluation(time, time_step_number))
+    pod_calculator_p.evaluate(pressure, time, Utilities::is_unsteady_timestep(time_step_number));
+  if(pod_calculator_p.time_control.reached_end_time())
+    pod_calculator_p.write_output();
+
+  // write the results of lift and drag, divergence and mass error, and kinetic energy
+  scalar_reductions.finish();
 }
 
 template<int dim, typename Number>
@@ -240,7 +311,8 @@ PostProcessor<dim, Number>::initialize_derived_fields()
 {
   // vorticity
   if(pp_data.output_data.write_vorticity || pp_data.output_data.write_streamfunction ||
-     pp_data.output_data.write_vorticity_magnitude)
+     pp_data.output_data.write_vorticity_magnitude ||
+     pp_data.in_situ_extraction_data.requires_field("vorticity"))
   {
     vorticity.type              = SolutionFieldType::vector;
     vorticity.name              = "vorticity";
@@ -295,7 +367,8 @@ PostProcessor<dim, Number>::initialize_derived_fields()
   }
 
   // divergence
-  if(pp_data.output_data.write_divergence)
+  if(pp_data.output_data.write_divergence ||
+     pp_data.in_situ_extraction_data.requires_field("div_u"))
   {
     divergence.type              = SolutionFieldType::scalar;
     divergence.name              = "div_u";
@@ -311,7 +384,8 @@ PostProcessor<dim, Number>::initialize_derived_fields()
   }
 
   // velocity magnitude
-  if(pp_data.output_data.write_velocity_magnitude)
+  if(pp_data.output_data.write_velocity_magnitude ||
+     pp_data.in_situ_extraction_data.requires_field("velocity_magnitude"))
   {
     velocity_magnitude.type              = SolutionFieldType::scalar;
     velocity_magnitude.name              = "velocity_magnitude";
@@ -327,7 +401,8 @@ PostProcessor<dim, Number>::initialize_derived_fields()
   }
 
   // q criterion
-  if(pp_data.output_data.write_q_criterion)
+  if(pp_data.output_data.write_q_criterion ||
+     pp_data.in_situ_extraction_data.requires_field("q_criterion"))
   {
     q_criterion.type              = SolutionFieldType::scalar;
     q_criterion.name              = "q_criterion";
@@ -378,6 +453,54 @@ PostProcessor<dim, Number>::initialize_derived_fields()
   }
 }
 
+template<int dim, typename Number>
+void
+PostProcessor<dim, Number>::evaluate_derived_fields(VectorType const & velocity,
+                                                    bool const         write_output,
+                                                    bool const         extract_in_situ)
+{
+  OutputData const &                output_data = pp_data.output_data;
+  InSituExtractionData<dim> const & in_situ     = pp_data.in_situ_extraction_data;
+
+  auto const required_in_situ = [&](std::string const & name) {
+    return extract_in_situ && in_situ.requires_field(name);
+  };
+
+  // All derived fields needed in this time step are computed in a single pass over the velocity.
+  // The fields are available afterwards, so that the evaluate() calls of the individual fields
+  // below do not recompute them. The streamfunction depends on the vorticity.
+  std::vector<std::pair<DerivedQuantity, VectorType *>> dst;
+
+  auto const add = [&](bool const                   needed,
+                       DerivedQuantity const        quantity,
+                       SolutionField<dim, Number> & field) {
+    if(needed)
+      dst.emplace_back(quantity, &field.get_for_evaluation());
+  };
+
+  add((write_output && (output_data.write_vorticity || output_data.write_streamfunction ||
+                        output_data.write_vorticity_magnitude)) ||
+        required_in_situ("vorticity"),
+      DerivedQuantity::Vorticity,
+      vorticity);
+  add(write_output && output_data.write_vorticity_magnitude,
+      DerivedQuantity::VorticityMagnitude,
+      vorticity_magnitude);
+  add((write_output && output_data.write_divergence) || required_in_situ("div_u"),
+      DerivedQuantity::Divergence,
+      divergence);
+  add((write_output && output_data.write_velocity_magnitude) ||
+        required_in_situ("velocity_magnitude"),
+      DerivedQuantity::VelocityMagnitude,
+      velocity_magnitude);
+  add((write_output && output_data.write_q_criterion) || required_in_situ("q_criterion"),
+      DerivedQuantity::QCriterion,
+      q_criterion);
+
+  if(!dst.empty())
+    navier_stokes_operator->compute_derived_quantities(dst, velocity);
+}
+
 template<int dim, typename Number>
 void
 PostProcessor<dim, Number>::invalidate_derived_fields()
@@ -29,9 +29,12 @@
 #include <exadg/incompressible_navier_stokes/postprocessor/postprocessor_base.h>
 #include <exadg/incompressible_navier_stokes/spatial_discretization/spatial_operator_base.h>
 #include <exadg/postprocessor/error_calculation.h>
+#include <exadg/postprocessor/in_situ_extraction.h>
+#include <exadg/postprocessor/incremental_pod_calculation.h>
 #include <exadg/postprocessor/kinetic_energy_spectrum.h>
 #include <exadg/postprocessor/lift_and_drag_calculation.h>
 #include <exadg/postprocessor/pressure_difference_calculation.h>
+#include <exadg/utilities/batched_reduction.h>
 
 namespace ExaDG
 {
@@ -53,6 +56,9 @@ struct PostProcessorData
   KineticEnergyData           kinetic_energy_data;
   KineticEnergySpectrumData   kinetic_energy_spectrum_data;
   LinePlotData<dim>           line_plot_data;
+  InSituExtractionData<dim>   in_situ_extraction_data;
+  IncrementalPODData          pod_data_u;
+  IncrementalPODData          pod_data_p;
 };
 
 template<int dim, typename Number>
@@ -90,6 +96,11 @@ private:
   void
   invalidate_derived_fields();
 
+  void
+  evaluate_derived_fields(VectorType const & velocity,
+                          bool const         write_output,
+                          bool const         extract_in_situ);
+
   PostProcessorData<dim> pp_data;
 
   dealii::SmartPointer<NavierStokesOperator const> navier_stokes_operator;
@@ -132,6 +143,16 @@ private:
 
   // evaluate quantities along lines through the domain
   LinePlotCalculator<dim, Number> line_plot_calculator;
+
+  // extract slices, clipped regions, and iso-surfaces instead of writing the full volume
+  InSituExtractor<dim, Number> in_situ_extractor;
+
+  // POD (and DMD) of velocity and pressure snapshots computed on the fly
+  IncrementalPODCalculator<dim, dim, Number> pod_calculator_u;
+  IncrementalPODCalculator<dim, 1, Number>   pod_calculator_p;
+
+  // global reductions of the scalar quantities computed in one call to do_postprocessing()
+  BatchedReduction scalar_reductions;
 };
 
 
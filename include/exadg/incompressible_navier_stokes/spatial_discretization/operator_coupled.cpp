@@ -129,6 +129,24 @@ OperatorCoupled<dim, Number>::initialize_solver_coupled()
       Krylov::SolverFGMRES<LinearOperatorCoupled<dim, Number>, Preconditioner, BlockVectorType>>(
       linear_operator, block_preconditioner, solver_data);
   }
+  else if(this->param.solver_coupled == SolverCoupled::GCRODR)
+  {
+    Krylov::SolverDataGCRODR solver_data;
+    solver_data.max_iter             = this->param.solver_data_coupled.max_iter;
+    solver_data.solver_tolerance_abs = this->param.solver_data_coupled.abs_tol;
+    solver_data.solver_tolerance_rel = this->param.solver_data_coupled.rel_tol;
+    solver_data.max_n_tmp_vectors    = this->param.solver_data_coupled.max_krylov_size;
+    solver_data.recycle_space_size   = this->param.solver_data_coupled.recycle_space_size;
+
+    if(this->param.preconditioner_coupled != PreconditionerCoupled::None)
+    {
+      solver_data.use_preconditioner = true;
+    }
+
+    linear_solver = std::make_shared<
+      Krylov::SolverGCRODR<LinearOperatorCoupled<dim, Number>, Preconditioner, BlockVectorType>>(
+      linear_operator, block_preconditioner, solver_data);
+  }
   else
   {
     AssertThrow(false,
@@ -273,6 +291,26 @@ OperatorCoupled<dim, Number>::solve_nonlinear_problem(BlockVectorType &  dst,
   return iter;
 }
 
+template<int dim, typename Number>
+Newton::Statistics const &
+OperatorCoupled<dim, Number>::get_newton_statistics() const
+{
+  AssertThrow(newton_solver.get() != 0,
+              dealii::ExcMessage("Newton solver has not been initialized."));
+
+  return newton_solver->get_statistics();
+}
+
+template<int dim, typename Number>
+std::size_t
+OperatorCoupled<dim, Number>::get_memory_consumption_linear_solver() const
+{
+  if(linear_solver.get() != 0)
+    return linear_solver->memory_consumption();
+  else
+    return 0;
+}
+
 template<int dim, typename Number>
 void
 OperatorCoupled<dim, Number>::evaluate_nonlinear_residual(BlockVectorType &       dst,
@@ -273,6 +273,18 @@ public:
                           double const &     time                = 0.0,
                           double const &     scaling_factor_mass = 1.0);
 
+  /*
+   * Statistics of the Newton iterations of the last call to solve_nonlinear_problem().
+   */
+  Newton::Statistics const &
+  get_newton_statistics() const;
+
+  /*
+   * Memory consumption in bytes of the vectors kept by the linear solver between solves.
+   */
+  std::size_t
+  get_memory_consumption_linear_solver() const;
+
 
   /*
    * This function evaluates the nonlinear residual.
@@ -71,6 +71,16 @@ OperatorDualSplitting<dim, Number>::setup_solvers(double const &     scaling_fac
   this->pcout << std::endl << "... done!" << std::endl;
 }
 
+template<int dim, typename Number>
+void
+OperatorDualSplitting<dim, Number>::update_after_grid_motion()
+{
+  ProjectionBase::update_after_grid_motion();
+
+  if(helmholtz_solver.get() != 0)
+    helmholtz_solver->reset_solution_history();
+}
+
 template<int dim, typename Number>
 void
 OperatorDualSplitting<dim, Number>::setup_helmholtz_solver()
@@ -158,9 +168,10 @@ OperatorDualSplitting<dim, Number>::initialize_helmholtz_solver()
   {
     // setup solver data
     Krylov::SolverDataCG solver_data;
-    solver_data.max_iter             = this->param.solver_data_viscous.max_iter;
-    solver_data.solver_tolerance_abs = this->param.solver_data_viscous.abs_tol;
-    solver_data.solver_tolerance_rel = this->param.solver_data_viscous.rel_tol;
+    solver_data.max_iter              = this->param.solver_data_viscous.max_iter;
+    solver_data.solver_tolerance_abs  = this->param.solver_data_viscous.abs_tol;
+    solver_data.solver_tolerance_rel  = this->param.solver_data_viscous.rel_tol;
+    solver_data.solution_history_size = this->param.solver_data_viscous.solution_history_size;
 
     if(this->param.preconditioner_viscous == PreconditionerViscous::PointJacobi ||
        this->param.preconditioner_viscous == PreconditionerViscous::BlockJacobi ||
@@ -178,10 +189,11 @@ OperatorDualSplitting<dim, Number>::initialize_helmholtz_solver()
   {
     // setup solver data
     Krylov::SolverDataGMRES solver_data;
-    solver_data.max_iter             = this->param.solver_data_viscous.max_iter;
-    solver_data.solver_tolerance_abs = this->param.solver_data_viscous.abs_tol;
-    solver_data.solver_tolerance_rel = this->param.solver_data_viscous.rel_tol;
-    solver_data.max_n_tmp_vectors    = this->param.solver_data_viscous.max_krylov_size;
+    solver_data.max_iter              = this->param.solver_data_viscous.max_iter;
+    solver_data.solver_tolerance_abs  = this->param.solver_data_viscous.abs_tol;
+    solver_data.solver_tolerance_rel  = this->param.solver_data_viscous.rel_tol;
+    solver_data.solution_history_size = this->param.solver_data_viscous.solution_history_size;
+    solver_data.max_n_tmp_vectors     = this->param.solver_data_viscous.max_krylov_size;
     // use default value of compute_eigenvalues
 
     // default value of use_preconditioner = false
@@ -200,10 +212,11 @@ OperatorDualSplitting<dim, Number>::initialize_helmholtz_solver()
   else if(this->param.solver_viscous == SolverViscous::FGMRES)
   {
     Krylov::SolverDataFGMRES solver_data;
-    solver_data.max_iter             = this->param.solver_data_viscous.max_iter;
-    solver_data.solver_tolerance_abs = this->param.solver_data_viscous.abs_tol;
-    solver_data.solver_tolerance_rel = this->param.solver_data_viscous.rel_tol;
-    solver_data.max_n_tmp_vectors    = this->param.solver_data_viscous.max_krylov_size;
+    solver_data.max_iter              = this->param.solver_data_viscous.max_iter;
+    solver_data.solver_tolerance_abs  = this->param.solver_data_viscous.abs_tol;
+    solver_data.solver_tolerance_rel  = this->param.solver_data_viscous.rel_tol;
+    solver_data.solution_history_size = this->param.solver_data_viscous.solution_history_size;
+    solver_data.max_n_tmp_vectors     = this->param.solver_data_viscous.max_krylov_size;
 
     if(this->param.preconditioner_viscous == PreconditionerViscous::PointJacobi ||
        this->param.preconditioner_viscous == PreconditionerViscous::BlockJacobi ||
@@ -752,6 +765,10 @@ OperatorDualSplitting<dim, Number>::solve_viscous(VectorType &       dst,
                                                   bool const &       update_preconditioner,
                                                   double const &     factor)
 {
+  // the solution history is only meaningful as long as the operator does not change
+  if(this->momentum_operator.get_scaling_factor_mass_operator() != factor)
+    helmholtz_solver->reset_solution_history();
+
   // Update operator
   this->momentum_operator.set_scaling_factor_mass_operator(factor);
 
@@ -762,6 +779,13 @@ OperatorDualSplitting<dim, Number>::solve_viscous(VectorType &       dst,
   return n_iter;
 }
 
+template<int dim, typename Number>
+double
+OperatorDualSplitting<dim, Number>::get_n_saved_iterations_viscous() const
+{
+  return helmholtz_solver->n_saved_iterations;
+}
+
 template<int dim, typename Number>
 void
 OperatorDualSplitting<dim, Number>::interpolate_velocity_dirichlet_bc(VectorType &   dst,
@@ -69,6 +69,9 @@ public:
   void
   setup_solvers(double const & scaling_factor_mass, VectorType const & velocity);
 
+  void
+  update_after_grid_motion() override;
+
   /*
    * Pressure Poisson equation.
    */
@@ -127,6 +130,13 @@ public:
                 bool const &       update_preconditioner,
                 double const &     scaling_factor_mass);
 
+  /*
+   * Estimated number of iterations saved by the solution history projection in the last call of
+   * solve_viscous().
+   */
+  double
+  get_n_saved_iterations_viscous() const;
+
   /*
    * Fill a DoF vector with velocity Dirichlet values on Dirichlet boundaries.
    *
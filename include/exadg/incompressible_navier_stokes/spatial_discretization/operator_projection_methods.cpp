@@ -73,6 +73,9 @@ OperatorProjectionMethods<dim, Number>::update_after_grid_motion()
   // update SIPG penalty parameter of Laplace operator which depends on the deformation
   // of elements
   laplace_operator.update_penalty_parameter();
+
+  if(pressure_poisson_solver.get() != 0)
+    pressure_poisson_solver->reset_solution_history();
 }
 
 template<int dim, typename Number>
@@ -200,9 +203,11 @@ OperatorProjectionMethods<dim, Number>::initialize_solver_pressure_poisson()
   {
     // setup solver data
     Krylov::SolverDataCG solver_data;
-    solver_data.max_iter             = this->param.solver_data_pressure_poisson.max_iter;
-    solver_data.solver_tolerance_abs = this->param.solver_data_pressure_poisson.abs_tol;
-    solver_data.solver_tolerance_rel = this->param.solver_data_pressure_poisson.rel_tol;
+    solver_data.max_iter              = this->param.solver_data_pressure_poisson.max_iter;
+    solver_data.solver_tolerance_abs  = this->param.solver_data_pressure_poisson.abs_tol;
+    solver_data.solver_tolerance_rel  = this->param.solver_data_pressure_poisson.rel_tol;
+    solver_data.solution_history_size =
+      this->param.solver_data_pressure_poisson.solution_history_size;
     // use default value of update_preconditioner (=false)
 
     if(this->param.preconditioner_pressure_poisson != PreconditionerPressurePoisson::None)
@@ -221,10 +226,12 @@ OperatorProjectionMethods<dim, Number>::initialize_solver_pressure_poisson()
   else if(this->param.solver_pressure_poisson == SolverPressurePoisson::FGMRES)
   {
     Krylov::SolverDataFGMRES solver_data;
-    solver_data.max_iter             = this->param.solver_data_pressure_poisson.max_iter;
-    solver_data.solver_tolerance_abs = this->param.solver_data_pressure_poisson.abs_tol;
-    solver_data.solver_tolerance_rel = this->param.solver_data_pressure_poisson.rel_tol;
-    solver_data.max_n_tmp_vectors    = this->param.solver_data_pressure_poisson.max_krylov_size;
+    solver_data.max_iter              = this->param.solver_data_pressure_poisson.max_iter;
+    solver_data.solver_tolerance_abs  = this->param.solver_data_pressure_poisson.abs_tol;
+    solver_data.solver_tolerance_rel  = this->param.solver_data_pressure_poisson.rel_tol;
+    solver_data.solution_history_size =
+      this->param.solver_data_pressure_poisson.solution_history_size;
+    solver_data.max_n_tmp_vectors     = this->param.solver_data_pressure_poisson.max_krylov_size;
     // use default value of update_preconditioner (=false)
 
     if(this->param.preconditioner_pressure_poisson != PreconditionerPressurePoisson::None)
@@ -294,6 +301,13 @@ OperatorProjectionMethods<dim, Number>::do_solve_pressure(VectorType &       dst
   return n_iter;
 }
 
+template<int dim, typename Number>
+double
+OperatorProjectionMethods<dim, Number>::get_n_saved_iterations_pressure() const
+{
+  return this->pressure_poisson_solver->n_saved_iterations;
+}
+
 
 template<int dim, typename Number>
 void
@@ -92,6 +92,13 @@ public:
                     VectorType const & src,
                     bool const         update_preconditioner) const;
 
+  /*
+   * Estimated number of iterations saved by the solution history projection in the last solution
+   * of the pressure Poisson equation.
+   */
+  double
+  get_n_saved_iterations_pressure() const;
+
   /*
    * This function applies the projection operator (used for throughput measurements).
    */
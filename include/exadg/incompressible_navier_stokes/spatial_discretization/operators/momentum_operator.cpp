@@ -218,6 +218,9 @@ MomentumOperator<dim, Number>::reinit_cell(unsigned int const cell) const
 
   if(operator_data.convective_problem)
     convective_kernel->reinit_cell(cell);
+
+  if(operator_data.viscous_problem)
+    viscous_kernel->reinit_cell(*this->integrator);
 }
 
 template<int dim, typename Number>
@@ -259,7 +262,9 @@ MomentumOperator<dim, Number>::reinit_face_cell_based(
     convective_kernel->reinit_face_cell_based(cell, face, boundary_id);
 
   if(operator_data.viscous_problem)
-    viscous_kernel->reinit_face_cell_based(boundary_id,
+    viscous_kernel->reinit_face_cell_based(cell,
+                                           face,
+                                           boundary_id,
                                            *this->integrator_m,
                                            *this->integrator_p,
                                            operator_data.dof_index);
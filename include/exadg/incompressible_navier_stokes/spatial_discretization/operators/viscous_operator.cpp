@@ -36,6 +36,15 @@ ViscousOperator<dim, Number>::update()
   kernel->calculate_penalty_parameter(this->get_matrix_free(), operator_data.dof_index);
 }
 
+template<int dim, typename Number>
+void
+ViscousOperator<dim, Number>::reinit_cell(unsigned int const cell) const
+{
+  Base::reinit_cell(cell);
+
+  kernel->reinit_cell(*this->integrator);
+}
+
 template<int dim, typename Number>
 void
 ViscousOperator<dim, Number>::reinit_face(unsigned int const face) const
@@ -63,7 +72,9 @@ ViscousOperator<dim, Number>::reinit_face_cell_based(
 {
   Base::reinit_face_cell_based(cell, face, boundary_id);
 
-  kernel->reinit_face_cell_based(boundary_id,
+  kernel->reinit_face_cell_based(cell,
+                                 face,
+                                 boundary_id,
                                  *this->integrator_m,
                                  *this->integrator_p,
                                  operator_data.dof_index);
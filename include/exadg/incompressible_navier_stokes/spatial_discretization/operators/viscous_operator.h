@@ -10,6 +10,7 @@
 
 #include <exadg/grid/grid_utilities.h>
 #include <exadg/incompressible_navier_stokes/spatial_discretization/operators/weak_boundary_conditions.h>
+#include <exadg/incompressible_navier_stokes/spatial_discretization/turbulence_model_kernel.h>
 #include <exadg/incompressible_navier_stokes/user_interface/parameters.h>
 #include <exadg/matrix_free/integrators.h>
 #include <exadg/operators/interior_penalty_parameter.h>
@@ -31,6 +32,8 @@ struct ViscousKernelData
       penalty_term_div_formulation(PenaltyTermDivergenceFormulation::Symmetrized),
       IP_formulation(InteriorPenaltyFormulation::SIPG),
       viscosity_is_variable(false),
+      viscosity_single_precision(false),
+      viscosity_on_the_fly(false),
       variable_normal_vector(false)
   {
   }
@@ -41,6 +44,8 @@ struct ViscousKernelData
   PenaltyTermDivergenceFormulation penalty_term_div_formulation;
   InteriorPenaltyFormulation       IP_formulation;
   bool                             viscosity_is_variable;
+  bool                             viscosity_single_precision;
+  bool                             viscosity_on_the_fly;
   bool                             variable_normal_vector;
 };
 
@@ -52,11 +57,17 @@ private:
   typedef dealii::Tensor<1, dim, dealii::VectorizedArray<Number>> vector;
   typedef dealii::Tensor<2, dim, dealii::VectorizedArray<Number>> tensor;
 
+  typedef dealii::LinearAlgebra::distributed::Vector<Number> VectorType;
+
   typedef CellIntegrator<dim, dim, Number> IntegratorCell;
   typedef FaceIntegrator<dim, dim, Number> IntegratorFace;
 
 public:
-  ViscousKernel() : degree(1), tau(dealii::make_vectorized_array<Number>(0.0))
+  ViscousKernel()
+    : degree(1),
+      tau(dealii::make_vectorized_array<Number>(0.0)),
+      turbulence_model_constant(1.0),
+      dof_index_velocity(0)
   {
   }
 
@@ -74,10 +85,13 @@ public:
 
     AssertThrow(data.viscosity >= 0.0, dealii::ExcMessage("Viscosity is not set!"));
 
-    if(data.viscosity_is_variable)
+    if(data.viscosity_is_variable and not(data.viscosity_on_the_fly))
     {
       // allocate vectors for variable coefficients and initialize with constant viscosity
-      viscosity_coefficients.initialize(matrix_free, degree, data.viscosity);
+      viscosity_coefficients.initialize(matrix_free,
+                                        degree,
+                                        data.viscosity,
+                                        data.viscosity_single_precision);
     }
   }
 
@@ -118,6 +132,68 @@ public:
     viscosity_coefficients.set_coefficient_face_neighbor(face, q, value);
   }
 
+  void
+  compress_coefficients()
+  {
+    viscosity_coefficients.compress();
+  }
+
+  /*
+   * The turbulent viscosity is computed on the fly in the quadrature points from the gradient of
+   * the velocity field set via set_velocity_copy(). As long as no velocity field has been set
+   * (e.g. for the operators on coarser multigrid levels), the laminar viscosity is used.
+   */
+  void
+  initialize_turbulence_model(
+    TurbulenceModelKernel<dim, Number> const & turbulence_model_kernel_in,
+    double const                               turbulence_model_constant_in,
+    unsigned int const                         dof_index_velocity_in)
+  {
+    AssertThrow(data.viscosity_is_variable and data.viscosity_on_the_fly,
+                dealii::ExcMessage("The viscous kernel has not been configured to compute the "
+                                   "viscosity on the fly."));
+
+    turbulence_model_kernel   = turbulence_model_kernel_in;
+    turbulence_model_constant = turbulence_model_constant_in;
+    dof_index_velocity        = dof_index_velocity_in;
+  }
+
+  void
+  set_filter_width(dealii::AlignedVector<scalar> const & filter_width_vector_in)
+  {
+    filter_width_vector = filter_width_vector_in;
+  }
+
+  void
+  set_velocity_copy(VectorType const & velocity_in)
+  {
+    velocity = velocity_in;
+
+    velocity.update_ghost_values();
+  }
+
+  void
+  reinit_cell(IntegratorCell const & integrator) const
+  {
+    if(turbulent_viscosity_is_computed_on_the_fly())
+    {
+      unsigned int const quad_index = integrator.get_quadrature_index();
+
+      if(integrator_velocity.get() == nullptr or
+         integrator_velocity->get_quadrature_index() != quad_index)
+      {
+        integrator_velocity = std::make_shared<IntegratorCell>(integrator.get_matrix_free(),
+                                                               dof_index_velocity,
+                                                               quad_index);
+      }
+
+      integrator_velocity->reinit(integrator.get_current_cell_index());
+      integrator_velocity->gather_evaluate(velocity, dealii::EvaluationFlags::gradients);
+
+      filter_width_cell = integrator_velocity->read_cell_data(filter_width_vector);
+    }
+  }
+
   IntegratorFlags
   get_integrator_flags() const
   {
@@ -161,6 +237,21 @@ public:
             GridUtilities::get_element_type(
               integrator_m.get_matrix_free().get_dof_handler(dof_index).get_triangulation()),
             data.IP_factor);
+
+    if(turbulent_viscosity_is_computed_on_the_fly())
+    {
+      unsigned int const face = integrator_m.get_current_cell_index();
+
+      initialize_integrators_velocity_face(integrator_m);
+
+      integrator_velocity_m->reinit(face);
+      integrator_velocity_m->gather_evaluate(velocity, dealii::EvaluationFlags::gradients);
+      filter_width_m = integrator_velocity_m->read_cell_data(filter_width_vector);
+
+      integrator_velocity_p->reinit(face);
+      integrator_velocity_p->gather_evaluate(velocity, dealii::EvaluationFlags::gradients);
+      filter_width_p = integrator_velocity_p->read_cell_data(filter_width_vector);
+    }
   }
 
   void
@@ -172,14 +263,46 @@ public:
             GridUtilities::get_element_type(
               integrator_m.get_matrix_free().get_dof_handler(dof_index).get_triangulation()),
             data.IP_factor);
+
+    if(turbulent_viscosity_is_computed_on_the_fly())
+    {
+      initialize_integrators_velocity_face(integrator_m);
+
+      integrator_velocity_m->reinit(integrator_m.get_current_cell_index());
+      integrator_velocity_m->gather_evaluate(velocity, dealii::EvaluationFlags::gradients);
+      filter_width_m = integrator_velocity_m->read_cell_data(filter_width_vector);
+    }
   }
 
   void
-  reinit_face_cell_based(dealii::types::boundary_id const boundary_id,
+  reinit_face_cell_based(unsigned int const               cell,
+                         unsigned int const               face,
+                         dealii::types::boundary_id const boundary_id,
                          IntegratorFace &                 integrator_m,
                          IntegratorFace &                 integrator_p,
                          unsigned int const               dof_index) const
   {
+    if(turbulent_viscosity_is_computed_on_the_fly())
+    {
+      initialize_integrators_velocity_face(integrator_m);
+
+      // the velocity values of the current cell have already been read in reinit_cell()
+      integrator_velocity_m->reinit(cell, face);
+      for(unsigned int i = 0; i < integrator_velocity_m->dofs_per_cell; ++i)
+        integrator_velocity_m->begin_dof_values()[i] = integrator_velocity->begin_dof_values()[i];
+      integrator_velocity_m->evaluate(dealii::EvaluationFlags::gradients);
+      filter_width_m = filter_width_cell;
+
+      // Same as for the operator: the data of the neighboring element is not accessible in
+      // case of cell-based face loops.
+      if(boundary_id == dealii::numbers::internal_face_boundary_id)
+      {
+        integrator_velocity_p->reinit(cell, face);
+        integrator_velocity_p->gather_evaluate(velocity, dealii::EvaluationFlags::gradients);
+        filter_width_p = integrator_velocity_p->read_cell_data(filter_width_vector);
+      }
+    }
+
     if(boundary_id == dealii::numbers::internal_face_boundary_id) // internal face
     {
       tau = std::max(integrator_m.read_cell_data(array_penalty_parameter),
@@ -210,9 +333,12 @@ public:
   {
     scalar viscosity = dealii::make_vectorized_array<Number>(data.viscosity);
 
-    if(data.viscosity_is_variable)
+    if(viscosity_is_variable())
     {
-      viscosity = viscosity_coefficients.get_coefficient_cell(cell, q);
+      if(data.viscosity_on_the_fly)
+        viscosity = calculate_turbulent_viscosity(*integrator_velocity, filter_width_cell, q);
+      else
+        viscosity = viscosity_coefficients.get_coefficient_cell(cell, q);
     }
 
     return viscosity;
@@ -227,9 +353,19 @@ public:
   {
     scalar average_viscosity = dealii::make_vectorized_array<Number>(0.0);
 
-    scalar coefficient_face = viscosity_coefficients.get_coefficient_face(face, q);
-    scalar coefficient_face_neighbor =
-      viscosity_coefficients.get_coefficient_face_neighbor(face, q);
+    scalar coefficient_face, coefficient_face_neighbor;
+
+    if(data.viscosity_on_the_fly)
+    {
+      coefficient_face = calculate_turbulent_viscosity(*integrator_velocity_m, filter_width_m, q);
+      coefficient_face_neighbor =
+        calculate_turbulent_viscosity(*integrator_velocity_p, filter_width_p, q);
+    }
+    else
+    {
+      coefficient_face          = viscosity_coefficients.get_coefficient_face(face, q);
+      coefficient_face_neighbor = viscosity_coefficients.get_coefficient_face_neighbor(face, q);
+    }
 
     // harmonic mean (harmonic weighting according to Schott and Rasthofer et al. (2015))
     average_viscosity = 2.0 * coefficient_face * coefficient_face_neighbor /
@@ -253,7 +389,7 @@ public:
   {
     scalar viscosity = dealii::make_vectorized_array<Number>(data.viscosity);
 
-    if(data.viscosity_is_variable)
+    if(viscosity_is_variable())
     {
       viscosity = calculate_average_viscosity(face, q);
     }
@@ -270,9 +406,12 @@ public:
   {
     scalar viscosity = dealii::make_vectorized_array<Number>(data.viscosity);
 
-    if(data.viscosity_is_variable)
+    if(viscosity_is_variable())
     {
-      viscosity = viscosity_coefficients.get_coefficient_face(face, q);
+      if(data.viscosity_on_the_fly)
+        viscosity = calculate_turbulent_viscosity(*integrator_velocity_m, filter_width_m, q);
+      else
+        viscosity = viscosity_coefficients.get_coefficient_face(face, q);
     }
 
     return viscosity;
@@ -487,6 +626,58 @@ public:
   }
 
 private:
+  bool
+  turbulent_viscosity_is_computed_on_the_fly() const
+  {
+    return data.viscosity_is_variable and data.viscosity_on_the_fly and velocity.size() > 0;
+  }
+
+  /*
+   * If the turbulent viscosity is computed on the fly but no velocity field has been set (e.g. for
+   * the operators on coarser multigrid levels), the laminar viscosity is used.
+   */
+  bool
+  viscosity_is_variable() const
+  {
+    return data.viscosity_is_variable and
+           (not(data.viscosity_on_the_fly) or turbulent_viscosity_is_computed_on_the_fly());
+  }
+
+  /*
+   * The integrators for the velocity use the quadrature rule of the integrators of the operator.
+   */
+  void
+  initialize_integrators_velocity_face(IntegratorFace const & integrator_m) const
+  {
+    unsigned int const quad_index = integrator_m.get_quadrature_index();
+
+    if(integrator_velocity_m.get() == nullptr or
+       integrator_velocity_m->get_quadrature_index() != quad_index)
+    {
+      integrator_velocity_m = std::make_shared<IntegratorFace>(
+        integrator_m.get_matrix_free(), true, dof_index_velocity, quad_index);
+      integrator_velocity_p = std::make_shared<IntegratorFace>(
+        integrator_m.get_matrix_free(), false, dof_index_velocity, quad_index);
+    }
+  }
+
+  template<typename Integrator>
+  inline DEAL_II_ALWAYS_INLINE //
+    scalar
+    calculate_turbulent_viscosity(Integrator const &  integrator_velocity,
+                                  scalar const &      filter_width,
+                                  unsigned int const q) const
+  {
+    scalar viscosity = dealii::make_vectorized_array<Number>(data.viscosity);
+
+    turbulence_model_kernel.add_turbulent_viscosity(viscosity,
+                                                    filter_width,
+                                                    integrator_velocity.get_gradient(q),
+                                                    turbulence_model_constant);
+
+    return viscosity;
+  }
+
   ViscousKernelData data;
 
   unsigned int degree;
@@ -495,7 +686,23 @@ private:
 
   mutable scalar tau;
 
+  // variable viscosity stored in the quadrature points
   VariableCoefficients<dim, Number> viscosity_coefficients;
+
+  // turbulent viscosity computed on the fly
+  TurbulenceModelKernel<dim, Number> turbulence_model_kernel;
+  double                             turbulence_model_constant;
+  unsigned int                       dof_index_velocity;
+  dealii::AlignedVector<scalar>      filter_width_vector;
+  VectorType                         velocity;
+
+  mutable std::shared_ptr<IntegratorCell> integrator_velocity;
+  mutable std::shared_ptr<IntegratorFace> integrator_velocity_m;
+  mutable std::shared_ptr<IntegratorFace> integrator_velocity_p;
+
+  mutable scalar filter_width_cell;
+  mutable scalar filter_width_m;
+  mutable scalar filter_width_p;
 };
 
 } // namespace Operators
@@ -537,6 +744,9 @@ public:
   update();
 
 private:
+  void
+  reinit_cell(unsigned int const cell) const;
+
   void
   reinit_face(unsigned int const face) const;
 
@@ -402,6 +402,8 @@ SpatialOperatorBase<dim, Number>::initialize_operators(std::string const & dof_i
   viscous_kernel_data.penalty_term_div_formulation = param.penalty_term_div_formulation;
   viscous_kernel_data.IP_formulation               = param.IP_formulation_viscous;
   viscous_kernel_data.viscosity_is_variable        = param.use_turbulence_model;
+  viscous_kernel_data.viscosity_single_precision   = param.turbulent_viscosity_single_precision;
+  viscous_kernel_data.viscosity_on_the_fly         = param.turbulence_model_on_the_fly;
   viscous_kernel_data.variable_normal_vector       = param.neumann_with_variable_normal_vector;
   viscous_kernel = std::make_shared<Operators::ViscousKernel<dim, Number>>();
   viscous_kernel->reinit(*matrix_free, viscous_kernel_data, get_dof_index_velocity());
@@ -638,6 +640,7 @@ SpatialOperatorBase<dim, Number>::initialize_turbulence_model()
   model_data.dof_index           = get_dof_index_velocity();
   model_data.quad_index          = get_quad_index_velocity_linear();
   model_data.degree              = param.degree_u;
+  model_data.on_the_fly          = param.turbulence_model_on_the_fly;
   turbulence_model.initialize(*matrix_free, *get_mapping(), viscous_kernel, model_data);
 }
 
@@ -660,6 +663,10 @@ SpatialOperatorBase<dim, Number>::initialize_calculators_for_derived_quantities(
                                     get_dof_index_velocity(),
                                     get_dof_index_velocity_scalar(),
                                     get_quad_index_velocity_linear());
+  derived_quantities_calculator.initialize(*matrix_free,
+                                           get_dof_index_velocity(),
+                                           get_dof_index_velocity_scalar(),
+                                           get_quad_index_velocity_linear());
 }
 
 template<int dim, typename Number>
@@ -871,7 +878,8 @@ SpatialOperatorBase<dim, Number>::get_viscosity_boundary_face(unsigned int const
   dealii::VectorizedArray<Number> viscosity =
     dealii::make_vectorized_array<Number>(get_viscosity());
 
-  bool const viscosity_is_variable = param.use_turbulence_model;
+  bool const viscosity_is_variable =
+    param.use_turbulence_model and not(param.turbulence_model_on_the_fly);
   if(viscosity_is_variable)
     viscous_kernel->get_coefficient_face(face, q);
 
@@ -1293,6 +1301,51 @@ SpatialOperatorBase<dim, Number>::compute_q_criterion(VectorType &       dst,
   inverse_mass_velocity_scalar.apply(dst, dst);
 }
 
+template<int dim, typename Number>
+void
+SpatialOperatorBase<dim, Number>::compute_derived_quantities(
+  std::vector<std::pair<DerivedQuantity, VectorType *>> const & dst,
+  VectorType const &                                            src) const
+{
+  if(param.spatial_discretization == SpatialDiscretization::L2)
+  {
+    derived_quantities_calculator.compute(dst, src);
+  }
+  else
+  {
+    // the inverse mass operator of the velocity is not cell-local for H(div) elements
+    for(auto const & [quantity, dst_vector] : dst)
+    {
+      switch(quantity)
+      {
+        case DerivedQuantity::Vorticity:
+          compute_vorticity(*dst_vector, src);
+          break;
+        case DerivedQuantity::Divergence:
+          compute_divergence(*dst_vector, src);
+          break;
+        case DerivedQuantity::VelocityMagnitude:
+          compute_velocity_magnitude(*dst_vector, src);
+          break;
+        case DerivedQuantity::VorticityMagnitude:
+        {
+          VectorType vorticity;
+          initialize_vector_velocity(vorticity);
+          compute_vorticity(vorticity, src);
+          compute_vorticity_magnitude(*dst_vector, vorticity);
+          break;
+        }
+        case DerivedQuantity::QCriterion:
+          compute_q_criterion(*dst_vector, src);
+          break;
+        default:
+          AssertThrow(false, dealii::ExcMessage("Not implemented."));
+          break;
+      }
+    }
+  }
+}
+
 template<int dim, typename Number>
 unsigned int
 SpatialOperatorBase<dim, Number>::apply_inverse_mass_operator(VectorType &       dst,
@@ -1342,6 +1395,21 @@ SpatialOperatorBase<dim, Number>::evaluate_convective_term(VectorType &       ds
   convective_operator.evaluate_nonlinear_operator(dst, src, time);
 }
 
+template<int dim, typename Number>
+void
+SpatialOperatorBase<dim, Number>::evaluate_negative_convective_term_and_apply_inverse_mass(
+  VectorType &       dst,
+  VectorType const & src,
+  Number const       time) const
+{
+  convective_operator.evaluate_nonlinear_operator(dst, src, time);
+
+  // shift convective term to the rhs of the equation
+  dst *= -1.0;
+
+  apply_inverse_mass_operator(dst, dst);
+}
+
 template<int dim, typename Number>
 void
 SpatialOperatorBase<dim, Number>::evaluate_pressure_gradient_term(VectorType &       dst,
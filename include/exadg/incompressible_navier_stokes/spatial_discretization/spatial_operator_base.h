@@ -54,8 +54,10 @@
 #include <exadg/operators/mass_operator.h>
 #include <exadg/poisson/preconditioners/multigrid_preconditioner.h>
 #include <exadg/poisson/spatial_discretization/laplace_operator.h>
+#include <exadg/postprocessor/derived_quantities_calculator.h>
 #include <exadg/solvers_and_preconditioners/preconditioners/preconditioner_base.h>
 #include <exadg/time_integration/interpolate.h>
+#include <exadg/time_integration/operator_integration_factor.h>
 
 namespace ExaDG
 {
@@ -311,6 +313,13 @@ public:
   void
   compute_q_criterion(VectorType & dst, VectorType const & src) const;
 
+  // computes several of the above quantities (except for the streamfunction) in a single pass over
+  // the velocity field src, where dst contains the quantities and the vectors they are written to
+  void
+  compute_derived_quantities(
+    std::vector<std::pair<DerivedQuantity, VectorType *>> const & dst,
+    VectorType const &                                            src) const;
+
   /*
    * Operators.
    */
@@ -346,6 +355,13 @@ public:
   unsigned int
   apply_inverse_mass_operator(VectorType & dst, VectorType const & src) const;
 
+  // operator-integration-factor splitting: convective term shifted to the right-hand side of the
+  // equations and multiplied by the inverse mass operator
+  void
+  evaluate_negative_convective_term_and_apply_inverse_mass(VectorType &       dst,
+                                                           VectorType const & src,
+                                                           Number const       time) const;
+
   /*
    *  Update turbulence model, i.e., calculate turbulent viscosity.
    */
@@ -588,6 +604,7 @@ protected:
   DivergenceCalculator<dim, Number>        divergence_calculator;
   VelocityMagnitudeCalculator<dim, Number> velocity_magnitude_calculator;
   QCriterionCalculator<dim, Number>        q_criterion_calculator;
+  DerivedQuantitiesCalculator<dim, Number> derived_quantities_calculator;
 
   MPI_Comm const mpi_comm;
 
@@ -653,6 +670,52 @@ private:
   TurbulenceModel<dim, Number> turbulence_model;
 };
 
+/*
+ * Operator of the pure convection problem solved by the sub-steps of the
+ * operator-integration-factor splitting.
+ */
+template<int dim, typename Number>
+class OperatorOIF
+{
+public:
+  typedef dealii::LinearAlgebra::distributed::Vector<Number> VectorType;
+
+  OperatorOIF(std::shared_ptr<SpatialOperatorBase<dim, Number>> operator_in)
+    : pde_operator(operator_in)
+  {
+  }
+
+  void
+  evaluate(VectorType & dst, VectorType const & src, double const evaluation_time) const
+  {
+    pde_operator->evaluate_negative_convective_term_and_apply_inverse_mass(dst,
+                                                                           src,
+                                                                           evaluation_time);
+  }
+
+  void
+  evaluate_and_update_stage(VectorType & solution,
+                            VectorType & vec_ri,
+                            VectorType & vec_ki,
+                            double const evaluation_time,
+                            double const factor_ri,
+                            double const factor_solution,
+                            bool const   update_ri) const
+  {
+    evaluate_and_update_stage_oif(
+      *this, solution, vec_ri, vec_ki, evaluation_time, factor_ri, factor_solution, update_ri);
+  }
+
+  void
+  initialize_dof_vector(VectorType & src) const
+  {
+    pde_operator->initialize_vector_velocity(src);
+  }
+
+private:
+  std::shared_ptr<SpatialOperatorBase<dim, Number>> pde_operator;
+};
+
 } // namespace IncNS
 } // namespace ExaDG
 
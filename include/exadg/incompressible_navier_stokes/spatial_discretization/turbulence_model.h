@@ -27,6 +27,7 @@
 
 // ExaDG
 #include <exadg/incompressible_navier_stokes/spatial_discretization/operators/viscous_operator.h>
+#include <exadg/incompressible_navier_stokes/spatial_discretization/turbulence_model_kernel.h>
 #include <exadg/incompressible_navier_stokes/user_interface/parameters.h>
 #include <exadg/matrix_free/integrators.h>
 
@@ -45,7 +46,8 @@ struct TurbulenceModelData
       kinematic_viscosity(1.0),
       dof_index(0),
       quad_index(0),
-      degree(1)
+      degree(1),
+      on_the_fly(false)
   {
   }
 
@@ -61,6 +63,10 @@ struct TurbulenceModelData
 
   // required for calculation of filter width
   unsigned int degree;
+
+  // compute the turbulent viscosity on the fly in the viscous kernel instead of storing it in
+  // tables of variable coefficients
+  bool on_the_fly;
 };
 
 
@@ -99,7 +105,9 @@ public:
              TurbulenceModelData const &                            data_in);
 
   /*
-   *  This function calculates the turbulent viscosity for a given velocity field.
+   *  This function calculates the turbulent viscosity for a given velocity field. If the
+   *  turbulent viscosity is computed on the fly, only the velocity field is passed to the viscous
+   *  kernel.
    */
   void
   calculate_turbulent_viscosity(VectorType const & velocity) const;
@@ -129,123 +137,10 @@ private:
                                       VectorType const & src,
                                       Range const &      face_range) const;
 
-  /*
-   *  This function adds the turbulent eddy-viscosity to the laminar viscosity
-   *  by using one of the implemented models.
-   */
-  void
-  add_turbulent_viscosity(scalar &       viscosity,
-                          scalar const & filter_width,
-                          tensor const & velocity_gradient,
-                          double const & model_constant) const;
-
-  /*
-   *  Smagorinsky model (1963):
-   *
-   *    nu_SGS = (C * filter_width)^{2} * sqrt(2 * S:S)
-   *
-   *    where S is the symmetric part of the velocity gradient
-   *
-   *      S = 1/2 * (grad(u) + grad(u)^T) and S:S = S_ij * S_ij
-   *
-   *    and the model constant is
-   *
-   *      C = 0.165 (Nicoud et al. (2011))
-   *      C = 0.18  (Toda et al. (2010))
-   */
-  void
-  smagorinsky_model(scalar const & filter_width,
-                    tensor const & velocity_gradient,
-                    double const & C,
-                    scalar &       viscosity) const;
-
-  /*
-   *  Vreman model (2004): Note that we only consider the isotropic variant of the Vreman model:
-   *
-   *    nu_SGS = (C * filter_width)^{2} * D
-   *
-   *  where the differential operator D is defined as
-   *
-   *    D = sqrt(B_gamma / ||grad(u)||^{2})
-   *
-   *  with
-   *
-   *    ||grad(u)||^{2} = grad(u) : grad(u) and grad(u) = d(u_i)/d(x_j) ,
-   *
-   *    gamma = grad(u) * grad(u)^T ,
-   *
-   *  and
-   *
-   *    B_gamma = gamma_11 * gamma_22 - gamma_12^{2}
-   *             +gamma_11 * gamma_33 - gamma_13^{2}
-   *             +gamma_22 * gamma_33 - gamma_23^{2}
-   *
-   *  Note that if ||grad(u)||^{2} = 0, nu_SGS is consistently defined as zero.
-   *
-   */
-  void
-  vreman_model(scalar const & filter_width,
-               tensor const & velocity_gradient,
-               double const & C,
-               scalar &       viscosity) const;
-
-  /*
-   *  WALE (wall-adapting local eddy-viscosity) model (Nicoud & Ducros 1999):
-   *
-   *    nu_SGS = (C * filter_width)^{2} * D ,
-   *
-   *  where the differential operator D is defined as
-   *
-   *    D = (S^{d}:S^{d})^{3/2} / ( (S:S)^{5/2} + (S^{d}:S^{d})^{5/4} )
-   *
-   *    where S is the symmetric part of the velocity gradient
-   *
-   *      S = 1/2 * (grad(u) + grad(u)^T) and S:S = S_ij * S_ij
-   *
-   *    and S^{d} the traceless symmetric part of the square of the velocity
-   *    gradient tensor
-   *
-   *      S^{d} = 1/2 * (g^{2} + (g^{2})^T) - 1/3 * trace(g^{2}) * I
-   *
-   *    with the square of the velocity gradient tensor
-   *
-   *      g^{2} = grad(u) * grad(u)
-   *
-   *    and the identity tensor I.
-   *
-   */
-  void
-  wale_model(scalar const & filter_width,
-             tensor const & velocity_gradient,
-             double const & C,
-             scalar &       viscosity) const;
-
-  /*
-   *  Sigma model (Toda et al. 2010, Nicoud et al. 2011):
-   *
-   *    nu_SGS = (C * filter_width)^{2} * D
-   *
-   *    where the differential operator D is defined as
-   *
-   *      D = s3 * (s1 - s2) * (s2 - s3) / s1^{2}
-   *
-   *    where s1 >= s2 >= s3 >= 0 are the singular values of
-   *    the velocity gradient tensor g = grad(u).
-   *
-   *    The model constant is
-   *
-   *      C = 1.35 (Nicoud et al. (2011)) ,
-   *      C = 1.5  (Toda et al. (2010)) .
-   */
-  void
-  sigma_model(scalar const & filter_width,
-              tensor const & velocity_gradient,
-              double const & C,
-              scalar &       viscosity) const;
-
-
   TurbulenceModelData turb_model_data;
 
+  TurbulenceModelKernel<dim, Number> turbulence_model_kernel;
+
   dealii::MatrixFree<dim, Number> const * matrix_free;
 
   std::shared_ptr<Operators::ViscousKernel<dim, Number>> viscous_kernel;
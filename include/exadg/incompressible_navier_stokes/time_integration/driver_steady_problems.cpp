@@ -169,8 +169,13 @@ DriverSteadyProblems<dim, Number>::do_solve(double const time, bool unsteady_pro
       solution, rhs, this->param.update_preconditioner_coupled, time);
 
     if(print_solver_info(time, unsteady_problem) and not(this->is_test))
+    {
       print_solver_info_nonlinear(pcout, std::get<0>(iter), std::get<1>(iter), timer.wall_time());
 
+      if(this->param.newton_solver_data_coupled.use_inexact_newton)
+        pde_operator->get_newton_statistics().print(pcout);
+    }
+
     iterations.first += 1;
     std::get<0>(iterations.second) += std::get<0>(iter);
     std::get<1>(iterations.second) += std::get<1>(iter);
@@ -23,6 +23,7 @@
 #include <exadg/incompressible_navier_stokes/spatial_discretization/spatial_operator_base.h>
 #include <exadg/incompressible_navier_stokes/time_integration/time_int_bdf.h>
 #include <exadg/incompressible_navier_stokes/user_interface/parameters.h>
+#include <exadg/time_integration/operator_integration_factor.h>
 #include <exadg/time_integration/push_back_vectors.h>
 #include <exadg/time_integration/time_step_calculation.h>
 
@@ -45,7 +46,8 @@ TimeIntBDF<dim, Number>::TimeIntBDF(
                            param_in.adaptive_time_stepping,
                            param_in.restart_data,
                            mpi_comm_in,
-                           is_test_in),
+                           is_test_in,
+                           param_in.error_controller_data),
     param(param_in),
     refine_steps_time(param_in.n_refine_time),
     cfl(param.cfl / std::pow(2.0, refine_steps_time)),
@@ -54,6 +56,7 @@ TimeIntBDF<dim, Number>::TimeIntBDF(
     use_extrapolation(true),
     store_solution(false),
     postprocessor(postprocessor_in),
+    cfl_oif(param_in.cfl_oif / std::pow(2.0, refine_steps_time)),
     vec_grid_coordinates(param_in.order_time_integrator)
 {
 }
@@ -122,6 +125,45 @@ TimeIntBDF<dim, Number>::setup_derived()
       initialize_vec_convective_term();
     }
   }
+
+  if(this->param.convective_problem() &&
+     this->param.treatment_of_convective_term == TreatmentOfConvectiveTerm::ExplicitOIF)
+  {
+    initialize_oif();
+  }
+}
+
+template<int dim, typename Number>
+void
+TimeIntBDF<dim, Number>::initialize_oif()
+{
+  convective_operator_oif = std::make_shared<OperatorOIF<dim, Number>>(operator_base);
+
+  time_integrator_oif =
+    create_time_integrator_oif<OperatorOIF<dim, Number>, VectorType>(param.time_integrator_oif,
+                                                                      convective_operator_oif);
+}
+
+template<int dim, typename Number>
+void
+TimeIntBDF<dim, Number>::calculate_sum_alphai_ui(VectorType & sum_alphai_ui)
+{
+  if(this->param.convective_problem() &&
+     this->param.treatment_of_convective_term == TreatmentOfConvectiveTerm::ExplicitOIF)
+  {
+    std::vector<VectorType const *> velocities(this->order);
+    for(unsigned int i = 0; i < this->order; ++i)
+      velocities[i] = &get_velocity(i);
+
+    this->calculate_sum_alphai_ui_oif_substepping(
+      sum_alphai_ui, *time_integrator_oif, velocities, cfl, cfl_oif);
+  }
+  else
+  {
+    sum_alphai_ui.equ(this->bdf.get_alpha(0) / this->get_time_step_size(), get_velocity(0));
+    for(unsigned int i = 1; i < this->order; ++i)
+      sum_alphai_ui.add(this->bdf.get_alpha(i) / this->get_time_step_size(), get_velocity(i));
+  }
 }
 
 template<int dim, typename Number>
@@ -342,9 +384,15 @@ template<int dim, typename Number>
 double
 TimeIntBDF<dim, Number>::recalculate_time_step_size() const
 {
-  AssertThrow(param.calculation_of_time_step_size == TimeStepCalculation::CFL,
-              dealii::ExcMessage(
-                "Adaptive time step is not implemented for this type of time step calculation."));
+  if(param.calculation_of_time_step_size != TimeStepCalculation::CFL)
+  {
+    AssertThrow(param.error_controller_data.active,
+                dealii::ExcMessage(
+                  "Adaptive time step is not implemented for this type of time step calculation."));
+
+    // the time step size is determined by the error controller only
+    return std::numeric_limits<double>::max();
+  }
 
   VectorType u_relative = get_velocity();
   if(param.ale_formulation == true)
@@ -367,6 +415,21 @@ TimeIntBDF<dim, Number>::recalculate_time_step_size() const
   return new_time_step_size;
 }
 
+template<int dim, typename Number>
+typename TimeIntBDF<dim, Number>::VectorType const &
+TimeIntBDF<dim, Number>::get_solution_np_error_estimation() const
+{
+  // the temporal error is estimated for the velocity only
+  return get_velocity_np();
+}
+
+template<int dim, typename Number>
+typename TimeIntBDF<dim, Number>::VectorType const &
+TimeIntBDF<dim, Number>::get_solution_error_estimation(unsigned int const i) const
+{
+  return get_velocity(i);
+}
+
 template<int dim, typename Number>
 bool
 TimeIntBDF<dim, Number>::print_solver_info() const
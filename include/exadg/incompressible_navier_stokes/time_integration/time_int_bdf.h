@@ -37,6 +37,9 @@ class Parameters;
 template<int dim, typename Number>
 class SpatialOperatorBase;
 
+template<int dim, typename Number>
+class OperatorOIF;
+
 template<typename Number>
 class PostProcessorInterface;
 
@@ -108,6 +111,14 @@ protected:
   void
   prepare_vectors_for_next_timestep() override;
 
+  /*
+   * Calculates the sum of the velocities at previous instants of time weighted by the BDF
+   * coefficients, sum_i (alpha_i/dt * u_{n-i}). In case of operator-integration-factor splitting,
+   * the velocities are transported to t_{n+1} by the sub-steps of the explicit time integrator.
+   */
+  void
+  calculate_sum_alphai_ui(VectorType & sum_alphai_ui);
+
   Parameters const & param;
 
   // number of refinement steps, where the time step size is reduced in
@@ -132,12 +143,21 @@ private:
   void
   initialize_vec_convective_term();
 
+  void
+  initialize_oif();
+
   double
   calculate_time_step_size() final;
 
   double
   recalculate_time_step_size() const final;
 
+  VectorType const &
+  get_solution_np_error_estimation() const final;
+
+  VectorType const &
+  get_solution_error_estimation(unsigned int const i) const final;
+
   virtual VectorType const &
   get_velocity(unsigned int i /* t_{n-i} */) const = 0;
 
@@ -156,6 +176,14 @@ private:
   // postprocessor
   std::shared_ptr<PostProcessorInterface<Number>> postprocessor;
 
+  // operator-integration-factor splitting
+  double const cfl_oif;
+
+  std::shared_ptr<OperatorOIF<dim, Number>> convective_operator_oif;
+
+  std::shared_ptr<ExplicitTimeIntegrator<OperatorOIF<dim, Number>, VectorType>>
+    time_integrator_oif;
+
   // ALE
   VectorType              grid_velocity;
   std::vector<VectorType> vec_grid_coordinates;
@@ -43,7 +43,8 @@ TimeIntBDFCoupled<dim, Number>::TimeIntBDFCoupled(
     iterations({0, {0, 0}}),
     iterations_penalty({0, 0}),
     scaling_factor_continuity(1.0),
-    characteristic_element_length(1.0)
+    characteristic_element_length(1.0),
+    time_step_preconditioner(-1.0)
 {
 }
 
@@ -219,10 +220,12 @@ TimeIntBDFCoupled<dim, Number>::do_timestep_solve()
   // calculate auxiliary variable p^{*} = 1/scaling_factor * p
   solution_np.block(1) *= 1.0 / scaling_factor_continuity;
 
-  bool const update_preconditioner =
-    this->param.update_preconditioner_coupled &&
+  bool const regular_update =
     ((this->time_step_number - 1) % this->param.update_preconditioner_coupled_every_time_steps ==
      0);
+  bool const update_preconditioner =
+    this->param.update_preconditioner_coupled &&
+    this->preconditioner_update_required(regular_update, time_step_preconditioner);
 
   if(this->param.linear_problem_has_to_be_solved())
   {
@@ -258,11 +261,7 @@ TimeIntBDFCoupled<dim, Number>::do_timestep_solve()
     VectorType sum_alphai_ui(solution[0].block(0));
 
     // calculate Sum_i (alpha_i/dt * u_i)
-    sum_alphai_ui.equ(this->bdf.get_alpha(0) / this->get_time_step_size(), solution[0].block(0));
-    for(unsigned int i = 1; i < solution.size(); ++i)
-    {
-      sum_alphai_ui.add(this->bdf.get_alpha(i) / this->get_time_step_size(), solution[i].block(0));
-    }
+    this->calculate_sum_alphai_ui(sum_alphai_ui);
 
     // apply mass operator to sum_alphai_ui and add to rhs vector
     pde_operator->apply_mass_operator_add(rhs_vector.block(0), sum_alphai_ui);
@@ -289,11 +288,7 @@ TimeIntBDFCoupled<dim, Number>::do_timestep_solve()
     VectorType sum_alphai_ui(solution[0].block(0));
 
     // calculate Sum_i (alpha_i/dt * u_i)
-    sum_alphai_ui.equ(this->bdf.get_alpha(0) / this->get_time_step_size(), solution[0].block(0));
-    for(unsigned int i = 1; i < solution.size(); ++i)
-    {
-      sum_alphai_ui.add(this->bdf.get_alpha(i) / this->get_time_step_size(), solution[i].block(0));
-    }
+    this->calculate_sum_alphai_ui(sum_alphai_ui);
 
     VectorType rhs(sum_alphai_ui);
     pde_operator->apply_mass_operator(rhs, sum_alphai_ui);
@@ -320,6 +315,9 @@ TimeIntBDFCoupled<dim, Number>::do_timestep_solve()
                                   std::get<0>(iter),
                                   std::get<1>(iter),
                                   timer.wall_time());
+
+      if(this->param.newton_solver_data_coupled.use_inexact_newton)
+        pde_operator->get_newton_statistics().print(this->pcout);
     }
   }
 
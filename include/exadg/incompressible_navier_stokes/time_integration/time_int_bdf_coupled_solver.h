@@ -132,6 +132,9 @@ private:
   // scaling factor continuity equation
   double scaling_factor_continuity;
   double characteristic_element_length;
+
+  // time step size of the last update of the preconditioner
+  double time_step_preconditioner;
 };
 
 } // namespace IncNS
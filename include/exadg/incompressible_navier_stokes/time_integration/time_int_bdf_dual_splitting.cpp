@@ -48,7 +48,8 @@ TimeIntBDFDualSplitting<dim, Number>::TimeIntBDFDualSplitting(
     iterations_penalty({0, 0}),
     iterations_mass({0, 0}),
     extra_pressure_nbc(this->param.order_extrapolation_pressure_nbc,
-                       this->param.start_with_low_order)
+                       this->param.start_with_low_order),
+    time_step_preconditioner_viscous(-1.0)
 {
 }
 
@@ -369,10 +370,9 @@ TimeIntBDFDualSplitting<dim, Number>::convective_step()
   iterations_mass.second += n_iter_mass;
 
   // calculate sum (alpha_i/dt * u_i) and add to velocity_np
-  for(unsigned int i = 0; i < velocity.size(); ++i)
-  {
-    velocity_np.add(this->bdf.get_alpha(i) / this->get_time_step_size(), velocity[i]);
-  }
+  VectorType sum_alphai_ui(velocity[0]);
+  this->calculate_sum_alphai_ui(sum_alphai_ui);
+  velocity_np += sum_alphai_ui;
 
   // solve discrete temporal derivative term for intermediate velocity u_hat
   velocity_np *= this->get_time_step_size() / this->bdf.get_gamma0();
@@ -468,6 +468,9 @@ TimeIntBDFDualSplitting<dim, Number>::pressure_step()
   {
     this->pcout << std::endl << "Solve pressure step:";
     print_solver_info_linear(this->pcout, n_iter, timer.wall_time());
+    if(this->param.solver_data_pressure_poisson.solution_history_size > 0)
+      print_solver_info_solution_history(this->pcout,
+                                         pde_operator->get_n_saved_iterations_pressure());
   }
 
   this->timer_tree->insert({"Timeloop", "Pressure step"}, timer.wall_time());
@@ -735,10 +738,12 @@ TimeIntBDFDualSplitting<dim, Number>::viscous_step()
     }
 
     // solve linear system of equations
-    bool const update_preconditioner =
-      this->param.update_preconditioner_viscous &&
+    bool const regular_update =
       ((this->time_step_number - 1) % this->param.update_preconditioner_viscous_every_time_steps ==
        0);
+    bool const update_preconditioner =
+      this->param.update_preconditioner_viscous &&
+      this->preconditioner_update_required(regular_update, time_step_preconditioner_viscous);
 
     unsigned int const n_iter = pde_operator->solve_viscous(
       velocity_np, rhs, update_preconditioner, this->get_scaling_factor_time_derivative_term());
@@ -753,6 +758,9 @@ TimeIntBDFDualSplitting<dim, Number>::viscous_step()
     {
       this->pcout << std::endl << "Solve viscous step:";
       print_solver_info_linear(this->pcout, n_iter, timer.wall_time());
+      if(this->param.solver_data_viscous.solution_history_size > 0)
+        print_solver_info_solution_history(this->pcout,
+                                           pde_operator->get_n_saved_iterations_viscous());
     }
   }
   else // inviscid
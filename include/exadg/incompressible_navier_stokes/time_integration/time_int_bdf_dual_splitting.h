@@ -176,6 +176,9 @@ private:
 
   // time integrator constants: extrapolation scheme
   ExtrapolationConstants extra_pressure_nbc;
+
+  // time step size of the last update of the preconditioner of the viscous step
+  double time_step_preconditioner_viscous;
 };
 
 } // namespace IncNS
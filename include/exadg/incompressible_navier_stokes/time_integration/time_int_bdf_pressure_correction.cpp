@@ -46,7 +46,8 @@ TimeIntBDFPressureCorrection<dim, Number>::TimeIntBDFPressureCorrection(
     pressure_dbc(param_in.order_pressure_extrapolation),
     iterations_momentum({0, {0, 0}}),
     iterations_pressure({0, 0}),
-    iterations_projection({0, 0})
+    iterations_projection({0, 0}),
+    time_step_preconditioner_momentum(-1.0)
 {
 }
 
@@ -386,10 +387,12 @@ TimeIntBDFPressureCorrection<dim, Number>::momentum_step()
    *  Solve the linear or nonlinear problem.
    */
 
-  bool const update_preconditioner =
-    this->param.update_preconditioner_momentum &&
+  bool const regular_update =
     ((this->time_step_number - 1) % this->param.update_preconditioner_momentum_every_time_steps ==
      0);
+  bool const update_preconditioner =
+    this->param.update_preconditioner_momentum &&
+    this->preconditioner_update_required(regular_update, time_step_preconditioner_momentum);
 
   if(this->param.linear_problem_has_to_be_solved())
   {
@@ -514,11 +517,7 @@ TimeIntBDFPressureCorrection<dim, Number>::rhs_momentum(VectorType & rhs)
   VectorType sum_alphai_ui(velocity[0]);
 
   // calculate sum (alpha_i/dt * u_i)
-  sum_alphai_ui.equ(this->bdf.get_alpha(0) / this->get_time_step_size(), velocity[0]);
-  for(unsigned int i = 1; i < velocity.size(); ++i)
-  {
-    sum_alphai_ui.add(this->bdf.get_alpha(i) / this->get_time_step_size(), velocity[i]);
-  }
+  this->calculate_sum_alphai_ui(sum_alphai_ui);
 
   pde_operator->apply_mass_operator_add(rhs, sum_alphai_ui);
 
@@ -605,6 +604,9 @@ TimeIntBDFPressureCorrection<dim, Number>::pressure_step(VectorType & pressure_i
   {
     this->pcout << std::endl << "Solve pressure step:";
     print_solver_info_linear(this->pcout, n_iter, timer.wall_time());
+    if(this->param.solver_data_pressure_poisson.solution_history_size > 0)
+      print_solver_info_solution_history(this->pcout,
+                                         pde_operator->get_n_saved_iterations_pressure());
   }
 
   this->timer_tree->insert({"Timeloop", "Pressure step"}, timer.wall_time());
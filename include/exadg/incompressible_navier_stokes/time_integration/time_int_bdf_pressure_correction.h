@@ -178,6 +178,9 @@ private:
     iterations_pressure;
   std::pair<unsigned int /* calls */, unsigned long long /* iteration counts */>
     iterations_projection;
+
+  // time step size of the last update of the preconditioner of the momentum step
+  double time_step_preconditioner_momentum;
 };
 
 } // namespace IncNS
@@ -212,6 +212,9 @@ enum_to_string(TreatmentOfConvectiveTerm const enum_type)
     case TreatmentOfConvectiveTerm::Explicit:
       string_type = "Explicit";
       break;
+    case TreatmentOfConvectiveTerm::ExplicitOIF:
+      string_type = "ExplicitOIF";
+      break;
     case TreatmentOfConvectiveTerm::Implicit:
       string_type = "Implicit";
       break;
@@ -223,7 +226,6 @@ enum_to_string(TreatmentOfConvectiveTerm const enum_type)
   return string_type;
 }
 
-
 std::string
 enum_to_string(TimeStepCalculation const enum_type)
 {
@@ -753,6 +755,9 @@ enum_to_string(SolverCoupled const enum_type)
     case SolverCoupled::FGMRES:
       string_type = "FGMRES";
       break;
+    case SolverCoupled::GCRODR:
+      string_type = "GCRODR";
+      break;
     default:
       AssertThrow(false, dealii::ExcMessage("Not implemented."));
       break;
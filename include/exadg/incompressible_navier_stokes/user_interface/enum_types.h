@@ -147,12 +147,15 @@ std::string
 enum_to_string(TemporalDiscretization const enum_type);
 
 /*
- *  The convective term can be treated explicitly (Explicit) or implicitly (Implicit).
+ *  The convective term can be treated explicitly (Explicit) or implicitly (Implicit). In case of
+ *  operator-integration-factor splitting (ExplicitOIF, Maday et al. 1990), the convective term is
+ *  integrated explicitly with sub-steps of an explicit Runge-Kutta method.
  */
 enum class TreatmentOfConvectiveTerm
 {
   Undefined,
   Explicit,
+  ExplicitOIF,
   Implicit
 };
 
@@ -549,11 +552,15 @@ enum_to_string(SolverMomentum const enum_type);
  *
  * - FGMRES might be necessary if a Krylov method is used inside the preconditioner
  *   (e.g., as multigrid smoother or as multigrid coarse grid solver).
+ *
+ * - GCRODR (flexible) recycles a subspace from one linear solve to the next, which reduces the
+ *   number of iterations for the sequence of linear systems of the Newton solver.
  */
 enum class SolverCoupled
 {
   GMRES,
-  FGMRES
+  FGMRES,
+  GCRODR
 };
 
 std::string
@@ -59,13 +59,16 @@ Parameters::Parameters()
     solver_type(SolverType::Undefined),
     temporal_discretization(TemporalDiscretization::Undefined),
     treatment_of_convective_term(TreatmentOfConvectiveTerm::Undefined),
+    time_integrator_oif(TimeIntegratorOIF::Undefined),
     calculation_of_time_step_size(TimeStepCalculation::Undefined),
     adaptive_time_stepping(false),
     adaptive_time_stepping_limiting_factor(1.2),
     time_step_size_max(std::numeric_limits<double>::max()),
     adaptive_time_stepping_cfl_type(CFLConditionType::VelocityNorm),
+    error_controller_data(ErrorControllerData()),
     max_velocity(-1.),
     cfl(-1.),
+    cfl_oif(-1.),
     cfl_exponent_fe_degree_velocity(2.0),
     c_eff(-1.),
     time_step_size(-1.),
@@ -134,6 +137,8 @@ Parameters::Parameters()
     use_turbulence_model(false),
     turbulence_model_constant(1.0),
     turbulence_model(TurbulenceEddyViscosityModel::Undefined),
+    turbulent_viscosity_single_precision(false),
+    turbulence_model_on_the_fly(false),
 
     // NUMERICAL PARAMETERS
     implement_block_diagonal_preconditioner_matrix_free(false),
@@ -345,6 +350,41 @@ Parameters::check(dealii::ConditionalOStream const & pcout) const
                   "Adaptive time stepping is only implemented for TimeStepCalculation::CFL."));
   }
 
+  if(error_controller_data.active)
+  {
+    AssertThrow(solver_type == SolverType::Unsteady,
+                dealii::ExcMessage(
+                  "Error-controlled time stepping can only be used with an unsteady solver."));
+
+    // a rejected time step would have to be repeated on a different mesh
+    AssertThrow(ale_formulation == false,
+                dealii::ExcMessage("Error-controlled time stepping is not implemented for the "
+                                   "ALE formulation."));
+  }
+
+  if(convective_problem() and
+     treatment_of_convective_term == TreatmentOfConvectiveTerm::ExplicitOIF)
+  {
+    AssertThrow(solver_type == SolverType::Unsteady,
+                dealii::ExcMessage("Operator-integration-factor splitting can only be used with "
+                                   "an unsteady solver."));
+
+    AssertThrow(time_integrator_oif != TimeIntegratorOIF::Undefined,
+                dealii::ExcMessage("parameter must be defined"));
+
+    AssertThrow(cfl_oif > 0., dealii::ExcMessage("parameter must be defined"));
+
+    AssertThrow(calculation_of_time_step_size == TimeStepCalculation::CFL,
+                dealii::ExcMessage("The size of the sub-steps of the operator-integration-factor "
+                                   "splitting is derived from the CFL condition. Use "
+                                   "TimeStepCalculation::CFL."));
+
+    // the sub-steps would have to be performed on the meshes of the former time steps
+    AssertThrow(ale_formulation == false,
+                dealii::ExcMessage("Operator-integration-factor splitting is not implemented "
+                                   "for the ALE formulation."));
+  }
+
   // SPATIAL DISCRETIZATION
 
   grid.check();
@@ -396,6 +436,11 @@ Parameters::check(dealii::ConditionalOStream const & pcout) const
   {
     AssertThrow(type_penalty_parameter != TypePenaltyParameter::Undefined,
                 dealii::ExcMessage("Parameter must be defined"));
+
+    // the penalty parameters, and hence the projection operator, change in every time step
+    AssertThrow(solver_data_projection.solution_history_size == 0,
+                dealii::ExcMessage("A solution history can not be used for the projection step "
+                                   "since the projection operator changes in every time step."));
   }
 
   if(solver_type == SolverType::Steady)
@@ -481,7 +526,8 @@ Parameters::check(dealii::ConditionalOStream const & pcout) const
       AssertThrow(multigrid_operator_type_momentum != MultigridOperatorType::Undefined,
                   dealii::ExcMessage("Parameter must be defined"));
 
-      if(treatment_of_convective_term == TreatmentOfConvectiveTerm::Explicit)
+      if(treatment_of_convective_term == TreatmentOfConvectiveTerm::Explicit or
+         treatment_of_convective_term == TreatmentOfConvectiveTerm::ExplicitOIF)
       {
         AssertThrow(
           multigrid_operator_type_momentum != MultigridOperatorType::ReactionConvectionDiffusion,
@@ -496,6 +542,10 @@ Parameters::check(dealii::ConditionalOStream const & pcout) const
     if(use_scaling_continuity == true)
       AssertThrow(scaling_factor_continuity > 0.0, dealii::ExcMessage("Invalid parameter"));
 
+    if(solver_coupled == SolverCoupled::GCRODR)
+      AssertThrow(solver_data_coupled.recycle_space_size > 0,
+                  dealii::ExcMessage("Size of recycle space has to be larger than zero."));
+
     if(preconditioner_velocity_block == MomentumPreconditioner::Multigrid)
     {
       AssertThrow(multigrid_operator_type_velocity_block != MultigridOperatorType::Undefined,
@@ -509,7 +559,8 @@ Parameters::check(dealii::ConditionalOStream const & pcout) const
                       "Invalid parameter (the specified equation type is Stokes)."));
       }
 
-      if(treatment_of_convective_term == TreatmentOfConvectiveTerm::Explicit)
+      if(treatment_of_convective_term == TreatmentOfConvectiveTerm::Explicit or
+         treatment_of_convective_term == TreatmentOfConvectiveTerm::ExplicitOIF)
       {
         AssertThrow(multigrid_operator_type_velocity_block !=
                       MultigridOperatorType::ReactionConvectionDiffusion,
@@ -519,6 +570,64 @@ Parameters::check(dealii::ConditionalOStream const & pcout) const
     }
   }
 
+  // MULTIGRID CYCLES (full multigrid is not supported by the Navier-Stokes solvers)
+  if(temporal_discretization == TemporalDiscretization::BDFDualSplittingScheme or
+     temporal_discretization == TemporalDiscretization::BDFPressureCorrection)
+  {
+    if(preconditioner_pressure_poisson == PreconditionerPressurePoisson::Multigrid)
+    {
+      multigrid_data_pressure_poisson.cycle_data.check(
+        solver_pressure_poisson == SolverPressurePoisson::FGMRES,
+        false /* full_multigrid_supported */);
+    }
+  }
+
+  if(temporal_discretization == TemporalDiscretization::BDFDualSplittingScheme and
+     preconditioner_viscous == PreconditionerViscous::Multigrid)
+  {
+    multigrid_data_viscous.cycle_data.check(solver_viscous == SolverViscous::FGMRES,
+                                            false /* full_multigrid_supported */);
+  }
+
+  if(temporal_discretization == TemporalDiscretization::BDFPressureCorrection and
+     preconditioner_momentum == MomentumPreconditioner::Multigrid)
+  {
+    multigrid_data_momentum.cycle_data.check(solver_momentum == SolverMomentum::FGMRES,
+                                             false /* full_multigrid_supported */);
+  }
+
+  if(temporal_discretization == TemporalDiscretization::BDFCoupledSolution or
+     solver_type == SolverType::Steady)
+  {
+    bool const flexible_solver =
+      solver_coupled == SolverCoupled::FGMRES or solver_coupled == SolverCoupled::GCRODR;
+
+    if(preconditioner_coupled != PreconditionerCoupled::None)
+    {
+      if(preconditioner_velocity_block == MomentumPreconditioner::Multigrid)
+      {
+        multigrid_data_velocity_block.cycle_data.check(flexible_solver,
+                                                       false /* full_multigrid_supported */);
+      }
+
+      // the Laplace operator is inverted by multigrid or by CG preconditioned by multigrid
+      if(preconditioner_pressure_block != SchurComplementPreconditioner::None and
+         preconditioner_pressure_block != SchurComplementPreconditioner::InverseMassMatrix)
+      {
+        multigrid_data_pressure_block.cycle_data.check(
+          flexible_solver and not(exact_inversion_of_laplace_operator),
+          false /* full_multigrid_supported */);
+      }
+    }
+  }
+
+  if(preconditioner_projection == PreconditionerProjection::Multigrid and
+     (use_divergence_penalty or use_continuity_penalty))
+  {
+    multigrid_data_projection.cycle_data.check(solver_projection == SolverProjection::FGMRES,
+                                               false /* full_multigrid_supported */);
+  }
+
   // NUMERICAL PARAMETERS
   if(implement_block_diagonal_preconditioner_matrix_free)
   {
@@ -568,7 +677,8 @@ bool
 Parameters::linear_problem_has_to_be_solved() const
 {
   return equation_type == EquationType::Stokes ||
-         treatment_of_convective_term == TreatmentOfConvectiveTerm::Explicit;
+         treatment_of_convective_term == TreatmentOfConvectiveTerm::Explicit ||
+         treatment_of_convective_term == TreatmentOfConvectiveTerm::ExplicitOIF;
 }
 
 bool
@@ -788,6 +898,14 @@ Parameters::print_parameters_temporal_discretization(dealii::ConditionalOStream
                   "Treatment of convective term",
                   enum_to_string(treatment_of_convective_term));
 
+  if(treatment_of_convective_term == TreatmentOfConvectiveTerm::ExplicitOIF)
+  {
+    print_parameter(pcout,
+                    "Time integrator for OIF splitting",
+                    enum_to_string(time_integrator_oif));
+    print_parameter(pcout, "CFL number for OIF splitting", cfl_oif);
+  }
+
   print_parameter(pcout,
                   "Calculation of time step size",
                   enum_to_string(calculation_of_time_step_size));
@@ -807,6 +925,9 @@ Parameters::print_parameters_temporal_discretization(dealii::ConditionalOStream
                     enum_to_string(adaptive_time_stepping_cfl_type));
   }
 
+  if(error_controller_data.active)
+    error_controller_data.print(pcout);
+
 
   // here we do not print quantities such as max_velocity, cfl, time_step_size
   // because this is done by the time integration scheme (or the functions that
@@ -948,6 +1069,10 @@ Parameters::print_parameters_turbulence(dealii::ConditionalOStream const & pcout
   {
     print_parameter(pcout, "Turbulence model", enum_to_string(turbulence_model));
     print_parameter(pcout, "Turbulence model constant", turbulence_model_constant);
+    print_parameter(pcout,
+                    "Turbulent viscosity in single precision",
+                    turbulent_viscosity_single_precision);
+    print_parameter(pcout, "Turbulence model on the fly", turbulence_model_on_the_fly);
   }
 }
 
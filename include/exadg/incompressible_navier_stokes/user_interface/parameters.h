@@ -34,6 +34,7 @@
 #include <exadg/solvers_and_preconditioners/preconditioners/enum_types.h>
 #include <exadg/solvers_and_preconditioners/solvers/solver_data.h>
 #include <exadg/time_integration/enum_types.h>
+#include <exadg/time_integration/error_controller.h>
 #include <exadg/time_integration/restart_data.h>
 #include <exadg/time_integration/solver_info_data.h>
 
@@ -214,6 +215,9 @@ public:
   // description: see enum declaration
   TreatmentOfConvectiveTerm treatment_of_convective_term;
 
+  // description: see enum declaration (only relevant for TreatmentOfConvectiveTerm::ExplicitOIF)
+  TimeIntegratorOIF time_integrator_oif;
+
   // description: see enum declaration
   TimeStepCalculation calculation_of_time_step_size;
 
@@ -236,6 +240,12 @@ public:
   // criterion.
   CFLConditionType adaptive_time_stepping_cfl_type;
 
+  // error-controlled time stepping based on the difference between the velocity at the end of the
+  // time step and the extrapolated predictor. The time step size is the minimum of the time step
+  // size selected by the error controller and the CFL-based time step size in case of
+  // TimeStepCalculation::CFL.
+  ErrorControllerData error_controller_data;
+
   // maximum velocity needed when calculating the time step according to cfl-condition
   double max_velocity;
 
@@ -245,6 +255,11 @@ public:
   // of operator-integration-factor splitting)
   double cfl;
 
+  // cfl number of the explicit Runge-Kutta method used for the sub-steps of the
+  // operator-integration-factor splitting, which has to be smaller than the critical CFL number of
+  // this method. The ratio cfl/cfl_oif determines the number of sub-steps per time step.
+  double cfl_oif;
+
   // dt = CFL/k_u^{exp} * h / || u ||
   double cfl_exponent_fe_degree_velocity;
 
@@ -411,6 +426,14 @@ public:
   // turbulence model
   TurbulenceEddyViscosityModel turbulence_model;
 
+  // store the (variable) viscosity in the quadrature points in single precision to reduce the
+  // memory traffic of the viscous operator
+  bool turbulent_viscosity_single_precision;
+
+  // compute the turbulent viscosity on the fly in the quadrature points from the velocity
+  // gradient instead of storing it, which trades memory traffic for arithmetic operations
+  bool turbulence_model_on_the_fly;
+
 
   /**************************************************************************************/
   /*                                                                                    */
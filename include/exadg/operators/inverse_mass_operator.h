@@ -22,12 +22,16 @@
 #ifndef INCLUDE_OPERATORS_INVERSEMASSMATRIX_H_
 #define INCLUDE_OPERATORS_INVERSEMASSMATRIX_H_
 
+// C/C++
+#include <functional>
+
 // deal.II
 #include <deal.II/lac/la_parallel_vector.h>
 #include <deal.II/matrix_free/operators.h>
 
 // ExaDG
 #include <exadg/matrix_free/integrators.h>
+#include <exadg/time_integration/multirate_levels.h>
 
 namespace ExaDG
 {
@@ -48,7 +52,8 @@ private:
   typedef std::pair<unsigned int, unsigned int> Range;
 
 public:
-  InverseMassOperator() : matrix_free(nullptr), dof_index(0), quad_index(0)
+  InverseMassOperator()
+    : matrix_free(nullptr), multirate_levels(nullptr), dof_index(0), quad_index(0)
   {
   }
 
@@ -62,6 +67,15 @@ public:
     quad_index        = quad_index_in;
   }
 
+  /*
+   * Restricts the application of the operator to the cells of the active time step levels.
+   */
+  void
+  set_multirate_levels(MultirateLevels<Number> const * multirate_levels_in)
+  {
+    multirate_levels = multirate_levels_in;
+  }
+
   void
   apply(VectorType & dst, VectorType const & src) const
   {
@@ -70,6 +84,55 @@ public:
     matrix_free->cell_loop(&This::cell_loop, this, dst, src);
   }
 
+  /*
+   * Applies the inverse mass operator to vec_ki in-place and performs the vector updates of a
+   * stage of a low-storage Runge-Kutta method with two registers,
+   *
+   *   vec_ri   = solution + factor_ri * M^{-1} vec_ki (only if update_ri == true),
+   *   solution = solution + factor_solution * M^{-1} vec_ki.
+   *
+   * The vector updates are executed by MatrixFree::cell_loop() on the DoF ranges of the cells
+   * that have just been processed, i.e., while the data is still in cache. This replaces the
+   * separate passes through the vectors otherwise needed for the inverse mass operator and the
+   * vector updates.
+   */
+  void
+  apply_and_update_stage(VectorType & solution,
+                         VectorType & vec_ri,
+                         VectorType & vec_ki,
+                         Number const factor_ri,
+                         Number const factor_solution,
+                         bool const   update_ri) const
+  {
+    vec_ki.zero_out_ghost_values();
+
+    matrix_free->cell_loop(
+      &This::cell_loop,
+      this,
+      vec_ki,
+      vec_ki,
+      std::function<void(unsigned int const, unsigned int const)>(),
+      [&](unsigned int const start_range, unsigned int const end_range) {
+        if(update_ri)
+        {
+          for(unsigned int i = start_range; i < end_range; ++i)
+          {
+            Number const k_i        = vec_ki.local_element(i);
+            Number const solution_i = solution.local_element(i);
+
+            vec_ri.local_element(i)   = solution_i + factor_ri * k_i;
+            solution.local_element(i) = solution_i + factor_solution * k_i;
+          }
+        }
+        else
+        {
+          for(unsigned int i = start_range; i < end_range; ++i)
+            solution.local_element(i) += factor_solution * vec_ki.local_element(i);
+        }
+      },
+      dof_index);
+  }
+
 private:
   void
   cell_loop(dealii::MatrixFree<dim, Number> const &,
@@ -82,6 +145,9 @@ private:
 
     for(unsigned int cell = cell_range.first; cell < cell_range.second; ++cell)
     {
+      if(multirate_levels != nullptr and not multirate_levels->is_active_cell_batch(cell))
+        continue;
+
       integrator.reinit(cell);
       integrator.read_dof_values(src, 0);
 
@@ -93,6 +159,8 @@ private:
 
   dealii::MatrixFree<dim, Number> const * matrix_free;
 
+  MultirateLevels<Number> const * multirate_levels;
+
   unsigned int dof_index, quad_index;
 };
 
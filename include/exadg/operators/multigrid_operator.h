@@ -164,6 +164,18 @@ public:
   }
 #endif
 
+  virtual void
+  init_system_matrix(SparseMatrixCSR & system_matrix, MPI_Comm const & mpi_comm) const
+  {
+    pde_operator->init_system_matrix(system_matrix, mpi_comm);
+  }
+
+  virtual void
+  calculate_system_matrix(SparseMatrixCSR & system_matrix) const
+  {
+    pde_operator->calculate_system_matrix(system_matrix);
+  }
+
 private:
   std::shared_ptr<Operator> pde_operator;
 };
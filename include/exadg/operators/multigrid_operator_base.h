@@ -28,6 +28,9 @@
 #include <deal.II/lac/trilinos_sparse_matrix.h>
 #include <deal.II/matrix_free/matrix_free.h>
 
+// ExaDG
+#include <exadg/solvers_and_preconditioners/amg/sparse_matrix_csr.h>
+
 namespace ExaDG
 {
 template<int dim, typename Number>
@@ -104,6 +107,12 @@ public:
   virtual void
   calculate_system_matrix(dealii::PETScWrappers::MPI::SparseMatrix & system_matrix) const = 0;
 #endif
+
+  virtual void
+  init_system_matrix(SparseMatrixCSR & system_matrix, MPI_Comm const & mpi_comm) const = 0;
+
+  virtual void
+  calculate_system_matrix(SparseMatrixCSR & system_matrix) const = 0;
 };
 
 } // namespace ExaDG
@@ -21,6 +21,7 @@
 
 // deal.II
 #include <deal.II/dofs/dof_tools.h>
+#include <deal.II/lac/affine_constraints.templates.h>
 #include <deal.II/lac/sparsity_tools.h>
 #include <deal.II/matrix_free/tools.h>
 
@@ -42,7 +43,8 @@ OperatorBase<dim, Number, n_components>::OperatorBase()
     data(OperatorBaseData()),
     level(dealii::numbers::invalid_unsigned_int),
     block_diagonal_preconditioner_is_initialized(false),
-    n_mpi_processes(0)
+    n_mpi_processes(0),
+    multirate_levels(nullptr)
 {
 }
 
@@ -406,6 +408,14 @@ OperatorBase<dim, Number, n_components>::evaluate_add(VectorType &       dst,
     &This::cell_loop, &This::face_loop, &This::boundary_face_loop_full_operator, this, dst, src);
 }
 
+template<int dim, typename Number, int n_components>
+void
+OperatorBase<dim, Number, n_components>::set_multirate_levels(
+  MultirateLevels<Number> const * multirate_levels_in)
+{
+  multirate_levels = multirate_levels_in;
+}
+
 template<int dim, typename Number, int n_components>
 void
 OperatorBase<dim, Number, n_components>::calculate_diagonal(VectorType & diagonal) const
@@ -746,6 +756,66 @@ OperatorBase<dim, Number, n_components>::calculate_system_matrix(
 }
 #endif
 
+template<int dim, typename Number, int n_components>
+void
+OperatorBase<dim, Number, n_components>::init_system_matrix(SparseMatrixCSR & system_matrix,
+                                                            MPI_Comm const &  mpi_comm) const
+{
+  internal_init_system_matrix(system_matrix, mpi_comm);
+
+  // the aggregation of the algebraic multigrid method only groups unknowns of the same component
+  if(n_components > 1)
+  {
+    dealii::DoFHandler<dim> const & dof_handler =
+      this->matrix_free->get_dof_handler(this->data.dof_index);
+    dealii::FiniteElement<dim> const & fe         = dof_handler.get_fe();
+    dealii::IndexSet const &           owned_dofs = system_matrix.get_locally_owned_rows();
+
+    std::vector<unsigned int>                    components(owned_dofs.n_elements(), 0);
+    std::vector<dealii::types::global_dof_index> dof_indices(fe.dofs_per_cell);
+
+    auto const fill_components = [&]() {
+      for(unsigned int i = 0; i < dof_indices.size(); ++i)
+        if(owned_dofs.is_element(dof_indices[i]))
+          components[owned_dofs.index_within_set(dof_indices[i])] =
+            fe.system_to_component_index(i).first;
+    };
+
+    if(is_mg)
+    {
+      for(auto const & cell : dof_handler.mg_cell_iterators_on_level(this->level))
+      {
+        if(cell->is_locally_owned_on_level())
+        {
+          cell->get_mg_dof_indices(dof_indices);
+          fill_components();
+        }
+      }
+    }
+    else
+    {
+      for(auto const & cell : dof_handler.active_cell_iterators())
+      {
+        if(cell->is_locally_owned())
+        {
+          cell->get_dof_indices(dof_indices);
+          fill_components();
+        }
+      }
+    }
+
+    system_matrix.set_row_components(components);
+  }
+}
+
+template<int dim, typename Number, int n_components>
+void
+OperatorBase<dim, Number, n_components>::calculate_system_matrix(
+  SparseMatrixCSR & system_matrix) const
+{
+  internal_calculate_system_matrix(system_matrix);
+}
+
 template<int dim, typename Number, int n_components>
 template<typename SparseMatrix>
 void
@@ -1034,6 +1104,9 @@ OperatorBase<dim, Number, n_components>::cell_loop(
 
   for(auto cell = range.first; cell < range.second; ++cell)
   {
+    if(multirate_levels != nullptr and not multirate_levels->is_active_cell_batch(cell))
+      continue;
+
     this->reinit_cell(cell);
 
     integrator->gather_evaluate(src, integrator_flags.cell_evaluate);
@@ -1056,6 +1129,9 @@ OperatorBase<dim, Number, n_components>::face_loop(
 
   for(auto face = range.first; face < range.second; ++face)
   {
+    if(multirate_levels != nullptr and not multirate_levels->is_active_face_batch(face))
+      continue;
+
     this->reinit_face(face);
 
     integrator_m->gather_evaluate(src, integrator_flags.face_evaluate);
@@ -1142,6 +1218,9 @@ OperatorBase<dim, Number, n_components>::boundary_face_loop_full_operator(
 {
   for(unsigned int face = range.first; face < range.second; face++)
   {
+    if(multirate_levels != nullptr and not multirate_levels->is_active_face_batch(face))
+      continue;
+
     this->reinit_boundary_face(face);
 
     integrator_m->gather_evaluate(src, integrator_flags.face_evaluate);
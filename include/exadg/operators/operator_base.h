@@ -40,6 +40,7 @@
 #include <exadg/matrix_free/categorization.h>
 #include <exadg/matrix_free/integrators.h>
 
+#include <exadg/solvers_and_preconditioners/amg/sparse_matrix_csr.h>
 #include <exadg/solvers_and_preconditioners/preconditioners/elementwise_preconditioners.h>
 #include <exadg/solvers_and_preconditioners/preconditioners/enum_types.h>
 #include <exadg/solvers_and_preconditioners/solvers/enum_types.h>
@@ -52,6 +53,8 @@
 #include <exadg/operators/mapping_flags.h>
 #include <exadg/operators/operator_type.h>
 
+#include <exadg/time_integration/multirate_levels.h>
+
 namespace ExaDG
 {
 struct OperatorBaseData
@@ -210,6 +213,16 @@ public:
   calculate_system_matrix(dealii::PETScWrappers::MPI::SparseMatrix & system_matrix) const;
 #endif
 
+  /*
+   * Algebraic multigrid (AMG): sparse matrix methods for the native AMG implementation. In addition
+   * to the matrix entries, the vector component of each row is stored for systems of equations.
+   */
+  void
+  init_system_matrix(SparseMatrixCSR & system_matrix, MPI_Comm const & mpi_comm) const;
+
+  void
+  calculate_system_matrix(SparseMatrixCSR & system_matrix) const;
+
   /*
    * Evaluate the homogeneous part of an operator. The homogeneous operator is the operator that is
    * obtained for homogeneous boundary conditions. This operation is typically applied in linear
@@ -250,6 +263,14 @@ public:
   virtual void
   evaluate_add(VectorType & dst, VectorType const & src) const;
 
+  /*
+   * Restricts the standard cell and face loops of the operator (as used by evaluate() and apply())
+   * to the cells and faces adjacent to the cells of the active time step levels of multirate time
+   * integration.
+   */
+  void
+  set_multirate_levels(MultirateLevels<Number> const * multirate_levels);
+
   /*
    * point Jacobi preconditioner (diagonal)
    */
@@ -641,6 +662,11 @@ private:
 
   unsigned int n_mpi_processes;
 
+  /*
+   * Time step levels of multirate time integration (optional).
+   */
+  MultirateLevels<Number> const * multirate_levels;
+
   /*
    * for CG
    */
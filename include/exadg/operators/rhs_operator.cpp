@@ -24,7 +24,8 @@
 namespace ExaDG
 {
 template<int dim, typename Number, int n_components>
-RHSOperator<dim, Number, n_components>::RHSOperator() : matrix_free(nullptr), time(0.0)
+RHSOperator<dim, Number, n_components>::RHSOperator()
+  : matrix_free(nullptr), multirate_levels(nullptr), time(0.0)
 {
 }
 
@@ -60,6 +61,14 @@ RHSOperator<dim, Number, n_components>::evaluate_add(VectorType & dst,
   matrix_free->cell_loop(&This::cell_loop, this, dst, src);
 }
 
+template<int dim, typename Number, int n_components>
+void
+RHSOperator<dim, Number, n_components>::set_multirate_levels(
+  MultirateLevels<Number> const * multirate_levels_in)
+{
+  multirate_levels = multirate_levels_in;
+}
+
 template<int dim, typename Number, int n_components>
 void
 RHSOperator<dim, Number, n_components>::do_cell_integral(IntegratorCell & integrator) const
@@ -86,6 +95,9 @@ RHSOperator<dim, Number, n_components>::cell_loop(
 
   for(unsigned int cell = cell_range.first; cell < cell_range.second; ++cell)
   {
+    if(multirate_levels != nullptr and not multirate_levels->is_active_cell_batch(cell))
+      continue;
+
     integrator.reinit(cell);
 
     do_cell_integral(integrator);
@@ -25,6 +25,7 @@
 #include <exadg/functions_and_boundary_conditions/evaluate_functions.h>
 #include <exadg/matrix_free/integrators.h>
 #include <exadg/operators/mapping_flags.h>
+#include <exadg/time_integration/multirate_levels.h>
 
 namespace ExaDG
 {
@@ -139,6 +140,12 @@ public:
   void
   evaluate_add(VectorType & dst, double const evaluation_time) const;
 
+  /*
+   * Restricts the evaluation to the cells of the active time step levels.
+   */
+  void
+  set_multirate_levels(MultirateLevels<Number> const * multirate_levels);
+
 private:
   void
   do_cell_integral(IntegratorCell & integrator) const;
@@ -155,6 +162,8 @@ private:
 
   dealii::MatrixFree<dim, Number> const * matrix_free;
 
+  MultirateLevels<Number> const * multirate_levels;
+
   RHSOperatorData<dim> data;
 
   mutable double time;
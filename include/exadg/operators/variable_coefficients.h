@@ -21,8 +21,197 @@
 #ifndef INCLUDE_EXADG_OPERATORS_VARIABLE_COEFFICIENTS_H_
 #define INCLUDE_EXADG_OPERATORS_VARIABLE_COEFFICIENTS_H_
 
+// C/C++
+#include <vector>
+
+// deal.II
+#include <deal.II/base/aligned_vector.h>
+#include <deal.II/base/vectorization.h>
+#include <deal.II/matrix_free/matrix_free.h>
+
 namespace ExaDG
 {
+/*
+ * Table of coefficients in the quadrature points of cell or face batches (rows of the table).
+ *
+ * The coefficients can optionally be stored in single precision, also if Number = double.
+ * Furthermore, compress() detects rows in which all quadrature points share the same value. For
+ * these rows, only the first entry is accessed by get(), which reduces the memory traffic when
+ * evaluating operators with (mostly) cellwise constant coefficients. Setting a coefficient in a
+ * row invalidates this information for the row until compress() is called again. Note that the
+ * storage of constant rows is not released, so that only the single precision storage reduces the
+ * memory consumption. compress() reads the whole table, which should be taken into account for
+ * coefficients that change frequently and are rarely constant.
+ */
+template<typename Number>
+class CoefficientTable
+{
+private:
+  typedef dealii::VectorizedArray<Number> scalar;
+
+  static unsigned int constexpr n_lanes = scalar::size();
+
+public:
+  CoefficientTable() : n_rows(0), n_points(0), single_precision(false)
+  {
+  }
+
+  void
+  reinit(unsigned int const n_rows_in,
+         unsigned int const n_points_in,
+         bool const         single_precision_in)
+  {
+    n_rows           = n_rows_in;
+    n_points         = n_points_in;
+    single_precision = single_precision_in;
+
+    std::size_t const size = std::size_t(n_rows) * n_points * n_lanes;
+
+    if(single_precision)
+    {
+      data_float.resize_fast(size);
+      data.clear();
+    }
+    else
+    {
+      data.resize_fast(size);
+      data_float.clear();
+    }
+
+    constant_row.assign(n_rows, 0);
+  }
+
+  unsigned int
+  size() const
+  {
+    return n_rows;
+  }
+
+  bool
+  empty() const
+  {
+    return n_rows == 0;
+  }
+
+  void
+  fill(Number const & value)
+  {
+    if(single_precision)
+      data_float.fill(static_cast<float>(value));
+    else
+      data.fill(value);
+
+    constant_row.assign(n_rows, 1);
+  }
+
+  scalar
+  get(unsigned int const row, unsigned int const q) const
+  {
+    return read(row, constant_row[row] ? 0 : q);
+  }
+
+  void
+  set(unsigned int const row, unsigned int const q, scalar const & value)
+  {
+    if(single_precision)
+    {
+      float * ptr = data_float.data() + offset(row, q);
+      for(unsigned int v = 0; v < n_lanes; ++v)
+        ptr[v] = value[v];
+    }
+    else
+    {
+      value.store(data.data() + offset(row, q));
+    }
+
+    constant_row[row] = 0;
+  }
+
+  bool
+  is_constant(unsigned int const row) const
+  {
+    return constant_row[row];
+  }
+
+  /*
+   * Detects the rows with constant coefficients.
+   */
+  void
+  compress()
+  {
+    for(unsigned int row = 0; row < n_rows; ++row)
+    {
+      if(single_precision)
+        constant_row[row] = row_is_constant(data_float, row);
+      else
+        constant_row[row] = row_is_constant(data, row);
+    }
+  }
+
+  /*
+   * Memory consumption in bytes.
+   */
+  std::size_t
+  memory_consumption() const
+  {
+    return data.memory_consumption() + data_float.memory_consumption() + constant_row.size();
+  }
+
+private:
+  std::size_t
+  offset(unsigned int const row, unsigned int const q) const
+  {
+    return (std::size_t(row) * n_points + q) * n_lanes;
+  }
+
+  scalar
+  read(unsigned int const row, unsigned int const q) const
+  {
+    scalar value;
+
+    if(single_precision)
+    {
+      float const * ptr = data_float.data() + offset(row, q);
+      for(unsigned int v = 0; v < n_lanes; ++v)
+        value[v] = ptr[v];
+    }
+    else
+    {
+      value.load(data.data() + offset(row, q));
+    }
+
+    return value;
+  }
+
+  template<typename StorageNumber>
+  bool
+  row_is_constant(dealii::AlignedVector<StorageNumber> const & storage,
+                  unsigned int const                           row) const
+  {
+    StorageNumber const * first = storage.data() + offset(row, 0);
+
+    for(unsigned int q = 1; q < n_points; ++q)
+    {
+      StorageNumber const * ptr = storage.data() + offset(row, q);
+      for(unsigned int v = 0; v < n_lanes; ++v)
+        if(ptr[v] != first[v])
+          return false;
+    }
+
+    return true;
+  }
+
+  unsigned int n_rows;
+  unsigned int n_points;
+  bool         single_precision;
+
+  dealii::AlignedVector<Number> data;
+  dealii::AlignedVector<float>  data_float;
+
+  // unsigned char instead of bool to allow setting the coefficients of different rows concurrently
+  std::vector<unsigned char> constant_row;
+};
+
 template<int dim, typename Number>
 class VariableCoefficientsCells
 {
@@ -33,29 +222,40 @@ public:
   void
   initialize(dealii::MatrixFree<dim, Number> const & matrix_free,
              unsigned int const                      degree,
-             Number const &                          constant_coefficient)
+             Number const &                          constant_coefficient,
+             bool const                              single_precision = false)
   {
     unsigned int const points_per_cell = dealii::Utilities::pow(degree + 1, dim);
 
-    coefficients_cell.reinit(matrix_free.n_cell_batches(), points_per_cell);
-    coefficients_cell.fill(dealii::make_vectorized_array<Number>(constant_coefficient));
+    coefficients_cell.reinit(matrix_free.n_cell_batches(), points_per_cell, single_precision);
+    coefficients_cell.fill(constant_coefficient);
   }
 
   scalar
   get_coefficient(unsigned int const cell, unsigned int const q) const
   {
-    return coefficients_cell[cell][q];
+    return coefficients_cell.get(cell, q);
   }
 
   void
   set_coefficient(unsigned int const cell, unsigned int const q, scalar const & value)
   {
-    coefficients_cell[cell][q] = value;
+    coefficients_cell.set(cell, q, value);
+  }
+
+  /*
+   * Has to be called after the coefficients have been set to detect cells with constant
+   * coefficients, see CoefficientTable.
+   */
+  void
+  compress()
+  {
+    coefficients_cell.compress();
   }
 
 private:
   // variable coefficients
-  dealii::Table<2, scalar> coefficients_cell;
+  CoefficientTable<Number> coefficients_cell;
 };
 
 template<int dim, typename Number>
@@ -65,29 +265,34 @@ private:
   typedef dealii::VectorizedArray<Number> scalar;
 
 public:
+  /*
+   * All tables are allocated here, so that the coefficients of different cells and faces can be
+   * set concurrently, e.g. within matrix-free loops with task parallelism.
+   */
   void
   initialize(dealii::MatrixFree<dim, Number> const & matrix_free,
              unsigned int const                      degree,
-             Number const &                          constant_coefficient)
+             Number const &                          constant_coefficient,
+             bool const                              single_precision = false)
   {
     unsigned int const points_per_cell = dealii::Utilities::pow(degree + 1, dim);
     unsigned int const points_per_face = dealii::Utilities::pow(degree + 1, dim - 1);
 
     // cells
-    coefficients_cell.reinit(matrix_free.n_cell_batches(), points_per_cell);
-
-    coefficients_cell.fill(dealii::make_vectorized_array<Number>(constant_coefficient));
+    coefficients_cell.reinit(matrix_free.n_cell_batches(), points_per_cell, single_precision);
+    coefficients_cell.fill(constant_coefficient);
 
     // face-based loops
     coefficients_face.reinit(matrix_free.n_inner_face_batches() +
                                matrix_free.n_boundary_face_batches(),
-                             points_per_face);
-
-    coefficients_face.fill(dealii::make_vectorized_array<Number>(constant_coefficient));
+                             points_per_face,
+                             single_precision);
+    coefficients_face.fill(constant_coefficient);
 
-    coefficients_face_neighbor.reinit(matrix_free.n_inner_face_batches(), points_per_face);
-
-    coefficients_face_neighbor.fill(dealii::make_vectorized_array<Number>(constant_coefficient));
+    coefficients_face_neighbor.reinit(matrix_free.n_inner_face_batches(),
+                                      points_per_face,
+                                      single_precision);
+    coefficients_face_neighbor.fill(constant_coefficient);
 
     // TODO cell-based face loops
     //    coefficients_face_cell_based.reinit(matrix_free.n_cell_batches()*2*dim,
@@ -99,37 +304,49 @@ public:
   scalar
   get_coefficient_cell(unsigned int const cell, unsigned int const q) const
   {
-    return coefficients_cell[cell][q];
+    return coefficients_cell.get(cell, q);
   }
 
   void
   set_coefficient_cell(unsigned int const cell, unsigned int const q, scalar const & value)
   {
-    coefficients_cell[cell][q] = value;
+    coefficients_cell.set(cell, q, value);
   }
 
   scalar
   get_coefficient_face(unsigned int const face, unsigned int const q) const
   {
-    return coefficients_face[face][q];
+    return coefficients_face.get(face, q);
   }
 
   void
   set_coefficient_face(unsigned int const face, unsigned int const q, scalar const & value)
   {
-    coefficients_face[face][q] = value;
+    coefficients_face.set(face, q, value);
   }
 
   scalar
   get_coefficient_face_neighbor(unsigned int const face, unsigned int const q) const
   {
-    return coefficients_face_neighbor[face][q];
+    return coefficients_face_neighbor.get(face, q);
   }
 
   void
   set_coefficient_face_neighbor(unsigned int const face, unsigned int const q, scalar const & value)
   {
-    coefficients_face_neighbor[face][q] = value;
+    coefficients_face_neighbor.set(face, q, value);
+  }
+
+  /*
+   * Has to be called after the coefficients have been set to detect cells and faces with constant
+   * coefficients, see CoefficientTable.
+   */
+  void
+  compress()
+  {
+    coefficients_cell.compress();
+    coefficients_face.compress();
+    coefficients_face_neighbor.compress();
   }
 
   // TODO
@@ -152,11 +369,11 @@ private:
   // variable coefficients
 
   // cell
-  dealii::Table<2, scalar> coefficients_cell;
+  CoefficientTable<Number> coefficients_cell;
 
   // face-based loops
-  dealii::Table<2, scalar> coefficients_face;
-  dealii::Table<2, scalar> coefficients_face_neighbor;
+  CoefficientTable<Number> coefficients_face;
+  CoefficientTable<Number> coefficients_face_neighbor;
 
   // TODO
   //  // cell-based face loops
@@ -26,6 +26,7 @@
 
 // ExaDG
 #include <exadg/poisson/driver.h>
+#include <exadg/postprocessor/asynchronous_file_writer.h>
 #include <exadg/utilities/print_functions.h>
 #include <exadg/utilities/print_general_infos.h>
 #include <exadg/utilities/print_solver_results.h>
@@ -86,6 +87,9 @@ Driver<dim, Number>::solve()
   // postprocessing of results
   timer.restart();
   poisson->postprocessor->do_postprocessing(sol);
+
+  // make sure that all output files have been written
+  AsynchronousFileWriter::get_instance().flush();
   timer_tree.insert({"Poisson", "Postprocessing"}, timer.wall_time());
 
   // calculate right-hand side
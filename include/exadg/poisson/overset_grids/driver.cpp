@@ -21,6 +21,7 @@
 
 // ExaDG
 #include <exadg/poisson/overset_grids/driver.h>
+#include <exadg/postprocessor/asynchronous_file_writer.h>
 #include <exadg/utilities/print_general_infos.h>
 #include <exadg/utilities/print_solver_results.h>
 #include <exadg/utilities/throughput_parameters.h>
@@ -133,6 +134,9 @@ DriverOversetGrids<dim, n_components, Number>::solve()
     if(iter > 10)
       converged = true;
   }
+
+  // make sure that all output files have been written
+  AsynchronousFileWriter::get_instance().flush();
 }
 
 template class DriverOversetGrids<2, 1, float>;
@@ -477,6 +477,23 @@ Operator<dim, n_components, Number>::solve(VectorType &       sol,
     laplace_operator.set_constrained_values(rhs_mutable, time);
   }
 
+  // compute initial guess by full multigrid (nested iteration)
+  if(param.preconditioner == Preconditioner::Multigrid and
+     param.multigrid_data.cycle_data.full_multigrid)
+  {
+    typedef MultigridPreconditioner<dim, Number, n_components> Multigrid;
+
+    std::shared_ptr<Multigrid> mg_preconditioner =
+      std::dynamic_pointer_cast<Multigrid>(preconditioner);
+
+    mg_preconditioner->apply_full_multigrid(sol, rhs_mutable);
+
+    if(param.spatial_discretization == SpatialDiscretization::CG)
+    {
+      laplace_operator.set_constrained_values(sol, time);
+    }
+  }
+
   unsigned int iterations = iterative_solver->solve(sol, rhs_mutable);
 
   // This step should actually be optional: The constrained degrees of freedom of the
@@ -66,6 +66,12 @@ Parameters::check() const
   AssertThrow(solver != Solver::Undefined, dealii::ExcMessage("parameter must be defined."));
   AssertThrow(preconditioner != Preconditioner::Undefined,
               dealii::ExcMessage("parameter must be defined."));
+
+  if(preconditioner == Preconditioner::Multigrid)
+  {
+    multigrid_data.cycle_data.check(solver == Solver::FGMRES,
+                                    true /* full_multigrid_supported */);
+  }
 }
 
 bool
@@ -0,0 +1,144 @@
+/*  ______________________________________________________________________
+ *
+ *  ExaDG - High-Order Discontinuous Galerkin for the Exa-Scale
+ *
+ *  Copyright (C) 2021 by the ExaDG authors
+ *
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *  ______________________________________________________________________
+ */
+
+// C/C++
+#include <algorithm>
+#include <fstream>
+
+// deal.II
+#include <deal.II/base/exceptions.h>
+
+// ExaDG
+#include <exadg/postprocessor/asynchronous_file_writer.h>
+
+namespace ExaDG
+{
+AsynchronousFileWriter &
+AsynchronousFileWriter::get_instance()
+{
+  static AsynchronousFileWriter writer;
+  return writer;
+}
+
+AsynchronousFileWriter::AsynchronousFileWriter() : busy(false), shutdown(false)
+{
+}
+
+AsynchronousFileWriter::~AsynchronousFileWriter()
+{
+  if(not thread.joinable())
+    return;
+
+  {
+    std::lock_guard<std::mutex> lock(mutex);
+    shutdown = true;
+  }
+  condition.notify_all();
+
+  // the background thread writes all pending files before it returns
+  thread.join();
+}
+
+void
+AsynchronousFileWriter::write(std::string const & filename,
+                              std::string &&      content,
+                              unsigned int const  max_pending_files)
+{
+  {
+    std::unique_lock<std::mutex> lock(mutex);
+
+    condition.wait(lock, [&] {
+      return pending_files.size() < std::max(max_pending_files, 1u) or
+             not failed_filename.empty();
+    });
+
+    if(failed_filename.empty())
+      pending_files.emplace_back(filename, std::move(content));
+
+    // the background thread is only started if asynchronous output is actually used
+    if(not thread.joinable())
+      thread = std::thread(&AsynchronousFileWriter::run, this);
+  }
+  condition.notify_all();
+
+  check_error();
+}
+
+void
+AsynchronousFileWriter::flush()
+{
+  {
+    std::unique_lock<std::mutex> lock(mutex);
+
+    condition.wait(lock, [&] {
+      return (pending_files.empty() and not busy) or not failed_filename.empty();
+    });
+  }
+
+  check_error();
+}
+
+void
+AsynchronousFileWriter::run()
+{
+  std::unique_lock<std::mutex> lock(mutex);
+
+  while(true)
+  {
+    condition.wait(lock, [&] { return shutdown or not pending_files.empty(); });
+
+    if(pending_files.empty())
+      break; // shutdown requested and no files left
+
+    std::pair<std::string, std::string> file = std::move(pending_files.front());
+    pending_files.pop_front();
+    busy = true;
+
+    // release the lock while writing so that new files can be enqueued
+    lock.unlock();
+    condition.notify_all();
+
+    std::ofstream output(file.first, std::ios::binary);
+    output.write(file.second.data(), file.second.size());
+    output.close();
+    bool const success = not output.fail();
+
+    lock.lock();
+    busy = false;
+    if(not success and failed_filename.empty())
+      failed_filename = file.first;
+    condition.notify_all();
+  }
+}
+
+void
+AsynchronousFileWriter::check_error()
+{
+  std::string filename;
+  {
+    std::lock_guard<std::mutex> lock(mutex);
+    filename = failed_filename;
+  }
+
+  AssertThrow(filename.empty(), dealii::ExcMessage("Could not write file " + filename + "."));
+}
+
+} // namespace ExaDG
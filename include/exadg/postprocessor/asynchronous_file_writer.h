@@ -0,0 +1,101 @@
+/*  ______________________________________________________________________
+ *
+ *  ExaDG - High-Order Discontinuous Galerkin for the Exa-Scale
+ *
+ *  Copyright (C) 2021 by the ExaDG authors
+ *
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *  ______________________________________________________________________
+ */
+
+#ifndef INCLUDE_EXADG_POSTPROCESSOR_ASYNCHRONOUS_FILE_WRITER_H_
+#define INCLUDE_EXADG_POSTPROCESSOR_ASYNCHRONOUS_FILE_WRITER_H_
+
+// C/C++
+#include <condition_variable>
+#include <deque>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <utility>
+
+namespace ExaDG
+{
+/**
+ * Writes files in a background thread so that the time loop does not wait for the file system.
+ * The content of a file is handed over as a fully serialized buffer, i.e., the caller does not
+ * have to keep any data alive. The background thread does not perform MPI communication, so that
+ * MPI_THREAD_MULTIPLE is not required.
+ *
+ * There is one writer per process, shared by all output generators, see get_instance(). The
+ * background thread is started when the first file is written. The number of buffers waiting to
+ * be written is bounded: write() blocks as long as the number of pending buffers exceeds the
+ * specified limit. flush() waits until all files have been written.
+ */
+class AsynchronousFileWriter
+{
+public:
+  static AsynchronousFileWriter &
+  get_instance();
+
+  ~AsynchronousFileWriter();
+
+  /*
+   * Enqueue the content to be written to a file. Blocks as long as max_pending_files or more
+   * files are pending.
+   */
+  void
+  write(std::string const & filename, std::string && content, unsigned int const max_pending_files);
+
+  /*
+   * Wait until all pending files have been written.
+   */
+  void
+  flush();
+
+private:
+  AsynchronousFileWriter();
+
+  AsynchronousFileWriter(AsynchronousFileWriter const &) = delete;
+
+  AsynchronousFileWriter &
+  operator=(AsynchronousFileWriter const &) = delete;
+
+  void
+  run();
+
+  // throws an exception if writing a file failed in the background thread
+  void
+  check_error();
+
+  std::thread thread;
+
+  std::mutex              mutex;
+  std::condition_variable condition;
+
+  // filename and content of the files to be written
+  std::deque<std::pair<std::string, std::string>> pending_files;
+
+  // a file is being written by the background thread
+  bool busy;
+
+  bool shutdown;
+
+  // name of a file that could not be written
+  std::string failed_filename;
+};
+
+} // namespace ExaDG
+
+#endif /* INCLUDE_EXADG_POSTPROCESSOR_ASYNCHRONOUS_FILE_WRITER_H_ */
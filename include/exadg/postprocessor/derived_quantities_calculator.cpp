@@ -0,0 +1,168 @@
+/*  ______________________________________________________________________
+ *
+ *  ExaDG - High-Order Discontinuous Galerkin for the Exa-Scale
+ *
+ *  Copyright (C) 2021 by the ExaDG authors
+ *
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *  ______________________________________________________________________
+ */
+
+// ExaDG
+#include <exadg/postprocessor/derived_quantities_calculator.h>
+
+namespace ExaDG
+{
+template<int dim, typename Number>
+DerivedQuantitiesCalculator<dim, Number>::DerivedQuantitiesCalculator()
+  : matrix_free(nullptr), dof_index_vector(0), dof_index_scalar(0), quad_index(0)
+{
+}
+
+template<int dim, typename Number>
+void
+DerivedQuantitiesCalculator<dim, Number>::initialize(
+  dealii::MatrixFree<dim, Number> const & matrix_free_in,
+  unsigned int const                      dof_index_vector_in,
+  unsigned int const                      dof_index_scalar_in,
+  unsigned int const                      quad_index_in)
+{
+  matrix_free      = &matrix_free_in;
+  dof_index_vector = dof_index_vector_in;
+  dof_index_scalar = dof_index_scalar_in;
+  quad_index       = quad_index_in;
+}
+
+template<int dim, typename Number>
+void
+DerivedQuantitiesCalculator<dim, Number>::compute(
+  std::vector<std::pair<DerivedQuantity, VectorType *>> const & dst,
+  VectorType const &                                            src) const
+{
+  if(dst.empty())
+    return;
+
+  dealii::EvaluationFlags::EvaluationFlags evaluation_flags = dealii::EvaluationFlags::nothing;
+  for(auto const & entry : dst)
+  {
+    if(entry.first == DerivedQuantity::VelocityMagnitude)
+      evaluation_flags |= dealii::EvaluationFlags::values;
+    else
+      evaluation_flags |= dealii::EvaluationFlags::gradients;
+  }
+
+  CellIntegratorVector integrator_velocity(*matrix_free, dof_index_vector, quad_index);
+  CellIntegratorVector integrator_vector(*matrix_free, dof_index_vector, quad_index);
+  CellIntegratorScalar integrator_scalar(*matrix_free, dof_index_scalar, quad_index);
+
+  CellwiseInverseMassVector inverse_mass_vector(integrator_vector);
+  CellwiseInverseMassScalar inverse_mass_scalar(integrator_scalar);
+
+  // The DG vectors are read and written on locally owned cells only, so no communication is
+  // needed and a plain loop over the cell batches is sufficient.
+  for(unsigned int cell = 0; cell < matrix_free->n_cell_batches(); ++cell)
+  {
+    integrator_velocity.reinit(cell);
+    integrator_velocity.read_dof_values(src);
+    integrator_velocity.evaluate(evaluation_flags);
+
+    for(auto const & [quantity, dst_vector] : dst)
+    {
+      if(quantity == DerivedQuantity::Vorticity)
+      {
+        integrator_vector.reinit(cell);
+
+        for(unsigned int q = 0; q < integrator_vector.n_q_points; ++q)
+        {
+          dealii::Tensor<1, number_vorticity_components, dealii::VectorizedArray<Number>> omega =
+            integrator_velocity.get_curl(q);
+
+          // the vorticity is a scalar in 2D, which is stored in the first component
+          vector omega_vector;
+          for(unsigned int d = 0; d < number_vorticity_components; ++d)
+            omega_vector[d] = omega[d];
+
+          integrator_vector.submit_value(omega_vector, q);
+        }
+
+        integrator_vector.integrate(dealii::EvaluationFlags::values);
+        inverse_mass_vector.apply(integrator_vector.begin_dof_values(),
+                                  integrator_vector.begin_dof_values());
+        integrator_vector.set_dof_values(*dst_vector);
+      }
+      else
+      {
+        integrator_scalar.reinit(cell);
+
+        for(unsigned int q = 0; q < integrator_scalar.n_q_points; ++q)
+          integrator_scalar.submit_value(compute_scalar_quantity(quantity, integrator_velocity, q),
+                                         q);
+
+        integrator_scalar.integrate(dealii::EvaluationFlags::values);
+        inverse_mass_scalar.apply(integrator_scalar.begin_dof_values(),
+                                  integrator_scalar.begin_dof_values());
+        integrator_scalar.set_dof_values(*dst_vector);
+      }
+    }
+  }
+}
+
+template<int dim, typename Number>
+typename DerivedQuantitiesCalculator<dim, Number>::scalar
+DerivedQuantitiesCalculator<dim, Number>::compute_scalar_quantity(
+  DerivedQuantity const        quantity,
+  CellIntegratorVector const & integrator,
+  unsigned int const           q) const
+{
+  if(quantity == DerivedQuantity::Divergence)
+  {
+    return integrator.get_divergence(q);
+  }
+  else if(quantity == DerivedQuantity::VelocityMagnitude)
+  {
+    return integrator.get_value(q).norm();
+  }
+  else if(quantity == DerivedQuantity::VorticityMagnitude)
+  {
+    return integrator.get_curl(q).norm();
+  }
+  else if(quantity == DerivedQuantity::QCriterion)
+  {
+    tensor const gradu = integrator.get_gradient(q);
+    tensor       Om, S;
+    for(unsigned int i = 0; i < dim; i++)
+    {
+      for(unsigned int j = 0; j < dim; j++)
+      {
+        Om[i][j] = 0.5 * (gradu[i][j] - gradu[j][i]);
+        S[i][j]  = 0.5 * (gradu[i][j] + gradu[j][i]);
+      }
+    }
+
+    return 0.5 * (Om.norm_square() - S.norm_square());
+  }
+  else
+  {
+    AssertThrow(false, dealii::ExcMessage("Not implemented."));
+    return scalar();
+  }
+}
+
+template class DerivedQuantitiesCalculator<2, float>;
+template class DerivedQuantitiesCalculator<2, double>;
+
+template class DerivedQuantitiesCalculator<3, float>;
+template class DerivedQuantitiesCalculator<3, double>;
+
+} // namespace ExaDG
@@ -0,0 +1,109 @@
+/*  ______________________________________________________________________
+ *
+ *  ExaDG - High-Order Discontinuous Galerkin for the Exa-Scale
+ *
+ *  Copyright (C) 2021 by the ExaDG authors
+ *
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *  ______________________________________________________________________
+ */
+
+#ifndef INCLUDE_EXADG_POSTPROCESSOR_DERIVED_QUANTITIES_CALCULATOR_H_
+#define INCLUDE_EXADG_POSTPROCESSOR_DERIVED_QUANTITIES_CALCULATOR_H_
+
+// C/C++
+#include <utility>
+#include <vector>
+
+// deal.II
+#include <deal.II/lac/la_parallel_vector.h>
+#include <deal.II/matrix_free/matrix_free.h>
+#include <deal.II/matrix_free/operators.h>
+
+// ExaDG
+#include <exadg/matrix_free/integrators.h>
+
+namespace ExaDG
+{
+enum class DerivedQuantity
+{
+  Vorticity,
+  Divergence,
+  VelocityMagnitude,
+  VorticityMagnitude,
+  QCriterion
+};
+
+/*
+ * Computes several quantities derived from a velocity field in a single pass over the cells, i.e.,
+ * the velocity is read and its gradient is evaluated only once per cell, while all requested
+ * quantities are written in the same cell loop. The quantities are L2-projected onto the DG spaces
+ * described by dof_index_vector (vorticity) and dof_index_scalar (all other quantities). Since the
+ * mass matrix is block-diagonal, the inverse mass matrix is applied cell by cell within the loop,
+ * which requires a quadrature rule with degree + 1 points per direction. The result is the same
+ * as the one obtained with the separate calculators followed by an InverseMassOperator.
+ */
+template<int dim, typename Number>
+class DerivedQuantitiesCalculator
+{
+private:
+  static unsigned int const number_vorticity_components = (dim == 2) ? 1 : dim;
+
+  typedef dealii::LinearAlgebra::distributed::Vector<Number> VectorType;
+
+  typedef dealii::VectorizedArray<Number>                         scalar;
+  typedef dealii::Tensor<1, dim, dealii::VectorizedArray<Number>> vector;
+  typedef dealii::Tensor<2, dim, dealii::VectorizedArray<Number>> tensor;
+
+  typedef CellIntegrator<dim, dim, Number> CellIntegratorVector;
+  typedef CellIntegrator<dim, 1, Number>   CellIntegratorScalar;
+
+  typedef dealii::MatrixFreeOperators::CellwiseInverseMassMatrix<dim, -1, dim, Number>
+    CellwiseInverseMassVector;
+  typedef dealii::MatrixFreeOperators::CellwiseInverseMassMatrix<dim, -1, 1, Number>
+    CellwiseInverseMassScalar;
+
+public:
+  DerivedQuantitiesCalculator();
+
+  void
+  initialize(dealii::MatrixFree<dim, Number> const & matrix_free_in,
+             unsigned int const                      dof_index_vector_in,
+             unsigned int const                      dof_index_scalar_in,
+             unsigned int const                      quad_index_in);
+
+  /*
+   * Computes the quantities listed in dst for the velocity field src, where each entry of dst
+   * holds the quantity and the vector it is written to.
+   */
+  void
+  compute(std::vector<std::pair<DerivedQuantity, VectorType *>> const & dst,
+          VectorType const &                                            src) const;
+
+private:
+  scalar
+  compute_scalar_quantity(DerivedQuantity const        quantity,
+                          CellIntegratorVector const & integrator,
+                          unsigned int const           q) const;
+
+  dealii::MatrixFree<dim, Number> const * matrix_free;
+
+  unsigned int dof_index_vector;
+  unsigned int dof_index_scalar;
+  unsigned int quad_index;
+};
+
+} // namespace ExaDG
+
+#endif /* INCLUDE_EXADG_POSTPROCESSOR_DERIVED_QUANTITIES_CALCULATOR_H_ */
@@ -0,0 +1,547 @@
+/*  ______________________________________________________________________
+ *
+ *  ExaDG - High-Order Discontinuous Galerkin for the Exa-Scale
+ *
+ *  Copyright (C) 2021 by the ExaDG authors
+ *
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *  ______________________________________________________________________
+ */
+
+// C/C++
+#include <array>
+#include <tuple>
+
+// deal.II
+#include <deal.II/numerics/data_out.h>
+#include <deal.II/numerics/vector_tools.h>
+
+// ExaDG
+#include <exadg/postprocessor/in_situ_extraction.h>
+#include <exadg/postprocessor/write_output.h>
+#include <exadg/utilities/create_directories.h>
+
+namespace ExaDG
+{
+namespace
+{
+/*
+ * Patches of dimension patch_dim in spacedim with one vertex per point, e.g., the cells of a slice
+ * or the elements of an iso-surface, which can be written with write_patches().
+ */
+template<int patch_dim, int spacedim>
+class PatchCollection : public dealii::DataOutInterface<patch_dim, spacedim>
+{
+public:
+  std::vector<dealii::DataOutBase::Patch<patch_dim, spacedim>> const &
+  get_patches() const final
+  {
+    return patches;
+  }
+
+  // one name per component
+  std::vector<std::string> dataset_names;
+
+  std::vector<std::tuple<unsigned int,
+                         unsigned int,
+                         std::string,
+                         dealii::DataComponentInterpretation::DataComponentInterpretation>>
+    nonscalar_data_ranges;
+
+  std::vector<dealii::DataOutBase::Patch<patch_dim, spacedim>> patches;
+
+private:
+  std::vector<std::string>
+  get_dataset_names() const final
+  {
+    return dataset_names;
+  }
+
+  std::vector<std::tuple<unsigned int,
+                         unsigned int,
+                         std::string,
+                         dealii::DataComponentInterpretation::DataComponentInterpretation>>
+  get_nonscalar_data_ranges() const final
+  {
+    return nonscalar_data_ranges;
+  }
+};
+
+/*
+ * Returns the points of the part of a slice evaluated by this process. The cells of the slice are
+ * distributed among the processes in slabs along the last direction of the slice, i.e.,
+ * direction_1 in 2D and direction_2 in 3D. The points are numbered lexicographically on a grid of
+ * n_points[0] x n_points[1] points.
+ */
+template<int dim>
+std::vector<dealii::Point<dim>>
+get_local_slice_points(SliceData<dim> const &        slice,
+                       std::array<unsigned int, 2> & n_points,
+                       MPI_Comm const &              mpi_comm)
+{
+  unsigned int const rank    = dealii::Utilities::MPI::this_mpi_process(mpi_comm);
+  unsigned int const n_ranks = dealii::Utilities::MPI::n_mpi_processes(mpi_comm);
+
+  unsigned int const n_cells = (dim == 2 ? slice.n_points_1 : slice.n_points_2) - 1;
+  unsigned int const begin   = (static_cast<unsigned long long>(n_cells) * rank) / n_ranks;
+  unsigned int const end     = (static_cast<unsigned long long>(n_cells) * (rank + 1)) / n_ranks;
+
+  // the points of the slab boundaries are evaluated by both adjacent processes
+  unsigned int const n_points_slab = begin < end ? end - begin + 1 : 0;
+  n_points = dim == 2 ? std::array<unsigned int, 2>{{n_points_slab, 1}} :
+                        std::array<unsigned int, 2>{{slice.n_points_1, n_points_slab}};
+
+  std::vector<dealii::Point<dim>> points;
+  for(unsigned int j = 0; j < n_points[1]; ++j)
+  {
+    for(unsigned int i = 0; i < n_points[0]; ++i)
+    {
+      unsigned int const i_global = dim == 2 ? begin + i : i;
+      unsigned int const j_global = dim == 2 ? j : begin + j;
+
+      double const s = slice.n_points_1 > 1 ? double(i_global) / (slice.n_points_1 - 1) : 0.0;
+      double const t = slice.n_points_2 > 1 ? double(j_global) / (slice.n_points_2 - 1) : 0.0;
+      points.push_back(slice.origin + s * slice.direction_1 + t * slice.direction_2);
+    }
+  }
+
+  return points;
+}
+
+/*
+ * Decomposition of a hypercube into simplices (Kuhn triangulation), where the vertices of the
+ * hypercube are numbered lexicographically. All simplices share the diagonal from vertex 0 to the
+ * opposite vertex, such that the decomposition is conforming between neighboring hypercubes.
+ */
+template<int dim>
+std::vector<std::array<unsigned int, dim + 1>>
+get_simplices();
+
+template<>
+std::vector<std::array<unsigned int, 3>>
+get_simplices<2>()
+{
+  return {{{0, 1, 3}}, {{0, 2, 3}}};
+}
+
+template<>
+std::vector<std::array<unsigned int, 4>>
+get_simplices<3>()
+{
+  return {{{0, 1, 3, 7}},
+          {{0, 1, 5, 7}},
+          {{0, 2, 3, 7}},
+          {{0, 2, 6, 7}},
+          {{0, 4, 5, 7}},
+          {{0, 4, 6, 7}}};
+}
+
+/*
+ * Appends the intersection of a simplex with the iso-surface of a linear function to elements,
+ * i.e., one line segment in 2D (two points) and up to two triangles in 3D (three points each).
+ */
+template<int dim>
+void
+intersect_simplex(std::array<dealii::Point<dim>, dim + 1> const & points,
+                  std::array<double, dim + 1> const &             values,
+                  double const                                    iso_value,
+                  std::vector<dealii::Point<dim>> &               elements)
+{
+  std::vector<unsigned int> above, below;
+  for(unsigned int i = 0; i < dim + 1; ++i)
+    (values[i] > iso_value ? above : below).push_back(i);
+
+  if(above.empty() or below.empty())
+    return;
+
+  auto const interpolate = [&](unsigned int const a, unsigned int const b) {
+    double const t = (iso_value - values[a]) / (values[b] - values[a]);
+    return dealii::Point<dim>(points[a] + t * (points[b] - points[a]));
+  };
+
+  if(above.size() == 1 or below.size() == 1)
+  {
+    // the iso-surface separates a single vertex from the others
+    std::vector<unsigned int> const & single = above.size() == 1 ? above : below;
+    std::vector<unsigned int> const & others = above.size() == 1 ? below : above;
+
+    for(unsigned int const other : others)
+      elements.push_back(interpolate(single[0], other));
+  }
+  else
+  {
+    // two vertices on each side in 3D, the intersection is a quadrilateral
+    dealii::Point<dim> const p0 = interpolate(above[0], below[0]);
+    dealii::Point<dim> const p1 = interpolate(above[0], below[1]);
+    dealii::Point<dim> const p2 = interpolate(above[1], below[1]);
+    dealii::Point<dim> const p3 = interpolate(above[1], below[0]);
+
+    elements.insert(elements.end(), {p0, p1, p2, p0, p2, p3});
+  }
+}
+
+} // namespace
+
+template<int dim, typename Number>
+InSituExtractor<dim, Number>::InSituExtractor(MPI_Comm const & comm) : mpi_comm(comm)
+{
+}
+
+template<int dim, typename Number>
+void
+InSituExtractor<dim, Number>::setup(dealii::Triangulation<dim> const & triangulation,
+                                    dealii::Mapping<dim> const &       mapping_in,
+                                    InSituExtractionData<dim> const &  data_in)
+{
+  mapping = &mapping_in;
+  data    = data_in;
+
+  time_control.setup(data.time_control_data);
+
+  if(data.time_control_data.is_active)
+  {
+    create_directories(data.directory, mpi_comm);
+
+    for(auto const & slice : data.slices)
+    {
+      AssertThrow(slice.n_points_1 > 1 and
+                    (dim == 2 ? slice.n_points_2 == 1 : slice.n_points_2 > 1),
+                  dealii::ExcMessage("A slice needs at least two points per direction, and a "
+                                     "single point in direction_2 in 2D."));
+
+      std::array<unsigned int, 2>           n_points;
+      std::vector<dealii::Point<dim>> const points =
+        get_local_slice_points(slice, n_points, mpi_comm);
+
+      auto evaluator =
+        std::make_shared<dealii::Utilities::MPI::RemotePointEvaluation<dim>>(1e-6, false, 0);
+      evaluator->reinit(points, triangulation, *mapping);
+
+      slice_points.push_back(points);
+      slice_n_points.push_back(n_points);
+      evaluators.push_back(evaluator);
+    }
+
+    for(auto const & iso_surface : data.iso_surfaces)
+    {
+      AssertThrow(not iso_surface.iso_values.empty(),
+                  dealii::ExcMessage("Specify at least one iso-value for " + iso_surface.name +
+                                     "."));
+    }
+  }
+}
+
+template<int dim, typename Number>
+void
+InSituExtractor<dim, Number>::evaluate(std::vector<ExtractionField<dim, Number>> const & fields,
+                                       double const                                     time,
+                                       bool const                                       unsteady)
+{
+  print_write_output_time(time, time_control.get_counter(), unsteady, mpi_comm);
+
+  for(unsigned int i = 0; i < data.slices.size(); ++i)
+    write_slice(i, fields, time);
+
+  for(auto const & clip : data.clips)
+    write_clip(clip, fields, time);
+
+  if(not data.iso_surfaces.empty())
+  {
+    std::vector<dealii::DoFHandler<dim> const *> dof_handlers;
+    for(auto const & iso_surface : data.iso_surfaces)
+    {
+      auto const dof_handler = get_field(fields, iso_surface.field).dof_handler;
+      if(std::find(dof_handlers.begin(), dof_handlers.end(), dof_handler) == dof_handlers.end())
+        dof_handlers.push_back(dof_handler);
+    }
+
+    // the MatrixFree object is only set up once, afterwards only the mapping is updated
+    patch_builder.reinit(*mapping, dof_handlers, data.n_subdivisions);
+
+    for(auto const & iso_surface : data.iso_surfaces)
+      write_iso_surface(iso_surface, fields, time);
+  }
+}
+
+template<int dim, typename Number>
+ExtractionField<dim, Number> const &
+InSituExtractor<dim, Number>::get_field(std::vector<ExtractionField<dim, Number>> const & fields,
+                                        std::string const & name) const
+{
+  auto const it = std::find_if(fields.begin(), fields.end(), [&](auto const & field) {
+    return field.name == name;
+  });
+
+  AssertThrow(it != fields.end(),
+              dealii::ExcMessage("The field " + name + " is not available for extraction."));
+
+  return *it;
+}
+
+template<int dim, typename Number>
+void
+InSituExtractor<dim, Number>::write_slice(unsigned int const                               index,
+                                          std::vector<ExtractionField<dim, Number>> const & fields,
+                                          double const time) const
+{
+  SliceData<dim> const &              slice    = data.slices[index];
+  auto const &                        points   = slice_points[index];
+  std::array<unsigned int, 2> const & n_points = slice_n_points[index];
+
+  std::vector<unsigned int>        n_components;
+  std::vector<std::vector<double>> values;
+
+  for(auto const & name : slice.fields)
+  {
+    ExtractionField<dim, Number> const & field = get_field(fields, name);
+
+    n_components.push_back(field.dof_handler->get_fe().n_components());
+    values.emplace_back();
+
+    if(n_components.back() == 1)
+    {
+      auto const point_values =
+        dealii::VectorTools::point_values<1>(*evaluators[index], *field.dof_handler, *field.vector);
+
+      values.back().assign(point_values.begin(), point_values.end());
+    }
+    else if(n_components.back() == dim)
+    {
+      auto const point_values = dealii::VectorTools::point_values<dim>(*evaluators[index],
+                                                                       *field.dof_handler,
+                                                                       *field.vector);
+
+      for(auto const & value : point_values)
+        for(unsigned int d = 0; d < dim; ++d)
+          values.back().push_back(value[d]);
+    }
+    else
+    {
+      AssertThrow(false, dealii::ExcMessage("Only scalar and vector fields can be extracted."));
+    }
+  }
+
+  // one patch per cell of the slice, i.e., line segments in 2D and quadrilaterals in 3D
+  PatchCollection<dim - 1, dim> patches;
+
+  for(unsigned int i = 0; i < slice.fields.size(); ++i)
+  {
+    patches.dataset_names.insert(patches.dataset_names.end(), n_components[i], slice.fields[i]);
+
+    if(n_components[i] > 1)
+    {
+      unsigned int const first = patches.dataset_names.size() - n_components[i];
+      patches.nonscalar_data_ranges.emplace_back(
+        first,
+        first + n_components[i] - 1,
+        slice.fields[i],
+        dealii::DataComponentInterpretation::component_is_part_of_vector);
+    }
+  }
+
+  unsigned int const n_vertices = dealii::GeometryInfo<dim - 1>::vertices_per_cell;
+  unsigned int const n_cells_1  = n_points[0] > 0 ? n_points[0] - 1 : 0;
+  unsigned int const n_cells_2  = dim == 2 ? 1 : (n_points[1] > 0 ? n_points[1] - 1 : 0);
+
+  for(unsigned int j = 0; j < n_cells_2; ++j)
+  {
+    for(unsigned int i = 0; i < n_cells_1; ++i)
+    {
+      dealii::DataOutBase::Patch<dim - 1, dim> patch;
+      patch.n_subdivisions = 1;
+      patch.patch_index    = patches.patches.size();
+      patch.data.reinit(patches.dataset_names.size(), n_vertices);
+
+      for(unsigned int v = 0; v < n_vertices; ++v)
+      {
+        // lexicographic numbering of the vertices
+        unsigned int const point = (i + (v & 1)) + (j + (v >> 1)) * n_points[0];
+
+        patch.vertices[v] = points[point];
+
+        unsigned int row = 0;
+        for(unsigned int f = 0; f < values.size(); ++f)
+          for(unsigned int c = 0; c < n_components[f]; ++c, ++row)
+            patch.data(row, v) = values[f][point * n_components[f] + c];
+      }
+
+      patches.patches.push_back(patch);
+    }
+  }
+
+  OutputDataBase output_data;
+  output_data.directory = data.directory;
+  output_data.filename  = data.filename + "_" + slice.name;
+
+  write_patches(patches, output_data, time_control.get_counter(), time, mpi_comm);
+}
+
+template<int dim, typename Number>
+void
+InSituExtractor<dim, Number>::write_clip(ClipData<dim> const &                            clip,
+                                         std::vector<ExtractionField<dim, Number>> const & fields,
+                                         double const time) const
+{
+  dealii::DataOut<dim> data_out;
+
+  data_out.set_cell_selection([&](typename dealii::Triangulation<dim>::cell_iterator const & cell) {
+    if(not(cell->is_active() and cell->is_locally_owned()))
+      return false;
+
+    dealii::Point<dim> const center = cell->center();
+    for(unsigned int d = 0; d < dim; ++d)
+      if(center[d] < clip.lower_left[d] or center[d] > clip.upper_right[d])
+        return false;
+
+    return true;
+  });
+
+  for(auto const & name : clip.fields)
+  {
+    ExtractionField<dim, Number> const & field = get_field(fields, name);
+
+    unsigned int const n_components = field.dof_handler->get_fe().n_components();
+    if(n_components == 1)
+    {
+      data_out.add_data_vector(*field.dof_handler, *field.vector, name);
+    }
+    else
+    {
+      std::vector<std::string> names(n_components, name);
+      std::vector<dealii::DataComponentInterpretation::DataComponentInterpretation>
+        component_interpretation(n_components,
+                                 dealii::DataComponentInterpretation::component_is_part_of_vector);
+
+      data_out.add_data_vector(*field.dof_handler, *field.vector, names, component_interpretation);
+    }
+  }
+
+  data_out.build_patches(*mapping, data.n_subdivisions, dealii::DataOut<dim>::curved_inner_cells);
+
+  OutputDataBase output_data;
+  output_data.directory = data.directory;
+  output_data.filename  = data.filename + "_" + clip.name;
+
+  write_patches(data_out, output_data, time_control.get_counter(), time, mpi_comm);
+}
+
+template<int dim, typename Number>
+void
+InSituExtractor<dim, Number>::write_iso_surface(
+  IsoSurfaceData const &                           iso_surface,
+  std::vector<ExtractionField<dim, Number>> const & fields,
+  double const                                     time)
+{
+  ExtractionField<dim, Number> const & field = get_field(fields, iso_surface.field);
+
+  AssertThrow(field.dof_handler->get_fe().n_components() == 1,
+              dealii::ExcMessage("Iso-surfaces can only be extracted for scalar fields."));
+
+  // evaluate the field in the subdivision points with sum-factorization kernels
+  patch_builder.clear_data_vectors();
+  patch_builder.add_data_vector(*field.vector,
+                                patch_builder.get_dof_index(*field.dof_handler),
+                                field.name);
+  patch_builder.build_patches();
+
+  unsigned int const n_subdivisions = data.n_subdivisions;
+  unsigned int const n_points_1d    = n_subdivisions + 1;
+
+  // offsets of the vertices of a subcell relative to its first point
+  std::array<unsigned int, dealii::GeometryInfo<dim>::vertices_per_cell> vertex_offsets;
+  for(unsigned int v = 0; v < vertex_offsets.size(); ++v)
+  {
+    vertex_offsets[v] = 0;
+    for(unsigned int d = 0, stride = 1; d < dim; ++d, stride *= n_points_1d)
+      if(v & (1 << d))
+        vertex_offsets[v] += stride;
+  }
+
+  auto const simplices = get_simplices<dim>();
+
+  std::vector<dealii::Point<dim>> elements;
+  std::vector<double>             element_iso_values;
+
+  for(auto const & patch : patch_builder.get_patches())
+  {
+    for(unsigned int subcell = 0; subcell < dealii::Utilities::pow(n_subdivisions, dim); ++subcell)
+    {
+      // index of the first point of the subcell
+      unsigned int first_point = 0;
+      for(unsigned int d = 0, index = subcell, stride = 1; d < dim;
+          ++d, index /= n_subdivisions, stride *= n_points_1d)
+        first_point += (index % n_subdivisions) * stride;
+
+      for(auto const & simplex : simplices)
+      {
+        std::array<dealii::Point<dim>, dim + 1> points;
+        std::array<double, dim + 1>             values;
+        for(unsigned int i = 0; i < dim + 1; ++i)
+        {
+          unsigned int const point = first_point + vertex_offsets[simplex[i]];
+
+          values[i] = patch.data(0, point);
+          for(unsigned int d = 0; d < dim; ++d)
+            points[i][d] = patch.data(1 + d, point);
+        }
+
+        for(double const iso_value : iso_surface.iso_values)
+        {
+          intersect_simplex<dim>(points, values, iso_value, elements);
+          element_iso_values.resize(elements.size(), iso_value);
+        }
+      }
+    }
+  }
+
+  // line segments in 2D, triangles in 3D, which are represented by quadrilaterals with two
+  // coinciding vertices
+  PatchCollection<dim - 1, dim> patches;
+  patches.dataset_names = {"iso_value"};
+
+  unsigned int const n_vertices_per_element = dim;
+  unsigned int const n_vertices             = dealii::GeometryInfo<dim - 1>::vertices_per_cell;
+  for(unsigned int e = 0; e < elements.size() / n_vertices_per_element; ++e)
+  {
+    dealii::DataOutBase::Patch<dim - 1, dim> patch;
+    patch.n_subdivisions = 1;
+    patch.patch_index    = e;
+    patch.data.reinit(1, n_vertices);
+
+    for(unsigned int v = 0; v < n_vertices; ++v)
+    {
+      unsigned int const element_vertex =
+        e * n_vertices_per_element + std::min(v, n_vertices_per_element - 1);
+
+      patch.vertices[v] = elements[element_vertex];
+      patch.data(0, v)  = element_iso_values[element_vertex];
+    }
+
+    patches.patches.push_back(patch);
+  }
+
+  OutputDataBase output_data;
+  output_data.directory = data.directory;
+  output_data.filename  = data.filename + "_" + iso_surface.name;
+
+  write_patches(patches, output_data, time_control.get_counter(), time, mpi_comm);
+}
+
+template class InSituExtractor<2, float>;
+template class InSituExtractor<2, double>;
+
+template class InSituExtractor<3, float>;
+template class InSituExtractor<3, double>;
+
+} // namespace ExaDG
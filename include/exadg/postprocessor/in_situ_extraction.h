@@ -0,0 +1,245 @@
+/*  ______________________________________________________________________
+ *
+ *  ExaDG - High-Order Discontinuous Galerkin for the Exa-Scale
+ *
+ *  Copyright (C) 2021 by the ExaDG authors
+ *
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *  ______________________________________________________________________
+ */
+
+#ifndef INCLUDE_EXADG_POSTPROCESSOR_IN_SITU_EXTRACTION_H_
+#define INCLUDE_EXADG_POSTPROCESSOR_IN_SITU_EXTRACTION_H_
+
+// C/C++
+#include <algorithm>
+#include <array>
+#include <memory>
+#include <string>
+#include <vector>
+
+// deal.II
+#include <deal.II/base/mpi_remote_point_evaluation.h>
+#include <deal.II/base/point.h>
+#include <deal.II/dofs/dof_handler.h>
+#include <deal.II/fe/mapping.h>
+#include <deal.II/lac/la_parallel_vector.h>
+
+// ExaDG
+#include <exadg/postprocessor/patch_builder.h>
+#include <exadg/postprocessor/time_control.h>
+#include <exadg/utilities/print_functions.h>
+
+namespace ExaDG
+{
+/*
+ * Planar slice sampled on a structured grid of n_points_1 x n_points_2 points, which spans the
+ * parallelogram origin + s * direction_1 + t * direction_2 with s, t in [0,1]. In 2D, the slice
+ * degenerates to a line (n_points_2 = 1). Points outside the domain get the value zero.
+ */
+template<int dim>
+struct SliceData
+{
+  SliceData() : name("slice"), n_points_1(2), n_points_2(1)
+  {
+  }
+
+  std::string name;
+
+  dealii::Point<dim>     origin;
+  dealii::Tensor<1, dim> direction_1;
+  dealii::Tensor<1, dim> direction_2;
+
+  unsigned int n_points_1;
+  unsigned int n_points_2;
+
+  // names of the fields written on the slice
+  std::vector<std::string> fields;
+};
+
+/*
+ * Cells whose center lies in the axis-parallel box spanned by lower_left and upper_right.
+ */
+template<int dim>
+struct ClipData
+{
+  ClipData() : name("clip")
+  {
+  }
+
+  std::string name;
+
+  dealii::Point<dim> lower_left;
+  dealii::Point<dim> upper_right;
+
+  // names of the fields written in the clipped region
+  std::vector<std::string> fields;
+};
+
+/*
+ * Iso-surfaces (iso-lines in 2D) of a scalar field.
+ */
+struct IsoSurfaceData
+{
+  IsoSurfaceData() : name("iso_surface")
+  {
+  }
+
+  std::string name;
+
+  // name of the scalar field
+  std::string field;
+
+  std::vector<double> iso_values;
+};
+
+template<int dim>
+struct InSituExtractionData
+{
+  InSituExtractionData() : directory("output/"), filename("extraction"), n_subdivisions(1)
+  {
+  }
+
+  void
+  print(dealii::ConditionalOStream & pcout, bool const unsteady) const
+  {
+    if(time_control_data.is_active)
+    {
+      pcout << std::endl << "  In-situ extraction:" << std::endl;
+
+      time_control_data.print(pcout, unsteady);
+
+      print_parameter(pcout, "Directory of output files", directory);
+      print_parameter(pcout, "Filename", filename);
+      print_parameter(pcout, "Number of slices", slices.size());
+      print_parameter(pcout, "Number of clips", clips.size());
+      print_parameter(pcout, "Number of iso-surfaces", iso_surfaces.size());
+      print_parameter(pcout, "Subdivisions per cell", n_subdivisions);
+    }
+  }
+
+  /*
+   * Returns true if the field with the given name is written by any of the extractors.
+   */
+  bool
+  requires_field(std::string const & field) const
+  {
+    if(not time_control_data.is_active)
+      return false;
+
+    auto const contains = [&](std::vector<std::string> const & fields) {
+      return std::find(fields.begin(), fields.end(), field) != fields.end();
+    };
+
+    for(auto const & slice : slices)
+      if(contains(slice.fields))
+        return true;
+
+    for(auto const & clip : clips)
+      if(contains(clip.fields))
+        return true;
+
+    for(auto const & iso_surface : iso_surfaces)
+      if(iso_surface.field == field)
+        return true;
+
+    return false;
+  }
+
+  TimeControlData time_control_data;
+
+  std::string directory;
+  std::string filename;
+
+  std::vector<SliceData<dim>> slices;
+  std::vector<ClipData<dim>>  clips;
+  std::vector<IsoSurfaceData> iso_surfaces;
+
+  // number of subdivisions per cell and coordinate direction used for clips and iso-surfaces
+  unsigned int n_subdivisions;
+};
+
+/*
+ * Field that can be referred to by name in InSituExtractionData.
+ */
+template<int dim, typename Number>
+struct ExtractionField
+{
+  std::string                                                name;
+  dealii::DoFHandler<dim> const *                            dof_handler;
+  dealii::LinearAlgebra::distributed::Vector<Number> const * vector;
+};
+
+/*
+ * Extracts slices, clipped regions, and iso-surfaces of the solution in-situ, i.e., during the
+ * simulation, which reduces the amount of data written to the file system compared to the output
+ * of the full volume. The extractors are evaluated and written in parallel by all processes, in
+ * the format of the field output, see write_patches().
+ */
+template<int dim, typename Number>
+class InSituExtractor
+{
+public:
+  InSituExtractor(MPI_Comm const & comm);
+
+  void
+  setup(dealii::Triangulation<dim> const & triangulation,
+        dealii::Mapping<dim> const &       mapping,
+        InSituExtractionData<dim> const &  data);
+
+  void
+  evaluate(std::vector<ExtractionField<dim, Number>> const & fields,
+           double const                                     time,
+           bool const                                       unsteady);
+
+  TimeControl time_control;
+
+private:
+  ExtractionField<dim, Number> const &
+  get_field(std::vector<ExtractionField<dim, Number>> const & fields,
+            std::string const &                              name) const;
+
+  void
+  write_slice(unsigned int const                               index,
+              std::vector<ExtractionField<dim, Number>> const & fields,
+              double const                                     time) const;
+
+  void
+  write_clip(ClipData<dim> const &                            clip,
+             std::vector<ExtractionField<dim, Number>> const & fields,
+             double const                                     time) const;
+
+  void
+  write_iso_surface(IsoSurfaceData const &                           iso_surface,
+                    std::vector<ExtractionField<dim, Number>> const & fields,
+                    double const                                     time);
+
+  MPI_Comm const mpi_comm;
+
+  dealii::SmartPointer<dealii::Mapping<dim> const> mapping;
+
+  InSituExtractionData<dim> data;
+
+  // one evaluator per slice, each process evaluates the points of a part of the slice
+  std::vector<std::vector<dealii::Point<dim>>>                                     slice_points;
+  std::vector<std::array<unsigned int, 2>>                                         slice_n_points;
+  std::vector<std::shared_ptr<dealii::Utilities::MPI::RemotePointEvaluation<dim>>> evaluators;
+
+  // evaluates the fields of the iso-surfaces in the subdivision points of the cells
+  PatchBuilder<dim, Number> patch_builder;
+};
+
+} // namespace ExaDG
+
+#endif /* INCLUDE_EXADG_POSTPROCESSOR_IN_SITU_EXTRACTION_H_ */
@@ -0,0 +1,144 @@
+/*  ______________________________________________________________________
+ *
+ *  ExaDG - High-Order Discontinuous Galerkin for the Exa-Scale
+ *
+ *  Copyright (C) 2021 by the ExaDG authors
+ *
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *  ______________________________________________________________________
+ */
+
+// deal.II
+#include <deal.II/base/exceptions.h>
+
+// ExaDG
+#include <exadg/postprocessor/in_transit_analysis.h>
+
+namespace ExaDG
+{
+namespace
+{
+struct InTransitAnalysisData
+{
+  bool         active           = false;
+  bool         is_analysis_rank = false;
+  int          rank             = 0;
+  unsigned int n_solver_ranks   = 0;
+  unsigned int n_analysis_ranks = 0;
+
+  MPI_Comm local_comm = MPI_COMM_NULL;
+  MPI_Comm intercomm  = MPI_COMM_NULL;
+};
+
+InTransitAnalysisData &
+get_data()
+{
+  static InTransitAnalysisData data;
+  return data;
+}
+} // namespace
+
+MPI_Comm
+InTransitAnalysis::setup(MPI_Comm const & comm, unsigned int const n_analysis_ranks)
+{
+  InTransitAnalysisData & data = get_data();
+
+  AssertThrow(not data.active, dealii::ExcMessage("In-transit analysis is already set up."));
+
+  unsigned int const rank = dealii::Utilities::MPI::this_mpi_process(comm);
+  unsigned int const size = dealii::Utilities::MPI::n_mpi_processes(comm);
+
+  AssertThrow(n_analysis_ranks > 0 and 2 * n_analysis_ranks <= size,
+              dealii::ExcMessage("In-transit analysis requires at least as many solver ranks as "
+                                 "analysis ranks."));
+
+  data.active           = true;
+  data.n_analysis_ranks = n_analysis_ranks;
+  data.n_solver_ranks   = size - n_analysis_ranks;
+  data.is_analysis_rank = rank >= data.n_solver_ranks;
+
+  MPI_Comm_split(comm, data.is_analysis_rank ? 1 : 0, rank, &data.local_comm);
+  MPI_Comm_rank(data.local_comm, &data.rank);
+
+  // the leaders of the groups are the first process of each group
+  int const remote_leader = data.is_analysis_rank ? 0 : data.n_solver_ranks;
+  MPI_Intercomm_create(data.local_comm, 0, comm, remote_leader, tag_setup, &data.intercomm);
+
+  return data.local_comm;
+}
+
+void
+InTransitAnalysis::finalize()
+{
+  InTransitAnalysisData & data = get_data();
+
+  if(not data.active)
+    return;
+
+  if(not data.is_analysis_rank)
+    MPI_Send(nullptr, 0, MPI_BYTE, get_analysis_rank(), tag_finish, data.intercomm);
+
+  MPI_Comm_free(&data.intercomm);
+  MPI_Comm_free(&data.local_comm);
+
+  data = InTransitAnalysisData();
+}
+
+bool
+InTransitAnalysis::is_active()
+{
+  return get_data().active;
+}
+
+bool
+InTransitAnalysis::is_analysis_rank()
+{
+  return get_data().is_analysis_rank;
+}
+
+MPI_Comm const &
+InTransitAnalysis::get_intercommunicator()
+{
+  AssertThrow(is_active(), dealii::ExcMessage("In-transit analysis has not been set up."));
+
+  return get_data().intercomm;
+}
+
+int
+InTransitAnalysis::get_analysis_rank()
+{
+  InTransitAnalysisData const & data = get_data();
+
+  AssertThrow(data.active and not data.is_analysis_rank,
+              dealii::ExcMessage("Only available for solver ranks."));
+
+  return data.rank % data.n_analysis_ranks;
+}
+
+std::vector<int>
+InTransitAnalysis::get_solver_ranks()
+{
+  InTransitAnalysisData const & data = get_data();
+
+  AssertThrow(data.active and data.is_analysis_rank,
+              dealii::ExcMessage("Only available for analysis ranks."));
+
+  std::vector<int> solver_ranks;
+  for(unsigned int r = data.rank; r < data.n_solver_ranks; r += data.n_analysis_ranks)
+    solver_ranks.push_back(r);
+
+  return solver_ranks;
+}
+
+} // namespace ExaDG
@@ -0,0 +1,89 @@
+/*  ______________________________________________________________________
+ *
+ *  ExaDG - High-Order Discontinuous Galerkin for the Exa-Scale
+ *
+ *  Copyright (C) 2021 by the ExaDG authors
+ *
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *  ______________________________________________________________________
+ */
+
+#ifndef INCLUDE_EXADG_POSTPROCESSOR_IN_TRANSIT_ANALYSIS_H_
+#define INCLUDE_EXADG_POSTPROCESSOR_IN_TRANSIT_ANALYSIS_H_
+
+// C/C++
+#include <vector>
+
+// deal.II
+#include <deal.II/base/mpi.h>
+
+namespace ExaDG
+{
+/**
+ * Communication setup for in-transit analysis: the last n_analysis_ranks MPI processes are
+ * dedicated to postprocessing (currently the computation of kinetic energy spectra) and do not
+ * take part in the simulation. The solver ranks send their data via non-blocking point-to-point
+ * messages over an intercommunicator and continue with the simulation while the analysis ranks
+ * process the data.
+ *
+ * Each solver rank r sends to analysis rank r % n_analysis_ranks. All solver ranks assigned to
+ * the same analysis rank send the same sequence of messages (setup, data, finish).
+ */
+class InTransitAnalysis
+{
+public:
+  // message tags
+  static int const tag_setup  = 1001;
+  static int const tag_data   = 1002;
+  static int const tag_finish = 1003;
+
+  /**
+   * Splits comm into solver and analysis ranks. Has to be called by all processes of comm.
+   * Returns the communicator of the group this process belongs to.
+   */
+  static MPI_Comm
+  setup(MPI_Comm const & comm, unsigned int const n_analysis_ranks);
+
+  /**
+   * Notifies the analysis ranks that the simulation has finished (solver ranks) and frees the
+   * communicators. Has to be called by all processes after the simulation or analysis loop.
+   */
+  static void
+  finalize();
+
+  static bool
+  is_active();
+
+  static bool
+  is_analysis_rank();
+
+  static MPI_Comm const &
+  get_intercommunicator();
+
+  /**
+   * Rank (in the remote group) of the analysis process the data of this solver rank is sent to
+   */
+  static int
+  get_analysis_rank();
+
+  /**
+   * Ranks (in the remote group) of all solver processes assigned to this analysis rank
+   */
+  static std::vector<int>
+  get_solver_ranks();
+};
+
+} // namespace ExaDG
+
+#endif /* INCLUDE_EXADG_POSTPROCESSOR_IN_TRANSIT_ANALYSIS_H_ */
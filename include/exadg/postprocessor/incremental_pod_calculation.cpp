@@ -0,0 +1,498 @@
+/*  ______________________________________________________________________
+ *
+ *  ExaDG - High-Order Discontinuous Galerkin for the Exa-Scale
+ *
+ *  Copyright (C) 2021 by the ExaDG authors
+ *
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *  ______________________________________________________________________
+ */
+
+// C/C++
+#include <algorithm>
+#include <cmath>
+#include <complex>
+#include <fstream>
+#include <iomanip>
+#include <limits>
+
+// deal.II
+#include <deal.II/lac/lapack_full_matrix.h>
+#include <deal.II/numerics/data_out.h>
+
+// ExaDG
+#include <exadg/postprocessor/incremental_pod_calculation.h>
+#include <exadg/utilities/create_directories.h>
+
+namespace ExaDG
+{
+template<int dim, int n_components, typename Number>
+IncrementalPODCalculator<dim, n_components, Number>::IncrementalPODCalculator(
+  MPI_Comm const & comm)
+  : mpi_comm(comm), snapshot_energy(0.0), output_written(false)
+{
+}
+
+template<int dim, int n_components, typename Number>
+void
+IncrementalPODCalculator<dim, n_components, Number>::setup(
+  dealii::MatrixFree<dim, Number> const &   matrix_free,
+  dealii::AffineConstraints<Number> const & constraints,
+  unsigned int const                        dof_index,
+  unsigned int const                        quad_index,
+  dealii::DoFHandler<dim> const &           dof_handler_in,
+  dealii::Mapping<dim> const &              mapping_in,
+  IncrementalPODData const &                data_in)
+{
+  dof_handler = &dof_handler_in;
+  mapping     = &mapping_in;
+  data        = data_in;
+
+  time_control.setup(data_in.time_control_data);
+
+  if(data.time_control_data.is_active)
+  {
+    AssertThrow(data.time_control_data.end_time < std::numeric_limits<double>::max(),
+                dealii::ExcMessage("The results of the incremental POD are written at the end "
+                                   "time of the time control, which has to be specified."));
+
+    AssertThrow(data.max_rank > 0, dealii::ExcMessage("The maximum rank has to be positive."));
+
+    MassOperatorData<dim> mass_operator_data;
+    mass_operator_data.dof_index  = dof_index;
+    mass_operator_data.quad_index = quad_index;
+    mass_operator.initialize(matrix_free, constraints, mass_operator_data);
+
+    create_directories(data.directory, mpi_comm);
+  }
+}
+
+template<int dim, int n_components, typename Number>
+void
+IncrementalPODCalculator<dim, n_components, Number>::evaluate(VectorType const & snapshot,
+                                                              double const       time,
+                                                              bool const         unsteady)
+{
+  AssertThrow(unsteady,
+              dealii::ExcMessage(
+                "This postprocessing tool can only be used for unsteady problems."));
+
+  AssertThrow(not(output_written),
+              dealii::ExcMessage("Snapshots can not be added after writing the results."));
+
+  times.push_back(time);
+
+  add_snapshot(snapshot);
+}
+
+template<int dim, int n_components, typename Number>
+unsigned int
+IncrementalPODCalculator<dim, n_components, Number>::get_rank() const
+{
+  return modes.size();
+}
+
+template<int dim, int n_components, typename Number>
+std::vector<double> const &
+IncrementalPODCalculator<dim, n_components, Number>::get_singular_values() const
+{
+  return singular_values;
+}
+
+template<int dim, int n_components, typename Number>
+void
+IncrementalPODCalculator<dim, n_components, Number>::add_snapshot(VectorType const & snapshot)
+{
+  unsigned int const rank = modes.size();
+
+  VectorType residual(snapshot), mass_times_residual;
+  mass_times_residual.reinit(snapshot, true /* omit_zeroing_entries */);
+
+  // Project the snapshot onto the current modes using classical Gram-Schmidt with one
+  // reorthogonalization. The norm of the residual after the second pass follows from the
+  // orthonormality of the modes, so that the mass operator is applied twice in total.
+  std::vector<double> projection(rank, 0.0);
+  double              norm_squared = 0.0;
+
+  unsigned int const n_passes = rank > 0 ? 2 : 1;
+  for(unsigned int pass = 0; pass < n_passes; ++pass)
+  {
+    mass_operator.apply(mass_times_residual, residual);
+
+    std::vector<double> const products = compute_inner_products(residual, mass_times_residual);
+
+    if(pass == 0)
+      snapshot_energy += products[rank];
+
+    norm_squared = products[rank];
+    for(unsigned int i = 0; i < rank; ++i)
+    {
+      residual.add(-products[i], modes[i]);
+      projection[i] += products[i];
+
+      if(pass == 1)
+        norm_squared -= products[i] * products[i];
+    }
+  }
+
+  double norm = std::sqrt(std::max(norm_squared, 0.0));
+
+  // the snapshot does not contain a new direction
+  double const reference = rank > 0 ? singular_values[0] : norm;
+  if(norm <= data.truncation_tolerance * reference)
+    norm = 0.0;
+
+  // SVD of the small matrix K = [S, p; 0, norm], which yields the update
+  //
+  //   [U, r / norm] K = U' S' V'^T  with  U' = [U, r / norm] U_K
+  //
+  dealii::LAPACKFullMatrix<double> K(rank + 1, rank + 1);
+  for(unsigned int i = 0; i < rank; ++i)
+  {
+    K(i, i)    = singular_values[i];
+    K(i, rank) = projection[i];
+  }
+  K(rank, rank) = norm;
+
+  K.compute_svd();
+
+  unsigned int new_rank = 0;
+  while(new_rank < std::min(rank + 1, data.max_rank) &&
+        K.singular_value(new_rank) > data.truncation_tolerance * K.singular_value(0))
+    ++new_rank;
+
+  dealii::LAPACKFullMatrix<double> const & U_K  = K.get_svd_u();
+  dealii::LAPACKFullMatrix<double> const & Vt_K = K.get_svd_vt();
+
+  // update modes
+  if(norm > 0.0)
+    residual *= 1.0 / norm;
+
+  std::vector<VectorType> new_modes(new_rank);
+  for(unsigned int j = 0; j < new_rank; ++j)
+  {
+    new_modes[j].reinit(snapshot);
+    for(unsigned int i = 0; i < rank; ++i)
+      new_modes[j].add(U_K(i, j), modes[i]);
+    if(norm > 0.0)
+      new_modes[j].add(U_K(rank, j), residual);
+  }
+  modes.swap(new_modes);
+
+  // update singular values
+  singular_values.resize(new_rank);
+  for(unsigned int j = 0; j < new_rank; ++j)
+    singular_values[j] = K.singular_value(j);
+
+  // update right singular vectors, V' = [V, 0; 0, 1] V_K
+  right_singular_vectors.push_back(std::vector<double>(rank, 0.0));
+  right_singular_vectors.back().push_back(1.0);
+
+  for(auto & row : right_singular_vectors)
+  {
+    std::vector<double> new_row(new_rank, 0.0);
+    for(unsigned int j = 0; j < new_rank; ++j)
+      for(unsigned int i = 0; i < row.size(); ++i)
+        new_row[j] += row[i] * Vt_K(j, i);
+
+    row.swap(new_row);
+  }
+}
+
+template<int dim, int n_components, typename Number>
+std::vector<double>
+IncrementalPODCalculator<dim, n_components, Number>::compute_inner_products(
+  VectorType const & vector,
+  VectorType const & mass_times_vector) const
+{
+  unsigned int const rank = modes.size();
+
+  std::vector<double> products(rank + 1, 0.0);
+  for(unsigned int k = 0; k < mass_times_vector.locally_owned_size(); ++k)
+  {
+    double const value = mass_times_vector.local_element(k);
+
+    for(unsigned int i = 0; i < rank; ++i)
+      products[i] += modes[i].local_element(k) * value;
+    products[rank] += vector.local_element(k) * value;
+  }
+
+  dealii::Utilities::MPI::sum(dealii::ArrayView<double const>(products.data(), products.size()),
+                              mpi_comm,
+                              dealii::ArrayView<double>(products.data(), products.size()));
+
+  return products;
+}
+
+template<int dim, int n_components, typename Number>
+void
+IncrementalPODCalculator<dim, n_components, Number>::write_output()
+{
+  if(output_written or not(data.time_control_data.is_active))
+    return;
+
+  write_singular_values();
+
+  write_coefficients();
+
+  std::vector<std::string> names;
+  for(unsigned int i = 0; i < modes.size(); ++i)
+    names.push_back("mode_" + std::to_string(i));
+  write_fields(modes, names, "modes");
+
+  if(data.compute_dmd)
+    write_dmd();
+
+  output_written = true;
+}
+
+template<int dim, int n_components, typename Number>
+void
+IncrementalPODCalculator<dim, n_components, Number>::write_singular_values() const
+{
+  if(dealii::Utilities::MPI::this_mpi_process(mpi_comm) == 0)
+  {
+    std::ofstream f;
+    f.open((data.directory + data.filename + "_singular_values").c_str(), std::ios::trunc);
+
+    f << "Number of snapshots: " << times.size() << std::endl
+      << "Energy of snapshots: sum_i (x_i,x_i)_Omega = " << std::scientific << snapshot_energy
+      << std::endl
+      << std::endl;
+
+    unsigned int const precision = 12;
+
+    // clang-format off
+    f << std::setw(10) << std::left << "mode"
+      << std::setw(precision + 8) << std::left << "singular value"
+      << std::setw(precision + 8) << std::left << "energy fraction"
+      << std::setw(precision + 8) << std::left << "cumulative"
+      << std::endl;
+    // clang-format on
+
+    double cumulative = 0.0;
+    for(unsigned int i = 0; i < singular_values.size(); ++i)
+    {
+      double const fraction =
+        snapshot_energy > 0.0 ? singular_values[i] * singular_values[i] / snapshot_energy : 0.0;
+      cumulative += fraction;
+
+      f << std::scientific << std::setprecision(precision) << std::setw(10) << std::left << i
+        << std::setw(precision + 8) << std::left << singular_values[i]
+        << std::setw(precision + 8) << std::left << fraction << std::setw(precision + 8)
+        << std::left << cumulative << std::endl;
+    }
+  }
+}
+
+template<int dim, int n_components, typename Number>
+void
+IncrementalPODCalculator<dim, n_components, Number>::write_coefficients() const
+{
+  if(dealii::Utilities::MPI::this_mpi_process(mpi_comm) == 0)
+  {
+    std::ofstream f;
+    f.open((data.directory + data.filename + "_coefficients").c_str(), std::ios::trunc);
+
+    unsigned int const precision = 12;
+
+    f << std::setw(precision + 8) << std::left << "time";
+    for(unsigned int i = 0; i < singular_values.size(); ++i)
+      f << std::setw(precision + 8) << std::left << "mode_" + std::to_string(i);
+    f << std::endl;
+
+    // the temporal coefficients of snapshot k are S V^T e_k
+    for(unsigned int k = 0; k < times.size(); ++k)
+    {
+      f << std::scientific << std::setprecision(precision) << std::setw(precision + 8) << std::left
+        << times[k];
+      for(unsigned int i = 0; i < singular_values.size(); ++i)
+        f << std::setw(precision + 8) << std::left
+          << singular_values[i] * right_singular_vectors[k][i];
+      f << std::endl;
+    }
+  }
+}
+
+template<int dim, int n_components, typename Number>
+void
+IncrementalPODCalculator<dim, n_components, Number>::write_dmd() const
+{
+  unsigned int const rank        = modes.size();
+  unsigned int const n_snapshots = times.size();
+
+  if(rank == 0 or n_snapshots < 2)
+    return;
+
+  auto const coefficient = [&](unsigned int const k, unsigned int const i) {
+    return singular_values[i] * right_singular_vectors[k][i];
+  };
+
+  // Least-squares fit of the operator A advancing the coefficients by one sampling interval,
+  // A = (X_2 X_1^T) (X_1 X_1^T)^+ with X_1 = [c_0, ..., c_{m-2}] and X_2 = [c_1, ..., c_{m-1}].
+  dealii::LAPACKFullMatrix<double> gram(rank, rank);
+  dealii::FullMatrix<double>       cross(rank, rank);
+  for(unsigned int k = 0; k + 1 < n_snapshots; ++k)
+  {
+    for(unsigned int i = 0; i < rank; ++i)
+    {
+      for(unsigned int j = 0; j < rank; ++j)
+      {
+        gram(i, j) += coefficient(k, i) * coefficient(k, j);
+        cross(i, j) += coefficient(k + 1, i) * coefficient(k, j);
+      }
+    }
+  }
+
+  // pseudo-inverse of the Gram matrix, discarding directions not excited by the snapshots
+  gram.compute_svd();
+  dealii::LAPACKFullMatrix<double> const & U_gram  = gram.get_svd_u();
+  dealii::LAPACKFullMatrix<double> const & Vt_gram = gram.get_svd_vt();
+
+  dealii::FullMatrix<double> gram_inverse(rank, rank);
+  for(unsigned int l = 0; l < rank; ++l)
+  {
+    double const sigma = gram.singular_value(l);
+    if(sigma <= data.truncation_tolerance * gram.singular_value(0))
+      continue;
+
+    for(unsigned int i = 0; i < rank; ++i)
+      for(unsigned int j = 0; j < rank; ++j)
+        gram_inverse(i, j) += Vt_gram(l, i) * U_gram(j, l) / sigma;
+  }
+
+  dealii::FullMatrix<double> A_full(rank, rank);
+  cross.mmult(A_full, gram_inverse);
+
+  dealii::LAPACKFullMatrix<double> A(rank, rank);
+  A = A_full;
+  A.compute_eigenvalues(true, false);
+  dealii::FullMatrix<std::complex<double>> const eigenvectors = A.get_right_eigenvectors();
+
+  // DMD assumes a constant sampling interval
+  double const dt = (times.back() - times.front()) / (n_snapshots - 1);
+
+  if(dealii::Utilities::MPI::this_mpi_process(mpi_comm) == 0)
+  {
+    std::ofstream f;
+    f.open((data.directory + data.filename + "_dmd_eigenvalues").c_str(), std::ios::trunc);
+
+    unsigned int const precision = 12;
+
+    f << "DMD eigenvalues mu with growth rate Re(log(mu))/dt and frequency Im(log(mu))/(2 pi dt),"
+      << std::endl
+      << "where dt = " << std::scientific << dt << " is the sampling interval" << std::endl
+      << std::endl;
+
+    // clang-format off
+    f << std::setw(10) << std::left << "mode"
+      << std::setw(precision + 8) << std::left << "Re(mu)"
+      << std::setw(precision + 8) << std::left << "Im(mu)"
+      << std::setw(precision + 8) << std::left << "growth rate"
+      << std::setw(precision + 8) << std::left << "frequency"
+      << std::endl;
+    // clang-format on
+
+    for(unsigned int i = 0; i < rank; ++i)
+    {
+      std::complex<double> const mu    = A.eigenvalue(i);
+      std::complex<double> const omega = std::log(mu) / dt;
+
+      f << std::scientific << std::setprecision(precision) << std::setw(10) << std::left << i
+        << std::setw(precision + 8) << std::left << mu.real() << std::setw(precision + 8)
+        << std::left << mu.imag() << std::setw(precision + 8) << std::left << omega.real()
+        << std::setw(precision + 8) << std::left << omega.imag() / (2.0 * dealii::numbers::PI)
+        << std::endl;
+    }
+  }
+
+  // DMD modes in the space of the POD modes. Complex conjugate pairs are written only once.
+  std::vector<VectorType>  dmd_modes;
+  std::vector<std::string> names;
+  for(unsigned int i = 0; i < rank; ++i)
+  {
+    std::complex<double> const mu = A.eigenvalue(i);
+    if(mu.imag() < -1.e-12 * std::abs(mu))
+      continue;
+
+    VectorType real_part, imaginary_part;
+    real_part.reinit(modes[0]);
+    imaginary_part.reinit(modes[0]);
+    for(unsigned int j = 0; j < rank; ++j)
+    {
+      real_part.add(eigenvectors(j, i).real(), modes[j]);
+      imaginary_part.add(eigenvectors(j, i).imag(), modes[j]);
+    }
+
+    dmd_modes.push_back(real_part);
+    names.push_back("dmd_mode_" + std::to_string(i) + "_real");
+    dmd_modes.push_back(imaginary_part);
+    names.push_back("dmd_mode_" + std::to_string(i) + "_imag");
+  }
+
+  write_fields(dmd_modes, names, "dmd_modes");
+}
+
+template<int dim, int n_components, typename Number>
+void
+IncrementalPODCalculator<dim, n_components, Number>::write_fields(
+  std::vector<VectorType> const &  fields,
+  std::vector<std::string> const & names,
+  std::string const &              name) const
+{
+  if(fields.empty())
+    return;
+
+  dealii::DataOutBase::VtkFlags flags;
+  flags.write_higher_order_cells = true;
+
+  dealii::DataOut<dim> data_out;
+  data_out.set_flags(flags);
+
+  for(unsigned int i = 0; i < fields.size(); ++i)
+  {
+    if(n_components == 1)
+    {
+      data_out.add_data_vector(*dof_handler, fields[i], names[i]);
+    }
+    else
+    {
+      std::vector<std::string> component_names(n_components, names[i]);
+      std::vector<dealii::DataComponentInterpretation::DataComponentInterpretation>
+        component_interpretation(n_components,
+                                 dealii::DataComponentInterpretation::component_is_part_of_vector);
+
+      data_out.add_data_vector(*dof_handler, fields[i], component_names, component_interpretation);
+    }
+  }
+
+  data_out.build_patches(*mapping, data.degree, dealii::DataOut<dim>::curved_inner_cells);
+
+  data_out.write_vtu_with_pvtu_record(
+    data.directory, data.filename + "_" + name, 0, mpi_comm, 4 /* n_digits_counter */);
+}
+
+template class IncrementalPODCalculator<2, 1, float>;
+template class IncrementalPODCalculator<2, 1, double>;
+
+template class IncrementalPODCalculator<3, 1, float>;
+template class IncrementalPODCalculator<3, 1, double>;
+
+template class IncrementalPODCalculator<2, 2, float>;
+template class IncrementalPODCalculator<2, 2, double>;
+
+template class IncrementalPODCalculator<3, 3, float>;
+template class IncrementalPODCalculator<3, 3, double>;
+
+} // namespace ExaDG
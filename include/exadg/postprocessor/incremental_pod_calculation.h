@@ -0,0 +1,209 @@
+/*  ______________________________________________________________________
+ *
+ *  ExaDG - High-Order Discontinuous Galerkin for the Exa-Scale
+ *
+ *  Copyright (C) 2021 by the ExaDG authors
+ *
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *  ______________________________________________________________________
+ */
+
+#ifndef INCLUDE_EXADG_POSTPROCESSOR_INCREMENTAL_POD_CALCULATION_H_
+#define INCLUDE_EXADG_POSTPROCESSOR_INCREMENTAL_POD_CALCULATION_H_
+
+// C/C++
+#include <string>
+#include <vector>
+
+// deal.II
+#include <deal.II/dofs/dof_handler.h>
+#include <deal.II/fe/mapping.h>
+#include <deal.II/lac/la_parallel_vector.h>
+#include <deal.II/matrix_free/matrix_free.h>
+
+// ExaDG
+#include <exadg/operators/mass_operator.h>
+#include <exadg/postprocessor/time_control.h>
+#include <exadg/utilities/print_functions.h>
+
+namespace ExaDG
+{
+struct IncrementalPODData
+{
+  IncrementalPODData()
+    : directory("output/"),
+      filename("pod"),
+      max_rank(10),
+      truncation_tolerance(1.e-10),
+      compute_dmd(false),
+      degree(1)
+  {
+  }
+
+  void
+  print(dealii::ConditionalOStream & pcout, bool const unsteady) const
+  {
+    if(time_control_data.is_active)
+    {
+      pcout << std::endl << "  Incremental POD:" << std::endl;
+
+      time_control_data.print(pcout, unsteady);
+
+      print_parameter(pcout, "Directory of output files", directory);
+      print_parameter(pcout, "Filename", filename);
+      print_parameter(pcout, "Maximum rank", max_rank);
+      print_parameter(pcout, "Truncation tolerance", truncation_tolerance);
+      print_parameter(pcout, "Compute DMD", compute_dmd);
+      print_parameter(pcout, "Polynomial degree of output", degree);
+    }
+  }
+
+  /*
+   *  Snapshots are taken whenever the time control triggers. The results are written once the end
+   *  time of the time control is reached, which therefore has to be specified.
+   *
+   *  Restarts are not supported: the decomposition is not stored in the restart files, so that
+   *  the results of a restarted simulation only include the snapshots taken after the restart.
+   */
+  TimeControlData time_control_data;
+
+  std::string directory;
+  std::string filename;
+
+  // maximum number of POD modes retained during the incremental update
+  unsigned int max_rank;
+
+  // modes with singular values below truncation_tolerance times the largest singular value are
+  // discarded
+  double truncation_tolerance;
+
+  // dynamic mode decomposition in the space of the POD modes (requires a constant sampling
+  // interval)
+  bool compute_dmd;
+
+  // polynomial degree used to write the modes
+  unsigned int degree;
+};
+
+/*
+ * Proper orthogonal decomposition (POD) of a sequence of snapshots computed on the fly, i.e.,
+ * without storing the snapshots. The truncated singular value decomposition
+ *
+ *   [x_0, ..., x_{m-1}] = U S V^T
+ *
+ * is updated incrementally for every new snapshot, see
+ *
+ *   Brand, M. (2002). Incremental singular value decomposition of uncertain data with missing
+ *   values. European Conference on Computer Vision, 707-720.
+ *
+ * The POD modes U are distributed vectors that are orthonormal with respect to the mass-weighted
+ * inner product (u,v)_Omega, so that the singular values measure the L2 norm (e.g. the kinetic
+ * energy in case of the velocity). S and the right singular vectors V are small and stored on all
+ * processes. The temporal coefficients of snapshot i are given by S V^T e_i.
+ *
+ * Optionally, a dynamic mode decomposition (DMD) is computed at the end from the temporal
+ * coefficients, i.e., the linear operator advancing the coefficients by one sampling interval is
+ * fitted in the least-squares sense and its eigenvalues and eigenvectors yield the DMD
+ * eigenvalues and (projected) DMD modes.
+ */
+template<int dim, int n_components, typename Number>
+class IncrementalPODCalculator
+{
+public:
+  typedef dealii::LinearAlgebra::distributed::Vector<Number> VectorType;
+
+  IncrementalPODCalculator(MPI_Comm const & comm);
+
+  void
+  setup(dealii::MatrixFree<dim, Number> const &   matrix_free,
+        dealii::AffineConstraints<Number> const & constraints,
+        unsigned int const                        dof_index,
+        unsigned int const                        quad_index,
+        dealii::DoFHandler<dim> const &           dof_handler_in,
+        dealii::Mapping<dim> const &              mapping_in,
+        IncrementalPODData const &                data_in);
+
+  /*
+   *  Adds the snapshot to the decomposition.
+   */
+  void
+  evaluate(VectorType const & snapshot, double const time, bool const unsteady);
+
+  /*
+   *  Writes the singular values, temporal coefficients and modes (and the DMD results if
+   *  requested). This is done only once, i.e., further calls have no effect.
+   */
+  void
+  write_output();
+
+  unsigned int
+  get_rank() const;
+
+  std::vector<double> const &
+  get_singular_values() const;
+
+  TimeControl time_control;
+
+private:
+  void
+  add_snapshot(VectorType const & snapshot);
+
+  /*
+   *  Computes the mass-weighted inner products of all modes and of the vector itself with the
+   *  vector M * vector using a single global reduction. The last entry is the squared norm.
+   */
+  std::vector<double>
+  compute_inner_products(VectorType const & vector, VectorType const & mass_times_vector) const;
+
+  void
+  write_singular_values() const;
+
+  void
+  write_coefficients() const;
+
+  void
+  write_dmd() const;
+
+  void
+  write_fields(std::vector<VectorType> const &   fields,
+               std::vector<std::string> const & names,
+               std::string const &              name) const;
+
+  MPI_Comm const mpi_comm;
+
+  MassOperator<dim, n_components, Number> mass_operator;
+
+  dealii::SmartPointer<dealii::DoFHandler<dim> const> dof_handler;
+  dealii::SmartPointer<dealii::Mapping<dim> const>    mapping;
+
+  IncrementalPODData data;
+
+  // POD modes (orthonormal with respect to the mass matrix) and singular values
+  std::vector<VectorType> modes;
+  std::vector<double>     singular_values;
+
+  // right singular vectors, one row per snapshot
+  std::vector<std::vector<double>> right_singular_vectors;
+
+  std::vector<double> times;
+
+  // sum of the squared norms of all snapshots
+  double snapshot_energy;
+
+  bool output_written;
+};
+
+} // namespace ExaDG
+
+#endif /* INCLUDE_EXADG_POSTPROCESSOR_INCREMENTAL_POD_CALCULATION_H_ */
@@ -59,6 +59,20 @@ void
 KineticEnergyCalculator<dim, Number>::evaluate(VectorType const & velocity,
                                                double const       time,
                                                bool const         unsteady)
+{
+  BatchedReduction reductions(mpi_comm);
+
+  evaluate(velocity, time, unsteady, reductions);
+
+  reductions.resolve();
+}
+
+template<int dim, typename Number>
+void
+KineticEnergyCalculator<dim, Number>::evaluate(VectorType const & velocity,
+                                               double const       time,
+                                               bool const         unsteady,
+                                               BatchedReduction & reductions)
 {
   AssertThrow(unsteady,
               dealii::ExcMessage(
@@ -67,18 +81,36 @@ KineticEnergyCalculator<dim, Number>::evaluate(VectorType const & velocity,
   AssertThrow(data.evaluate_individual_terms == false,
               dealii::ExcMessage("Not implemented in this class."));
 
-  calculate_basic(velocity, time);
+  calculate_basic(velocity, time, reductions);
 }
 
 template<int dim, typename Number>
 void
 KineticEnergyCalculator<dim, Number>::calculate_basic(VectorType const & velocity,
-                                                      double const       time)
+                                                      double const       time,
+                                                      BatchedReduction & reductions)
 {
-  Number kinetic_energy = 0.0, enstrophy = 0.0, dissipation = 0.0, max_vorticity = 0.0;
+  unsigned int const index = add_integrals(*matrix_free, velocity, reductions);
 
-  integrate(*matrix_free, velocity, kinetic_energy, enstrophy, dissipation, max_vorticity);
+  reductions.on_completion([this, index, time](BatchedReduction const & result) {
+    double const volume = result.get(index);
+
+    write_output(time,
+                 result.get(index + 1) / volume,
+                 result.get(index + 3) / volume,
+                 result.get(index + 2) / volume,
+                 result.get(index + 4));
+  });
+}
 
+template<int dim, typename Number>
+void
+KineticEnergyCalculator<dim, Number>::write_output(double const time,
+                                                   double const kinetic_energy,
+                                                   double const dissipation,
+                                                   double const enstrophy,
+                                                   double const max_vorticity)
+{
   // write output file
   if(dealii::Utilities::MPI::this_mpi_process(mpi_comm) == 0)
   {
@@ -126,25 +158,41 @@ KineticEnergyCalculator<dim, Number>::integrate(dealii::MatrixFree<dim, Number>
                                                 Number &                                dissipation,
                                                 Number & max_vorticity)
 {
-  std::vector<Number> dst(5, 0.0);
-  matrix_free.cell_loop(&KineticEnergyCalculator<dim, Number>::cell_loop, this, dst, velocity);
+  BatchedReduction reductions(mpi_comm);
 
-  // sum over all MPI processes
-  Number volume = 1.0;
-  volume        = dealii::Utilities::MPI::sum(dst.at(0), mpi_comm);
-  energy        = dealii::Utilities::MPI::sum(dst.at(1), mpi_comm);
-  enstrophy     = dealii::Utilities::MPI::sum(dst.at(2), mpi_comm);
-  dissipation   = dealii::Utilities::MPI::sum(dst.at(3), mpi_comm);
+  unsigned int const index = add_integrals(matrix_free, velocity, reductions);
 
-  energy /= volume;
-  enstrophy /= volume;
-  dissipation /= volume;
+  Number volume = 1.0;
+  reductions.on_completion([&](BatchedReduction const & result) {
+    volume        = result.get(index);
+    energy        = result.get(index + 1) / volume;
+    enstrophy     = result.get(index + 2) / volume;
+    dissipation   = result.get(index + 3) / volume;
+    max_vorticity = result.get(index + 4);
+  });
 
-  max_vorticity = dealii::Utilities::MPI::max(dst.at(4), mpi_comm);
+  // sum over all MPI processes
+  reductions.resolve();
 
   return volume;
 }
 
+template<int dim, typename Number>
+unsigned int
+KineticEnergyCalculator<dim, Number>::add_integrals(
+  dealii::MatrixFree<dim, Number> const & matrix_free,
+  VectorType const &                      velocity,
+  BatchedReduction &                      reductions)
+{
+  std::vector<Number> dst(5, 0.0);
+  matrix_free.cell_loop(&KineticEnergyCalculator<dim, Number>::cell_loop, this, dst, velocity);
+
+  unsigned int const index = reductions.add({dst.at(0), dst.at(1), dst.at(2), dst.at(3)});
+  reductions.add(dst.at(4), ReductionOperation::Max);
+
+  return index;
+}
+
 template<int dim, typename Number>
 void
 KineticEnergyCalculator<dim, Number>::cell_loop(
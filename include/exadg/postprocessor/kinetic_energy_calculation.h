@@ -29,6 +29,7 @@
 #include <exadg/incompressible_navier_stokes/spatial_discretization/curl_compute.h>
 #include <exadg/matrix_free/integrators.h>
 #include <exadg/postprocessor/time_control.h>
+#include <exadg/utilities/batched_reduction.h>
 #include <exadg/utilities/print_functions.h>
 
 namespace ExaDG
@@ -99,11 +100,38 @@ public:
   void
   evaluate(VectorType const & velocity, double const time, bool const unsteady);
 
+  /*
+   * Same as above, but the global reduction is deferred to the batch of reductions, i.e., the
+   * results are written once reductions.finish() has been called.
+   */
+  void
+  evaluate(VectorType const & velocity,
+           double const       time,
+           bool const         unsteady,
+           BatchedReduction & reductions);
+
   TimeControl time_control;
 
 protected:
   void
-  calculate_basic(VectorType const & velocity, double const time);
+  calculate_basic(VectorType const & velocity, double const time, BatchedReduction & reductions);
+
+  void
+  write_output(double const time,
+               double const kinetic_energy,
+               double const dissipation,
+               double const enstrophy,
+               double const max_vorticity);
+
+  /*
+   * Computes the process-local integrals (volume, energy, enstrophy, dissipation) and the local
+   * maximum of the vorticity, and registers them for the global reduction. Returns the index of
+   * the first value.
+   */
+  unsigned int
+  add_integrals(dealii::MatrixFree<dim, Number> const & matrix_free_data,
+                VectorType const &                      velocity,
+                BatchedReduction &                      reductions);
 
   /*
    *  This function calculates the kinetic energy
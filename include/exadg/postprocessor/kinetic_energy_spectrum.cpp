@@ -23,10 +23,57 @@
 #include <fstream>
 
 // ExaDG
+#include <exadg/postprocessor/in_transit_analysis.h>
 #include <exadg/postprocessor/kinetic_energy_spectrum.h>
 #include <exadg/postprocessor/mirror_dof_vector_taylor_green.h>
 #include <exadg/utilities/create_directories.h>
 
+namespace ExaDG
+{
+namespace
+{
+template<int dim>
+std::size_t
+norm_point_to_lex(dealii::Point<dim> const & c, unsigned int const & n_cells_1D)
+{
+  // convert normalized point [0, 1] to lex
+  if(dim == 2)
+    return static_cast<std::size_t>(std::floor(c[0]) + n_cells_1D * std::floor(c[1]));
+  else if(dim == 3)
+    return static_cast<std::size_t>(std::floor(c[0]) + n_cells_1D * std::floor(c[1]) +
+                                    n_cells_1D * n_cells_1D * std::floor(c[2]));
+  else
+    Assert(false, dealii::ExcMessage("not implemented"));
+
+  return 0;
+}
+
+/*
+ * Lexicographic indices of the locally owned cells of a uniform triangulation of [-pi, pi]^dim
+ * with n_cells_1D cells in each direction.
+ */
+template<int dim>
+std::vector<dealii::types::global_dof_index>
+get_local_cells(dealii::Triangulation<dim> const & tria, unsigned int const n_cells_1D)
+{
+  std::vector<dealii::types::global_dof_index> local_cells;
+  for(auto const & cell : tria.active_cell_iterators())
+  {
+    if(cell->is_locally_owned())
+    {
+      auto c = cell->center();
+      for(unsigned int i = 0; i < dim; i++)
+        c[i] = (c[i] + dealii::numbers::PI) / (2 * dealii::numbers::PI / n_cells_1D);
+
+      local_cells.push_back(norm_point_to_lex(c, n_cells_1D));
+    }
+  }
+
+  return local_cells;
+}
+} // namespace
+} // namespace ExaDG
+
 #ifdef EXADG_WITH_FFTW
 // deal.II
 #  include <deal.II/base/mpi.templates.h>
@@ -73,6 +120,26 @@ public:
     print_timings();
   }
 
+  /**
+   * Configure the parallel FFT, has to be called before init()
+   *
+   * @param pencil          use pencil decomposition instead of slab decomposition
+   * @param process_rows    number of rows of the process grid (0: automatic)
+   * @param measure         create FFTW plans with FFTW_MEASURE instead of FFTW_ESTIMATE
+   * @param wisdom_file     file for caching FFTW wisdom (empty: no wisdom)
+   */
+  void
+  configure_fft(bool const          pencil,
+                unsigned int const  process_rows,
+                bool const          measure,
+                std::string const & wisdom_file)
+  {
+    s.pencil_decomposition = pencil;
+    s.process_rows         = process_rows;
+    s.measure_plans        = measure;
+    s.wisdom_file          = wisdom_file;
+  }
+
   /**
    * Initialize data structures
    *
@@ -80,33 +147,34 @@ public:
    * @param cells         number of cells in each direction
    * @param points_src    number of Gauss-Lobatto points (order + 1)
    * @param points_dst    number of equidisant points (for post processing)
-   * @param local_cells   number of cells this process owns
+   * @param tria          triangulation (uniform, [-pi, pi]^dim)
    *
    */
-  template<class Tria>
+  template<int dimension>
   void
-  init(dealii::types::global_dof_index dim,
-       dealii::types::global_dof_index n_cells_1D,
-       dealii::types::global_dof_index points_src,
-       dealii::types::global_dof_index points_dst,
-       Tria &                          tria)
+  init(dealii::types::global_dof_index          dim,
+       dealii::types::global_dof_index          n_cells_1D,
+       dealii::types::global_dof_index          points_src,
+       dealii::types::global_dof_index          points_dst,
+       dealii::Triangulation<dimension> const & tria)
+  {
+    init(dim, n_cells_1D, points_src, points_dst, get_local_cells(tria, n_cells_1D));
+  }
+
+  /**
+   * Same as above, but the lexicographic indices of the cells whose data is passed to execute()
+   * are given explicitly (in the order of the data)
+   */
+  void
+  init(dealii::types::global_dof_index                      dim,
+       dealii::types::global_dof_index                      n_cells_1D,
+       dealii::types::global_dof_index                      points_src,
+       dealii::types::global_dof_index                      points_dst,
+       std::vector<dealii::types::global_dof_index> const & local_cells)
   {
     // init setup ...
     s.init(dim, n_cells_1D, points_src, points_dst);
 
-    std::vector<dealii::types::global_dof_index> local_cells;
-    for(auto const & cell : tria.active_cell_iterators())
-    {
-      if(cell->is_locally_owned())
-      {
-        auto c = cell->center();
-        for(dealii::types::global_dof_index i = 0; i < dim; i++)
-          c[i] = (c[i] + dealii::numbers::PI) / (2 * dealii::numbers::PI / n_cells_1D);
-
-        local_cells.push_back(norm_point_to_lex(c, n_cells_1D));
-      }
-    }
-
     dealii::types::global_dof_index n_local_cells = local_cells.size();
     dealii::types::global_dof_index global_offset = 0;
 
@@ -131,12 +199,6 @@ public:
     fftw.init();
     timer.stop("Init-FFTW");
 
-    int start_;
-    int end_;
-    fftw.getLocalRange(start_, end_);
-    const dealii::types::global_dof_index start = start_;
-    const dealii::types::global_dof_index end   = end_;
-
     std::vector<dealii::types::global_dof_index> indices_has, indices_want;
 
     for(auto const & I : local_cells)
@@ -153,27 +215,20 @@ public:
           indices_has.push_back(d * dealii::Utilities::pow(points_dst * n_cells_1D, dim) + index);
         }
 
-    dealii::types::global_dof_index N  = s.cells * s.points_dst;
-    dealii::types::global_dof_index Nx = (N / 2 + 1) * 2;
-
+    // the layout of the FFT input arrays depends on the decomposition (slab or pencil)
     for(dealii::types::global_dof_index d = 0;
         d < static_cast<dealii::types::global_dof_index>(s.dim);
         d++)
     {
-      dealii::types::global_dof_index c = 0;
-      for(dealii::types::global_dof_index k = 0; k < (end - start); k++)
-        for(dealii::types::global_dof_index j = 0; j < N; j++)
-          for(dealii::types::global_dof_index i = 0; i < Nx; i++, c++)
-            if(i < N)
-              indices_want.push_back(d * dealii::Utilities::pow(points_dst * n_cells_1D, dim) +
-                                     (k + start) *
-                                       dealii::Utilities::pow(points_dst * n_cells_1D, 2) +
-                                     j * dealii::Utilities::pow(points_dst * n_cells_1D, 1) + i);
-            else
-              indices_want.push_back(dealii::numbers::invalid_dof_index); // x-padding
-
-      for(; c < static_cast<dealii::types::global_dof_index>(fftw.bsize); c++)
-        indices_want.push_back(dealii::numbers::invalid_dof_index); // z-padding
+      for(int c = 0; c < fftw.bsize; c++)
+      {
+        long int const index = fftw.local_to_lexicographic(c);
+        if(index >= 0)
+          indices_want.push_back(d * dealii::Utilities::pow(points_dst * n_cells_1D, dim) +
+                                 index);
+        else
+          indices_want.push_back(dealii::numbers::invalid_dof_index); // padding
+      }
     }
 
     nonconti = std::make_shared<dealii::Utilities::MPI::NoncontiguousPartitioner>(indices_has,
@@ -214,7 +269,7 @@ public:
         dealii::Utilities::pow(static_cast<dealii::types::global_dof_index>(s.cells * s.points_dst),
                                s.dim) *
         s.dim;
-      dealii::ArrayView<double>       dst(fftw.u_real, size * 2);
+      dealii::ArrayView<double>       dst(fftw.u_real, fftw.bsize * s.dim);
       dealii::ArrayView<double const> src_(ipol.dst, size);
       nonconti->export_to_ghosted_array(src_, dst);
 
@@ -255,23 +310,19 @@ public:
       timer.printTimings();
   }
 
-private:
-  template<int dim>
-  std::size_t
-  norm_point_to_lex(dealii::Point<dim> const & c, unsigned int const & n_cells_1D)
+  /**
+   * Return wall time of the last call of the given step
+   *
+   * @param label     Init-Ipol, Init-FFTW, Interpolation, Permutation, FFT, or Postprocessing
+   * @return wall time of this process
+   */
+  double
+  get_wall_time(std::string const & label) const
   {
-    // convert normalized point [0, 1] to lex
-    if(dim == 2)
-      return static_cast<std::size_t>(std::floor(c[0]) + n_cells_1D * std::floor(c[1]));
-    else if(dim == 3)
-      return static_cast<std::size_t>(std::floor(c[0]) + n_cells_1D * std::floor(c[1]) +
-                                      n_cells_1D * n_cells_1D * std::floor(c[2]));
-    else
-      Assert(false, dealii::ExcMessage("not implemented"));
-
-    return 0;
+    return timer.get_last(label);
   }
 
+private:
   MPI_Comm const & comm;
 
   // flush flow field to hard drive?
@@ -309,6 +360,11 @@ public:
   {
   }
 
+  void
+  configure_fft(bool const, unsigned int const, bool const, std::string const &)
+  {
+  }
+
   template<typename T>
   void
   init(int, int, int, int, T &)
@@ -325,18 +381,218 @@ public:
   {
     return 0;
   }
+
+  double
+  get_wall_time(std::string const &) const
+  {
+    return 0.0;
+  }
 };
 } // namespace ExaDG
 #endif
 
 namespace ExaDG
 {
+namespace
+{
+unsigned int const precision = 12;
+
+/*
+ * Prints the wall times (maximum over all processes) of the given steps of the spectral analysis.
+ */
+void
+print_wall_times_spectrum(DealSpectrumWrapper const &      deal_spectrum_wrapper,
+                          std::vector<std::string> const & labels,
+                          MPI_Comm const &                 mpi_comm)
+{
+  dealii::ConditionalOStream pcout(std::cout,
+                                   dealii::Utilities::MPI::this_mpi_process(mpi_comm) == 0);
+
+  pcout << std::endl << "Wall times kinetic energy spectrum (max over all processes):" << std::endl;
+  for(auto const & label : labels)
+    print_parameter(pcout,
+                    label + " [s]",
+                    dealii::Utilities::MPI::max(deal_spectrum_wrapper.get_wall_time(label),
+                                                mpi_comm));
+}
+
+/*
+ * Computes the kinetic energy spectrum of the given velocity data (cell-wise, in the order
+ * specified in DealSpectrumWrapper::init()) and writes the results to file.
+ */
+void
+calculate_and_write_spectrum(DealSpectrumWrapper &             deal_spectrum_wrapper,
+                             KineticEnergySpectrumData const & data,
+                             double const *                    velocity,
+                             unsigned int const                counter,
+                             double const                      time,
+                             bool &                            clear_files,
+                             MPI_Comm const &                  mpi_comm)
+{
+  std::string const file_name = data.filename + "_" + dealii::Utilities::int_to_string(counter, 4);
+
+  deal_spectrum_wrapper.execute(velocity, file_name, time);
+
+  if(data.do_fftw && data.print_wall_times)
+    print_wall_times_spectrum(deal_spectrum_wrapper,
+                              {"Interpolation", "Permutation", "FFT", "Postprocessing"},
+                              mpi_comm);
+
+  if(data.do_fftw)
+  {
+    // write output file
+    if(dealii::Utilities::MPI::this_mpi_process(mpi_comm) == 0)
+    {
+      std::cout << std::endl
+                << "Write kinetic energy spectrum at time t = " << time << ":" << std::endl;
+
+      // get tabularized results ...
+      double * kappa;
+      double * E;
+      double * C;
+      double   e_physical = 0.0;
+      double   e_spectral = 0.0;
+      int len = deal_spectrum_wrapper.get_results(kappa, E, C /*unused*/, e_physical, e_spectral);
+
+      std::ostringstream filename;
+      filename << data.directory + data.filename;
+
+      std::ofstream f;
+      if(clear_files == true)
+      {
+        f.open(filename.str().c_str(), std::ios::trunc);
+        clear_files = false;
+      }
+      else
+      {
+        f.open(filename.str().c_str(), std::ios::app);
+      }
+
+      f << std::endl
+        << "Calculate kinetic energy spectrum at time t = " << time << ":" << std::endl
+        << std::scientific << std::setprecision(precision) << std::setw(precision + 8) << std::endl
+        << "  Energy physical space e_phy = " << e_physical << std::endl
+        << "  Energy spectral space e_spe = " << e_spectral << std::endl
+        << "  Difference  |e_phy - e_spe| = " << std::abs(e_physical - e_spectral) << std::endl
+        << std::endl
+        << "    k  k (avg)              E(k)" << std::endl;
+
+      // ... and print it line by line:
+      for(int i = 0; i < len; i++)
+      {
+        f << std::scientific << std::setprecision(0)
+          << std::setw(2 + static_cast<unsigned int>(std::ceil(std::max(3.0, log(len) / log(10)))))
+          << i << std::scientific << std::setprecision(precision) << std::setw(precision + 8)
+          << kappa[i] << "   " << E[i] << std::endl;
+      }
+    }
+  }
+}
+
+/*
+ * Setup message of the in-transit analysis: the parameters and the lexicographic indices of the
+ * cells of a solver rank are sent as integers, the names of directory, file, and wisdom file as
+ * characters (separated by '\0').
+ */
+unsigned int const n_setup_parameters = 12;
+
+void
+pack_setup(std::vector<unsigned long long> &                    integers,
+           std::vector<char> &                                  characters,
+           KineticEnergySpectrumData const &                    data,
+           unsigned int const                                   dim,
+           unsigned int const                                   n_cells_1d,
+           unsigned int const                                   points_dst,
+           std::vector<dealii::types::global_dof_index> const & local_cells)
+{
+  integers = {dim,
+              n_cells_1d,
+              data.degree + 1,
+              points_dst,
+              data.write_raw_data_to_files,
+              data.do_fftw,
+              data.fft_decomposition == FFTDecomposition::Pencil,
+              data.n_process_rows,
+              data.measure_fftw_plans,
+              data.clear_file,
+              data.print_wall_times,
+              local_cells.size()};
+  integers.insert(integers.end(), local_cells.begin(), local_cells.end());
+
+  characters.clear();
+  for(std::string const & name : {data.directory, data.filename, data.fftw_wisdom_file})
+  {
+    characters.insert(characters.end(), name.begin(), name.end());
+    characters.push_back('\0');
+  }
+}
+
+void
+unpack_setup(std::vector<unsigned long long> const & integers,
+             std::vector<char> const &               characters,
+             KineticEnergySpectrumData &             data,
+             std::vector<unsigned long long> &       parameters)
+{
+  parameters.assign(integers.begin(), integers.begin() + n_setup_parameters);
+
+  data.write_raw_data_to_files = parameters[4];
+  data.do_fftw                 = parameters[5];
+  data.fft_decomposition  = parameters[6] ? FFTDecomposition::Pencil : FFTDecomposition::Slab;
+  data.n_process_rows     = parameters[7];
+  data.measure_fftw_plans = parameters[8];
+  data.clear_file         = parameters[9];
+  data.print_wall_times   = parameters[10];
+
+  std::vector<std::string> names(1);
+  for(char const c : characters)
+  {
+    if(c == '\0')
+      names.emplace_back();
+    else
+      names.back().push_back(c);
+  }
+  data.directory        = names[0];
+  data.filename         = names[1];
+  data.fftw_wisdom_file = names[2];
+}
+
+/*
+ * Receives a message of unknown size.
+ */
+template<typename T>
+std::vector<T>
+receive_message(int const            source,
+                int const            tag,
+                MPI_Datatype const & datatype,
+                MPI_Comm const &     comm)
+{
+  MPI_Status status;
+  MPI_Probe(source, tag, comm, &status);
+
+  int count = 0;
+  MPI_Get_count(&status, datatype, &count);
+
+  std::vector<T> message(count);
+  MPI_Recv(message.data(), count, datatype, source, tag, comm, MPI_STATUS_IGNORE);
+
+  return message;
+}
+} // namespace
+
 template<int dim, typename Number>
 KineticEnergySpectrumCalculator<dim, Number>::KineticEnergySpectrumCalculator(MPI_Comm const & comm)
-  : mpi_comm(comm), clear_files(true)
+  : mpi_comm(comm), clear_files(true), in_transit_request(MPI_REQUEST_NULL)
 {
 }
 
+template<int dim, typename Number>
+KineticEnergySpectrumCalculator<dim, Number>::~KineticEnergySpectrumCalculator()
+{
+  // complete pending send operation of in-transit analysis
+  if(in_transit_request != MPI_REQUEST_NULL)
+    MPI_Wait(&in_transit_request, MPI_STATUS_IGNORE);
+}
+
 template<int dim, typename Number>
 void
 KineticEnergySpectrumCalculator<dim, Number>::setup(
@@ -362,14 +618,18 @@ KineticEnergySpectrumCalculator<dim, Number>::setup(
                     "do_fftw = true and write_raw_data_to_files = false."));
     }
 
-    if(deal_spectrum_wrapper == nullptr)
+    if(data.in_transit)
     {
-      deal_spectrum_wrapper =
-        std::make_shared<DealSpectrumWrapper>(mpi_comm, data.write_raw_data_to_files, data.do_fftw);
+      AssertThrow(InTransitAnalysis::is_active(),
+                  dealii::ExcMessage("In-transit analysis requires dedicated analysis ranks, "
+                                     "see GeneralParameters."));
     }
 
     unsigned int evaluation_points = std::max(data.degree + 1, data.evaluation_points_per_cell);
 
+    dealii::Triangulation<dim> const * tria  = &dof_handler->get_triangulation();
+    int                                cells = 0;
+
     // create data structures for full system
     if(data.exploit_symmetry)
     {
@@ -387,21 +647,43 @@ KineticEnergySpectrumCalculator<dim, Number>::setup(
       dof_handler_full = std::make_shared<dealii::DoFHandler<dim>>(*tria_full);
       dof_handler_full->distribute_dofs(*fe_full);
 
-      int cells = tria_full->n_global_active_cells();
-      cells     = static_cast<int>(std::round(std::pow(cells, 1.0 / dim)));
-      deal_spectrum_wrapper->init(dim, cells, data.degree + 1, evaluation_points, *tria_full);
+      cells = tria_full->n_global_active_cells();
+      cells = static_cast<int>(std::round(std::pow(cells, 1.0 / dim)));
+      tria  = tria_full.get();
     }
     else
     {
       int local_cells = matrix_free_data_in.n_physical_cells();
-      int cells       = local_cells;
+      cells           = local_cells;
       MPI_Allreduce(MPI_IN_PLACE, &cells, 1, MPI_INTEGER, MPI_SUM, mpi_comm);
       cells = static_cast<int>(std::round(std::pow(cells, 1.0 / dim)));
-      deal_spectrum_wrapper->init(
-        dim, cells, data.degree + 1, evaluation_points, dof_handler->get_triangulation());
     }
 
-    create_directories(data.directory, mpi_comm);
+    if(data.in_transit)
+    {
+      send_setup_to_analysis_rank(cells, evaluation_points, get_local_cells(*tria, cells));
+    }
+    else
+    {
+      if(deal_spectrum_wrapper == nullptr)
+      {
+        deal_spectrum_wrapper = std::make_shared<DealSpectrumWrapper>(mpi_comm,
+                                                                      data.write_raw_data_to_files,
+                                                                      data.do_fftw);
+      }
+
+      deal_spectrum_wrapper->configure_fft(data.fft_decomposition == FFTDecomposition::Pencil,
+                                           data.n_process_rows,
+                                           data.measure_fftw_plans,
+                                           data.fftw_wisdom_file);
+
+      deal_spectrum_wrapper->init(dim, cells, data.degree + 1, evaluation_points, *tria);
+
+      if(data.print_wall_times)
+        print_wall_times_spectrum(*deal_spectrum_wrapper, {"Init-Ipol", "Init-FFTW"}, mpi_comm);
+
+      create_directories(data.directory, mpi_comm);
+    }
   }
 }
 
@@ -449,61 +731,161 @@ void
 KineticEnergySpectrumCalculator<dim, Number>::do_evaluate(VectorType const & velocity,
                                                           double const       time)
 {
+  if(data.in_transit)
+  {
+    send_data_to_analysis_rank(velocity, time);
+    return;
+  }
+
   // extract beginning of vector...
   Number const * temp = velocity.begin();
 
-  std::string const file_name =
-    data.filename + "_" + dealii::Utilities::int_to_string(time_control.get_counter(), 4);
+  calculate_and_write_spectrum(*deal_spectrum_wrapper,
+                               data,
+                               (double *)temp,
+                               time_control.get_counter(),
+                               time,
+                               clear_files,
+                               mpi_comm);
+}
 
-  deal_spectrum_wrapper->execute((double *)temp, file_name, time);
+template<int dim, typename Number>
+void
+KineticEnergySpectrumCalculator<dim, Number>::send_setup_to_analysis_rank(
+  unsigned int const                                   n_cells_1d,
+  unsigned int const                                   points_dst,
+  std::vector<dealii::types::global_dof_index> const & local_cells)
+{
+  std::vector<unsigned long long> integers;
+  std::vector<char>               characters;
+  pack_setup(integers, characters, data, dim, n_cells_1d, points_dst, local_cells);
+
+  MPI_Comm const & intercomm     = InTransitAnalysis::get_intercommunicator();
+  int const        analysis_rank = InTransitAnalysis::get_analysis_rank();
+
+  MPI_Send(integers.data(),
+           integers.size(),
+           MPI_UNSIGNED_LONG_LONG,
+           analysis_rank,
+           InTransitAnalysis::tag_setup,
+           intercomm);
+  MPI_Send(characters.data(),
+           characters.size(),
+           MPI_CHAR,
+           analysis_rank,
+           InTransitAnalysis::tag_setup,
+           intercomm);
+}
 
-  if(data.do_fftw)
-  {
-    // write output file
-    if(dealii::Utilities::MPI::this_mpi_process(mpi_comm) == 0)
-    {
-      std::cout << std::endl
-                << "Write kinetic energy spectrum at time t = " << time << ":" << std::endl;
+template<int dim, typename Number>
+void
+KineticEnergySpectrumCalculator<dim, Number>::send_data_to_analysis_rank(
+  VectorType const & velocity,
+  double const       time)
+{
+  // the buffer of the previous evaluation can only be reused once its send has completed, i.e.,
+  // the simulation only waits if the analysis ranks fall behind
+  if(in_transit_request != MPI_REQUEST_NULL)
+    MPI_Wait(&in_transit_request, MPI_STATUS_IGNORE);
+
+  // time and counter followed by the local velocity dofs
+  in_transit_buffer.resize(2 + velocity.locally_owned_size());
+  in_transit_buffer[0] = time;
+  in_transit_buffer[1] = time_control.get_counter();
+  std::copy(velocity.begin(), velocity.end(), in_transit_buffer.begin() + 2);
+
+  MPI_Isend(in_transit_buffer.data(),
+            in_transit_buffer.size(),
+            MPI_DOUBLE,
+            InTransitAnalysis::get_analysis_rank(),
+            InTransitAnalysis::tag_data,
+            InTransitAnalysis::get_intercommunicator(),
+            &in_transit_request);
+}
 
-      // get tabularized results ...
-      double * kappa;
-      double * E;
-      double * C;
-      double   e_physical = 0.0;
-      double   e_spectral = 0.0;
-      int len = deal_spectrum_wrapper->get_results(kappa, E, C /*unused*/, e_physical, e_spectral);
+void
+run_kinetic_energy_spectrum_analysis(MPI_Comm const & mpi_comm)
+{
+  MPI_Comm const &       intercomm    = InTransitAnalysis::get_intercommunicator();
+  std::vector<int> const solver_ranks = InTransitAnalysis::get_solver_ranks();
 
-      std::ostringstream filename;
-      filename << data.directory + data.filename;
+  KineticEnergySpectrumData            data;
+  bool                                 clear_files = true;
+  std::shared_ptr<DealSpectrumWrapper> deal_spectrum_wrapper;
+  std::vector<double>                  velocity;
 
-      std::ofstream f;
-      if(clear_files == true)
-      {
-        f.open(filename.str().c_str(), std::ios::trunc);
-        clear_files = false;
-      }
-      else
+  while(true)
+  {
+    // all solver ranks assigned to this process send the same sequence of messages
+    MPI_Status status;
+    MPI_Probe(solver_ranks[0], MPI_ANY_TAG, intercomm, &status);
+
+    if(status.MPI_TAG == InTransitAnalysis::tag_finish)
+    {
+      for(int const rank : solver_ranks)
+        MPI_Recv(
+          nullptr, 0, MPI_BYTE, rank, InTransitAnalysis::tag_finish, intercomm, MPI_STATUS_IGNORE);
+
+      break;
+    }
+    else if(status.MPI_TAG == InTransitAnalysis::tag_setup)
+    {
+      // the cells of all assigned solver ranks are processed by this rank
+      std::vector<unsigned long long>              parameters;
+      std::vector<dealii::types::global_dof_index> local_cells;
+      for(int const rank : solver_ranks)
       {
-        f.open(filename.str().c_str(), std::ios::app);
+        std::vector<unsigned long long> const integers = receive_message<unsigned long long>(
+          rank, InTransitAnalysis::tag_setup, MPI_UNSIGNED_LONG_LONG, intercomm);
+        std::vector<char> const characters =
+          receive_message<char>(rank, InTransitAnalysis::tag_setup, MPI_CHAR, intercomm);
+
+        unpack_setup(integers, characters, data, parameters);
+        local_cells.insert(local_cells.end(),
+                           integers.begin() + n_setup_parameters,
+                           integers.end());
       }
 
-      f << std::endl
-        << "Calculate kinetic energy spectrum at time t = " << time << ":" << std::endl
-        << std::scientific << std::setprecision(precision) << std::setw(precision + 8) << std::endl
-        << "  Energy physical space e_phy = " << e_physical << std::endl
-        << "  Energy spectral space e_spe = " << e_spectral << std::endl
-        << "  Difference  |e_phy - e_spe| = " << std::abs(e_physical - e_spectral) << std::endl
-        << std::endl
-        << "    k  k (avg)              E(k)" << std::endl;
+      clear_files = data.clear_file;
 
-      // ... and print it line by line:
-      for(int i = 0; i < len; i++)
+      deal_spectrum_wrapper = std::make_shared<DealSpectrumWrapper>(mpi_comm,
+                                                                    data.write_raw_data_to_files,
+                                                                    data.do_fftw);
+
+      deal_spectrum_wrapper->configure_fft(data.fft_decomposition == FFTDecomposition::Pencil,
+                                           data.n_process_rows,
+                                           data.measure_fftw_plans,
+                                           data.fftw_wisdom_file);
+
+      deal_spectrum_wrapper->init(
+        parameters[0], parameters[1], parameters[2], parameters[3], local_cells);
+
+      if(data.print_wall_times)
+        print_wall_times_spectrum(*deal_spectrum_wrapper, {"Init-Ipol", "Init-FFTW"}, mpi_comm);
+
+      create_directories(data.directory, mpi_comm);
+    }
+    else
+    {
+      AssertThrow(status.MPI_TAG == InTransitAnalysis::tag_data,
+                  dealii::ExcMessage("Unknown message."));
+
+      // the data of all assigned solver ranks is processed in the order of the setup
+      double       time    = 0.0;
+      unsigned int counter = 0;
+      velocity.clear();
+      for(int const rank : solver_ranks)
       {
-        f << std::scientific << std::setprecision(0)
-          << std::setw(2 + static_cast<unsigned int>(std::ceil(std::max(3.0, log(len) / log(10)))))
-          << i << std::scientific << std::setprecision(precision) << std::setw(precision + 8)
-          << kappa[i] << "   " << E[i] << std::endl;
+        std::vector<double> const message =
+          receive_message<double>(rank, InTransitAnalysis::tag_data, MPI_DOUBLE, intercomm);
+
+        time    = message[0];
+        counter = static_cast<unsigned int>(message[1]);
+        velocity.insert(velocity.end(), message.begin() + 2, message.end());
       }
+
+      calculate_and_write_spectrum(
+        *deal_spectrum_wrapper, data, velocity.data(), counter, time, clear_files, mpi_comm);
     }
   }
 }
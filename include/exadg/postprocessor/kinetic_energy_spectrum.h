@@ -36,6 +36,37 @@ namespace ExaDG
 // forward declaration
 class DealSpectrumWrapper;
 
+/**
+ * Data distribution for the parallel FFT: slab decomposition as provided by FFTW-MPI, or a 2D
+ * pencil decomposition (3D only) which allows to use more processes than points per direction.
+ */
+enum class FFTDecomposition
+{
+  Slab,
+  Pencil
+};
+
+inline std::string
+enum_to_string(FFTDecomposition const enum_type)
+{
+  std::string string_type;
+
+  switch(enum_type)
+  {
+    case FFTDecomposition::Slab:
+      string_type = "Slab";
+      break;
+    case FFTDecomposition::Pencil:
+      string_type = "Pencil";
+      break;
+    default:
+      AssertThrow(false, dealii::ExcMessage("Not implemented."));
+      break;
+  }
+
+  return string_type;
+}
+
 struct KineticEnergySpectrumData
 {
   KineticEnergySpectrumData()
@@ -44,6 +75,12 @@ struct KineticEnergySpectrumData
       directory("output/"),
       filename("energy_spectrum"),
       clear_file(true),
+      fft_decomposition(FFTDecomposition::Slab),
+      n_process_rows(0),
+      measure_fftw_plans(false),
+      fftw_wisdom_file(""),
+      print_wall_times(false),
+      in_transit(false),
       degree(0),
       evaluation_points_per_cell(0),
       exploit_symmetry(false),
@@ -68,6 +105,19 @@ struct KineticEnergySpectrumData
       print_parameter(pcout, "Filename", filename);
       print_parameter(pcout, "Clear file", clear_file);
 
+      if(do_fftw)
+      {
+        print_parameter(pcout, "FFT decomposition", enum_to_string(fft_decomposition));
+        if(fft_decomposition == FFTDecomposition::Pencil)
+          print_parameter(pcout, "Number of process rows", n_process_rows);
+        print_parameter(pcout, "Measure FFTW plans", measure_fftw_plans);
+        if(!fftw_wisdom_file.empty())
+          print_parameter(pcout, "FFTW wisdom file", fftw_wisdom_file);
+        print_parameter(pcout, "Print wall times", print_wall_times);
+      }
+
+      print_parameter(pcout, "In-transit analysis", in_transit);
+
       print_parameter(pcout, "Evaluation points per cell", evaluation_points_per_cell);
 
       print_parameter(pcout, "Exploit symmetry", exploit_symmetry);
@@ -90,6 +140,26 @@ struct KineticEnergySpectrumData
   std::string filename;
   bool        clear_file;
 
+  FFTDecomposition fft_decomposition;
+
+  // number of rows of the 2D process grid for pencil decomposition (0: chosen automatically)
+  unsigned int n_process_rows;
+
+  // the FFTW plans are created once during setup, optionally with FFTW_MEASURE (instead of
+  // FFTW_ESTIMATE), which is more expensive but typically results in faster transforms
+  bool measure_fftw_plans;
+
+  // FFTW wisdom is read from and written to this file to avoid repeated planning costs in
+  // subsequent runs (no wisdom is used if empty)
+  std::string fftw_wisdom_file;
+
+  // print wall times of the individual steps (interpolation, permutation, FFT, postprocessing)
+  bool print_wall_times;
+
+  // send the velocity to the dedicated analysis ranks (see InTransitAnalysis) which perform
+  // interpolation, FFT and output while the simulation continues
+  bool in_transit;
+
   unsigned int degree;
   unsigned int evaluation_points_per_cell;
 
@@ -109,6 +179,8 @@ public:
 
   KineticEnergySpectrumCalculator(MPI_Comm const & mpi_comm);
 
+  ~KineticEnergySpectrumCalculator();
+
   void
   setup(dealii::MatrixFree<dim, Number> const & matrix_free_data_in,
         dealii::DoFHandler<dim> const &         dof_handler_in,
@@ -123,11 +195,18 @@ private:
   void
   do_evaluate(VectorType const & velocity, double const time);
 
+  void
+  send_setup_to_analysis_rank(unsigned int const                                   n_cells_1d,
+                              unsigned int const                                   points_dst,
+                              std::vector<dealii::types::global_dof_index> const & local_cells);
+
+  void
+  send_data_to_analysis_rank(VectorType const & velocity, double const time);
+
   MPI_Comm const mpi_comm;
 
   bool                      clear_files;
   KineticEnergySpectrumData data;
-  unsigned int const        precision = 12;
 
   std::shared_ptr<DealSpectrumWrapper> deal_spectrum_wrapper;
 
@@ -137,7 +216,18 @@ private:
   std::shared_ptr<dealii::Triangulation<dim>> tria_full;
   std::shared_ptr<dealii::FESystem<dim>>      fe_full;
   std::shared_ptr<dealii::DoFHandler<dim>>    dof_handler_full;
+
+  // in-transit analysis: the buffer must not be modified until the send has completed
+  std::vector<double> in_transit_buffer;
+  MPI_Request         in_transit_request;
 };
+
+/**
+ * Main loop of the analysis ranks for the in-transit computation of kinetic energy spectra, see
+ * InTransitAnalysis. Returns once all solver ranks have finished.
+ */
+void
+run_kinetic_energy_spectrum_analysis(MPI_Comm const & mpi_comm);
 } // namespace ExaDG
 
 #endif /* INCLUDE_EXADG_POSTPROCESSOR_KINETIC_ENERGY_SPECTRUM_H_ */
@@ -40,8 +40,7 @@ void
                                 std::set<dealii::types::boundary_id> const & boundary_IDs,
                                 dealii::LinearAlgebra::distributed::Vector<Number> const & velocity,
                                 dealii::LinearAlgebra::distributed::Vector<Number> const & pressure,
-                                double const     viscosity,
-                                MPI_Comm const & mpi_comm)
+                                double const viscosity)
 {
   FaceIntegrator<dim, dim, Number> integrator_velocity(matrix_free,
                                                        true,
@@ -99,7 +98,6 @@ void
       }
     }
   }
-  Force = dealii::Utilities::MPI::sum(Force, mpi_comm);
 }
 
 void
@@ -165,6 +163,20 @@ void
 LiftAndDragCalculator<dim, Number>::evaluate(VectorType const & velocity,
                                              VectorType const & pressure,
                                              double const       time) const
+{
+  BatchedReduction reductions(mpi_comm);
+
+  evaluate(velocity, pressure, time, reductions);
+
+  reductions.resolve();
+}
+
+template<int dim, typename Number>
+void
+LiftAndDragCalculator<dim, Number>::evaluate(VectorType const & velocity,
+                                             VectorType const & pressure,
+                                             double const       time,
+                                             BatchedReduction & reductions) const
 {
   if(data.boundary_IDs.size() > 0)
   {
@@ -178,75 +190,92 @@ LiftAndDragCalculator<dim, Number>::evaluate(VectorType const & velocity,
                                                data.boundary_IDs,
                                                velocity,
                                                pressure,
-                                               data.viscosity,
-                                               mpi_comm);
+                                               data.viscosity);
 
-    // compute lift and drag coefficients (c = (F/rho)/(1/2 U² A)
-    double const reference_value = data.reference_value;
-    Force /= reference_value;
+    // sum over all MPI processes
+    std::vector<double> force_local(dim);
+    for(unsigned int d = 0; d < dim; ++d)
+      force_local[d] = Force[d];
 
-    double const drag = Force[0], lift = Force[1];
-    c_D_min = std::min(c_D_min, drag);
-    c_D_max = std::max(c_D_max, drag);
-    c_L_min = std::min(c_L_min, lift);
-    c_L_max = std::max(c_L_max, lift);
+    unsigned int const index = reductions.add(force_local);
 
-    if(dealii::Utilities::MPI::this_mpi_process(mpi_comm) == 0)
-    {
-      std::string filename_drag, filename_lift;
-      filename_drag = data.directory + data.filename_drag;
-      filename_lift = data.directory + data.filename_lift;
+    reductions.on_completion([this, index, time](BatchedReduction const & result) {
+      // compute lift and drag coefficients (c = (F/rho)/(1/2 U² A)
+      double const reference_value = data.reference_value;
 
-      unsigned int precision = 12;
+      write_output(time,
+                   result.get(index) / reference_value,
+                   result.get(index + 1) / reference_value);
+    });
+  }
+}
 
-      std::ofstream f_drag, f_lift;
-      if(clear_files)
-      {
-        f_drag.open(filename_drag.c_str(), std::ios::trunc);
-        f_lift.open(filename_lift.c_str(), std::ios::trunc);
-
-        // clang-format off
-        f_drag << std::setw(precision+8) << std::left << "time_t"
-               << std::setw(precision+8) << std::left << "c_D(t)"
-               << std::setw(precision+8) << std::left << "c_D_min"
-               << std::setw(precision+8) << std::left << "c_D_max"
-               << std::endl;
-
-        f_lift << std::setw(precision+8) << std::left << "time_t"
-               << std::setw(precision+8) << std::left << "c_L(t)"
-               << std::setw(precision+8) << std::left << "c_L_min"
-               << std::setw(precision+8) << std::left << "c_L_max"
-               << std::endl;
-        // clang-format on
-
-        clear_files = false;
-      }
-      else
-      {
-        f_drag.open(filename_drag.c_str(), std::ios::app);
-        f_lift.open(filename_lift.c_str(), std::ios::app);
-      }
+template<int dim, typename Number>
+void
+LiftAndDragCalculator<dim, Number>::write_output(double const time,
+                                                 double const drag,
+                                                 double const lift) const
+{
+  c_D_min = std::min(c_D_min, drag);
+  c_D_max = std::max(c_D_max, drag);
+  c_L_min = std::min(c_L_min, lift);
+  c_L_max = std::max(c_L_max, lift);
 
-      // clang-format off
-      f_drag << std::scientific << std::setprecision(precision)
-             << std::setw(precision+8) << std::left << time
-             << std::setw(precision+8) << std::left << drag
-             << std::setw(precision+8) << std::left << c_D_min
-             << std::setw(precision+8) << std::left << c_D_max
-             << std::endl;
+  if(dealii::Utilities::MPI::this_mpi_process(mpi_comm) == 0)
+  {
+    std::string filename_drag, filename_lift;
+    filename_drag = data.directory + data.filename_drag;
+    filename_lift = data.directory + data.filename_lift;
 
-      f_drag.close();
+    unsigned int precision = 12;
 
-      f_lift << std::scientific << std::setprecision(precision)
-             << std::setw(precision+8) << std::left << time
-             << std::setw(precision+8) << std::left << lift
-             << std::setw(precision+8) << std::left << c_L_min
-             << std::setw(precision+8) << std::left << c_L_max
+    std::ofstream f_drag, f_lift;
+    if(clear_files)
+    {
+      f_drag.open(filename_drag.c_str(), std::ios::trunc);
+      f_lift.open(filename_lift.c_str(), std::ios::trunc);
+
+      // clang-format off
+      f_drag << std::setw(precision+8) << std::left << "time_t"
+             << std::setw(precision+8) << std::left << "c_D(t)"
+             << std::setw(precision+8) << std::left << "c_D_min"
+             << std::setw(precision+8) << std::left << "c_D_max"
              << std::endl;
 
-      f_lift.close();
+      f_lift << std::setw(precision+8) << std::left << "time_t"
+             << std::setw(precision+8) << std::left << "c_L(t)"
+             << std::setw(precision+8) << std::left << "c_L_min"
+             << std::setw(precision+8) << std::left << "c_L_max"
+             << std::endl;
       // clang-format on
+
+      clear_files = false;
     }
+    else
+    {
+      f_drag.open(filename_drag.c_str(), std::ios::app);
+      f_lift.open(filename_lift.c_str(), std::ios::app);
+    }
+
+    // clang-format off
+    f_drag << std::scientific << std::setprecision(precision)
+           << std::setw(precision+8) << std::left << time
+           << std::setw(precision+8) << std::left << drag
+           << std::setw(precision+8) << std::left << c_D_min
+           << std::setw(precision+8) << std::left << c_D_max
+           << std::endl;
+
+    f_drag.close();
+
+    f_lift << std::scientific << std::setprecision(precision)
+           << std::setw(precision+8) << std::left << time
+           << std::setw(precision+8) << std::left << lift
+           << std::setw(precision+8) << std::left << c_L_min
+           << std::setw(precision+8) << std::left << c_L_max
+           << std::endl;
+
+    f_lift.close();
+    // clang-format on
   }
 }
 
@@ -28,6 +28,7 @@
 
 // ExaDG
 #include <exadg/postprocessor/time_control.h>
+#include <exadg/utilities/batched_reduction.h>
 
 namespace ExaDG
 {
@@ -93,9 +94,22 @@ public:
   void
   evaluate(VectorType const & velocity, VectorType const & pressure, double const time) const;
 
+  /*
+   * Same as above, but the global reduction is deferred to the batch of reductions, i.e., the
+   * results are written once reductions.finish() has been called.
+   */
+  void
+  evaluate(VectorType const & velocity,
+           VectorType const & pressure,
+           double const       time,
+           BatchedReduction & reductions) const;
+
   TimeControl time_control;
 
 private:
+  void
+  write_output(double const time, double const drag, double const lift) const;
+
   MPI_Comm const mpi_comm;
 
   mutable bool clear_files;
@@ -0,0 +1,315 @@
+/*  ______________________________________________________________________
+ *
+ *  ExaDG - High-Order Discontinuous Galerkin for the Exa-Scale
+ *
+ *  Copyright (C) 2021 by the ExaDG authors
+ *
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *  ______________________________________________________________________
+ */
+
+// C/C++
+#include <algorithm>
+#include <cmath>
+#include <limits>
+
+// ExaDG
+#include <exadg/postprocessor/moment_accumulator.h>
+
+namespace ExaDG
+{
+MomentAccumulator::MomentAccumulator() : n_comp(0), entry_size(get_entry_size(0))
+{
+}
+
+void
+MomentAccumulator::reinit(unsigned int const n_locations, unsigned int const n_components)
+{
+  n_comp     = n_components;
+  entry_size = get_entry_size(n_components);
+
+  state.assign(n_locations * entry_size, 0.0);
+  sample.assign(entry_size, 0.0);
+}
+
+void
+MomentAccumulator::reset()
+{
+  std::fill(state.begin(), state.end(), 0.0);
+}
+
+void
+MomentAccumulator::add_sample(unsigned int const location,
+                              double const *     values,
+                              double const       weight)
+{
+  AssertIndexRange(location, n_locations());
+
+  // a single sample is a set with weight w, mean values x_i and vanishing central moments
+  sample[0] = weight;
+  for(unsigned int i = 0; i < n_comp; ++i)
+    sample[1 + i] = values[i];
+
+  merge(&state[location * entry_size], sample.data(), n_comp);
+}
+
+unsigned int
+MomentAccumulator::n_locations() const
+{
+  return state.size() / entry_size;
+}
+
+unsigned int
+MomentAccumulator::n_components() const
+{
+  return n_comp;
+}
+
+double
+MomentAccumulator::weight(unsigned int const location) const
+{
+  return entry(location)[0];
+}
+
+double
+MomentAccumulator::mean(unsigned int const location, unsigned int const component) const
+{
+  AssertIndexRange(component, n_comp);
+
+  return entry(location)[1 + component];
+}
+
+double
+MomentAccumulator::covariance(unsigned int const location,
+                              unsigned int const i,
+                              unsigned int const j) const
+{
+  AssertIndexRange(i, n_comp);
+  AssertIndexRange(j, n_comp);
+
+  double const * e = entry(location);
+
+  if(e[0] <= 0.0)
+    return 0.0;
+
+  unsigned int const k = std::min(i, j), l = std::max(i, j);
+
+  return e[1 + n_comp + k * n_comp - (k * (k - 1)) / 2 + (l - k)] / e[0];
+}
+
+double
+MomentAccumulator::skewness(unsigned int const location, unsigned int const component) const
+{
+  double const * e = entry(location);
+
+  double const variance = covariance(location, component, component);
+
+  if(variance <= 0.0)
+    return 0.0;
+
+  double const M3 = e[1 + n_comp + (n_comp * (n_comp + 1)) / 2 + component];
+
+  return M3 / e[0] / std::pow(variance, 1.5);
+}
+
+double
+MomentAccumulator::flatness(unsigned int const location, unsigned int const component) const
+{
+  double const * e = entry(location);
+
+  double const variance = covariance(location, component, component);
+
+  if(variance <= 0.0)
+    return 0.0;
+
+  double const M4 = e[1 + n_comp + (n_comp * (n_comp + 1)) / 2 + n_comp + component];
+
+  return M4 / e[0] / (variance * variance);
+}
+
+std::vector<MomentAccumulator>
+MomentAccumulator::reduce(std::vector<MomentAccumulator const *> const & accumulators,
+                          MPI_Comm const &                               mpi_comm)
+{
+  // Pack all accumulators into a single buffer. The header describing the layout is identical on
+  // all processes and is used by the reduction operation to identify the individual entries.
+  std::vector<double> buffer;
+  buffer.push_back(accumulators.size());
+  for(auto const & accumulator : accumulators)
+  {
+    buffer.push_back(accumulator->n_locations());
+    buffer.push_back(accumulator->n_comp);
+  }
+  for(auto const & accumulator : accumulators)
+    buffer.insert(buffer.end(), accumulator->state.begin(), accumulator->state.end());
+
+  AssertThrow(buffer.size() <= (std::size_t)std::numeric_limits<int>::max(),
+              dealii::ExcMessage("Statistics are too large for a single MPI reduction."));
+
+  MPI_Datatype type;
+  MPI_Type_contiguous(buffer.size(), MPI_DOUBLE, &type);
+  MPI_Type_commit(&type);
+
+  MPI_Op op;
+  MPI_Op_create(&merge_packed, 1 /* commutative */, &op);
+
+  std::vector<double> result_buffer(buffer.size());
+  int const           ierr =
+    MPI_Reduce(buffer.data(), result_buffer.data(), 1, type, op, 0 /* root */, mpi_comm);
+  AssertThrowMPI(ierr);
+
+  MPI_Op_free(&op);
+  MPI_Type_free(&type);
+
+  // unpack
+  std::vector<MomentAccumulator> result;
+  result.reserve(accumulators.size());
+
+  auto position = result_buffer.begin() + 1 + 2 * accumulators.size();
+  for(auto const & accumulator : accumulators)
+  {
+    result.push_back(*accumulator);
+    std::copy(position, position + accumulator->state.size(), result.back().state.begin());
+    position += accumulator->state.size();
+  }
+
+  return result;
+}
+
+void
+MomentAccumulator::write_restart(boost::archive::binary_oarchive & oa) const
+{
+  unsigned int const n_loc = n_locations();
+  oa &               n_loc;
+  oa &               n_comp;
+
+  for(unsigned int i = 0; i < state.size(); ++i)
+    oa & state[i];
+}
+
+void
+MomentAccumulator::read_restart(boost::archive::binary_iarchive & ia)
+{
+  unsigned int n_loc = 0, n_components = 0;
+  ia &         n_loc;
+  ia &         n_components;
+
+  AssertThrow(n_loc == n_locations() && n_components == n_comp,
+              dealii::ExcMessage("The statistics restart data does not match the current setup "
+                                 "(number of locations or components differ)."));
+
+  for(unsigned int i = 0; i < state.size(); ++i)
+    ia & state[i];
+}
+
+unsigned int
+MomentAccumulator::get_entry_size(unsigned int const n_components)
+{
+  // weight, means, co-moment matrix (upper triangle), third and fourth moments
+  return 1 + n_components + (n_components * (n_components + 1)) / 2 + 2 * n_components;
+}
+
+void
+MomentAccumulator::merge(double * a, double const * b, unsigned int const n)
+{
+  double const Wa = a[0];
+  double const Wb = b[0];
+
+  if(Wb == 0.0)
+    return;
+
+  if(Wa == 0.0)
+  {
+    std::copy(b, b + get_entry_size(n), a);
+    return;
+  }
+
+  double const W = Wa + Wb;
+
+  double * const       mean_a = a + 1;
+  double const * const mean_b = b + 1;
+  double * const       C_a    = a + 1 + n;
+  double const * const C_b    = b + 1 + n;
+  double * const       M3_a   = C_a + (n * (n + 1)) / 2;
+  double const * const M3_b   = C_b + (n * (n + 1)) / 2;
+  double * const       M4_a   = M3_a + n;
+  double const * const M4_b   = M3_b + n;
+
+  // third and fourth moments, which depend on the second moments before the update
+  for(unsigned int i = 0, ii = 0; i < n; ii += n - i, ++i)
+  {
+    double const d    = mean_b[i] - mean_a[i];
+    double const d2   = d * d;
+    double const M2_a = C_a[ii];
+    double const M2_b = C_b[ii];
+
+    M4_a[i] += M4_b[i] + d2 * d2 * Wa * Wb * (Wa * Wa - Wa * Wb + Wb * Wb) / (W * W * W) +
+               6.0 * d2 * (Wa * Wa * M2_b + Wb * Wb * M2_a) / (W * W) +
+               4.0 * d * (Wa * M3_b[i] - Wb * M3_a[i]) / W;
+
+    M3_a[i] += M3_b[i] + d2 * d * Wa * Wb * (Wa - Wb) / (W * W) +
+               3.0 * d * (Wa * M2_b - Wb * M2_a) / W;
+  }
+
+  // co-moments
+  for(unsigned int i = 0, ij = 0; i < n; ++i)
+  {
+    double const d_i = mean_b[i] - mean_a[i];
+    for(unsigned int j = i; j < n; ++j, ++ij)
+      C_a[ij] += C_b[ij] + d_i * (mean_b[j] - mean_a[j]) * Wa * Wb / W;
+  }
+
+  // means and weight
+  for(unsigned int i = 0; i < n; ++i)
+    mean_a[i] += (mean_b[i] - mean_a[i]) * Wb / W;
+
+  a[0] = W;
+}
+
+void
+MomentAccumulator::merge_packed(void * in, void * inout, int * len, MPI_Datatype * datatype)
+{
+  int size = 0;
+  MPI_Type_size(*datatype, &size);
+  unsigned int const n_doubles = size / sizeof(double);
+
+  for(int element = 0; element < *len; ++element)
+  {
+    double const * b = static_cast<double const *>(in) + element * n_doubles;
+    double *       a = static_cast<double *>(inout) + element * n_doubles;
+
+    unsigned int const n_accumulators = (unsigned int)a[0];
+
+    unsigned int position = 1 + 2 * n_accumulators;
+    for(unsigned int k = 0; k < n_accumulators; ++k)
+    {
+      unsigned int const n_loc      = (unsigned int)a[1 + 2 * k];
+      unsigned int const n          = (unsigned int)a[2 + 2 * k];
+      unsigned int const entry_size = get_entry_size(n);
+
+      for(unsigned int l = 0; l < n_loc; ++l, position += entry_size)
+        merge(a + position, b + position, n);
+    }
+  }
+}
+
+double const *
+MomentAccumulator::entry(unsigned int const location) const
+{
+  AssertIndexRange(location, n_locations());
+
+  return &state[location * entry_size];
+}
+
+} // namespace ExaDG
@@ -0,0 +1,148 @@
+/*  ______________________________________________________________________
+ *
+ *  ExaDG - High-Order Discontinuous Galerkin for the Exa-Scale
+ *
+ *  Copyright (C) 2021 by the ExaDG authors
+ *
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *  ______________________________________________________________________
+ */
+
+#ifndef INCLUDE_EXADG_POSTPROCESSOR_MOMENT_ACCUMULATOR_H_
+#define INCLUDE_EXADG_POSTPROCESSOR_MOMENT_ACCUMULATOR_H_
+
+// C/C++
+#include <boost/archive/binary_iarchive.hpp>
+#include <boost/archive/binary_oarchive.hpp>
+
+#include <vector>
+
+// deal.II
+#include <deal.II/base/mpi.h>
+
+namespace ExaDG
+{
+/*
+ * Streaming accumulator of weighted statistical moments for a number of sampling locations, e.g.
+ * the points along a line or the x-z-planes of a channel. At every location, n_components
+ * quantities (e.g. the velocity components) are sampled together. For each location, the
+ * accumulated weight, the mean values, the co-moment matrix (i.e. the Reynolds stresses) as well as
+ * the third and fourth central moments of each component are updated with the weighted Welford
+ * algorithm, which avoids the cancellation errors of computing variances as <u²> - <u>².
+ *
+ * Averaging in homogeneous directions is realized by adding all quadrature points of a plane or
+ * line with their integration weight JxW, averaging over time by adding the samples of all time
+ * steps, which gives the time average of the spatial averages as long as the mesh does not change.
+ *
+ * Samples are only added to the process-local state, i.e., no communication takes place when
+ * sampling. The global moments are obtained by reduce(), which merges the partial states of all
+ * processes with the pairwise update formulas of Chan et al. and Pebay in a single collective
+ * operation for an arbitrary number of accumulators. Since merging is exact, the reduced state
+ * can be written for a restart and read into a single process of a subsequent simulation.
+ */
+class MomentAccumulator
+{
+public:
+  MomentAccumulator();
+
+  void
+  reinit(unsigned int const n_locations, unsigned int const n_components);
+
+  /*
+   * Resets all moments to zero.
+   */
+  void
+  reset();
+
+  /*
+   * Adds one sample of all n_components quantities at the given location with the given weight.
+   */
+  void
+  add_sample(unsigned int const location, double const * values, double const weight = 1.0);
+
+  unsigned int
+  n_locations() const;
+
+  unsigned int
+  n_components() const;
+
+  /*
+   * Accumulated weight, e.g. the number of samples times the length or area in the homogeneous
+   * directions.
+   */
+  double
+  weight(unsigned int const location) const;
+
+  double
+  mean(unsigned int const location, unsigned int const component) const;
+
+  /*
+   * Covariance <u_i' u_j'> of two components.
+   */
+  double
+  covariance(unsigned int const location, unsigned int const i, unsigned int const j) const;
+
+  /*
+   * Standardized third and fourth moments <u_i'³>/<u_i'²>^(3/2) and <u_i'⁴>/<u_i'²>².
+   */
+  double
+  skewness(unsigned int const location, unsigned int const component) const;
+
+  double
+  flatness(unsigned int const location, unsigned int const component) const;
+
+  /*
+   * Merges the local states of all accumulators over all processes of mpi_comm with a single
+   * collective operation. Has to be called by all processes with accumulators of the same sizes.
+   * The global moments are returned on rank 0, the local accumulators remain unchanged so that
+   * sampling can continue.
+   */
+  static std::vector<MomentAccumulator>
+  reduce(std::vector<MomentAccumulator const *> const & accumulators, MPI_Comm const & mpi_comm);
+
+  void
+  write_restart(boost::archive::binary_oarchive & oa) const;
+
+  void
+  read_restart(boost::archive::binary_iarchive & ia);
+
+private:
+  static unsigned int
+  get_entry_size(unsigned int const n_components);
+
+  // merges the state b into the state a
+  static void
+  merge(double * a, double const * b, unsigned int const n_components);
+
+  // user-defined MPI reduction operating on packed accumulators
+  static void
+  merge_packed(void * in, void * inout, int * len, MPI_Datatype * datatype);
+
+  double const *
+  entry(unsigned int const location) const;
+
+  unsigned int n_comp;
+  unsigned int entry_size;
+
+  // For all locations: weight, means, upper triangle of co-moment matrix, third and fourth central
+  // moments of each component
+  std::vector<double> state;
+
+  // temporary storage for a single sample
+  std::vector<double> sample;
+};
+
+} // namespace ExaDG
+
+#endif /* INCLUDE_EXADG_POSTPROCESSOR_MOMENT_ACCUMULATOR_H_ */
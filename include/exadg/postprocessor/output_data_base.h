@@ -27,6 +27,33 @@
 
 namespace ExaDG
 {
+enum class OutputFormat
+{
+  VTU,
+  HDF5
+};
+
+inline std::string
+enum_to_string(OutputFormat const enum_type)
+{
+  std::string string_type;
+
+  switch(enum_type)
+  {
+    case OutputFormat::VTU:
+      string_type = "VTU";
+      break;
+    case OutputFormat::HDF5:
+      string_type = "HDF5";
+      break;
+    default:
+      AssertThrow(false, dealii::ExcMessage("Not implemented."));
+      break;
+  }
+
+  return string_type;
+}
+
 struct OutputDataBase
 {
   OutputDataBase()
@@ -37,7 +64,12 @@ struct OutputDataBase
       write_grid(false),
       write_processor_id(false),
       write_higher_order(true),
-      degree(1)
+      degree(1),
+      write_asynchronously(false),
+      max_pending_files(4),
+      output_format(OutputFormat::VTU),
+      hdf5_single_precision(false),
+      hdf5_compression_level(0)
   {
   }
 
@@ -58,6 +90,19 @@ struct OutputDataBase
 
       print_parameter(pcout, "Write higher order", write_higher_order);
       print_parameter(pcout, "Polynomial degree", degree);
+
+      if(write_asynchronously)
+      {
+        print_parameter(pcout, "Write asynchronously", write_asynchronously);
+        print_parameter(pcout, "Maximum number of pending files", max_pending_files);
+      }
+
+      if(output_format == OutputFormat::HDF5)
+      {
+        print_parameter(pcout, "Output format", enum_to_string(output_format));
+        print_parameter(pcout, "HDF5 single precision", hdf5_single_precision);
+        print_parameter(pcout, "HDF5 compression level", hdf5_compression_level);
+      }
     }
   }
 
@@ -94,6 +139,27 @@ struct OutputDataBase
   // case of write_higher_order = false, this variable defines the number of subdivisions of a cell,
   // with ParaView using linear interpolation for visualization on these subdivided cells.
   unsigned int degree;
+
+  // write the output files in a background thread, see AsynchronousFileWriter. The patches are
+  // still built and serialized synchronously, but the time loop continues while the files are
+  // written to the file system.
+  bool write_asynchronously;
+
+  // maximum number of serialized files (per process) waiting to be written in case of
+  // write_asynchronously = true, which bounds the memory needed for in-flight output
+  unsigned int max_pending_files;
+
+  // file format of the field output. VTU writes one file per process and output step, while HDF5
+  // writes one file per output step collectively via MPI-IO, together with an XDMF file describing
+  // the time series (requires deal.II configured with HDF5)
+  OutputFormat output_format;
+
+  // store the field data (but not the node coordinates) in single precision in case of HDF5 output
+  bool hdf5_single_precision;
+
+  // compression level (0 = no compression, 9 = maximum compression) of the deflate filter applied
+  // to the data sets in case of HDF5 output
+  unsigned int hdf5_compression_level;
 };
 
 } // namespace ExaDG
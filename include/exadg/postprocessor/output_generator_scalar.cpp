@@ -39,10 +39,9 @@ write_output(OutputDataBase const &          output_data,
              dealii::Mapping<dim> const &    mapping,
              VectorType const &              solution_vector,
              unsigned int const              output_counter,
+             double const                    time,
              MPI_Comm const &                mpi_comm)
 {
-  std::string folder = output_data.directory, file = output_data.filename;
-
   dealii::DataOutBase::VtkFlags flags;
   flags.write_higher_order_cells = output_data.write_higher_order;
 
@@ -54,7 +53,7 @@ write_output(OutputDataBase const &          output_data,
   data_out.add_data_vector(solution_vector, "solution");
   data_out.build_patches(mapping, output_data.degree, dealii::DataOut<dim>::curved_inner_cells);
 
-  data_out.write_vtu_with_pvtu_record(folder, file, output_counter, mpi_comm, 4);
+  write_patches(data_out, output_data, output_counter, time, mpi_comm);
 }
 
 template<int dim, typename Number>
@@ -122,7 +121,7 @@ OutputGenerator<dim, Number>::evaluate(VectorType const & solution,
   print_write_output_time(time, time_control.get_counter(), unsteady, mpi_comm);
 
   write_output<dim>(
-    output_data, *dof_handler, *mapping, solution, time_control.get_counter(), mpi_comm);
+    output_data, *dof_handler, *mapping, solution, time_control.get_counter(), time, mpi_comm);
 }
 
 template class OutputGenerator<2, float>;
@@ -0,0 +1,348 @@
+/*  ______________________________________________________________________
+ *
+ *  ExaDG - High-Order Discontinuous Galerkin for the Exa-Scale
+ *
+ *  Copyright (C) 2021 by the ExaDG authors
+ *
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *  ______________________________________________________________________
+ */
+
+// C/C++
+#include <algorithm>
+
+// deal.II
+#include <deal.II/base/quadrature_lib.h>
+#include <deal.II/lac/affine_constraints.h>
+
+// ExaDG
+#include <exadg/matrix_free/integrators.h>
+#include <exadg/postprocessor/patch_builder.h>
+
+namespace ExaDG
+{
+template<int dim, typename Number>
+PatchBuilder<dim, Number>::PatchBuilder() : n_subdivisions(0)
+{
+}
+
+template<int dim, typename Number>
+void
+PatchBuilder<dim, Number>::reinit(
+  dealii::Mapping<dim> const &                         mapping,
+  std::vector<dealii::DoFHandler<dim> const *> const & dof_handlers_in,
+  unsigned int const                                   n_subdivisions_in)
+{
+  AssertThrow(not dof_handlers_in.empty(),
+              dealii::ExcMessage("At least one DoFHandler has to be provided."));
+  AssertThrow(n_subdivisions_in > 0,
+              dealii::ExcMessage("The number of subdivisions has to be larger than zero."));
+
+  if(dof_handlers_in == dof_handlers and n_subdivisions_in == n_subdivisions)
+  {
+    matrix_free.update_mapping(mapping);
+    return;
+  }
+
+  // The vectors are read without constraints. This is only correct for discontinuous elements,
+  // since hanging-node constraints of continuous and H(div)-conforming elements would be ignored.
+  for(auto const & dof_handler : dof_handlers_in)
+  {
+    AssertThrow(dof_handler->get_fe().n_dofs_per_face() == 0,
+                dealii::ExcMessage("PatchBuilder only supports discontinuous finite elements. "
+                                   "Use dealii::DataOut for continuous or H(div) elements."));
+  }
+
+  dof_handlers   = dof_handlers_in;
+  n_subdivisions = n_subdivisions_in;
+
+  std::vector<dealii::AffineConstraints<Number>>         constraints(dof_handlers.size());
+  std::vector<dealii::AffineConstraints<Number> const *> constraint_pointers;
+  for(auto & constraint : constraints)
+  {
+    constraint.close();
+    constraint_pointers.push_back(&constraint);
+  }
+
+  // equidistant subdivision points including the vertices of the cell in lexicographic order,
+  // which is the ordering of the points of a patch
+  dealii::QIterated<1> const quadrature(dealii::QGaussLobatto<1>(2), n_subdivisions);
+
+  typename dealii::MatrixFree<dim, Number>::AdditionalData additional_data;
+  additional_data.tasks_parallel_scheme = dealii::MatrixFree<dim, Number>::AdditionalData::none;
+  additional_data.mapping_update_flags  = dealii::update_quadrature_points;
+
+  matrix_free.reinit(mapping, dof_handlers, constraint_pointers, quadrature, additional_data);
+
+  first_patch_of_cell_batch.resize(matrix_free.n_cell_batches());
+  unsigned int n_patches = 0;
+  for(unsigned int cell = 0; cell < matrix_free.n_cell_batches(); ++cell)
+  {
+    first_patch_of_cell_batch[cell] = n_patches;
+    n_patches += matrix_free.n_active_entries_per_cell_batch(cell);
+  }
+
+  patches.resize(n_patches);
+  for(unsigned int i = 0; i < patches.size(); ++i)
+  {
+    patches[i].patch_index          = i;
+    patches[i].n_subdivisions       = n_subdivisions;
+    patches[i].points_are_available = true;
+  }
+
+  vectors_matrix_free.resize(dof_handlers.size());
+  for(unsigned int i = 0; i < dof_handlers.size(); ++i)
+    matrix_free.initialize_dof_vector(vectors_matrix_free[i], i);
+}
+
+template<int dim, typename Number>
+unsigned int
+PatchBuilder<dim, Number>::get_dof_index(dealii::DoFHandler<dim> const & dof_handler) const
+{
+  auto const it = std::find(dof_handlers.begin(), dof_handlers.end(), &dof_handler);
+
+  AssertThrow(it != dof_handlers.end(),
+              dealii::ExcMessage("The DoFHandler has not been passed to PatchBuilder::reinit()."));
+
+  return std::distance(dof_handlers.begin(), it);
+}
+
+template<int dim, typename Number>
+void
+PatchBuilder<dim, Number>::clear_data_vectors()
+{
+  data_vectors.clear();
+  cell_data_vectors.clear();
+}
+
+template<int dim, typename Number>
+void
+PatchBuilder<dim, Number>::add_data_vector(VectorType const &  vector,
+                                           unsigned int const  dof_index,
+                                           std::string const & name)
+{
+  add_data_vector(vector,
+                  dof_index,
+                  std::vector<std::string>{name},
+                  {dealii::DataComponentInterpretation::component_is_scalar});
+}
+
+template<int dim, typename Number>
+void
+PatchBuilder<dim, Number>::add_data_vector(
+  VectorType const &               vector,
+  unsigned int const               dof_index,
+  std::vector<std::string> const & names,
+  std::vector<dealii::DataComponentInterpretation::DataComponentInterpretation> const &
+    component_interpretation)
+{
+  AssertThrow(names.size() == 1 or names.size() == dim,
+              dealii::ExcMessage("Only scalar fields and vector fields with dim components are "
+                                 "supported."));
+  AssertThrow(names.size() == component_interpretation.size(),
+              dealii::ExcMessage("The number of names has to match the number of components."));
+  AssertThrow(names.size() == dof_handlers[dof_index]->get_fe().n_components(),
+              dealii::ExcMessage("The number of names has to match the number of components of "
+                                 "the finite element."));
+
+  data_vectors.push_back({&vector, dof_index, names, component_interpretation});
+}
+
+template<int dim, typename Number>
+void
+PatchBuilder<dim, Number>::build_patches()
+{
+  unsigned int n_data_rows = cell_data_vectors.size();
+  for(auto const & data_vector : data_vectors)
+    n_data_rows += data_vector.names.size();
+
+  unsigned int const n_points = dealii::Utilities::pow(n_subdivisions + 1, dim);
+  for(auto & patch : patches)
+    patch.data.reinit(n_data_rows + dim, n_points);
+
+  unsigned int row = 0;
+  for(auto const & data_vector : data_vectors)
+  {
+    if(data_vector.names.size() == 1)
+      evaluate_data_vector<1>(*data_vector.vector, data_vector.dof_index, row);
+    else
+      evaluate_data_vector<dim>(*data_vector.vector, data_vector.dof_index, row);
+
+    row += data_vector.names.size();
+  }
+
+  for(auto const & cell_data_vector : cell_data_vectors)
+  {
+    for(unsigned int cell = 0; cell < matrix_free.n_cell_batches(); ++cell)
+    {
+      for(unsigned int v = 0; v < matrix_free.n_active_entries_per_cell_batch(cell); ++v)
+      {
+        double const value =
+          cell_data_vector.second[matrix_free.get_cell_iterator(cell, v)->active_cell_index()];
+
+        auto & data = patches[first_patch_of_cell_batch[cell] + v].data;
+        for(unsigned int q = 0; q < n_points; ++q)
+          data(row, q) = value;
+      }
+    }
+
+    ++row;
+  }
+
+  // the last dim rows contain the coordinates of the points
+  evaluate_coordinates(row);
+}
+
+template<int dim, typename Number>
+template<int n_components>
+void
+PatchBuilder<dim, Number>::evaluate_data_vector(VectorType const & vector,
+                                                unsigned int const dof_index,
+                                                unsigned int const first_row)
+{
+  // the vector might be distributed differently than required by the MatrixFree object used here
+  VectorType & vector_matrix_free = vectors_matrix_free[dof_index];
+  vector_matrix_free.copy_locally_owned_data_from(vector);
+  vector_matrix_free.update_ghost_values();
+
+  CellIntegrator<dim, n_components, Number> integrator(matrix_free, dof_index, 0);
+
+  for(unsigned int cell = 0; cell < matrix_free.n_cell_batches(); ++cell)
+  {
+    integrator.reinit(cell);
+    integrator.read_dof_values(vector_matrix_free);
+    integrator.evaluate(dealii::EvaluationFlags::values);
+
+    for(unsigned int q = 0; q < integrator.n_q_points; ++q)
+    {
+      auto const value = integrator.get_value(q);
+
+      for(unsigned int v = 0; v < matrix_free.n_active_entries_per_cell_batch(cell); ++v)
+      {
+        auto & data = patches[first_patch_of_cell_batch[cell] + v].data;
+
+        if constexpr(n_components == 1)
+        {
+          data(first_row, q) = value[v];
+        }
+        else
+        {
+          for(unsigned int c = 0; c < n_components; ++c)
+            data(first_row + c, q) = value[c][v];
+        }
+      }
+    }
+  }
+
+  vector_matrix_free.zero_out_ghost_values();
+}
+
+template<int dim, typename Number>
+void
+PatchBuilder<dim, Number>::evaluate_coordinates(unsigned int const first_row)
+{
+  CellIntegrator<dim, 1, Number> integrator(matrix_free, 0, 0);
+
+  // index of the point located at vertex i of the patch
+  std::vector<unsigned int> vertex_points(dealii::GeometryInfo<dim>::vertices_per_cell, 0);
+  for(unsigned int i = 0; i < vertex_points.size(); ++i)
+    for(unsigned int d = 0, stride = n_subdivisions; d < dim; ++d, stride *= n_subdivisions + 1)
+      if(i & (1 << d))
+        vertex_points[i] += stride;
+
+  for(unsigned int cell = 0; cell < matrix_free.n_cell_batches(); ++cell)
+  {
+    integrator.reinit(cell);
+
+    for(unsigned int v = 0; v < matrix_free.n_active_entries_per_cell_batch(cell); ++v)
+    {
+      auto & patch = patches[first_patch_of_cell_batch[cell] + v];
+
+      for(unsigned int q = 0; q < integrator.n_q_points; ++q)
+      {
+        auto const point = integrator.quadrature_point(q);
+        for(unsigned int d = 0; d < dim; ++d)
+          patch.data(first_row + d, q) = point[d][v];
+      }
+
+      for(unsigned int i = 0; i < vertex_points.size(); ++i)
+        for(unsigned int d = 0; d < dim; ++d)
+          patch.vertices[i][d] = patch.data(first_row + d, vertex_points[i]);
+    }
+  }
+}
+
+template<int dim, typename Number>
+std::vector<dealii::DataOutBase::Patch<dim, dim>> const &
+PatchBuilder<dim, Number>::get_patches() const
+{
+  return patches;
+}
+
+template<int dim, typename Number>
+std::vector<std::string>
+PatchBuilder<dim, Number>::get_dataset_names() const
+{
+  std::vector<std::string> names;
+
+  for(auto const & data_vector : data_vectors)
+    names.insert(names.end(), data_vector.names.begin(), data_vector.names.end());
+
+  for(auto const & cell_data_vector : cell_data_vectors)
+    names.push_back(cell_data_vector.first);
+
+  return names;
+}
+
+template<int dim, typename Number>
+std::vector<std::tuple<unsigned int,
+                       unsigned int,
+                       std::string,
+                       dealii::DataComponentInterpretation::DataComponentInterpretation>>
+PatchBuilder<dim, Number>::get_nonscalar_data_ranges() const
+{
+  std::vector<std::tuple<unsigned int,
+                         unsigned int,
+                         std::string,
+                         dealii::DataComponentInterpretation::DataComponentInterpretation>>
+    ranges;
+
+  unsigned int row = 0;
+  for(auto const & data_vector : data_vectors)
+  {
+    unsigned int const n_components = data_vector.names.size();
+
+    if(n_components > 1 and
+       data_vector.component_interpretation[0] ==
+         dealii::DataComponentInterpretation::component_is_part_of_vector)
+    {
+      ranges.emplace_back(row,
+                          row + n_components - 1,
+                          data_vector.names[0],
+                          dealii::DataComponentInterpretation::component_is_part_of_vector);
+    }
+
+    row += n_components;
+  }
+
+  return ranges;
+}
+
+template class PatchBuilder<2, float>;
+template class PatchBuilder<2, double>;
+
+template class PatchBuilder<3, float>;
+template class PatchBuilder<3, double>;
+
+} // namespace ExaDG
@@ -0,0 +1,157 @@
+/*  ______________________________________________________________________
+ *
+ *  ExaDG - High-Order Discontinuous Galerkin for the Exa-Scale
+ *
+ *  Copyright (C) 2021 by the ExaDG authors
+ *
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *  ______________________________________________________________________
+ */
+
+#ifndef INCLUDE_EXADG_POSTPROCESSOR_PATCH_BUILDER_H_
+#define INCLUDE_EXADG_POSTPROCESSOR_PATCH_BUILDER_H_
+
+// C/C++
+#include <string>
+#include <tuple>
+#include <vector>
+
+// deal.II
+#include <deal.II/base/data_out_base.h>
+#include <deal.II/dofs/dof_handler.h>
+#include <deal.II/fe/mapping.h>
+#include <deal.II/lac/la_parallel_vector.h>
+#include <deal.II/matrix_free/matrix_free.h>
+#include <deal.II/numerics/data_component_interpretation.h>
+
+namespace ExaDG
+{
+/*
+ * Builds the patches for visualization output, i.e., one patch per locally owned cell with
+ * n_subdivisions subdivisions per coordinate direction. In contrast to
+ * dealii::DataOut::build_patches(), which evaluates the fields cell by cell via FEValues, the
+ * fields are evaluated in the subdivision points with the sum-factorization kernels of MatrixFree
+ * for whole cell batches. The coordinates of all subdivision points are stored in the patches,
+ * corresponding to dealii::DataOut::curved_inner_cells. The patches are written with the same
+ * functions as those generated by dealii::DataOut, see write_patches(). Only discontinuous
+ * finite elements are supported, since the vectors are read without constraints.
+ */
+template<int dim, typename Number>
+class PatchBuilder : public dealii::DataOutInterface<dim, dim>
+{
+public:
+  typedef dealii::LinearAlgebra::distributed::Vector<Number> VectorType;
+
+  PatchBuilder();
+
+  /*
+   * Sets up the MatrixFree object with the subdivision points as quadrature points. The data
+   * vectors added below refer to the given DoFHandlers by their index, see get_dof_index(). If
+   * this function is called again with the same DoFHandlers, only the coordinates of the
+   * subdivision points are recomputed (e.g., in case of a moving mesh).
+   */
+  void
+  reinit(dealii::Mapping<dim> const &                         mapping,
+         std::vector<dealii::DoFHandler<dim> const *> const & dof_handlers,
+         unsigned int const                                   n_subdivisions);
+
+  unsigned int
+  get_dof_index(dealii::DoFHandler<dim> const & dof_handler) const;
+
+  void
+  clear_data_vectors();
+
+  void
+  add_data_vector(VectorType const &  vector,
+                  unsigned int const  dof_index,
+                  std::string const & name);
+
+  void
+  add_data_vector(
+    VectorType const &               vector,
+    unsigned int const               dof_index,
+    std::vector<std::string> const & names,
+    std::vector<dealii::DataComponentInterpretation::DataComponentInterpretation> const &
+      component_interpretation);
+
+  /*
+   * Adds a vector with one value per active cell of the triangulation.
+   */
+  template<typename CellVectorType>
+  void
+  add_cell_data_vector(CellVectorType const & vector, std::string const & name)
+  {
+    std::vector<double> values(vector.size());
+    for(unsigned int i = 0; i < values.size(); ++i)
+      values[i] = vector(i);
+
+    cell_data_vectors.emplace_back(name, std::move(values));
+  }
+
+  void
+  build_patches();
+
+  std::vector<dealii::DataOutBase::Patch<dim, dim>> const &
+  get_patches() const final;
+
+private:
+  std::vector<std::string>
+  get_dataset_names() const final;
+
+  std::vector<std::tuple<unsigned int,
+                         unsigned int,
+                         std::string,
+                         dealii::DataComponentInterpretation::DataComponentInterpretation>>
+  get_nonscalar_data_ranges() const final;
+
+  template<int n_components>
+  void
+  evaluate_data_vector(VectorType const & vector,
+                       unsigned int const dof_index,
+                       unsigned int const first_row);
+
+  void
+  evaluate_coordinates(unsigned int const first_row);
+
+  struct DataVector
+  {
+    VectorType const *       vector;
+    unsigned int             dof_index;
+    std::vector<std::string> names;
+    std::vector<dealii::DataComponentInterpretation::DataComponentInterpretation>
+      component_interpretation;
+  };
+
+  dealii::MatrixFree<dim, Number> matrix_free;
+
+  std::vector<dealii::DoFHandler<dim> const *> dof_handlers;
+
+  // vectors distributed as required by matrix_free, one per DoFHandler
+  std::vector<VectorType> vectors_matrix_free;
+
+  unsigned int n_subdivisions;
+
+  // index of the patch of the first cell of each cell batch
+  std::vector<unsigned int> first_patch_of_cell_batch;
+
+  std::vector<DataVector> data_vectors;
+
+  std::vector<std::pair<std::string, std::vector<double>>> cell_data_vectors;
+
+  std::vector<dealii::DataOutBase::Patch<dim, dim>> patches;
+};
+
+} // namespace ExaDG
+
+#endif /* INCLUDE_EXADG_POSTPROCESSOR_PATCH_BUILDER_H_ */
@@ -96,6 +96,19 @@ public:
     return get();
   }
 
+  /**
+   * This function gives write access to the solution vector, e.g., in order to compute several
+   * fields together in a single pass over the source vector. The field is considered available
+   * afterwards, i.e., a subsequent call to evaluate() does not recompute the field.
+   */
+  VectorType &
+  get_for_evaluation()
+  {
+    is_available = true;
+
+    return solution_vector;
+  }
+
   std::string const &
   get_name() const
   {
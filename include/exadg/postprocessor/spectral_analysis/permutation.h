@@ -70,9 +70,10 @@ cmp(const void * a, const void * b)
 
 /**
  * Class for permuting dofs from cellwise-sfc-order to lexicographical order
- * such that processes own complete rows (2D) or complete planes (3D) as
- * specified by FFTW. To be able to process the resulting array by FFTW, we
- * on the fly insert padding.
+ * such that processes own the data as specified by the FFTW wrapper, i.e.,
+ * complete rows (2D) or complete planes (3D) for slab decomposition and
+ * complete lines for pencil decomposition. To be able to process the
+ * resulting array by FFTW, we on the fly insert padding.
  *
  * This class expects an input array as described in the interpolation class and
  * produces an array of the format which comply the requirements described in
@@ -116,11 +117,9 @@ public:
     unsigned long int points = s.points_dst;
     int               n      = s.cells;
 
-    int start, end, start_, end_;
+    int start, end;
     // ... my range of the space filling curve
     MAP.getLocalRange(start, end);
-    // ... my rows for FFT
-    FFT.getLocalRange(start_, end_);
     bsize = FFT.bsize;
 
     // data structures for determining the communication partners...
@@ -130,9 +129,10 @@ public:
     send_buffer                    = new double[has_length * dim];
     send_index                     = new int[has_length];
 
-    int                 want_length = (end_ - start_) * dealii::Utilities::pow(n * points, dim - 1);
+    int                 want_length = FFT.n_local_points();
     unsigned long int * want        = new unsigned long int[want_length];
     int *               want_procs  = new int[want_length];
+    int *               want_pos    = new int[want_length];
     recv_buffer                     = new double[want_length * dim];
     recv_index                      = new int[want_length];
 
@@ -152,7 +152,7 @@ public:
               (MAP.lbf(i * dim + 0) * points + I);
             has[counter] = temp;
             // ... which process does need this dof?
-            int proc           = FFT.indices_proc_rows(temp / pow(n * points, dim - 1));
+            int proc           = FFT.owner(temp);
             has_procs[counter] = proc;
           }
     }
@@ -201,21 +201,25 @@ public:
 
 
     // R.1: determine all dofs this process wants (+procs)
-    // ... loop over all local rows
-    for(int ii = start_, pn = points * n, counter = 0; ii < end_; ii++)
-      // ... loop inside row
-      for(int jj = 0; jj < pow(n * points, dim - 1); jj++, counter++)
-      {
-        // ... determine dof
-        unsigned long int temp = ii * dealii::Utilities::pow(n * points, dim - 1) + jj;
-        want[counter]          = temp;
-        // ... determine owning process
-        int t = dim == 3 ? (temp % pn) / points + ((temp % (pn * pn)) / pn) / points * n +
-                             (temp / pn / pn) / points * n * n :
-                           (temp % pn) / points + (temp / pn) / points * n;
-        int proc            = MAP.indices_proc(MAP.indices_inv(t));
-        want_procs[counter] = proc;
-      }
+    // ... loop over all local entries of the FFT input array (skipping padding)
+    for(int ii = 0, pn = points * n, counter = 0; ii < bsize; ii++)
+    {
+      long int const lex = FFT.local_to_lexicographic(ii);
+      if(lex < 0)
+        continue;
+
+      // ... determine dof
+      unsigned long int temp = lex;
+      want[counter]          = temp;
+      want_pos[counter]      = ii;
+      // ... determine owning process
+      int t = dim == 3 ? (temp % pn) / points + ((temp % (pn * pn)) / pn) / points * n +
+                           (temp / pn / pn) / points * n * n :
+                         (temp % pn) / points + (temp / pn) / points * n;
+      int proc            = MAP.indices_proc(MAP.indices_inv(t));
+      want_procs[counter] = proc;
+      counter++;
+    }
 
 
     // R.2: which processes needs how many dofs
@@ -238,14 +242,9 @@ public:
 
     qsort(recv_index, want_length, sizeof(int), cmp);
 
-    // R.4: add padding
-    {
-      // consider padding needed by FFTW...
-      int N  = points * n;
-      int Nx = (N / 2 + 1) * 2;
-      for(int i = 0; i < want_length; i++)
-        recv_index[i] += (recv_index[i] / N) * (Nx - N);
-    }
+    // R.4: add padding, i.e., translate to position in FFT input array
+    for(int i = 0; i < want_length; i++)
+      recv_index[i] = want_pos[recv_index[i]];
 
     // R.5: determine offsets
     for(auto & i : want_map)
@@ -373,6 +372,7 @@ public:
     delete[] has_procs;
     delete[] want;
     delete[] want_procs;
+    delete[] want_pos;
   }
 
   /**
@@ -24,6 +24,7 @@
 
 // C/C++
 #include <mpi.h>
+#include <string>
 
 // define helper funtions
 #ifndef MIN
@@ -86,6 +87,14 @@ public:
   int bins;
   // time stemp
   double time = 0.0;
+  // use 2D pencil decomposition (only 3D) instead of slab decomposition for FFT
+  bool pencil_decomposition = false;
+  // nr. of rows of the process grid for pencil decomposition (0: chosen automatically)
+  int process_rows = 0;
+  // plan FFTs with FFTW_MEASURE instead of FFTW_ESTIMATE
+  bool measure_plans = false;
+  // file for caching FFTW wisdom (empty: do not use wisdom)
+  std::string wisdom_file;
 
   /**
    * Constructor
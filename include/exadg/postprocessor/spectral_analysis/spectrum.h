@@ -24,22 +24,33 @@
 
 #include <fftw3-mpi.h>
 #include <mpi.h>
+#include <algorithm>
 #include <cmath>
+#include <vector>
 
 // ExaDG
 #include <exadg/postprocessor/spectral_analysis/setup.h>
 
-// shortcuts for accessing linearized arrays
-#define u_comp2(i, j) u_comp[(j - local_start) * (N / 2 + 1) + i]
-#define v_comp2(i, j) v_comp[(j - local_start) * (N / 2 + 1) + i]
-#define u_comp3(i, j, k) u_comp[((k - local_start) * N + j) * (N / 2 + 1) + i]
-#define v_comp3(i, j, k) v_comp[((k - local_start) * N + j) * (N / 2 + 1) + i]
-#define w_comp3(i, j, k) w_comp[((k - local_start) * N + j) * (N / 2 + 1) + i]
-
 namespace dealspectrum
 {
 /**
  * Class wrapping FFTW and performing energy spectral analysis.
+ *
+ * Two data distributions are supported:
+ *
+ *  (1) slab decomposition (default): FFTW-MPI distributes rows (2D) or planes (3D), i.e., the
+ *      number of processes owning data is limited by the number of points in one direction.
+ *
+ *  (2) pencil decomposition (3D only): the processes are arranged in a 2D process grid and own
+ *      complete lines in x-direction. The 3D transform is performed by local 1D transforms in x-,
+ *      y-, and z-direction with two global transposes in between, which are performed within
+ *      the rows and columns of the process grid. Hence, up to N^2 processes can be used.
+ *
+ * In physical space, the point (i, j, k) has the lexicographic index (k * N + j) * N + i. In
+ * spectral space, only the wave numbers 0 <= kx <= N/2 are stored due to the real-to-complex
+ * transform.
+ *
+ * The FFTW plans are created once in init() and reused for all transforms.
  */
 class SpectralAnalysis
 {
@@ -49,7 +60,7 @@ class SpectralAnalysis
   Setup & s;
   // is initialized?
   bool initialized;
-  // rank of process which owns row
+  // rank of process which owns row (slab decomposition)
   int * _indices_proc_rows;
 
 public:
@@ -62,7 +73,8 @@ public:
   }
 
   /**
-   * Determines rank of process owning specified row (2D) or plane (3D)
+   * Determines rank of process owning specified row (2D) or plane (3D) in case of slab
+   * decomposition
    *
    * @param i     position on sfc
    * @return      rank of process owning cell
@@ -74,7 +86,7 @@ public:
   }
 
   /**
-   * Get process local range of rows/plane this process owns
+   * Get process local range of rows/plane this process owns (slab decomposition)
    *
    * @param start     start point
    * @param end       end point
@@ -82,12 +94,88 @@ public:
   void
   getLocalRange(int & start, int & end)
   {
+    AssertThrow(!pencil, dealii::ExcMessage("Only available for slab decomposition."));
+
     start = local_start;
     end   = local_end;
   }
 
   /**
-   * Initialize data structures
+   * Determines rank of process owning a point in physical space
+   *
+   * @param index     lexicographic index of point
+   * @return          rank of process owning point
+   */
+  int
+  owner(unsigned long int const index) const
+  {
+    unsigned long int const line = index / N;
+
+    if(!pencil)
+      return _indices_proc_rows[line / dealii::Utilities::pow(N, dim - 2)];
+
+    int const row = find_block(y_starts, line % N);
+    int const col = find_block(z_starts, line / N);
+
+    return row * p_col + col;
+  }
+
+  /**
+   * Number of points in physical space owned by this process
+   */
+  int
+  n_local_points() const
+  {
+    int count = 0;
+    for(int c = 0; c < bsize; c++)
+      if(local_to_lexicographic(c) >= 0)
+        count++;
+
+    return count;
+  }
+
+  /**
+   * Lexicographic index of the point stored at position c of the real input array of one
+   * component, or -1 in case of padding
+   *
+   * @param c     position in real array
+   * @return      lexicographic index
+   */
+  long int
+  local_to_lexicographic(int const c) const
+  {
+    if(pencil)
+    {
+      long int const i = c % N;
+      long int const j = (c / N) % ly + y_starts[row_coord];
+      long int const k = c / (N * ly) + z_starts[col_coord];
+
+      return (k * N + j) * N + i;
+    }
+
+    // slab decomposition: each row is padded to 2 * (N / 2 + 1) entries
+    int const      Nx   = 2 * (N / 2 + 1);
+    long int const i    = c % Nx;
+    long int const line = c / Nx;
+
+    if(i >= N)
+      return -1;
+
+    if(dim == 2)
+    {
+      long int const j = line + local_start;
+      return j < local_end ? j * N + i : -1;
+    }
+    else
+    {
+      long int const k = line / N + local_start;
+      long int const j = line % N;
+      return k < local_end ? (k * N + j) * N + i : -1;
+    }
+  }
+
+  /**
+   * Initialize data structures and create FFTW plans
    */
   void
   init()
@@ -98,64 +186,45 @@ public:
     this->initialized = true;
 
     // extract settings
-    this->N    = s.cells * s.points_dst;
-    this->dim  = s.dim;
-    this->rank = s.rank;
-    this->size = s.size;
-    this->bins = s.bins;
-
-    // setup global size of output arrays...
-    n = new ptrdiff_t[dim];
-    for(int i = 0; i < dim - 1; i++)
-      n[i] = N;
-    n[dim - 1] = N / 2 + 1;
+    this->N      = s.cells * s.points_dst;
+    this->dim    = s.dim;
+    this->rank   = s.rank;
+    this->size   = s.size;
+    this->bins   = s.bins;
+    this->pencil = s.pencil_decomposition;
 
-    // ...get local size of local output arrays
-    ptrdiff_t local_elements = 0;
-    alloc_local              = fftw_mpi_local_size(dim, n, comm, &local_elements, &local_start);
-    local_end                = local_start + local_elements;
-
-    // determine how many rows each process has
-    int * global_elements = new int[size];
-    MPI_Allgather(&local_elements, 1, MPI_INTEGER, global_elements, 1, MPI_INTEGER, comm);
+    AssertThrow(!pencil || dim == 3,
+                dealii::ExcMessage("Pencil decomposition is only implemented for dim = 3."));
 
-    // ... save for each row by whom it is owned
-    _indices_proc_rows = new int[N];
+    fftw_mpi_init();
 
-    for(int i = 0, c = 0; i < size; i++)
-      for(int j = 0; j < global_elements[i]; j++, c++)
-        _indices_proc_rows[c] = i;
+    // reuse FFTW wisdom from previous runs
+    if(!s.wisdom_file.empty())
+    {
+      if(rank == 0)
+        fftw_import_wisdom_from_filename(s.wisdom_file.c_str());
+      fftw_mpi_broadcast_wisdom(comm);
+    }
 
-    // ... clean up
-    delete[] global_elements;
+    unsigned int const flags = s.measure_plans ? FFTW_MEASURE : FFTW_ESTIMATE;
 
-    // modify global size for input array
-    n[dim - 1] = N;
+    if(pencil)
+      init_pencil(flags);
+    else
+      init_slab(flags);
 
-    // allocate memory
-    // ... for input array (real) - allocated together for all directions
-    u_real = fftw_alloc_real(2 * alloc_local * dim);
-    // ... and save required size
-    this->bsize = 2 * alloc_local;
+    // store FFTW wisdom for subsequent runs
+    if(!s.wisdom_file.empty())
+    {
+      fftw_mpi_gather_wisdom(comm);
+      if(rank == 0)
+        fftw_export_wisdom_to_filename(s.wisdom_file.c_str());
+    }
 
     // initialize input array with zero (not needed: only useful for IO -> hard zero)
-    for(int i = 0; i < 2 * alloc_local * dim; i++)
+    for(int i = 0; i < bsize * dim; i++)
       u_real[i] = 0;
 
-    // set pointer for v input field
-    v_real = u_real + 2 * alloc_local;
-
-    // allocate memory for output array (complex)
-    u_comp = fftw_alloc_complex(alloc_local);
-    v_comp = fftw_alloc_complex(alloc_local);
-
-    // do the same for 3D
-    if(dim == 3)
-    {
-      w_real = v_real + 2 * alloc_local;
-      w_comp = fftw_alloc_complex(alloc_local);
-    }
-
     // allocate memory and ...
     this->e = new double[N];
     this->E = new double[N];
@@ -175,24 +244,40 @@ public:
       return;
 
     // free data structures
-    delete[] _indices_proc_rows;
+    for(auto & plan : plans)
+      fftw_destroy_plan(plan);
+
+    if(pencil)
+    {
+      fftw_destroy_plan(plan_y);
+      fftw_free(buffer_x);
+      fftw_free(buffer_y);
+      fftw_free(buffer_send);
+      fftw_free(buffer_recv);
+      MPI_Comm_free(&comm_xy);
+      MPI_Comm_free(&comm_yz);
+    }
+    else
+    {
+      delete[] _indices_proc_rows;
+      delete[] n;
+    }
 
-    free(n);
     fftw_free(u_comp);
     fftw_free(v_comp);
-    free(u_real);
+    fftw_free(u_real);
 
     if(dim == 3)
     {
       fftw_free(w_comp);
     }
 
-    delete e;
-    delete E;
-    delete k;
-    delete K;
-    delete c;
-    delete C;
+    delete[] e;
+    delete[] E;
+    delete[] k;
+    delete[] K;
+    delete[] c;
+    delete[] C;
   }
 
   /**
@@ -201,22 +286,26 @@ public:
   void
   execute()
   {
-    // perform FFT for u
-    fftw_plan pu = fftw_mpi_plan_dft_r2c(dim, n, u_real, u_comp, comm, FFTW_ESTIMATE);
-    fftw_execute(pu);
-    fftw_destroy_plan(pu);
+    double *       real[3] = {u_real, v_real, w_real};
+    fftw_complex * comp[3] = {u_comp, v_comp, w_comp};
 
-    // ... for v
-    fftw_plan pv = fftw_mpi_plan_dft_r2c(dim, n, v_real, v_comp, comm, FFTW_ESTIMATE);
-    fftw_execute(pv);
-    fftw_destroy_plan(pv);
-
-    // ... for w
-    if(dim == 3)
+    for(int d = 0; d < dim; d++)
     {
-      fftw_plan pw = fftw_mpi_plan_dft_r2c(dim, n, w_real, w_comp, comm, FFTW_ESTIMATE);
-      fftw_execute(pw);
-      fftw_destroy_plan(pw);
+      if(pencil)
+      {
+        // transform in x-direction (real-to-complex), ...
+        fftw_execute(plans[2 * d]);
+        // ... transpose to y-pencils, transform in y-direction, ...
+        transpose_x_y(buffer_x, buffer_y);
+        fftw_execute(plan_y);
+        // ... and transpose to z-pencils and transform in z-direction
+        transpose_y_z(buffer_y, comp[d]);
+        fftw_execute(plans[2 * d + 1]);
+      }
+      else
+      {
+        fftw_execute(plans[d]);
+      }
     }
   }
 
@@ -226,7 +315,7 @@ public:
     double scaling    = pow(N, dim);
     double e_physical = 0.0, e_spectral = 0.0;
 
-    for(int i = 0; i < 2 * alloc_local * dim; i++)
+    for(int i = 0; i < bsize * dim; i++)
     {
       e_physical += u_real[i] * u_real[i];
     }
@@ -236,41 +325,9 @@ public:
     // ... and make to energy 0.5*u^2
     e_physical *= 0.5;
 
-    if(dim == 2)
-    {
-      for(int j = local_start; j < local_end; j++)
-      {
-        for(int i = 0; i < N; i++)
-        {
-          e_spectral += u_comp2(MIN(i, N - i), j)[0] * u_comp2(MIN(i, N - i), j)[0] +
-                        u_comp2(MIN(i, N - i), j)[1] * u_comp2(MIN(i, N - i), j)[1] +
-                        v_comp2(MIN(i, N - i), j)[0] * v_comp2(MIN(i, N - i), j)[0] +
-                        v_comp2(MIN(i, N - i), j)[1] * v_comp2(MIN(i, N - i), j)[1];
-        }
-      }
-    }
-    else if(dim == 3)
-    {
-      for(int k_ = local_start; k_ < local_end; k_++)
-      {
-        for(int j = 0; j < N; j++)
-        {
-          for(int i = 0; i < N; i++)
-          {
-            e_spectral += u_comp3(MIN(i, N - i), j, k_)[0] * u_comp3(MIN(i, N - i), j, k_)[0] +
-                          u_comp3(MIN(i, N - i), j, k_)[1] * u_comp3(MIN(i, N - i), j, k_)[1] +
-                          v_comp3(MIN(i, N - i), j, k_)[0] * v_comp3(MIN(i, N - i), j, k_)[0] +
-                          v_comp3(MIN(i, N - i), j, k_)[1] * v_comp3(MIN(i, N - i), j, k_)[1] +
-                          w_comp3(MIN(i, N - i), j, k_)[0] * w_comp3(MIN(i, N - i), j, k_)[0] +
-                          w_comp3(MIN(i, N - i), j, k_)[1] * w_comp3(MIN(i, N - i), j, k_)[1];
-          }
-        }
-      }
-    }
-    else
-    {
-      AssertThrow(false, dealii::ExcMessage("Not implemented."));
-    }
+    for_each_local_wave_number([&](int const index, int, int, int, double const weight) {
+      e_spectral += weight * energy(index);
+    });
 
     // scale: due to FFT...
     e_spectral /= scaling * scaling;
@@ -298,56 +355,19 @@ public:
     }
 
     // collect energy for local domain...
-    if(dim == 2)
-    {
-      for(int j = local_start; j < local_end; j++)
-      {
-        for(int i = 0; i < N; i++)
-        {
-          // determine wavenumber...
-          double r = sqrt(pow(MIN(i, N - i), 2.0) + pow(MIN(j, N - j), 2.0));
-          // ... use for binning
-          int p = static_cast<int>(std::round(r));
-          // ... update energy
-          e[p] += u_comp2(MIN(i, N - i), j)[0] * u_comp2(MIN(i, N - i), j)[0] +
-                  u_comp2(MIN(i, N - i), j)[1] * u_comp2(MIN(i, N - i), j)[1] +
-                  v_comp2(MIN(i, N - i), j)[0] * v_comp2(MIN(i, N - i), j)[0] +
-                  v_comp2(MIN(i, N - i), j)[1] * v_comp2(MIN(i, N - i), j)[1];
-
-          // ... update kappa results
-          k[p] += r;
-          c[p]++;
-        }
-      }
-    }
-    else if(dim == 3)
-    {
-      for(int k_ = local_start; k_ < local_end; k_++)
-      {
-        for(int j = 0; j < N; j++)
-        {
-          for(int i = 0; i < N; i++)
-          {
-            // determine wavenumber...
-            double r =
-              sqrt(pow(MIN(i, N - i), 2.0) + pow(MIN(j, N - j), 2.0) + pow(MIN(k_, N - k_), 2.0));
-            // ... use for binning
-            int p = static_cast<int>(std::round(r));
-            // ... update energy
-            e[p] += u_comp3(MIN(i, N - i), j, k_)[0] * u_comp3(MIN(i, N - i), j, k_)[0] +
-                    u_comp3(MIN(i, N - i), j, k_)[1] * u_comp3(MIN(i, N - i), j, k_)[1] +
-                    v_comp3(MIN(i, N - i), j, k_)[0] * v_comp3(MIN(i, N - i), j, k_)[0] +
-                    v_comp3(MIN(i, N - i), j, k_)[1] * v_comp3(MIN(i, N - i), j, k_)[1] +
-                    w_comp3(MIN(i, N - i), j, k_)[0] * w_comp3(MIN(i, N - i), j, k_)[0] +
-                    w_comp3(MIN(i, N - i), j, k_)[1] * w_comp3(MIN(i, N - i), j, k_)[1];
-
-            // ... update kappa results
-            k[p] += r;
-            c[p]++;
-          }
-        }
-      }
-    }
+    for_each_local_wave_number(
+      [&](int const index, int const kx, int const ky, int const kz, double const weight) {
+        // determine wavenumber...
+        double r = sqrt(pow(kx, 2.0) + pow(MIN(ky, N - ky), 2.0) + pow(MIN(kz, N - kz), 2.0));
+        // ... use for binning
+        int p = static_cast<int>(std::round(r));
+        // ... update energy
+        e[p] += weight * energy(index);
+
+        // ... update kappa results
+        k[p] += weight * r;
+        c[p] += weight;
+      });
 
     // ... sum up local results to global result
     MPI_Reduce(e, E, N, MPI_DOUBLE, MPI_SUM, 0, comm);
@@ -392,6 +412,8 @@ public:
   void
   serialize(char const * filename)
   {
+    AssertThrow(!pencil, dealii::ExcMessage("Only implemented for slab decomposition."));
+
     int start     = local_start;
     int end       = local_end;
     int delta     = 2 * (N / 2 + 1) * dealii::Utilities::pow(N, dim - 2);
@@ -434,6 +456,8 @@ public:
   void
   deserialize(char *& filename)
   {
+    AssertThrow(!pencil, dealii::ExcMessage("Only implemented for slab decomposition."));
+
     int start     = local_start;
     int end       = local_end;
     int delta     = 2 * (N / 2 + 1) * dealii::Utilities::pow(N, dim - 2);
@@ -469,6 +493,340 @@ public:
   }
 
 private:
+  /**
+   * Splits n entries into p contiguous blocks of (almost) equal size
+   */
+  static std::vector<int>
+  partition(int const n, int const p)
+  {
+    std::vector<int> starts(p + 1);
+    for(int i = 0; i <= p; i++)
+      starts[i] = i * (n / p) + MIN(i, n % p);
+
+    return starts;
+  }
+
+  /**
+   * Determines block containing the given index
+   */
+  static int
+  find_block(std::vector<int> const & starts, long int const index)
+  {
+    return std::upper_bound(starts.begin(), starts.end(), index) - starts.begin() - 1;
+  }
+
+  /**
+   * Slab decomposition as provided by FFTW-MPI
+   */
+  void
+  init_slab(unsigned int const flags)
+  {
+    // setup global size of output arrays...
+    n = new ptrdiff_t[dim];
+    for(int i = 0; i < dim - 1; i++)
+      n[i] = N;
+    n[dim - 1] = N / 2 + 1;
+
+    // ...get local size of local output arrays
+    ptrdiff_t local_elements = 0;
+    alloc_local              = fftw_mpi_local_size(dim, n, comm, &local_elements, &local_start);
+    local_end                = local_start + local_elements;
+
+    // determine how many rows each process has
+    int * global_elements = new int[size];
+    MPI_Allgather(&local_elements, 1, MPI_INTEGER, global_elements, 1, MPI_INTEGER, comm);
+
+    // ... save for each row by whom it is owned
+    _indices_proc_rows = new int[N];
+
+    for(int i = 0, c = 0; i < size; i++)
+      for(int j = 0; j < global_elements[i]; j++, c++)
+        _indices_proc_rows[c] = i;
+
+    // ... clean up
+    delete[] global_elements;
+
+    // modify global size for input array
+    n[dim - 1] = N;
+
+    // allocate memory
+    // ... for input array (real) - allocated together for all directions
+    u_real = fftw_alloc_real(2 * alloc_local * dim);
+    // ... and save required size
+    this->bsize = 2 * alloc_local;
+
+    // set pointer for v input field
+    v_real = u_real + 2 * alloc_local;
+
+    // allocate memory for output array (complex)
+    u_comp = fftw_alloc_complex(alloc_local);
+    v_comp = fftw_alloc_complex(alloc_local);
+
+    // do the same for 3D
+    if(dim == 3)
+    {
+      w_real = v_real + 2 * alloc_local;
+      w_comp = fftw_alloc_complex(alloc_local);
+    }
+
+    // create plans once (note: planning with FFTW_MEASURE overwrites the arrays)
+    double *       real[3] = {u_real, v_real, w_real};
+    fftw_complex * comp[3] = {u_comp, v_comp, w_comp};
+    for(int d = 0; d < dim; d++)
+      plans.push_back(fftw_mpi_plan_dft_r2c(dim, n, real[d], comp[d], comm, flags));
+  }
+
+  /**
+   * Pencil decomposition on a 2D process grid with p_row x p_col processes: in physical space,
+   * y is distributed among the rows and z among the columns of the process grid. After the
+   * transforms, kx is distributed among the rows and ky among the columns.
+   */
+  void
+  init_pencil(unsigned int const flags)
+  {
+    if(s.process_rows > 0)
+    {
+      p_row = s.process_rows;
+      AssertThrow(size % p_row == 0,
+                  dealii::ExcMessage("Number of processes has to be a multiple of the number of "
+                                     "rows of the process grid."));
+    }
+    else
+    {
+      int dims[2] = {0, 0};
+      MPI_Dims_create(size, 2, dims);
+      p_row = dims[0];
+    }
+    p_col = size / p_row;
+
+    int const Nh = N / 2 + 1;
+
+    AssertThrow(p_row <= Nh && p_col <= N,
+                dealii::ExcMessage("Process grid too large for the number of points."));
+
+    row_coord = rank / p_col;
+    col_coord = rank % p_col;
+
+    // communicators for transposes within the columns and rows of the process grid
+    MPI_Comm_split(comm, col_coord, row_coord, &comm_xy);
+    MPI_Comm_split(comm, row_coord, col_coord, &comm_yz);
+
+    y_starts  = partition(N, p_row);
+    z_starts  = partition(N, p_col);
+    kx_starts = partition(Nh, p_row);
+    ky_starts = partition(N, p_col);
+
+    ly  = y_starts[row_coord + 1] - y_starts[row_coord];
+    lz  = z_starts[col_coord + 1] - z_starts[col_coord];
+    lkx = kx_starts[row_coord + 1] - kx_starts[row_coord];
+    lky = ky_starts[col_coord + 1] - ky_starts[col_coord];
+
+    // message sizes (in doubles) of the transposes
+    setup_transpose(transpose_x_to_y, p_row, y_starts, kx_starts, lz * ly, lz * lkx);
+    setup_transpose(transpose_y_to_z, p_col, z_starts, ky_starts, lz * lkx, lkx * lky);
+
+    // allocate memory
+    // ... for input array (real) - x-pencils without padding
+    this->bsize = lz * ly * N;
+    u_real      = fftw_alloc_real(MAX(bsize * dim, 1));
+    v_real      = u_real + bsize;
+    w_real      = v_real + bsize;
+
+    // ... for output arrays (complex) - z-pencils
+    int const size_comp = MAX(lkx * lky * N, 1);
+    u_comp              = fftw_alloc_complex(size_comp);
+    v_comp              = fftw_alloc_complex(size_comp);
+    w_comp              = fftw_alloc_complex(size_comp);
+
+    // ... and for intermediate results
+    int const size_x = MAX(lz * ly * Nh, 1);
+    int const size_y = MAX(lz * lkx * N, 1);
+    buffer_x         = fftw_alloc_complex(size_x);
+    buffer_y         = fftw_alloc_complex(size_y);
+    buffer_send      = fftw_alloc_complex(MAX(MAX(size_x, size_y), size_comp));
+    buffer_recv      = fftw_alloc_complex(MAX(MAX(size_x, size_y), size_comp));
+
+    // create plans for 1D transforms once (note: planning with FFTW_MEASURE overwrites the
+    // arrays)
+    int            n_1d    = N;
+    double *       real[3] = {u_real, v_real, w_real};
+    fftw_complex * comp[3] = {u_comp, v_comp, w_comp};
+    for(int d = 0; d < dim; d++)
+    {
+      plans.push_back(fftw_plan_many_dft_r2c(
+        1, &n_1d, lz * ly, real[d], NULL, 1, N, buffer_x, NULL, 1, Nh, flags));
+      plans.push_back(fftw_plan_many_dft(
+        1, &n_1d, lkx * lky, comp[d], NULL, 1, N, comp[d], NULL, 1, N, FFTW_FORWARD, flags));
+    }
+    plan_y = fftw_plan_many_dft(
+      1, &n_1d, lz * lkx, buffer_y, NULL, 1, N, buffer_y, NULL, 1, N, FFTW_FORWARD, flags);
+  }
+
+  /**
+   * Message sizes and displacements (in doubles) of a transpose within a row or column of the
+   * process grid
+   */
+  struct Transpose
+  {
+    std::vector<int> send_counts, send_displs, recv_counts, recv_displs;
+  };
+
+  /**
+   * The direction distributed according to starts_src becomes local, while the local direction
+   * is distributed according to starts_dst afterwards. Each process sends n_lines_src lines and
+   * receives n_lines_dst lines (of the respective block size).
+   */
+  static void
+  setup_transpose(Transpose &              t,
+                  int const                p,
+                  std::vector<int> const & starts_src,
+                  std::vector<int> const & starts_dst,
+                  int const                n_lines_src,
+                  int const                n_lines_dst)
+  {
+    t.send_counts.resize(p);
+    t.send_displs.resize(p + 1, 0);
+    t.recv_counts.resize(p);
+    t.recv_displs.resize(p + 1, 0);
+
+    for(int r = 0; r < p; r++)
+    {
+      t.send_counts[r] = 2 * n_lines_src * (starts_dst[r + 1] - starts_dst[r]);
+      t.recv_counts[r] = 2 * n_lines_dst * (starts_src[r + 1] - starts_src[r]);
+
+      t.send_displs[r + 1] = t.send_displs[r] + t.send_counts[r];
+      t.recv_displs[r + 1] = t.recv_displs[r] + t.recv_counts[r];
+    }
+  }
+
+  void
+  exchange(Transpose const & t, MPI_Comm const & comm_transpose)
+  {
+    MPI_Alltoallv(buffer_send,
+                  t.send_counts.data(),
+                  t.send_displs.data(),
+                  MPI_DOUBLE,
+                  buffer_recv,
+                  t.recv_counts.data(),
+                  t.recv_displs.data(),
+                  MPI_DOUBLE,
+                  comm_transpose);
+  }
+
+  /**
+   * Transpose x-pencils [z][y][kx] into y-pencils [z][kx][y] within the column of the process
+   * grid
+   */
+  void
+  transpose_x_y(fftw_complex const * src, fftw_complex * dst)
+  {
+    int const Nh = N / 2 + 1;
+
+    // pack data sorted by destination ...
+    for(int r = 0, c = 0; r < p_row; r++)
+      for(int z = 0; z < lz; z++)
+        for(int y = 0; y < ly; y++)
+          for(int kx = kx_starts[r]; kx < kx_starts[r + 1]; kx++, c++)
+          {
+            buffer_send[c][0] = src[(z * ly + y) * Nh + kx][0];
+            buffer_send[c][1] = src[(z * ly + y) * Nh + kx][1];
+          }
+
+    exchange(transpose_x_to_y, comm_xy);
+
+    // ... and unpack data sorted by source
+    for(int r = 0, c = 0; r < p_row; r++)
+      for(int z = 0; z < lz; z++)
+        for(int y = y_starts[r]; y < y_starts[r + 1]; y++)
+          for(int kx = 0; kx < lkx; kx++, c++)
+          {
+            dst[(z * lkx + kx) * N + y][0] = buffer_recv[c][0];
+            dst[(z * lkx + kx) * N + y][1] = buffer_recv[c][1];
+          }
+  }
+
+  /**
+   * Transpose y-pencils [z][kx][ky] into z-pencils [kx][ky][z] within the row of the process
+   * grid
+   */
+  void
+  transpose_y_z(fftw_complex const * src, fftw_complex * dst)
+  {
+    // pack data sorted by destination ...
+    for(int r = 0, c = 0; r < p_col; r++)
+      for(int z = 0; z < lz; z++)
+        for(int kx = 0; kx < lkx; kx++)
+          for(int ky = ky_starts[r]; ky < ky_starts[r + 1]; ky++, c++)
+          {
+            buffer_send[c][0] = src[(z * lkx + kx) * N + ky][0];
+            buffer_send[c][1] = src[(z * lkx + kx) * N + ky][1];
+          }
+
+    exchange(transpose_y_to_z, comm_yz);
+
+    // ... and unpack data sorted by source
+    for(int r = 0, c = 0; r < p_col; r++)
+      for(int z = z_starts[r]; z < z_starts[r + 1]; z++)
+        for(int kx = 0; kx < lkx; kx++)
+          for(int ky = 0; ky < lky; ky++, c++)
+          {
+            dst[(kx * lky + ky) * N + z][0] = buffer_recv[c][0];
+            dst[(kx * lky + ky) * N + z][1] = buffer_recv[c][1];
+          }
+  }
+
+  /**
+   * Loops over all wave numbers stored on this process. Since only kx <= N/2 is stored, the
+   * complex conjugate modes are taken into account by a weight of 2.
+   *
+   * @param f     function called with (index in complex arrays, kx, ky, kz, weight)
+   */
+  template<typename Function>
+  void
+  for_each_local_wave_number(Function const & f) const
+  {
+    int const  Nh     = N / 2 + 1;
+    auto const weight = [&](int const kx) { return (kx == 0 || 2 * kx == N) ? 1.0 : 2.0; };
+
+    if(pencil)
+    {
+      for(int i = 0; i < lkx; i++)
+        for(int j = 0; j < lky; j++)
+          for(int k_ = 0; k_ < N; k_++)
+          {
+            int const kx = kx_starts[row_coord] + i;
+            f((i * lky + j) * N + k_, kx, ky_starts[col_coord] + j, k_, weight(kx));
+          }
+    }
+    else if(dim == 2)
+    {
+      for(int j = local_start; j < local_end; j++)
+        for(int i = 0; i < Nh; i++)
+          f((j - local_start) * Nh + i, i, j, 0, weight(i));
+    }
+    else
+    {
+      for(int k_ = local_start; k_ < local_end; k_++)
+        for(int j = 0; j < N; j++)
+          for(int i = 0; i < Nh; i++)
+            f(((k_ - local_start) * N + j) * Nh + i, i, j, k_, weight(i));
+    }
+  }
+
+  /**
+   * Squared magnitude of the velocity at the given position of the complex arrays
+   */
+  double
+  energy(int const index) const
+  {
+    double result = u_comp[index][0] * u_comp[index][0] + u_comp[index][1] * u_comp[index][1] +
+                    v_comp[index][0] * v_comp[index][0] + v_comp[index][1] * v_comp[index][1];
+    if(dim == 3)
+      result += w_comp[index][0] * w_comp[index][0] + w_comp[index][1] * w_comp[index][1];
+
+    return result;
+  }
+
   // number of dofs in each direction
   int N;
   // dimensions
@@ -479,6 +837,10 @@ private:
   int size;
   // bin count
   int bins;
+  // pencil (instead of slab) decomposition?
+  bool pencil;
+
+  // slab decomposition:
   // number of dofs in each direction (for FFTW)
   ptrdiff_t * n;
   // local row/plane range: start
@@ -487,6 +849,32 @@ private:
   ptrdiff_t local_end;
   ptrdiff_t alloc_local;
 
+  // pencil decomposition:
+  // size of process grid
+  int p_row, p_col;
+  // coordinates of this process in process grid
+  int row_coord, col_coord;
+  // communicators for transposes x <-> y (column of process grid) and y <-> z (row)
+  MPI_Comm comm_xy, comm_yz;
+  // distribution of y and z in physical space, and of kx and ky in spectral space
+  std::vector<int> y_starts, z_starts, kx_starts, ky_starts;
+  // ... and the local sizes
+  int ly, lz, lkx, lky;
+  // transposes
+  Transpose transpose_x_to_y, transpose_y_to_z;
+  // intermediate results after transforms in x- and y-direction
+  fftw_complex * buffer_x;
+  fftw_complex * buffer_y;
+  // communication buffers
+  fftw_complex * buffer_send;
+  fftw_complex * buffer_recv;
+  // plan for transform in y-direction (shared by all components)
+  fftw_plan plan_y;
+
+  // FFTW plans created once: one plan per component (slab decomposition) or plans for
+  // transforms in x- and z-direction of each component (pencil decomposition)
+  std::vector<fftw_plan> plans;
+
 public:
   // size of each real field
   int bsize;
@@ -497,13 +885,13 @@ private:
   // ... for v
   double * v_real;
   // ... for w
-  double * w_real;
+  double * w_real = nullptr;
   // complex field for u
   fftw_complex * u_comp;
   // ... for v
   fftw_complex * v_comp;
   // ... for w
-  fftw_complex * w_comp;
+  fftw_complex * w_comp = nullptr;
 
 private:
   // array for locally collecting energy
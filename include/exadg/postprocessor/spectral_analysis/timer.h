@@ -22,10 +22,15 @@
 #ifndef DEAL_SPECTRUM_TIMER
 #define DEAL_SPECTRUM_TIMER
 
+// C/C++
+#include <mpi.h>
+#include <map>
+#include <string>
+
 namespace dealspectrum
 {
 /**
- * Class for timing
+ * Class for timing (wall time)
  */
 class DealSpectrumTimer
 {
@@ -40,11 +45,13 @@ class DealSpectrumTimer
     // ... timing instance has been started
     bool started;
     // ... current timing
-    clock_t time;
+    double time = 0.0;
     // ... temporal timing
-    clock_t temp;
+    double temp = 0.0;
+    // ... last timing
+    double last = 0.0;
     // ... how often has this been timed
-    int count;
+    int count = 0;
   };
 
 public:
@@ -65,7 +72,7 @@ public:
   {
     if(!m.count(label))
       m[label] = Instance();
-    m[label].temp    = clock();
+    m[label].temp    = MPI_Wtime();
     m[label].started = true;
   }
 
@@ -80,7 +87,8 @@ public:
     if(m.count(label) && m[label].started)
     {
       auto & t  = m[label];
-      t.time    = clock() - m[label].temp;
+      t.time    = MPI_Wtime() - m[label].temp;
+      t.last    = t.time;
       t.started = false;
       t.count++;
     }
@@ -96,13 +104,27 @@ public:
   {
     if(m.count(label) && m[label].started)
     {
-      auto & t = m[label];
-      t.time += (clock() - t.temp);
+      auto & t  = m[label];
+      t.last    = MPI_Wtime() - t.temp;
+      t.time += t.last;
       t.started = false;
       t.count++;
     }
   }
 
+  /**
+   * last timing of a label
+   *
+   * @param label label assigned to timing instance
+   * @return      last timing (0 if this label has not been timed yet)
+   */
+  double
+  get_last(std::string const & label) const
+  {
+    auto const it = m.find(label);
+    return it != m.end() ? it->second.last : 0.0;
+  }
+
   /**
    * write timing statistics to screen
    *
@@ -122,10 +144,10 @@ public:
       printf("  %-18s %4d %18.12f %18.12f\n",
              i.first.c_str(),
              i.second.count,
-             ((double)i.second.time) / CLOCKS_PER_SEC / i.second.count,
-             ((double)i.second.time) / CLOCKS_PER_SEC);
-      sum_total += ((double)i.second.time) / CLOCKS_PER_SEC;
-      sum_latency += ((double)i.second.time) / CLOCKS_PER_SEC / i.second.count;
+             i.second.time / i.second.count,
+             i.second.time);
+      sum_total += i.second.time;
+      sum_latency += i.second.time / i.second.count;
     }
     printf("===============================================================\n");
     printf("                          %18.12f %18.12f\n", sum_latency, sum_total);
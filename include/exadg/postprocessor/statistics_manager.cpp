@@ -21,6 +21,7 @@
 
 // C/C++
 #include <fstream>
+#include <sstream>
 
 // deal.II
 #include <deal.II/base/quadrature_lib.h>
@@ -29,6 +30,7 @@
 
 // ExaDG
 #include <exadg/postprocessor/statistics_manager.h>
+#include <exadg/time_integration/restart.h>
 #include <exadg/utilities/create_directories.h>
 
 //#define OUTPUT_DEBUG_INFO
@@ -107,18 +109,8 @@ StatisticsManager<dim, Number>::setup(const std::function<double(double const &)
 
     unsigned int const n_points_y_glob = n_cells_y_dir * (n_points_y_per_cell - 1) + 1;
 
-    // velocity vector with 3-components
-    vel_glob.resize(3);
-    for(unsigned int i = 0; i < 3; i++)
-      vel_glob[i].resize(n_points_y_glob); // vector for all y-coordinates
-
-    // velocity vector with 3-components
-    velsq_glob.resize(3);
-    for(unsigned int i = 0; i < 3; i++)
-      velsq_glob[i].resize(n_points_y_glob); // vector for all y-coordinates
-
-    // u*v (scalar quantity)
-    veluv_glob.resize(n_points_y_glob); // vector for all y-coordinates
+    // velocity vector with 3-components (for all y-coordinates)
+    velocity_statistics.reinit(n_points_y_glob, 3);
 
     // initialize number of samples
     number_of_samples = 0;
@@ -290,6 +282,9 @@ StatisticsManager<dim, Number>::setup(const std::function<double(double const &)
     AssertThrow(y_glob.size() == n_points_y_glob, dealii::ExcInternalError());
 
     create_directories(data.directory, mpi_comm);
+
+    if(data.time_control_data_statistics.read_restart)
+      read_restart();
   }
 }
 
@@ -315,13 +310,7 @@ template<int dim, typename Number>
 void
 StatisticsManager<dim, Number>::reset()
 {
-  for(unsigned int i = 0; i < dim; i++)
-    std::fill(vel_glob[i].begin(), vel_glob[i].end(), 0.);
-
-  for(unsigned int i = 0; i < dim; i++)
-    std::fill(velsq_glob[i].begin(), velsq_glob[i].end(), 0.);
-
-  std::fill(veluv_glob.begin(), veluv_glob.end(), 0.);
+  velocity_statistics.reset();
 
   number_of_samples = 0;
 }
@@ -357,30 +346,16 @@ StatisticsManager<dim, Number>::evaluate_statistics(std::vector<VectorType> cons
  *   - averaging over homogeneous directions (=averaging over x-z-planes)
  *   - and subsequently averaging the x-z-plane-averaged quantities over time samples
  *
- *  Therefore, we have to compute the following quantities: <u>, <u²>, <u*v>, since ...
- *
- *   - <u'²> = <(u-<u>)²> = <u² - 2*u<u> + <u>²> = <u²> - 2*<u>² + <u>² = <u²> - <u>²
- *   - <u'v'> = <(u-<u>)*(v-<v>)> = <u*v> - <u*<v>> - <<u>*v> + <u><v> = <u*v> - <u><v>
- *            = <u*v> since <v> = 0
+ *  Both averages are computed at once by adding the velocity in all quadrature points of the
+ *  x-z-planes with weight JxW to a MomentAccumulator, which updates the mean values and co-moments
+ *  with the Welford algorithm. Since the area of the x-z-planes does not change in time, this is
+ *  equivalent to averaging the plane averages over time. The samples are only accumulated on the
+ *  local processor, the global reduction is performed when writing the output.
  */
 template<int dim, typename Number>
 void
 StatisticsManager<dim, Number>::do_evaluate(const std::vector<VectorType const *> & velocity)
 {
-  // Use local vectors xxx_loc in order to average/integrate over all
-  // locally owned cells of current processor.
-  std::vector<double> area_loc(vel_glob[0].size());
-
-  std::vector<std::vector<double>> vel_loc(dim);
-  for(unsigned int i = 0; i < dim; i++)
-    vel_loc[i].resize(vel_glob[0].size());
-
-  std::vector<std::vector<double>> velsq_loc(dim);
-  for(unsigned int i = 0; i < dim; i++)
-    velsq_loc[i].resize(vel_glob[0].size());
-
-  std::vector<double> veluv_loc(vel_glob[0].size());
-
   // use 2d quadrature to integrate over x-z-planes
   unsigned int const      fe_degree = dof_handler.get_fe().degree;
   dealii::QGauss<dim - 1> gauss_2d(fe_degree + 1);
@@ -447,45 +422,6 @@ StatisticsManager<dim, Number>::do_evaluate(const std::vector<VectorType const *
       {
         fe_values[i]->reinit(typename dealii::Triangulation<dim>::active_cell_iterator(cell));
 
-        std::vector<double> vel(dim, 0.);
-        std::vector<double> velsq(dim, 0.);
-        double              area = 0, veluv = 0;
-
-        // perform integral over current x-z-plane of current cell
-        for(unsigned int q = 0; q < fe_values[i]->n_quadrature_points; ++q)
-        {
-          // interpolate velocity to the quadrature point
-          dealii::Tensor<1, dim> velocity;
-          for(unsigned int j = 0; j < velocity_vector.size(); ++j)
-            velocity += fe_values[i]->shape_value(j, q) * velocity_vector[j];
-
-          double det = 0.;
-          if(dim == 3)
-          {
-            dealii::Tensor<2, 2> reduced_jacobian;
-            reduced_jacobian[0][0] = fe_values[i]->jacobian(q)[0][0];
-            reduced_jacobian[0][1] = fe_values[i]->jacobian(q)[0][2];
-            reduced_jacobian[1][0] = fe_values[i]->jacobian(q)[2][0];
-            reduced_jacobian[1][1] = fe_values[i]->jacobian(q)[2][2];
-            det                    = determinant(reduced_jacobian);
-          }
-          else
-          {
-            det = std::abs(fe_values[i]->jacobian(q)[0][0]);
-          }
-
-          double area_ele = det * fe_values[i]->get_quadrature().weight(q);
-          area += area_ele;
-
-          for(unsigned int i = 0; i < dim; i++)
-            vel[i] += velocity[i] * area_ele;
-
-          for(unsigned int i = 0; i < dim; i++)
-            velsq[i] += velocity[i] * velocity[i] * area_ele;
-
-          veluv += velocity[0] * velocity[1] * area_ele;
-        }
-
         // Tranform cell index 'i' to global index 'idx' of y_glob-vector
 
         // find index within the y-values: first do a binary search to find
@@ -513,44 +449,40 @@ StatisticsManager<dim, Number>::do_evaluate(const std::vector<VectorType const *
                                        std::to_string(std::abs(y_glob[idx] - y)) +
                                        ". Check transform() function given to constructor."));
 
-        // Add results of cellwise integral to xxx_loc vectors since we want
-        // to average/integrate over all locally owned cells.
-        for(unsigned int i = 0; i < dim; i++)
-          vel_loc[i].at(idx) += vel[i];
-
-        for(unsigned int i = 0; i < dim; i++)
-          velsq_loc[i].at(idx) += velsq[i];
-
-        veluv_loc.at(idx) += veluv;
-        area_loc.at(idx) += area;
-      }
-    }
-  }
-
-  // accumulate data over all processors overwriting
-  // the processor-local data in xxx_loc since we want
-  // to average/integrate over the global x-z-plane.
-  for(unsigned int i = 0; i < dim; i++)
-    dealii::Utilities::MPI::sum(vel_loc[i], mpi_comm, vel_loc[i]);
-
-  for(unsigned int i = 0; i < dim; i++)
-    dealii::Utilities::MPI::sum(velsq_loc[i], mpi_comm, velsq_loc[i]);
+        // perform integral over current x-z-plane of current cell
+        for(unsigned int q = 0; q < fe_values[i]->n_quadrature_points; ++q)
+        {
+          // interpolate velocity to the quadrature point
+          dealii::Tensor<1, dim> velocity;
+          for(unsigned int j = 0; j < velocity_vector.size(); ++j)
+            velocity += fe_values[i]->shape_value(j, q) * velocity_vector[j];
 
-  dealii::Utilities::MPI::sum(veluv_loc, mpi_comm, veluv_loc);
-  dealii::Utilities::MPI::sum(area_loc, mpi_comm, area_loc);
+          double det = 0.;
+          if(dim == 3)
+          {
+            dealii::Tensor<2, 2> reduced_jacobian;
+            reduced_jacobian[0][0] = fe_values[i]->jacobian(q)[0][0];
+            reduced_jacobian[0][1] = fe_values[i]->jacobian(q)[0][2];
+            reduced_jacobian[1][0] = fe_values[i]->jacobian(q)[2][0];
+            reduced_jacobian[1][1] = fe_values[i]->jacobian(q)[2][2];
+            det                    = determinant(reduced_jacobian);
+          }
+          else
+          {
+            det = std::abs(fe_values[i]->jacobian(q)[0][0]);
+          }
 
-  // Add values averaged over global x-z-planes
-  // (=MPI::sum(xxx_loc)/MPI::sum(area_loc)) to xxx_glob vectors.
-  // Averaging over time-samples is performed when writing the output.
-  for(unsigned int idx = 0; idx < y_glob.size(); idx++)
-  {
-    for(unsigned int i = 0; i < dim; i++)
-      vel_glob[i].at(idx) += vel_loc[i][idx] / area_loc[idx];
+          double const area_ele = det * fe_values[i]->get_quadrature().weight(q);
 
-    for(unsigned int i = 0; i < dim; i++)
-      velsq_glob[i].at(idx) += velsq_loc[i][idx] / area_loc[idx];
+          // the third velocity component vanishes in 2D
+          double values[3] = {0., 0., 0.};
+          for(unsigned int d = 0; d < dim; d++)
+            values[d] = velocity[d];
 
-    veluv_glob.at(idx) += veluv_loc[idx] / area_loc[idx];
+          velocity_statistics.add_sample(idx, values, area_ele);
+        }
+      }
+    }
   }
 
   // increment number of samples
@@ -563,11 +495,20 @@ StatisticsManager<dim, Number>::do_write_output(std::string const filename,
                                                 double const      dynamic_viscosity,
                                                 double const      density)
 {
+  // accumulate data over all processors in order to average over the global x-z-planes
+  std::vector<MomentAccumulator> const statistics =
+    MomentAccumulator::reduce({&velocity_statistics}, mpi_comm);
+
   if(dealii::Utilities::MPI::this_mpi_process(mpi_comm) == 0)
   {
+    MomentAccumulator const & velocity = statistics[0];
+
+    if(data.time_control_data_statistics.write_restart)
+      write_restart(velocity);
+
     // tau_w = mu * d<u>/dy = mu * (<u>(y2)-<u>(y1))/(y2-y1), where mu = rho * nu
-    double tau_w = dynamic_viscosity * ((vel_glob[0].at(1) - vel_glob[0].at(0)) /
-                                        (double)number_of_samples / (y_glob.at(1) - y_glob.at(0)));
+    double tau_w = dynamic_viscosity * ((velocity.mean(1, 0) - velocity.mean(0, 0)) /
+                                        (y_glob.at(1) - y_glob.at(0)));
 
     // Re_tau = u_tau * delta / nu = sqrt(tau_w/rho) * delta / (mu/rho), where delta = 1
     double Re_tau = sqrt(tau_w / density) / (dynamic_viscosity / density);
@@ -594,18 +535,17 @@ StatisticsManager<dim, Number>::do_write_output(std::string const filename,
       f << std::scientific << std::setprecision(7) << std::setw(15) << y_glob.at(idx);
 
       // mean velocity <u_i>, i=1,...,d
-      f << std::setw(15) << vel_glob[0].at(idx) / (double)number_of_samples  /* <u_1> */
-        << std::setw(15) << vel_glob[1].at(idx) / (double)number_of_samples  /* <u_2> */
-        << std::setw(15) << vel_glob[2].at(idx) / (double)number_of_samples; /* <u_3> */
+      f << std::setw(15) << velocity.mean(idx, 0)  /* <u_1> */
+        << std::setw(15) << velocity.mean(idx, 1)  /* <u_2> */
+        << std::setw(15) << velocity.mean(idx, 2); /* <u_3> */
 
-      // rms values: sqrt( <u_i'²> ) = sqrt( <u_i²> - <u_i>² ) where <u_i> = 0 for i=2,3
-      double mean_u1 = vel_glob[0].at(idx) / (double)number_of_samples;
-      f << std::setw(15) << std::sqrt(std::abs((velsq_glob[0].at(idx) / (double)(number_of_samples)-mean_u1 * mean_u1))) /* rms(u_1) */
-        << std::setw(15) << sqrt(velsq_glob[1].at(idx) / (double)(number_of_samples))                                    /* rms(u_2) */
-        << std::setw(15) << sqrt(velsq_glob[2].at(idx) / (double)(number_of_samples));                                   /* rms(u_3) */
+      // rms values: sqrt( <u_i'²> )
+      f << std::setw(15) << std::sqrt(std::abs(velocity.covariance(idx, 0, 0))) /* rms(u_1) */
+        << std::setw(15) << std::sqrt(std::abs(velocity.covariance(idx, 1, 1))) /* rms(u_2) */
+        << std::setw(15) << std::sqrt(std::abs(velocity.covariance(idx, 2, 2))); /* rms(u_3) */
 
-      // <u'v'> = <u*v>
-      f << std::setw(15) << (veluv_glob.at(idx)) / (double)(number_of_samples) << std::endl;
+      // <u'v'>
+      f << std::setw(15) << velocity.covariance(idx, 0, 1) << std::endl;
 
       // clang-format on
     }
@@ -614,6 +554,55 @@ StatisticsManager<dim, Number>::do_write_output(std::string const filename,
   }
 }
 
+template<int dim, typename Number>
+std::string
+StatisticsManager<dim, Number>::get_restart_filename() const
+{
+  return data.directory + data.filename + "_statistics.restart";
+}
+
+template<int dim, typename Number>
+void
+StatisticsManager<dim, Number>::write_restart(
+  MomentAccumulator const & velocity_statistics_global) const
+{
+  std::string const filename = get_restart_filename();
+
+  rename_restart_files(filename);
+
+  std::ostringstream              oss;
+  boost::archive::binary_oarchive oa(oss);
+
+  oa & number_of_samples;
+  velocity_statistics_global.write_restart(oa);
+
+  write_restart_file(oss, filename);
+}
+
+/*
+ *  The restart file contains the global statistics. These are read on the first processor only and
+ *  merged with the data of all other processors once the output is written, which does not require
+ *  the same number of processors or partitioning of the mesh as in the previous simulation.
+ */
+template<int dim, typename Number>
+void
+StatisticsManager<dim, Number>::read_restart()
+{
+  if(dealii::Utilities::MPI::this_mpi_process(mpi_comm) == 0)
+  {
+    std::string const filename = get_restart_filename();
+    std::ifstream     in(filename);
+    AssertThrow(in, dealii::ExcMessage("File " + filename + " does not exist."));
+
+    boost::archive::binary_iarchive ia(in);
+
+    ia & number_of_samples;
+    velocity_statistics.read_restart(ia);
+  }
+
+  number_of_samples = dealii::Utilities::MPI::max(number_of_samples, mpi_comm);
+}
+
 template class StatisticsManager<2, float>;
 template class StatisticsManager<3, float>;
 
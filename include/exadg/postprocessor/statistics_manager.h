@@ -27,6 +27,7 @@
 #include <deal.II/lac/la_parallel_vector.h>
 
 // ExaDG
+#include <exadg/postprocessor/moment_accumulator.h>
 #include <exadg/postprocessor/time_control_statistics.h>
 #include <exadg/utilities/print_functions.h>
 
@@ -123,6 +124,15 @@ private:
   void
   do_write_output(std::string const filename, double const dynamic_viscosity, double const density);
 
+  std::string
+  get_restart_filename() const;
+
+  void
+  write_restart(MomentAccumulator const & velocity_statistics_global) const;
+
+  void
+  read_restart();
+
   dealii::DoFHandler<dim> const & dof_handler;
   dealii::Mapping<dim> const &    mapping;
   MPI_Comm                        mpi_comm;
@@ -130,14 +140,9 @@ private:
   // vector of y-coordinates at which statistical quantities are computed
   std::vector<double> y_glob;
 
-  // mean velocity <u_i>, i=1,...,d (for all y-coordinates)
-  std::vector<std::vector<double>> vel_glob;
-
-  // square velocity <u_i²>, i=1,...,d (for all y-coordinates)
-  std::vector<std::vector<double>> velsq_glob;
-
-  // <u_1*u_2> = <u*v> (for all y-coordinates)
-  std::vector<double> veluv_glob;
+  // process-local moments of the velocity vector (3 components) for all y-coordinates: mean
+  // velocity <u_i> and Reynolds stresses <u_i'u_j'>, averaged over x-z-planes and time
+  MomentAccumulator velocity_statistics;
 
   // number of samples
   int number_of_samples;
@@ -26,7 +26,9 @@
 namespace ExaDG
 {
 TimeControlDataStatistics::TimeControlDataStatistics()
-  : write_preliminary_results_every_nth_time_step(numbers::invalid_timestep)
+  : write_preliminary_results_every_nth_time_step(numbers::invalid_timestep),
+    write_restart(false),
+    read_restart(false)
 {
 }
 
@@ -38,6 +40,10 @@ TimeControlDataStatistics::print(dealii::ConditionalOStream & pcout, bool const
     print_parameter(pcout,
                     "Write preliminary results every nth time step",
                     write_preliminary_results_every_nth_time_step);
+  if(write_restart)
+    print_parameter(pcout, "Write restart", write_restart);
+  if(read_restart)
+    print_parameter(pcout, "Read restart", read_restart);
 }
 
 TimeControlStatistics::TimeControlStatistics() : final_output_written(false)
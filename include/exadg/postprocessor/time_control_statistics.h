@@ -36,6 +36,13 @@ struct TimeControlDataStatistics
 
   types::time_step write_preliminary_results_every_nth_time_step;
 
+  // write the accumulated statistics along with every output in order to continue the averaging
+  // after a restart
+  bool write_restart;
+
+  // initialize the statistics with the data written by a previous simulation
+  bool read_restart;
+
   TimeControlData time_control_data;
 };
 
@@ -0,0 +1,372 @@
+/*  ______________________________________________________________________
+ *
+ *  ExaDG - High-Order Discontinuous Galerkin for the Exa-Scale
+ *
+ *  Copyright (C) 2021 by the ExaDG authors
+ *
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *  ______________________________________________________________________
+ */
+
+// C/C++
+#include <algorithm>
+#include <fstream>
+#include <iomanip>
+#include <limits>
+#include <sstream>
+#include <utility>
+#include <vector>
+
+// deal.II
+#include <deal.II/base/exceptions.h>
+
+#ifdef DEAL_II_WITH_HDF5
+#  include <hdf5.h>
+#endif
+
+// ExaDG
+#include <exadg/postprocessor/write_hdf5.h>
+
+namespace ExaDG
+{
+namespace
+{
+/*
+ * Returns the offset of the local rows and the global number of rows.
+ */
+std::pair<unsigned long long, unsigned long long>
+get_offset_and_global_size(unsigned long long const n_local, MPI_Comm const & mpi_comm)
+{
+  unsigned long long offset = 0;
+  int const ierr =
+    MPI_Exscan(&n_local, &offset, 1, MPI_UNSIGNED_LONG_LONG, MPI_SUM, mpi_comm);
+  AssertThrowMPI(ierr);
+
+  // the result of MPI_Exscan is undefined on rank 0
+  if(dealii::Utilities::MPI::this_mpi_process(mpi_comm) == 0)
+    offset = 0;
+
+  return {offset, dealii::Utilities::MPI::sum(n_local, mpi_comm)};
+}
+
+#ifdef DEAL_II_WITH_HDF5
+void
+check_hdf5_status(herr_t const status)
+{
+  AssertThrow(status >= 0, dealii::ExcMessage("An error occurred in an HDF5 library call."));
+}
+
+/*
+ * Collectively writes a two-dimensional data set with n_columns columns, where each process
+ * contributes the rows stored in data.
+ */
+void
+write_data_set(hid_t const         file,
+               std::string const & name,
+               void const *        data,
+               hsize_t const       n_rows_local,
+               hsize_t const       n_columns,
+               hid_t const         type,
+               unsigned int const  compression_level,
+               MPI_Comm const &    mpi_comm)
+{
+  auto const [offset, n_rows_global] = get_offset_and_global_size(n_rows_local, mpi_comm);
+
+  hsize_t const global_dims[2] = {n_rows_global, n_columns};
+  hid_t const   file_space     = H5Screate_simple(2, global_dims, nullptr);
+
+  hid_t const creation_properties = H5Pcreate(H5P_DATASET_CREATE);
+  if(compression_level > 0 and n_rows_global > 0)
+  {
+    // the deflate filter requires a chunked layout
+    hsize_t const chunk_dims[2] = {std::min<hsize_t>(n_rows_global, 1 << 16), n_columns};
+    check_hdf5_status(H5Pset_chunk(creation_properties, 2, chunk_dims));
+    check_hdf5_status(H5Pset_deflate(creation_properties, compression_level));
+  }
+
+  hid_t const data_set = H5Dcreate2(
+    file, name.c_str(), type, file_space, H5P_DEFAULT, creation_properties, H5P_DEFAULT);
+  AssertThrow(data_set >= 0, dealii::ExcMessage("Could not create HDF5 data set " + name + "."));
+
+  hsize_t const local_dims[2] = {n_rows_local, n_columns};
+  hid_t const   memory_space  = H5Screate_simple(2, local_dims, nullptr);
+
+  if(n_rows_local > 0)
+  {
+    hsize_t const start[2] = {offset, 0};
+    check_hdf5_status(
+      H5Sselect_hyperslab(file_space, H5S_SELECT_SET, start, nullptr, local_dims, nullptr));
+  }
+  else
+  {
+    // processes without data have to participate in the collective write
+    check_hdf5_status(H5Sselect_none(file_space));
+    check_hdf5_status(H5Sselect_none(memory_space));
+  }
+
+  // collective I/O is required for parallel writes to compressed data sets
+  hid_t const transfer_properties = H5Pcreate(H5P_DATASET_XFER);
+  check_hdf5_status(H5Pset_dxpl_mpio(transfer_properties, H5FD_MPIO_COLLECTIVE));
+
+  double const dummy = 0.0;
+  check_hdf5_status(H5Dwrite(data_set,
+                             type,
+                             memory_space,
+                             file_space,
+                             transfer_properties,
+                             data != nullptr ? data : &dummy));
+
+  check_hdf5_status(H5Pclose(transfer_properties));
+  check_hdf5_status(H5Sclose(memory_space));
+  check_hdf5_status(H5Dclose(data_set));
+  check_hdf5_status(H5Pclose(creation_properties));
+  check_hdf5_status(H5Sclose(file_space));
+}
+#endif
+
+/*
+ * Reads the grids of all output steps, together with the time of each output step, from an XDMF
+ * file written by add_to_xdmf_time_series(). Returns an empty vector if the file does not exist.
+ */
+std::vector<std::pair<double, std::string>>
+read_xdmf_time_series(std::string const & xdmf_filename)
+{
+  std::vector<std::pair<double, std::string>> grids;
+
+  std::ifstream xdmf(xdmf_filename);
+  std::string   line;
+  bool          inside_grid = false;
+  while(std::getline(xdmf, line))
+  {
+    if(line.find("<Grid Name=\"mesh\"") != std::string::npos)
+    {
+      grids.emplace_back(0.0, std::string());
+      inside_grid = true;
+    }
+
+    if(inside_grid)
+    {
+      grids.back().second += line + "\n";
+
+      std::string const time_tag = "<Time Value=\"";
+      std::size_t const position = line.find(time_tag);
+      if(position != std::string::npos)
+        grids.back().first = std::stod(line.substr(position + time_tag.size()));
+
+      // the grids of the output steps do not contain further grids
+      if(line.find("</Grid>") != std::string::npos)
+        inside_grid = false;
+    }
+  }
+
+  AssertThrow(not inside_grid,
+              dealii::ExcMessage("The XDMF file " + xdmf_filename + " is incomplete."));
+
+  return grids;
+}
+
+} // namespace
+
+std::string
+get_xdmf_attribute_type(unsigned int const n_components)
+{
+  if(n_components == 1)
+    return "Scalar";
+  else if(n_components == 3)
+    return "Vector";
+  else if(n_components == 6)
+    return "Tensor6";
+  else if(n_components == 9)
+    return "Tensor";
+  else
+    return "Matrix";
+}
+
+void
+write_hdf5_file(dealii::DataOutBase::DataOutFilter const & data_filter,
+                std::string const &                        filename,
+                unsigned int const                         dim,
+                unsigned int const                         spacedim,
+                bool const                                 single_precision,
+                unsigned int const                         compression_level,
+                MPI_Comm const &                           mpi_comm)
+{
+#ifdef DEAL_II_WITH_HDF5
+  AssertThrow(compression_level <= 9,
+              dealii::ExcMessage("The compression level has to be in the range 0-9."));
+
+  hid_t const access_properties = H5Pcreate(H5P_FILE_ACCESS);
+  check_hdf5_status(H5Pset_fapl_mpio(access_properties, mpi_comm, MPI_INFO_NULL));
+
+  hid_t const file = H5Fcreate(filename.c_str(), H5F_ACC_TRUNC, H5P_DEFAULT, access_properties);
+  AssertThrow(file >= 0, dealii::ExcMessage("Could not create file " + filename + "."));
+
+  check_hdf5_status(H5Pclose(access_properties));
+
+  unsigned int const n_nodes = data_filter.n_nodes();
+
+  // node coordinates
+  std::vector<double> node_data;
+  data_filter.fill_node_data(node_data);
+  write_data_set(file,
+                 "nodes",
+                 node_data.data(),
+                 n_nodes,
+                 spacedim,
+                 H5T_NATIVE_DOUBLE,
+                 compression_level,
+                 mpi_comm);
+
+  // connectivity in terms of the global numbering of the nodes
+  unsigned long long const node_offset = get_offset_and_global_size(n_nodes, mpi_comm).first;
+  AssertThrow(node_offset + n_nodes <= std::numeric_limits<unsigned int>::max(),
+              dealii::ExcMessage("The number of nodes exceeds the range of unsigned int."));
+
+  std::vector<unsigned int> cell_data;
+  data_filter.fill_cell_data(node_offset, cell_data);
+  write_data_set(file,
+                 "cells",
+                 cell_data.data(),
+                 data_filter.n_cells(),
+                 1 << dim,
+                 H5T_NATIVE_UINT,
+                 compression_level,
+                 mpi_comm);
+
+  // field data
+  std::vector<float> data_single_precision;
+  for(unsigned int i = 0; i < data_filter.n_data_sets(); ++i)
+  {
+    unsigned int const n_components = data_filter.get_data_set_dim(i);
+    double const *     data         = data_filter.get_data_set_data(i);
+
+    if(single_precision)
+    {
+      data_single_precision.assign(data, data + n_nodes * n_components);
+      write_data_set(file,
+                     data_filter.get_data_set_name(i),
+                     data_single_precision.data(),
+                     n_nodes,
+                     n_components,
+                     H5T_NATIVE_FLOAT,
+                     compression_level,
+                     mpi_comm);
+    }
+    else
+    {
+      write_data_set(file,
+                     data_filter.get_data_set_name(i),
+                     data,
+                     n_nodes,
+                     n_components,
+                     H5T_NATIVE_DOUBLE,
+                     compression_level,
+                     mpi_comm);
+    }
+  }
+
+  check_hdf5_status(H5Fclose(file));
+#else
+  (void)data_filter;
+  (void)filename;
+  (void)dim;
+  (void)spacedim;
+  (void)single_precision;
+  (void)compression_level;
+  (void)mpi_comm;
+
+  AssertThrow(false, dealii::ExcMessage("HDF5 output requires deal.II configured with HDF5."));
+#endif
+}
+
+void
+add_to_xdmf_time_series(dealii::DataOutBase::DataOutFilter const & data_filter,
+                        std::string const &                        xdmf_filename,
+                        std::string const &                        hdf5_filename,
+                        double const                               time,
+                        unsigned int const                         dim,
+                        unsigned int const                         spacedim,
+                        bool const                                 single_precision,
+                        MPI_Comm const &                           mpi_comm)
+{
+  unsigned long long const n_nodes =
+    get_offset_and_global_size(data_filter.n_nodes(), mpi_comm).second;
+  unsigned long long const n_cells =
+    get_offset_and_global_size(data_filter.n_cells(), mpi_comm).second;
+
+  if(dealii::Utilities::MPI::this_mpi_process(mpi_comm) != 0)
+    return;
+
+  std::string const precision = single_precision ? "4" : "8";
+
+  std::ostringstream grid;
+  grid << std::setprecision(std::numeric_limits<double>::max_digits10);
+  grid << "      <Grid Name=\"mesh\" GridType=\"Uniform\">" << std::endl
+       << "        <Time Value=\"" << time << "\"/>" << std::endl
+       << "        <Geometry GeometryType=\"" << (spacedim == 2 ? "XY" : "XYZ") << "\">"
+       << std::endl
+       << "          <DataItem Dimensions=\"" << n_nodes << " " << spacedim
+       << "\" NumberType=\"Float\" Precision=\"8\" Format=\"HDF\">" << hdf5_filename
+       << ":/nodes</DataItem>" << std::endl
+       << "        </Geometry>" << std::endl
+       << "        <Topology TopologyType=\"" << (dim == 2 ? "Quadrilateral" : "Hexahedron")
+       << "\" NumberOfElements=\"" << n_cells << "\">" << std::endl
+       << "          <DataItem Dimensions=\"" << n_cells << " " << (1 << dim)
+       << "\" NumberType=\"UInt\" Precision=\"4\" Format=\"HDF\">" << hdf5_filename
+       << ":/cells</DataItem>" << std::endl
+       << "        </Topology>" << std::endl;
+
+  for(unsigned int i = 0; i < data_filter.n_data_sets(); ++i)
+  {
+    std::string const  name         = data_filter.get_data_set_name(i);
+    unsigned int const n_components = data_filter.get_data_set_dim(i);
+
+    grid << "        <Attribute Name=\"" << name << "\" AttributeType=\""
+         << get_xdmf_attribute_type(n_components) << "\" Center=\"Node\">" << std::endl
+         << "          <DataItem Dimensions=\"" << n_nodes << " " << n_components
+         << "\" NumberType=\"Float\" Precision=\"" << precision << "\" Format=\"HDF\">"
+         << hdf5_filename << ":/" << name << "</DataItem>" << std::endl
+         << "        </Attribute>" << std::endl;
+  }
+
+  grid << "      </Grid>" << std::endl;
+
+  // The XDMF file is rewritten in every output step such that it is valid at any time. The former
+  // output steps are read from the file itself, so that the output steps written before a restart
+  // are retained. Output steps at times not before the current time have been written before a
+  // restart from an earlier state, or by a former simulation, and are replaced.
+  std::vector<std::pair<double, std::string>> grids = read_xdmf_time_series(xdmf_filename);
+  grids.erase(std::remove_if(grids.begin(),
+                             grids.end(),
+                             [&](auto const & entry) { return entry.first >= time; }),
+              grids.end());
+  grids.emplace_back(time, grid.str());
+
+  std::ofstream xdmf(xdmf_filename);
+  xdmf << "<?xml version=\"1.0\" ?>" << std::endl
+       << "<!DOCTYPE Xdmf SYSTEM \"Xdmf.dtd\" []>" << std::endl
+       << "<Xdmf Version=\"2.0\">" << std::endl
+       << "  <Domain>" << std::endl
+       << "    <Grid Name=\"TimeSeries\" GridType=\"Collection\" CollectionType=\"Temporal\">"
+       << std::endl;
+
+  for(auto const & entry : grids)
+    xdmf << entry.second;
+
+  xdmf << "    </Grid>" << std::endl << "  </Domain>" << std::endl << "</Xdmf>" << std::endl;
+
+  AssertThrow(xdmf, dealii::ExcMessage("Could not write file " + xdmf_filename + "."));
+}
+
+} // namespace ExaDG
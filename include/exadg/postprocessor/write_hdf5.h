@@ -0,0 +1,120 @@
+/*  ______________________________________________________________________
+ *
+ *  ExaDG - High-Order Discontinuous Galerkin for the Exa-Scale
+ *
+ *  Copyright (C) 2021 by the ExaDG authors
+ *
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *  ______________________________________________________________________
+ */
+
+#ifndef INCLUDE_EXADG_POSTPROCESSOR_WRITE_HDF5_H_
+#define INCLUDE_EXADG_POSTPROCESSOR_WRITE_HDF5_H_
+
+// C/C++
+#include <string>
+
+// deal.II
+#include <deal.II/base/data_out_base.h>
+#include <deal.II/base/mpi.h>
+
+// ExaDG
+#include <exadg/postprocessor/output_data_base.h>
+
+namespace ExaDG
+{
+/*
+ * Writes the data of a DataOutFilter collectively into a single HDF5 file, containing the data
+ * sets "nodes", "cells", and one data set per output quantity. The field data is optionally
+ * stored in single precision and compressed with the deflate filter. The node coordinates are
+ * always stored in double precision.
+ */
+void
+write_hdf5_file(dealii::DataOutBase::DataOutFilter const & data_filter,
+                std::string const &                        filename,
+                unsigned int const                         dim,
+                unsigned int const                         spacedim,
+                bool const                                 single_precision,
+                unsigned int const                         compression_level,
+                MPI_Comm const &                           mpi_comm);
+
+/*
+ * Returns the XDMF attribute type of a data set with n_components components per node.
+ */
+std::string
+get_xdmf_attribute_type(unsigned int const n_components);
+
+/*
+ * Adds the HDF5 file of one output step to the XDMF file describing the time series, which can be
+ * opened in ParaView. The XDMF file is written by rank 0. The former output steps are read from
+ * the existing XDMF file, such that the time series is continued after a restart. Output steps of
+ * the existing file at times later than or equal to the given time are discarded.
+ */
+void
+add_to_xdmf_time_series(dealii::DataOutBase::DataOutFilter const & data_filter,
+                        std::string const &                        xdmf_filename,
+                        std::string const &                        hdf5_filename,
+                        double const                               time,
+                        unsigned int const                         dim,
+                        unsigned int const                         spacedim,
+                        bool const                                 single_precision,
+                        MPI_Comm const &                           mpi_comm);
+
+/*
+ * Writes the patches of data_out in HDF5 format (one file per output step) together with an XDMF
+ * descriptor. In contrast to the vtu output, the number of files is independent of the number of
+ * processes. Higher order output is not supported by XDMF, i.e., the cells are subdivided
+ * according to the degree used to build the patches.
+ */
+template<int dim, int spacedim>
+void
+write_hdf5_files(dealii::DataOutInterface<dim, spacedim> const & data_out,
+                 OutputDataBase const &                          output_data,
+                 unsigned int const                              counter,
+                 double const                                    time,
+                 MPI_Comm const &                                mpi_comm)
+{
+  AssertThrow(dim == 2 or dim == 3,
+              dealii::ExcMessage("HDF5 output is only implemented for dim = 2 and dim = 3."));
+
+  // duplicate vertices are not filtered since the data is discontinuous in general
+  dealii::DataOutBase::DataOutFilter data_filter(
+    dealii::DataOutBase::DataOutFilterFlags(false /* filter_duplicate_vertices */,
+                                            true /* xdmf_hdf5_output */));
+  data_out.write_filtered_data(data_filter);
+
+  std::string const hdf5_filename =
+    output_data.filename + "_" + dealii::Utilities::int_to_string(counter, 4) + ".h5";
+
+  write_hdf5_file(data_filter,
+                  output_data.directory + hdf5_filename,
+                  dim,
+                  spacedim,
+                  output_data.hdf5_single_precision,
+                  output_data.hdf5_compression_level,
+                  mpi_comm);
+
+  add_to_xdmf_time_series(data_filter,
+                          output_data.directory + output_data.filename + ".xdmf",
+                          hdf5_filename,
+                          time,
+                          dim,
+                          spacedim,
+                          output_data.hdf5_single_precision,
+                          mpi_comm);
+}
+
+} // namespace ExaDG
+
+#endif /* INCLUDE_EXADG_POSTPROCESSOR_WRITE_HDF5_H_ */
@@ -24,14 +24,102 @@
 
 // C/C++
 #include <fstream>
+#include <sstream>
 
 // deal.II
 #include <deal.II/grid/grid_out.h>
 #include <deal.II/numerics/data_out.h>
 #include <deal.II/numerics/data_out_faces.h>
 
+// ExaDG
+#include <exadg/postprocessor/asynchronous_file_writer.h>
+#include <exadg/postprocessor/output_data_base.h>
+#include <exadg/postprocessor/write_hdf5.h>
+
 namespace ExaDG
 {
+/*
+ * Writes the patches of data_out to one vtu file per process and a pvtu record, analogously to
+ * dealii::DataOutInterface::write_vtu_with_pvtu_record(). If requested, the files are serialized
+ * into memory and written to the file system in a background thread.
+ */
+template<int dim, int spacedim>
+void
+write_vtu_files(dealii::DataOutInterface<dim, spacedim> const & data_out,
+                OutputDataBase const &                          output_data,
+                unsigned int const                              counter,
+                MPI_Comm const &                                mpi_comm)
+{
+  unsigned int const n_digits_counter = 4;
+
+  if(not output_data.write_asynchronously)
+  {
+    data_out.write_vtu_with_pvtu_record(
+      output_data.directory, output_data.filename, counter, mpi_comm, n_digits_counter);
+
+    return;
+  }
+
+  unsigned int const rank    = dealii::Utilities::MPI::this_mpi_process(mpi_comm);
+  unsigned int const n_ranks = dealii::Utilities::MPI::n_mpi_processes(mpi_comm);
+
+  // same file names as dealii::DataOutInterface::write_vtu_with_pvtu_record()
+  unsigned int const n_digits_rank = dealii::Utilities::needed_digits(n_ranks - 1);
+
+  std::string const basename =
+    output_data.filename + "_" + dealii::Utilities::int_to_string(counter, n_digits_counter);
+
+  auto const piece_name = [&](unsigned int const i) {
+    return basename + "." + dealii::Utilities::int_to_string(i, n_digits_rank) + ".vtu";
+  };
+
+  AsynchronousFileWriter & writer = AsynchronousFileWriter::get_instance();
+
+  std::ostringstream vtu;
+  data_out.write_vtu(vtu);
+  writer.write(output_data.directory + piece_name(rank),
+               vtu.str(),
+               output_data.max_pending_files);
+
+  if(rank == 0)
+  {
+    std::vector<std::string> piece_names;
+    for(unsigned int i = 0; i < n_ranks; ++i)
+      piece_names.push_back(piece_name(i));
+
+    std::ostringstream pvtu;
+    data_out.write_pvtu_record(pvtu, piece_names);
+    writer.write(output_data.directory + basename + ".pvtu",
+                 pvtu.str(),
+                 output_data.max_pending_files);
+  }
+}
+
+/*
+ * Writes the patches of data_out in the file format specified in output_data.
+ */
+template<int dim, int spacedim>
+void
+write_patches(dealii::DataOutInterface<dim, spacedim> const & data_out,
+              OutputDataBase const &                          output_data,
+              unsigned int const                              counter,
+              double const                                    time,
+              MPI_Comm const &                                mpi_comm)
+{
+  if(output_data.output_format == OutputFormat::HDF5)
+  {
+    AssertThrow(not output_data.write_asynchronously,
+                dealii::ExcMessage("HDF5 output is written collectively and can not be combined "
+                                   "with write_asynchronously = true."));
+
+    write_hdf5_files(data_out, output_data, counter, time, mpi_comm);
+  }
+  else
+  {
+    write_vtu_files(data_out, output_data, counter, mpi_comm);
+  }
+}
+
 template<int dim>
 void
 write_surface_mesh(dealii::Triangulation<dim> const & triangulation,
@@ -0,0 +1,481 @@
+/*  ______________________________________________________________________
+ *
+ *  ExaDG - High-Order Discontinuous Galerkin for the Exa-Scale
+ *
+ *  Copyright (C) 2021 by the ExaDG authors
+ *
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *  ______________________________________________________________________
+ */
+
+// C/C++
+#include <algorithm>
+#include <cmath>
+
+// deal.II
+#include <deal.II/base/mpi.h>
+#include <deal.II/lac/solver_cg.h>
+
+// ExaDG
+#include <exadg/solvers_and_preconditioners/amg/smoothed_aggregation_amg.h>
+#include <exadg/solvers_and_preconditioners/preconditioners/jacobi_preconditioner.h>
+#include <exadg/solvers_and_preconditioners/utilities/compute_eigenvalues.h>
+#include <exadg/utilities/print_functions.h>
+
+namespace ExaDG
+{
+namespace
+{
+typedef SparseMatrixCSR::size_type size_type;
+typedef SparseMatrixCSR::Row       Row;
+
+/*
+ * Returns the first global index of the locally owned range given the number of locally owned
+ * indices, where the ranges are numbered in the order of the MPI ranks.
+ */
+size_type
+compute_global_offset(unsigned int const n_locally_owned, MPI_Comm const & mpi_comm)
+{
+  std::vector<size_type> const sizes =
+    dealii::Utilities::MPI::all_gather(mpi_comm, static_cast<size_type>(n_locally_owned));
+
+  size_type offset = 0;
+  for(unsigned int p = 0; p < dealii::Utilities::MPI::this_mpi_process(mpi_comm); ++p)
+    offset += sizes[p];
+
+  return offset;
+}
+
+/*
+ * Returns the global row indices of all columns of the matrix that are not locally owned.
+ */
+std::vector<size_type>
+get_ghost_columns(SparseMatrixCSR const & matrix)
+{
+  std::vector<size_type> ghost_columns;
+  for(unsigned int i = 0; i < matrix.local_size(); ++i)
+    for(unsigned int k = 0; k < matrix.row_length(i); ++k)
+      if(not matrix.get_locally_owned_columns().is_element(matrix.row_columns(i)[k]))
+        ghost_columns.push_back(matrix.row_columns(i)[k]);
+
+  std::sort(ghost_columns.begin(), ghost_columns.end());
+  ghost_columns.erase(std::unique(ghost_columns.begin(), ghost_columns.end()), ghost_columns.end());
+
+  return ghost_columns;
+}
+
+} // namespace
+
+SmoothedAggregationAMG::SmoothedAggregationAMG()
+{
+}
+
+void
+SmoothedAggregationAMG::initialize(SparseMatrixCSR const & matrix, NativeAMGData const & data_in)
+{
+  AssertThrow(matrix.m() == matrix.n(),
+              dealii::ExcMessage("Algebraic multigrid requires a square matrix."));
+
+  data = data_in;
+
+  levels.clear();
+  levels.push_back(std::make_shared<Level>());
+  levels.back()->matrix = &matrix;
+
+  for(bool coarsest_level = false; not coarsest_level;)
+  {
+    Level & level = *levels.back();
+
+    coarsest_level = level.matrix->m() <= data.coarse_size || levels.size() >= data.max_levels;
+
+    std::shared_ptr<Level> coarse_level;
+    if(not coarsest_level)
+    {
+      coarse_level   = std::make_shared<Level>();
+      coarsest_level = not build_coarse_level(level, *coarse_level);
+    }
+
+    initialize_smoother(level, coarsest_level);
+
+    if(not coarsest_level)
+      levels.push_back(coarse_level);
+  }
+}
+
+void
+SmoothedAggregationAMG::vmult(VectorType & dst, VectorType const & src) const
+{
+  Level const & fine_level = *levels[0];
+
+  fine_level.rhs.copy_locally_owned_data_from(src);
+
+  for(unsigned int cycle = 0; cycle < data.n_cycles; ++cycle)
+    v_cycle(0, cycle == 0);
+
+  dst.copy_locally_owned_data_from(fine_level.solution);
+}
+
+unsigned int
+SmoothedAggregationAMG::n_levels() const
+{
+  return levels.size();
+}
+
+double
+SmoothedAggregationAMG::get_operator_complexity() const
+{
+  double n_nonzeros = 0.0;
+  for(auto const & level : levels)
+    n_nonzeros += level->matrix->n_nonzero_elements();
+
+  return n_nonzeros / levels[0]->matrix->n_nonzero_elements();
+}
+
+void
+SmoothedAggregationAMG::print_hierarchy(dealii::ConditionalOStream const & pcout) const
+{
+  pcout << std::endl << "Algebraic multigrid hierarchy (smoothed aggregation):" << std::endl;
+
+  for(unsigned int l = 0; l < levels.size(); ++l)
+    print_parameter(pcout,
+                    "Level " + std::to_string(l) + " (rows / nonzeros)",
+                    std::to_string(levels[l]->matrix->m()) + " / " +
+                      std::to_string(levels[l]->matrix->n_nonzero_elements()));
+
+  print_parameter(pcout, "Operator complexity", get_operator_complexity());
+}
+
+std::pair<std::vector<unsigned int>, unsigned int>
+SmoothedAggregationAMG::compute_aggregates(SparseMatrixCSR const & matrix) const
+{
+  unsigned int const n_rows = matrix.local_size();
+
+  dealii::IndexSet const & owned_rows = matrix.get_locally_owned_rows();
+  size_type const          row_begin  = n_rows > 0 ? owned_rows.nth_index_in_set(0) : 0;
+
+  std::vector<unsigned int> const & components     = matrix.get_row_components();
+  bool const                        use_components = n_rows > 0 && components.size() == n_rows;
+
+  std::vector<double> diagonal(n_rows);
+  for(unsigned int i = 0; i < n_rows; ++i)
+    diagonal[i] = std::abs(matrix.diag_element(i));
+
+  // strong connections among the locally owned rows (uncoupled aggregation), stored together with
+  // the strength of the connection
+  std::vector<std::vector<std::pair<unsigned int, double>>> strong_neighbors(n_rows);
+  for(unsigned int i = 0; i < n_rows; ++i)
+  {
+    for(unsigned int k = 0; k < matrix.row_length(i); ++k)
+    {
+      size_type const col = matrix.row_columns(i)[k];
+      if(not owned_rows.is_element(col))
+        continue;
+
+      unsigned int const j = col - row_begin;
+      if(j == i || (use_components && components[i] != components[j]))
+        continue;
+
+      double const scaling = std::sqrt(diagonal[i] * diagonal[j]);
+      if(scaling == 0.0)
+        continue;
+
+      double const strength = std::abs(matrix.row_values(i)[k]) / scaling;
+      if(strength >= data.strong_threshold)
+        strong_neighbors[i].push_back(std::make_pair(j, strength));
+    }
+  }
+
+  unsigned int const        unassigned = dealii::numbers::invalid_unsigned_int;
+  std::vector<unsigned int> aggregates(n_rows, unassigned);
+  unsigned int              n_aggregates = 0;
+
+  // phase 1: form aggregates from root nodes whose strong neighborhood is not yet aggregated
+  for(unsigned int i = 0; i < n_rows; ++i)
+  {
+    if(aggregates[i] != unassigned || strong_neighbors[i].empty())
+      continue;
+
+    bool neighborhood_is_free = true;
+    for(auto const & neighbor : strong_neighbors[i])
+      if(aggregates[neighbor.first] != unassigned)
+        neighborhood_is_free = false;
+
+    if(neighborhood_is_free)
+    {
+      aggregates[i] = n_aggregates;
+      for(auto const & neighbor : strong_neighbors[i])
+        aggregates[neighbor.first] = n_aggregates;
+      ++n_aggregates;
+    }
+  }
+
+  // phase 2: attach remaining nodes to the aggregate of the most strongly connected neighbor that
+  // has been aggregated in phase 1
+  std::vector<unsigned int> const aggregates_phase_1 = aggregates;
+  for(unsigned int i = 0; i < n_rows; ++i)
+  {
+    if(aggregates[i] != unassigned)
+      continue;
+
+    double max_strength = 0.0;
+    for(auto const & neighbor : strong_neighbors[i])
+    {
+      if(aggregates_phase_1[neighbor.first] != unassigned && neighbor.second > max_strength)
+      {
+        aggregates[i] = aggregates_phase_1[neighbor.first];
+        max_strength  = neighbor.second;
+      }
+    }
+  }
+
+  // phase 3: remaining nodes form new aggregates with their unassigned strong neighbors
+  for(unsigned int i = 0; i < n_rows; ++i)
+  {
+    if(aggregates[i] != unassigned)
+      continue;
+
+    aggregates[i] = n_aggregates;
+    for(auto const & neighbor : strong_neighbors[i])
+      if(aggregates[neighbor.first] == unassigned)
+        aggregates[neighbor.first] = n_aggregates;
+    ++n_aggregates;
+  }
+
+  return std::make_pair(aggregates, n_aggregates);
+}
+
+bool
+SmoothedAggregationAMG::build_coarse_level(Level & level, Level & coarse_level) const
+{
+  SparseMatrixCSR const & matrix   = *level.matrix;
+  MPI_Comm const &        mpi_comm = matrix.get_mpi_communicator();
+
+  unsigned int const       n_rows     = matrix.local_size();
+  dealii::IndexSet const & owned_rows = matrix.get_locally_owned_rows();
+  size_type const          row_begin  = n_rows > 0 ? owned_rows.nth_index_in_set(0) : 0;
+
+  auto const                        aggregation  = compute_aggregates(matrix);
+  std::vector<unsigned int> const & aggregates   = aggregation.first;
+  unsigned int const                n_aggregates = aggregation.second;
+
+  size_type const n_coarse_rows =
+    dealii::Utilities::MPI::sum(static_cast<size_type>(n_aggregates), mpi_comm);
+
+  if(n_coarse_rows == 0 || n_coarse_rows >= matrix.m())
+    return false;
+
+  size_type const  coarse_begin = compute_global_offset(n_aggregates, mpi_comm);
+  dealii::IndexSet owned_coarse_rows(n_coarse_rows);
+  owned_coarse_rows.add_range(coarse_begin, coarse_begin + n_aggregates);
+
+  // tentative prolongator interpolating constants, normalized to columns of unit norm
+  std::vector<unsigned int> aggregate_sizes(n_aggregates, 0);
+  for(unsigned int i = 0; i < n_rows; ++i)
+    ++aggregate_sizes[aggregates[i]];
+
+  std::vector<Row> rows_tentative(n_rows);
+  for(unsigned int i = 0; i < n_rows; ++i)
+    rows_tentative[i][coarse_begin + aggregates[i]] =
+      1.0 / std::sqrt(aggregate_sizes[aggregates[i]]);
+
+  SparseMatrixCSR tentative_prolongation;
+  tentative_prolongation.reinit(
+    owned_rows, owned_coarse_rows, rows_tentative, std::map<size_type, Row>(), mpi_comm);
+
+  std::vector<size_type> const   ghost_columns = get_ghost_columns(matrix);
+  std::map<size_type, Row> const ghost_rows_tentative =
+    tentative_prolongation.get_remote_rows(ghost_columns);
+
+  // damping of the prolongator smoothing based on a Gershgorin estimate of lambda_max(D^{-1} A)
+  double lambda_max = 0.0;
+  for(unsigned int i = 0; i < n_rows; ++i)
+  {
+    double const diagonal = std::abs(matrix.diag_element(i));
+    if(diagonal == 0.0)
+      continue;
+
+    double row_sum = 0.0;
+    for(unsigned int k = 0; k < matrix.row_length(i); ++k)
+      row_sum += std::abs(matrix.row_values(i)[k]);
+    lambda_max = std::max(lambda_max, row_sum / diagonal);
+  }
+  lambda_max = dealii::Utilities::MPI::max(lambda_max, mpi_comm);
+
+  double const omega = lambda_max > 0.0 ? data.prolongator_damping / lambda_max : 0.0;
+
+  // smoothed prolongator P = (I - omega D^{-1} A) P_tent
+  std::vector<Row> rows_prolongation(rows_tentative);
+  for(unsigned int i = 0; i < n_rows; ++i)
+  {
+    double const diagonal = matrix.diag_element(i);
+    if(diagonal == 0.0)
+      continue;
+
+    double const factor = omega / diagonal;
+    for(unsigned int k = 0; k < matrix.row_length(i); ++k)
+    {
+      size_type const col = matrix.row_columns(i)[k];
+
+      Row const & row_tentative = owned_rows.is_element(col) ?
+                                    rows_tentative[col - row_begin] :
+                                    ghost_rows_tentative.at(col);
+
+      for(auto const & entry : row_tentative)
+        rows_prolongation[i][entry.first] -= factor * matrix.row_values(i)[k] * entry.second;
+    }
+  }
+
+  level.prolongation.reinit(
+    owned_rows, owned_coarse_rows, rows_prolongation, std::map<size_type, Row>(), mpi_comm);
+
+  // restriction R = P^T
+  std::vector<Row>         rows_restriction(n_aggregates);
+  std::map<size_type, Row> nonlocal_rows_restriction;
+  for(unsigned int i = 0; i < n_rows; ++i)
+  {
+    for(auto const & entry : rows_prolongation[i])
+    {
+      Row & row = owned_coarse_rows.is_element(entry.first) ?
+                    rows_restriction[entry.first - coarse_begin] :
+                    nonlocal_rows_restriction[entry.first];
+      row[row_begin + i] += entry.second;
+    }
+  }
+
+  level.restriction.reinit(
+    owned_coarse_rows, owned_rows, rows_restriction, nonlocal_rows_restriction, mpi_comm);
+
+  // Galerkin product A_c = P^T (A P), computed row by row of the fine level
+  std::map<size_type, Row> const ghost_rows_prolongation =
+    level.prolongation.get_remote_rows(ghost_columns);
+
+  std::vector<Row>         rows_coarse(n_aggregates);
+  std::map<size_type, Row> nonlocal_rows_coarse;
+  for(unsigned int i = 0; i < n_rows; ++i)
+  {
+    Row row_AP;
+    for(unsigned int k = 0; k < matrix.row_length(i); ++k)
+    {
+      size_type const col = matrix.row_columns(i)[k];
+
+      Row const & row_prolongation = owned_rows.is_element(col) ?
+                                       rows_prolongation[col - row_begin] :
+                                       ghost_rows_prolongation.at(col);
+
+      for(auto const & entry : row_prolongation)
+        row_AP[entry.first] += matrix.row_values(i)[k] * entry.second;
+    }
+
+    for(auto const & entry_P : rows_prolongation[i])
+    {
+      Row & row = owned_coarse_rows.is_element(entry_P.first) ?
+                    rows_coarse[entry_P.first - coarse_begin] :
+                    nonlocal_rows_coarse[entry_P.first];
+
+      for(auto const & entry_AP : row_AP)
+        row[entry_AP.first] += entry_P.second * entry_AP.second;
+    }
+  }
+
+  coarse_level.coarse_matrix.reinit(
+    owned_coarse_rows, owned_coarse_rows, rows_coarse, nonlocal_rows_coarse, mpi_comm);
+  coarse_level.matrix = &coarse_level.coarse_matrix;
+
+  // coarse unknowns inherit the vector component of their aggregate
+  std::vector<unsigned int> const & components = matrix.get_row_components();
+  if(n_rows > 0 && components.size() == n_rows)
+  {
+    std::vector<unsigned int> coarse_components(n_aggregates, 0);
+    for(unsigned int i = 0; i < n_rows; ++i)
+      coarse_components[aggregates[i]] = components[i];
+
+    coarse_level.coarse_matrix.set_row_components(coarse_components);
+  }
+
+  return true;
+}
+
+void
+SmoothedAggregationAMG::initialize_smoother(Level & level, bool const coarsest_level) const
+{
+  SparseMatrixCSR const & matrix = *level.matrix;
+
+  std::shared_ptr<Preconditioner> preconditioner = std::make_shared<Preconditioner>();
+  VectorType &                    inverse_diagonal = preconditioner->get_vector();
+  matrix.calculate_inverse_diagonal(inverse_diagonal);
+
+  Smoother::AdditionalData smoother_data;
+  smoother_data.preconditioner = preconditioner;
+
+  if(coarsest_level)
+  {
+    // estimate the extremal eigenvalues by a Jacobi-preconditioned CG iteration to cover the whole
+    // spectrum by the Chebyshev iteration
+    std::pair<double, double> const eigenvalues =
+      compute_eigenvalues(matrix, inverse_diagonal, false /* operator_is_singular */, 1000);
+
+    double const min_eigenvalue = eigenvalues.first;
+    double const max_eigenvalue = eigenvalues.second;
+
+    double const factor = 1.1;
+
+    smoother_data.degree              = data.coarse_smoother_degree;
+    smoother_data.max_eigenvalue      = factor * max_eigenvalue;
+    smoother_data.smoothing_range     = factor * max_eigenvalue / std::max(min_eigenvalue, 1e-12);
+    smoother_data.eig_cg_n_iterations = 0;
+  }
+  else
+  {
+    smoother_data.degree              = data.smoother_degree;
+    smoother_data.smoothing_range     = data.smoothing_range;
+    smoother_data.eig_cg_n_iterations = data.eig_cg_n_iterations;
+  }
+
+  level.smoother.initialize(matrix, smoother_data);
+
+  matrix.initialize_dof_vector(level.solution);
+  matrix.initialize_dof_vector(level.rhs);
+  matrix.initialize_dof_vector(level.residual);
+}
+
+void
+SmoothedAggregationAMG::v_cycle(unsigned int const l, bool const zero_initial_guess) const
+{
+  Level const & level = *levels[l];
+
+  // pre-smoothing, or approximate solution on the coarsest level
+  if(zero_initial_guess)
+    level.smoother.vmult(level.solution, level.rhs);
+  else
+    level.smoother.step(level.solution, level.rhs);
+
+  if(l == levels.size() - 1)
+    return;
+
+  Level const & coarse_level = *levels[l + 1];
+
+  // restriction of the residual
+  level.matrix->residual(level.residual, level.solution, level.rhs);
+  level.restriction.vmult(coarse_level.rhs, level.residual);
+
+  // coarse-grid correction
+  v_cycle(l + 1, true);
+  level.prolongation.vmult(level.residual, coarse_level.solution);
+  level.solution += level.residual;
+
+  // post-smoothing
+  level.smoother.step(level.solution, level.rhs);
+}
+
+} // namespace ExaDG
@@ -0,0 +1,138 @@
+/*  ______________________________________________________________________
+ *
+ *  ExaDG - High-Order Discontinuous Galerkin for the Exa-Scale
+ *
+ *  Copyright (C) 2021 by the ExaDG authors
+ *
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *  ______________________________________________________________________
+ */
+
+#ifndef INCLUDE_EXADG_SOLVERS_AND_PRECONDITIONERS_AMG_SMOOTHED_AGGREGATION_AMG_H_
+#define INCLUDE_EXADG_SOLVERS_AND_PRECONDITIONERS_AMG_SMOOTHED_AGGREGATION_AMG_H_
+
+// C/C++
+#include <memory>
+#include <vector>
+
+// deal.II
+#include <deal.II/base/conditional_ostream.h>
+#include <deal.II/lac/diagonal_matrix.h>
+#include <deal.II/lac/precondition.h>
+
+// ExaDG
+#include <exadg/solvers_and_preconditioners/amg/sparse_matrix_csr.h>
+#include <exadg/solvers_and_preconditioners/multigrid/multigrid_parameters.h>
+
+namespace ExaDG
+{
+/*
+ * Algebraic multigrid method based on smoothed aggregation that operates on SparseMatrixCSR and
+ * hence does not depend on Trilinos or PETSc.
+ *
+ * Setup: Unknowns are grouped into aggregates of strongly connected unknowns of the same vector
+ * component. Aggregation is done independently on every process (uncoupled aggregation), so that
+ * all coarse unknowns of an aggregate are owned by the process owning the fine unknowns. The
+ * tentative prolongator interpolates constants (per component) and is smoothed by one damped
+ * Jacobi step, P = (I - omega D^{-1} A) P_tent. Coarse matrices are computed by the Galerkin
+ * product A_c = P^T A P.
+ *
+ * Solution: V-cycle with Chebyshev smoothing (point-Jacobi preconditioned) on all levels. The
+ * coarsest level is solved approximately by a Chebyshev iteration of high degree.
+ */
+class SmoothedAggregationAMG : public dealii::Subscriptor
+{
+public:
+  typedef dealii::LinearAlgebra::distributed::Vector<double> VectorType;
+
+  SmoothedAggregationAMG();
+
+  /*
+   * Builds the multigrid hierarchy. The matrix has to remain valid as long as this object is used.
+   */
+  void
+  initialize(SparseMatrixCSR const & matrix, NativeAMGData const & data);
+
+  /*
+   * Applies data.n_cycles V-cycles with zero initial guess.
+   */
+  void
+  vmult(VectorType & dst, VectorType const & src) const;
+
+  unsigned int
+  n_levels() const;
+
+  /*
+   * Sum of the number of nonzeros of all levels divided by the number of nonzeros of the
+   * fine-level matrix.
+   */
+  double
+  get_operator_complexity() const;
+
+  void
+  print_hierarchy(dealii::ConditionalOStream const & pcout) const;
+
+private:
+  typedef dealii::DiagonalMatrix<VectorType>                                         Preconditioner;
+  typedef dealii::PreconditionChebyshev<SparseMatrixCSR, VectorType, Preconditioner> Smoother;
+
+  struct Level
+  {
+    Level() : matrix(nullptr)
+    {
+    }
+
+    SparseMatrixCSR const * matrix;
+
+    // matrix of coarse levels (the fine-level matrix is owned by the caller)
+    SparseMatrixCSR coarse_matrix;
+
+    // transfer between this level and the next coarser level
+    SparseMatrixCSR prolongation;
+    SparseMatrixCSR restriction;
+
+    Smoother smoother;
+
+    mutable VectorType solution, rhs, residual;
+  };
+
+  /*
+   * Groups the locally owned rows of the matrix into aggregates. Returns the local index of the
+   * aggregate of every locally owned row and the number of aggregates.
+   */
+  std::pair<std::vector<unsigned int>, unsigned int>
+  compute_aggregates(SparseMatrixCSR const & matrix) const;
+
+  /*
+   * Computes the smoothed prolongator and the restriction of level as well as the matrix of the
+   * coarse level. Returns false if the coarsening is not effective, i.e., if level is the coarsest
+   * level.
+   */
+  bool
+  build_coarse_level(Level & level, Level & coarse_level) const;
+
+  void
+  initialize_smoother(Level & level, bool const coarsest_level) const;
+
+  void
+  v_cycle(unsigned int const level, bool const zero_initial_guess) const;
+
+  NativeAMGData data;
+
+  std::vector<std::shared_ptr<Level>> levels;
+};
+
+} // namespace ExaDG
+
+#endif /* INCLUDE_EXADG_SOLVERS_AND_PRECONDITIONERS_AMG_SMOOTHED_AGGREGATION_AMG_H_ */
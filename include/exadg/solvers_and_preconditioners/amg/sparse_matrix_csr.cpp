@@ -0,0 +1,634 @@
+/*  ______________________________________________________________________
+ *
+ *  ExaDG - High-Order Discontinuous Galerkin for the Exa-Scale
+ *
+ *  Copyright (C) 2021 by the ExaDG authors
+ *
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *  ______________________________________________________________________
+ */
+
+// C/C++
+#include <algorithm>
+
+// deal.II
+#include <deal.II/base/mpi.h>
+
+// ExaDG
+#include <exadg/solvers_and_preconditioners/amg/sparse_matrix_csr.h>
+
+namespace ExaDG
+{
+namespace
+{
+typedef std::vector<std::pair<unsigned int, std::vector<double>>> Messages;
+
+int const tag_compress      = 4101;
+int const tag_request_rows  = 4102;
+int const tag_send_rows     = 4103;
+int const tag_nonlocal_rows = 4104;
+
+/*
+ * Point-to-point exchange of buffers of variable length. The destinations have to be different
+ * from the own rank. Returns the received buffers together with the rank of the sender.
+ */
+Messages
+exchange_messages(std::map<unsigned int, std::vector<double>> const & send_buffers,
+                  MPI_Comm const &                                    mpi_comm,
+                  int const                                           tag)
+{
+  std::vector<unsigned int> destinations;
+  for(auto const & buffer : send_buffers)
+    destinations.push_back(buffer.first);
+
+  std::vector<unsigned int> const sources =
+    dealii::Utilities::MPI::compute_point_to_point_communication_pattern(mpi_comm, destinations);
+
+  std::vector<MPI_Request> requests(send_buffers.size());
+  unsigned int             counter = 0;
+  for(auto const & buffer : send_buffers)
+  {
+    int const ierr = MPI_Isend(buffer.second.data(),
+                               buffer.second.size(),
+                               MPI_DOUBLE,
+                               buffer.first,
+                               tag,
+                               mpi_comm,
+                               &requests[counter++]);
+    AssertThrowMPI(ierr);
+  }
+
+  // Receiving from the known sources (instead of MPI_ANY_SOURCE) guarantees, due to the
+  // non-overtaking rule of MPI, that messages of subsequent exchanges with the same tag are not
+  // mixed up.
+  Messages received(sources.size());
+  for(unsigned int i = 0; i < sources.size(); ++i)
+  {
+    auto & message = received[i];
+
+    MPI_Status status;
+    int        ierr = MPI_Probe(sources[i], tag, mpi_comm, &status);
+    AssertThrowMPI(ierr);
+
+    int count = 0;
+    ierr      = MPI_Get_count(&status, MPI_DOUBLE, &count);
+    AssertThrowMPI(ierr);
+
+    message.first = sources[i];
+    message.second.resize(count);
+    ierr = MPI_Recv(message.second.data(),
+                    count,
+                    MPI_DOUBLE,
+                    sources[i],
+                    tag,
+                    mpi_comm,
+                    MPI_STATUS_IGNORE);
+    AssertThrowMPI(ierr);
+  }
+
+  int const ierr = MPI_Waitall(requests.size(), requests.data(), MPI_STATUSES_IGNORE);
+  AssertThrowMPI(ierr);
+
+  return received;
+}
+
+/*
+ * Rows are serialized as [row, n_entries, col_0, val_0, col_1, val_1, ...]. Global indices are
+ * represented exactly in double precision up to 2^53.
+ */
+void
+pack_row(std::vector<double> &            buffer,
+         SparseMatrixCSR::size_type const row,
+         SparseMatrixCSR::Row const &     entries)
+{
+  buffer.push_back(row);
+  buffer.push_back(entries.size());
+  for(auto const & entry : entries)
+  {
+    buffer.push_back(entry.first);
+    buffer.push_back(entry.second);
+  }
+}
+
+template<typename Function>
+void
+unpack_rows(std::vector<double> const & buffer, Function const & function)
+{
+  unsigned int position = 0;
+  while(position < buffer.size())
+  {
+    SparseMatrixCSR::size_type const row       = buffer[position++];
+    unsigned int const               n_entries = buffer[position++];
+    for(unsigned int i = 0; i < n_entries; ++i, position += 2)
+    {
+      SparseMatrixCSR::size_type const col = buffer[position];
+      function(row, col, buffer[position + 1]);
+    }
+  }
+}
+
+} // namespace
+
+SparseMatrixCSR::SparseMatrixCSR() : mpi_comm(MPI_COMM_SELF), row_begin(0)
+{
+}
+
+void
+SparseMatrixCSR::reinit(dealii::IndexSet const &               locally_owned_rows_in,
+                        dealii::IndexSet const &               locally_owned_columns_in,
+                        dealii::DynamicSparsityPattern const & dsp,
+                        MPI_Comm const &                       mpi_comm_in)
+{
+  std::vector<Row> local_rows(locally_owned_rows_in.n_elements());
+  for(unsigned int i = 0; i < local_rows.size(); ++i)
+  {
+    size_type const row = locally_owned_rows_in.nth_index_in_set(i);
+    for(auto entry = dsp.begin(row); entry != dsp.end(row); ++entry)
+      local_rows[i][entry->column()] = 0.0;
+  }
+
+  reinit(locally_owned_rows_in,
+         locally_owned_columns_in,
+         local_rows,
+         std::map<size_type, Row>(),
+         mpi_comm_in);
+}
+
+void
+SparseMatrixCSR::reinit(dealii::IndexSet const &         locally_owned_rows_in,
+                        dealii::IndexSet const &         locally_owned_columns_in,
+                        std::vector<Row> const &         local_rows,
+                        std::map<size_type, Row> const & nonlocal_rows,
+                        MPI_Comm const &                 mpi_comm_in)
+{
+  AssertThrow(locally_owned_rows_in.is_contiguous() && locally_owned_columns_in.is_contiguous(),
+              dealii::ExcMessage("SparseMatrixCSR requires contiguous ranges of locally owned "
+                                 "rows and columns."));
+  AssertThrow(local_rows.size() == locally_owned_rows_in.n_elements(),
+              dealii::ExcMessage("Number of rows does not match number of locally owned rows."));
+
+  mpi_comm              = mpi_comm_in;
+  locally_owned_rows    = locally_owned_rows_in;
+  locally_owned_columns = locally_owned_columns_in;
+
+  // rows are distributed contiguously in the order of the ranks
+  std::vector<size_type> const n_rows_of_rank =
+    dealii::Utilities::MPI::all_gather(mpi_comm,
+                                       static_cast<size_type>(locally_owned_rows.n_elements()));
+  row_offsets.resize(n_rows_of_rank.size());
+  size_type offset = 0;
+  for(unsigned int p = 0; p < n_rows_of_rank.size(); ++p)
+  {
+    row_offsets[p] = offset;
+    offset += n_rows_of_rank[p];
+  }
+  row_begin = row_offsets[dealii::Utilities::MPI::this_mpi_process(mpi_comm)];
+
+  AssertThrow(locally_owned_rows.n_elements() == 0 ||
+                locally_owned_rows.nth_index_in_set(0) == row_begin,
+              dealii::ExcMessage("Locally owned rows have to be numbered in the order of the "
+                                 "MPI ranks."));
+
+  // add contributions to rows owned by other processes
+  std::vector<Row> rows = local_rows;
+
+  std::map<unsigned int, std::vector<double>> send_buffers;
+  for(auto const & row : nonlocal_rows)
+  {
+    AssertThrow(not locally_owned_rows.is_element(row.first),
+                dealii::ExcMessage("Row is locally owned and can not be a nonlocal row."));
+    pack_row(send_buffers[get_owner(row.first)], row.first, row.second);
+  }
+
+  Messages const received = exchange_messages(send_buffers, mpi_comm, tag_nonlocal_rows);
+  for(auto const & message : received)
+    unpack_rows(message.second, [&](size_type const row, size_type const col, double const value) {
+      rows[row - row_begin][col] += value;
+    });
+
+  // fill CSR storage
+  row_starts.resize(rows.size() + 1);
+  row_starts[0] = 0;
+  for(unsigned int i = 0; i < rows.size(); ++i)
+    row_starts[i + 1] = row_starts[i] + rows[i].size();
+
+  column_indices.resize(row_starts.back());
+  values.resize(row_starts.back());
+  for(unsigned int i = 0; i < rows.size(); ++i)
+  {
+    unsigned int k = row_starts[i];
+    for(auto const & entry : rows[i])
+    {
+      column_indices[k] = entry.first;
+      values[k]         = entry.second;
+      ++k;
+    }
+  }
+
+  nonlocal_entries.clear();
+  row_components.clear();
+  column_partitioner.reset();
+
+  finalize();
+}
+
+SparseMatrixCSR &
+SparseMatrixCSR::operator=(double const value)
+{
+  AssertThrow(value == 0.0, dealii::ExcMessage("Only zero can be assigned to SparseMatrixCSR."));
+
+  std::fill(values.begin(), values.end(), 0.0);
+  nonlocal_entries.clear();
+
+  for(auto & slice_value : slice_values)
+    slice_value = 0.0;
+
+  return *this;
+}
+
+void
+SparseMatrixCSR::add(size_type const row, size_type const col, double const value)
+{
+  if(locally_owned_rows.is_element(row))
+  {
+    unsigned int const local_row = row - row_begin;
+
+    auto const begin = column_indices.begin() + row_starts[local_row];
+    auto const end   = column_indices.begin() + row_starts[local_row + 1];
+    auto const entry = std::lower_bound(begin, end, col);
+
+    AssertThrow(entry != end && *entry == col,
+                dealii::ExcMessage("Entry (" + std::to_string(row) + ", " + std::to_string(col) +
+                                   ") is not part of the sparsity pattern."));
+
+    values[entry - column_indices.begin()] += value;
+  }
+  else
+  {
+    nonlocal_entries[row][col] += value;
+  }
+}
+
+void
+SparseMatrixCSR::add(size_type const   row,
+                     size_type const   n_cols,
+                     size_type const * col_indices,
+                     double const *    values_in,
+                     bool const        elide_zero_values,
+                     bool const /* col_indices_are_sorted */)
+{
+  for(size_type j = 0; j < n_cols; ++j)
+  {
+    if(elide_zero_values && values_in[j] == 0.0)
+      continue;
+
+    add(row, col_indices[j], values_in[j]);
+  }
+}
+
+void
+SparseMatrixCSR::compress(dealii::VectorOperation::values const operation)
+{
+  AssertThrow(operation == dealii::VectorOperation::add,
+              dealii::ExcMessage("SparseMatrixCSR only supports VectorOperation::add."));
+
+  std::map<unsigned int, std::vector<double>> send_buffers;
+  for(auto const & row : nonlocal_entries)
+    pack_row(send_buffers[get_owner(row.first)], row.first, row.second);
+  nonlocal_entries.clear();
+
+  Messages const received = exchange_messages(send_buffers, mpi_comm, tag_compress);
+  for(auto const & message : received)
+    unpack_rows(message.second, [&](size_type const row, size_type const col, double const value) {
+      add(row, col, value);
+    });
+
+  finalize();
+}
+
+SparseMatrixCSR::size_type
+SparseMatrixCSR::m() const
+{
+  return locally_owned_rows.size();
+}
+
+SparseMatrixCSR::size_type
+SparseMatrixCSR::n() const
+{
+  return locally_owned_columns.size();
+}
+
+unsigned int
+SparseMatrixCSR::local_size() const
+{
+  return row_starts.empty() ? 0 : row_starts.size() - 1;
+}
+
+SparseMatrixCSR::size_type
+SparseMatrixCSR::n_nonzero_elements() const
+{
+  return dealii::Utilities::MPI::sum(static_cast<size_type>(column_indices.size()), mpi_comm);
+}
+
+std::size_t
+SparseMatrixCSR::memory_consumption() const
+{
+  return row_starts.size() * sizeof(unsigned int) + column_indices.size() * sizeof(size_type) +
+         values.size() * sizeof(double) + slice_starts.size() * sizeof(unsigned int) +
+         slice_column_indices.size() * sizeof(unsigned int) +
+         slice_values.size() * sizeof(dealii::VectorizedArray<double>) +
+         ghosted_src.memory_consumption();
+}
+
+double
+SparseMatrixCSR::diag_element(unsigned int const local_row) const
+{
+  auto const begin = column_indices.begin() + row_starts[local_row];
+  auto const end   = column_indices.begin() + row_starts[local_row + 1];
+  auto const entry = std::lower_bound(begin, end, row_begin + local_row);
+
+  if(entry != end && *entry == row_begin + local_row)
+    return values[entry - column_indices.begin()];
+  else
+    return 0.0;
+}
+
+void
+SparseMatrixCSR::calculate_inverse_diagonal(VectorType & inverse_diagonal) const
+{
+  initialize_dof_vector(inverse_diagonal);
+  for(unsigned int i = 0; i < local_size(); ++i)
+  {
+    double const diagonal = diag_element(i);
+
+    inverse_diagonal.local_element(i) = diagonal != 0.0 ? 1.0 / diagonal : 1.0;
+  }
+}
+
+void
+SparseMatrixCSR::vmult(VectorType & dst, VectorType const & src) const
+{
+  if(src.get_partitioner().get() == column_partitioner.get())
+  {
+    src.update_ghost_values();
+    apply(dst, src.begin());
+    src.zero_out_ghost_values();
+  }
+  else
+  {
+    ghosted_src.copy_locally_owned_data_from(src);
+    ghosted_src.update_ghost_values();
+    apply(dst, ghosted_src.begin());
+  }
+}
+
+void
+SparseMatrixCSR::Tvmult(VectorType & dst, VectorType const & src) const
+{
+  AssertThrow(m() == n(), dealii::ExcMessage("Tvmult() is only available for square matrices."));
+
+  vmult(dst, src);
+}
+
+void
+SparseMatrixCSR::residual(VectorType & dst, VectorType const & x, VectorType const & src) const
+{
+  vmult(dst, x);
+  dst.sadd(-1.0, 1.0, src);
+}
+
+void
+SparseMatrixCSR::initialize_dof_vector(VectorType & vector) const
+{
+  if(locally_owned_rows == locally_owned_columns)
+    vector.reinit(column_partitioner);
+  else
+    vector.reinit(locally_owned_rows, mpi_comm);
+}
+
+void
+SparseMatrixCSR::initialize_column_vector(VectorType & vector) const
+{
+  vector.reinit(column_partitioner);
+}
+
+std::map<SparseMatrixCSR::size_type, SparseMatrixCSR::Row>
+SparseMatrixCSR::get_remote_rows(std::vector<size_type> const & row_indices) const
+{
+  std::map<size_type, Row> rows;
+
+  // request rows from their owners
+  std::map<unsigned int, std::vector<double>> request_buffers;
+  for(auto const row : row_indices)
+  {
+    if(locally_owned_rows.is_element(row))
+    {
+      unsigned int const local_row = row - row_begin;
+      for(unsigned int k = row_starts[local_row]; k < row_starts[local_row + 1]; ++k)
+        rows[row][column_indices[k]] = values[k];
+    }
+    else
+    {
+      request_buffers[get_owner(row)].push_back(row);
+    }
+  }
+
+  Messages const requests = exchange_messages(request_buffers, mpi_comm, tag_request_rows);
+
+  // send requested rows
+  std::map<unsigned int, std::vector<double>> send_buffers;
+  for(auto const & request : requests)
+  {
+    std::vector<double> & buffer = send_buffers[request.first];
+    for(double const requested_row : request.second)
+    {
+      size_type const    row       = requested_row;
+      unsigned int const local_row = row - row_begin;
+
+      buffer.push_back(row);
+      buffer.push_back(row_starts[local_row + 1] - row_starts[local_row]);
+      for(unsigned int k = row_starts[local_row]; k < row_starts[local_row + 1]; ++k)
+      {
+        buffer.push_back(column_indices[k]);
+        buffer.push_back(values[k]);
+      }
+    }
+  }
+
+  Messages const received = exchange_messages(send_buffers, mpi_comm, tag_send_rows);
+  for(auto const & message : received)
+    unpack_rows(message.second, [&](size_type const row, size_type const col, double const value) {
+      rows[row][col] = value;
+    });
+
+  return rows;
+}
+
+unsigned int
+SparseMatrixCSR::row_length(unsigned int const local_row) const
+{
+  return row_starts[local_row + 1] - row_starts[local_row];
+}
+
+SparseMatrixCSR::size_type const *
+SparseMatrixCSR::row_columns(unsigned int const local_row) const
+{
+  return column_indices.data() + row_starts[local_row];
+}
+
+double const *
+SparseMatrixCSR::row_values(unsigned int const local_row) const
+{
+  return values.data() + row_starts[local_row];
+}
+
+dealii::IndexSet const &
+SparseMatrixCSR::get_locally_owned_rows() const
+{
+  return locally_owned_rows;
+}
+
+dealii::IndexSet const &
+SparseMatrixCSR::get_locally_owned_columns() const
+{
+  return locally_owned_columns;
+}
+
+std::shared_ptr<dealii::Utilities::MPI::Partitioner const> const &
+SparseMatrixCSR::get_column_partitioner() const
+{
+  return column_partitioner;
+}
+
+MPI_Comm const &
+SparseMatrixCSR::get_mpi_communicator() const
+{
+  return mpi_comm;
+}
+
+void
+SparseMatrixCSR::set_row_components(std::vector<unsigned int> const & components)
+{
+  AssertThrow(components.size() == local_size(),
+              dealii::ExcMessage("Number of components does not match number of local rows."));
+
+  row_components = components;
+}
+
+std::vector<unsigned int> const &
+SparseMatrixCSR::get_row_components() const
+{
+  return row_components;
+}
+
+void
+SparseMatrixCSR::finalize()
+{
+  unsigned int const n_rows   = local_size();
+  unsigned int const n_slices = (n_rows + n_lanes - 1) / n_lanes;
+
+  // the column partitioner and the slice structure only depend on the sparsity pattern
+  if(column_partitioner.get() == nullptr)
+  {
+    std::vector<size_type> ghost_columns;
+    for(auto const col : column_indices)
+      if(not locally_owned_columns.is_element(col))
+        ghost_columns.push_back(col);
+
+    std::sort(ghost_columns.begin(), ghost_columns.end());
+    ghost_columns.erase(std::unique(ghost_columns.begin(), ghost_columns.end()),
+                        ghost_columns.end());
+
+    dealii::IndexSet ghost_set(locally_owned_columns.size());
+    ghost_set.add_indices(ghost_columns.begin(), ghost_columns.end());
+
+    column_partitioner = std::make_shared<dealii::Utilities::MPI::Partitioner const>(
+      locally_owned_columns, ghost_set, mpi_comm);
+
+    ghosted_src.reinit(column_partitioner);
+
+    slice_starts.resize(n_slices + 1);
+    slice_starts[0] = 0;
+    for(unsigned int s = 0; s < n_slices; ++s)
+    {
+      unsigned int max_length = 0;
+      for(unsigned int lane = 0; lane < n_lanes && s * n_lanes + lane < n_rows; ++lane)
+        max_length = std::max(max_length, row_length(s * n_lanes + lane));
+      slice_starts[s + 1] = slice_starts[s] + max_length;
+    }
+
+    // padded entries point to the first local column and have a value of zero
+    slice_column_indices.assign(slice_starts.back() * n_lanes, 0);
+    for(unsigned int s = 0; s < n_slices; ++s)
+      for(unsigned int lane = 0; lane < n_lanes && s * n_lanes + lane < n_rows; ++lane)
+      {
+        unsigned int const row = s * n_lanes + lane;
+        for(unsigned int j = 0; j < row_length(row); ++j)
+          slice_column_indices[(slice_starts[s] + j) * n_lanes + lane] =
+            column_partitioner->global_to_local(column_indices[row_starts[row] + j]);
+      }
+  }
+
+  slice_values.resize(slice_starts.back());
+  for(auto & slice_value : slice_values)
+    slice_value = 0.0;
+
+  for(unsigned int s = 0; s < n_slices; ++s)
+    for(unsigned int lane = 0; lane < n_lanes && s * n_lanes + lane < n_rows; ++lane)
+    {
+      unsigned int const row = s * n_lanes + lane;
+      for(unsigned int j = 0; j < row_length(row); ++j)
+        slice_values[slice_starts[s] + j][lane] = values[row_starts[row] + j];
+    }
+}
+
+void
+SparseMatrixCSR::apply(VectorType & dst, double const * src) const
+{
+  unsigned int const n_rows   = local_size();
+  unsigned int const n_slices = (n_rows + n_lanes - 1) / n_lanes;
+
+  double * dst_ptr = dst.begin();
+
+  for(unsigned int s = 0; s < n_slices; ++s)
+  {
+    dealii::VectorizedArray<double> sum = 0.0;
+    for(unsigned int j = slice_starts[s]; j < slice_starts[s + 1]; ++j)
+    {
+      dealii::VectorizedArray<double> x;
+      x.gather(src, &slice_column_indices[j * n_lanes]);
+      sum += slice_values[j] * x;
+    }
+
+    if(s * n_lanes + n_lanes <= n_rows)
+    {
+      sum.store(dst_ptr + s * n_lanes);
+    }
+    else
+    {
+      for(unsigned int lane = 0; s * n_lanes + lane < n_rows; ++lane)
+        dst_ptr[s * n_lanes + lane] = sum[lane];
+    }
+  }
+}
+
+unsigned int
+SparseMatrixCSR::get_owner(size_type const row) const
+{
+  AssertThrow(row < m(), dealii::ExcMessage("Row index exceeds size of matrix."));
+
+  return std::upper_bound(row_offsets.begin(), row_offsets.end(), row) - row_offsets.begin() - 1;
+}
+
+} // namespace ExaDG
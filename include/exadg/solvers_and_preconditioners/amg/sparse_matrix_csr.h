@@ -0,0 +1,277 @@
+/*  ______________________________________________________________________
+ *
+ *  ExaDG - High-Order Discontinuous Galerkin for the Exa-Scale
+ *
+ *  Copyright (C) 2021 by the ExaDG authors
+ *
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *  ______________________________________________________________________
+ */
+
+#ifndef INCLUDE_EXADG_SOLVERS_AND_PRECONDITIONERS_AMG_SPARSE_MATRIX_CSR_H_
+#define INCLUDE_EXADG_SOLVERS_AND_PRECONDITIONERS_AMG_SPARSE_MATRIX_CSR_H_
+
+// C/C++
+#include <map>
+#include <memory>
+#include <vector>
+
+// deal.II
+#include <deal.II/base/index_set.h>
+#include <deal.II/base/partitioner.h>
+#include <deal.II/base/subscriptor.h>
+#include <deal.II/base/vectorization.h>
+#include <deal.II/lac/dynamic_sparsity_pattern.h>
+#include <deal.II/lac/la_parallel_vector.h>
+#include <deal.II/lac/vector_operation.h>
+
+namespace ExaDG
+{
+/*
+ * Distributed sparse matrix in compressed row storage (CSR) that is used by the native algebraic
+ * multigrid implementation. Each process stores the rows of its contiguous range of locally owned
+ * rows with global column indices. Contributions to rows owned by other processes (e.g. from face
+ * integrals at processor boundaries) are cached and sent to the owner in compress().
+ *
+ * Once the matrix is finalized, the column indices are translated to local indices of a
+ * dealii::Utilities::MPI::Partitioner (owned columns followed by ghost columns) and the matrix is
+ * additionally stored in a sliced ELLPACK format with slices of the width of
+ * dealii::VectorizedArray<double>, which is used for a vectorized matrix-vector product.
+ */
+class SparseMatrixCSR : public dealii::Subscriptor
+{
+public:
+  typedef double                                             value_type;
+  typedef dealii::types::global_dof_index                    size_type;
+  typedef dealii::LinearAlgebra::distributed::Vector<double> VectorType;
+
+  // sorted list of (global column, value) pairs
+  typedef std::map<size_type, double> Row;
+
+  SparseMatrixCSR();
+
+  /*
+   * Initializes the sparsity pattern from a distributed dynamic sparsity pattern. This is the
+   * interface used by OperatorBase::init_system_matrix(). All entries are set to zero.
+   */
+  void
+  reinit(dealii::IndexSet const &               locally_owned_rows,
+         dealii::IndexSet const &               locally_owned_columns,
+         dealii::DynamicSparsityPattern const & dsp,
+         MPI_Comm const &                       mpi_comm);
+
+  /*
+   * Initializes the matrix from rows given in global indices. The vector local_rows contains the
+   * locally owned rows, the map nonlocal_rows contains contributions to rows owned by other
+   * processes, which are communicated and added to the rows of the owner. The matrix is finalized
+   * afterwards.
+   */
+  void
+  reinit(dealii::IndexSet const &         locally_owned_rows,
+         dealii::IndexSet const &         locally_owned_columns,
+         std::vector<Row> const &         local_rows,
+         std::map<size_type, Row> const & nonlocal_rows,
+         MPI_Comm const &                 mpi_comm);
+
+  /*
+   * Sets all entries to zero while keeping the sparsity pattern.
+   */
+  SparseMatrixCSR &
+  operator=(double const value);
+
+  /*
+   * Adds value to the entry (row, col). The entry has to be part of the sparsity pattern if row is
+   * locally owned.
+   */
+  void
+  add(size_type const row, size_type const col, double const value);
+
+  /*
+   * Adds a row of values. This interface is used by dealii::AffineConstraints.
+   */
+  void
+  add(size_type const   row,
+      size_type const   n_cols,
+      size_type const * col_indices,
+      double const *    values,
+      bool const        elide_zero_values      = true,
+      bool const        col_indices_are_sorted = false);
+
+  /*
+   * Communicates contributions to rows owned by other processes and finalizes the matrix.
+   */
+  void
+  compress(dealii::VectorOperation::values const operation);
+
+  /*
+   * Global number of rows and columns.
+   */
+  size_type
+  m() const;
+
+  size_type
+  n() const;
+
+  /*
+   * Number of locally owned rows.
+   */
+  unsigned int
+  local_size() const;
+
+  /*
+   * Global number of stored entries.
+   */
+  size_type
+  n_nonzero_elements() const;
+
+  /*
+   * Memory consumption of this process in bytes.
+   */
+  std::size_t
+  memory_consumption() const;
+
+  /*
+   * Diagonal entry of locally owned row (specified by the local index).
+   */
+  double
+  diag_element(unsigned int const local_row) const;
+
+  /*
+   * Inverse of the diagonal, where rows with zero diagonal entry get the value one. Together with
+   * initialize_dof_vector(), this is the interface required by JacobiPreconditioner.
+   */
+  void
+  calculate_inverse_diagonal(VectorType & inverse_diagonal) const;
+
+  /*
+   * Matrix-vector products dst = A * src and dst = A^T * src. The latter is only valid for
+   * symmetric matrices and provided for compatibility with deal.II solvers and smoothers.
+   */
+  void
+  vmult(VectorType & dst, VectorType const & src) const;
+
+  void
+  Tvmult(VectorType & dst, VectorType const & src) const;
+
+  /*
+   * Computes dst = src - A * x.
+   */
+  void
+  residual(VectorType & dst, VectorType const & x, VectorType const & src) const;
+
+  /*
+   * Initializes a vector with the row partitioning (dst of vmult).
+   */
+  void
+  initialize_dof_vector(VectorType & vector) const;
+
+  /*
+   * Initializes a vector with the column partitioning including ghost entries (src of vmult).
+   */
+  void
+  initialize_column_vector(VectorType & vector) const;
+
+  /*
+   * Returns the rows of the matrix with global indices row_indices. The rows are requested from
+   * the owning processes.
+   */
+  std::map<size_type, Row>
+  get_remote_rows(std::vector<size_type> const & row_indices) const;
+
+  /*
+   * Access to the locally owned rows in global column indices.
+   */
+  unsigned int
+  row_length(unsigned int const local_row) const;
+
+  size_type const *
+  row_columns(unsigned int const local_row) const;
+
+  double const *
+  row_values(unsigned int const local_row) const;
+
+  dealii::IndexSet const &
+  get_locally_owned_rows() const;
+
+  dealii::IndexSet const &
+  get_locally_owned_columns() const;
+
+  std::shared_ptr<dealii::Utilities::MPI::Partitioner const> const &
+  get_column_partitioner() const;
+
+  MPI_Comm const &
+  get_mpi_communicator() const;
+
+  /*
+   * Vector component associated to each locally owned row. This information is optional and used
+   * by the aggregation of the algebraic multigrid method for systems of equations.
+   */
+  void
+  set_row_components(std::vector<unsigned int> const & components);
+
+  std::vector<unsigned int> const &
+  get_row_components() const;
+
+private:
+  /*
+   * Builds the local column indices, the column partitioner, and the sliced ELLPACK storage used
+   * by the matrix-vector product.
+   */
+  void
+  finalize();
+
+  void
+  apply(VectorType & dst, double const * src) const;
+
+  /*
+   * Returns the rank of the process owning the given global row.
+   */
+  unsigned int
+  get_owner(size_type const row) const;
+
+  MPI_Comm mpi_comm;
+
+  dealii::IndexSet locally_owned_rows;
+  dealii::IndexSet locally_owned_columns;
+
+  // first global row index of every process, used to determine the owner of a row
+  std::vector<size_type> row_offsets;
+  size_type              row_begin;
+
+  // CSR storage with global column indices (sorted within each row)
+  std::vector<unsigned int> row_starts;
+  std::vector<size_type>    column_indices;
+  std::vector<double>       values;
+
+  // contributions to rows owned by other processes
+  std::map<size_type, Row> nonlocal_entries;
+
+  std::vector<unsigned int> row_components;
+
+  // sliced ELLPACK storage: slices of n_lanes rows, entries of a slice are stored column-major
+  static unsigned int const n_lanes = dealii::VectorizedArray<double>::size();
+
+  std::vector<unsigned int>                    slice_starts;
+  std::vector<unsigned int>                    slice_column_indices;
+  std::vector<dealii::VectorizedArray<double>> slice_values;
+
+  std::shared_ptr<dealii::Utilities::MPI::Partitioner const> column_partitioner;
+
+  // ghosted vector for source vectors with a different partitioning
+  mutable VectorType ghosted_src;
+};
+
+} // namespace ExaDG
+
+#endif /* INCLUDE_EXADG_SOLVERS_AND_PRECONDITIONERS_AMG_SPARSE_MATRIX_CSR_H_ */
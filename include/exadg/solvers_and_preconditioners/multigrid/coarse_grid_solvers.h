@@ -129,6 +129,11 @@ public:
         AssertThrow(false, dealii::ExcMessage("deal.II is not compiled with PETSc!"));
 #endif
       }
+      else if(additional_data.amg_data.amg_type == AMGType::Native)
+      {
+        preconditioner_amg = std::make_shared<PreconditionerNativeAMG<Operator, NumberAMG>>(
+          matrix, additional_data.amg_data.native_data);
+      }
       else
       {
         AssertThrow(false, dealii::ExcNotImplemented());
@@ -262,6 +267,45 @@ public:
           });
 #endif
       }
+      else if(additional_data.amg_data.amg_type == AMGType::Native)
+      {
+        std::shared_ptr<PreconditionerNativeAMG<Operator, NumberAMG>> coarse_operator =
+          std::dynamic_pointer_cast<PreconditionerNativeAMG<Operator, NumberAMG>>(
+            preconditioner_amg);
+
+        // create temporal vectors of type NumberAMG (double) with the partitioning of the matrix
+        VectorTypeAMG dst_amg;
+        coarse_operator->system_matrix.initialize_dof_vector(dst_amg);
+        VectorTypeAMG src_amg;
+        coarse_operator->system_matrix.initialize_dof_vector(src_amg);
+        src_amg.copy_locally_owned_data_from(r);
+
+        dealii::ReductionControl solver_control(additional_data.solver_data.max_iter,
+                                                additional_data.solver_data.abs_tol,
+                                                additional_data.solver_data.rel_tol);
+
+        if(additional_data.solver_type == KrylovSolverType::CG)
+        {
+          dealii::SolverCG<VectorTypeAMG> solver(solver_control);
+          solver.solve(coarse_operator->system_matrix, dst_amg, src_amg, coarse_operator->amg);
+        }
+        else if(additional_data.solver_type == KrylovSolverType::GMRES)
+        {
+          typename dealii::SolverGMRES<VectorTypeAMG>::AdditionalData gmres_data;
+          gmres_data.max_n_tmp_vectors     = additional_data.solver_data.max_krylov_size;
+          gmres_data.right_preconditioning = true;
+
+          dealii::SolverGMRES<VectorTypeAMG> solver(solver_control, gmres_data);
+          solver.solve(coarse_operator->system_matrix, dst_amg, src_amg, coarse_operator->amg);
+        }
+        else
+        {
+          AssertThrow(false, dealii::ExcMessage("Not implemented."));
+        }
+
+        // convert NumberAMG (double) -> MultigridNumber (float)
+        dst.copy_locally_owned_data_from(dst_amg);
+      }
       else
       {
         AssertThrow(false, dealii::ExcNotImplemented());
@@ -409,6 +453,11 @@ public:
       AssertThrow(false, dealii::ExcMessage("deal.II is not compiled with Trilinos!"));
 #endif
     }
+    else if(data.amg_type == AMGType::Native)
+    {
+      amg_preconditioner =
+        std::make_shared<PreconditionerNativeAMG<Operator, NumberAMG>>(op, data.native_data);
+    }
     else
     {
       AssertThrow(false, dealii::ExcNotImplemented());
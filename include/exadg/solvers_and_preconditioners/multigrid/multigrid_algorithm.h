@@ -32,6 +32,7 @@
 #include <deal.II/multigrid/multigrid.h>
 
 // ExaDG
+#include <exadg/solvers_and_preconditioners/multigrid/multigrid_parameters.h>
 #include <exadg/solvers_and_preconditioners/multigrid/transfers/mg_transfer.h>
 #include <exadg/utilities/timer_tree.h>
 
@@ -47,8 +48,10 @@
 namespace ExaDG
 {
 /*
- * Re-implementation of multigrid preconditioner (V-cycle) in order to have more direct control over
- * its individual components and avoid inner products and other expensive stuff.
+ * Re-implementation of multigrid preconditioner in order to have more direct control over
+ * its individual components and avoid inner products and other expensive stuff. Besides the
+ * V-cycle, W- and F-cycles, a Krylov-accelerated coarse-grid correction (K-cycle), and full
+ * multigrid (nested iteration) are supported, see CycleData.
  */
 template<typename VectorType, typename MatrixType, typename SmootherType>
 class MultigridAlgorithm
@@ -59,20 +62,25 @@ public:
                      MGTransfer<VectorType> const &                               transfer,
                      dealii::MGLevelObject<std::shared_ptr<SmootherType>> const & smoother,
                      MPI_Comm const &                                             comm,
-                     unsigned int const                                           n_cycles = 1)
+                     CycleData const &                                            cycle_data)
     : minlevel(matrix.min_level()),
       maxlevel(matrix.max_level()),
       defect(minlevel, maxlevel),
       solution(minlevel, maxlevel),
       t(minlevel, maxlevel),
+      kcycle_c(minlevel, maxlevel),
+      kcycle_v(minlevel, maxlevel),
+      kcycle_w(minlevel, maxlevel),
+      kcycle_r(minlevel, maxlevel),
       matrix(&matrix, typeid(*this).name()),
       coarse(&coarse, typeid(*this).name()),
       transfer(transfer),
       smoother(&smoother, typeid(*this).name()),
       mpi_comm(comm),
-      n_cycles(n_cycles)
+      cycle_data(cycle_data)
   {
-    AssertThrow(n_cycles == 1, dealii::ExcNotImplemented());
+    AssertThrow(cycle_data.krylov_acceleration_interval > 0,
+                dealii::ExcMessage("Krylov acceleration interval has to be larger than zero."));
 
     for(unsigned int level = minlevel; level <= maxlevel; ++level)
     {
@@ -81,6 +89,19 @@ public:
       t[level]      = solution[level];
     }
 
+    // additional vectors are only needed on those levels that are the coarse level of a
+    // Krylov-accelerated coarse-grid correction
+    for(unsigned int level = minlevel + 1; level <= maxlevel; ++level)
+    {
+      if(use_krylov_acceleration(level))
+      {
+        kcycle_c[level - 1] = solution[level - 1];
+        kcycle_v[level - 1] = solution[level - 1];
+        kcycle_w[level - 1] = solution[level - 1];
+        kcycle_r[level - 1] = solution[level - 1];
+      }
+    }
+
     timer_tree = std::make_shared<TimerTree>();
   }
 
@@ -92,13 +113,9 @@ public:
     dealii::Timer timer;
 #endif
 
-    for(unsigned int i = minlevel; i < maxlevel; i++)
-    {
-      defect[i] = 0.0;
-    }
     defect[maxlevel].copy_locally_owned_data_from(src);
 
-    v_cycle(maxlevel, false);
+    cycle(maxlevel, cycle_data.type, false);
 
     dst.copy_locally_owned_data_from(solution[maxlevel]);
 
@@ -111,6 +128,11 @@ public:
   unsigned int
   solve(OtherVectorType & dst, OtherVectorType const & src) const
   {
+    if(cycle_data.full_multigrid)
+    {
+      full_multigrid(dst, src);
+    }
+
     defect[maxlevel].copy_locally_owned_data_from(src);
 
     solution[maxlevel].copy_locally_owned_data_from(dst);
@@ -130,12 +152,7 @@ public:
     bool converged = norm_r_0 < abstol;
     while(!converged)
     {
-      for(unsigned int i = minlevel; i < maxlevel; i++)
-      {
-        defect[i] = 0.0;
-      }
-
-      v_cycle(maxlevel, true);
+      cycle(maxlevel, cycle_data.type, true);
 
       // calculate residual and check convergence
       norm_r = calculate_residual(residual);
@@ -150,6 +167,51 @@ public:
     return n_iter;
   }
 
+  /**
+   * Full multigrid (nested iteration): Computes an approximate solution dst of the fine-level
+   * problem with right-hand side src, which can be used as initial guess of an outer solver.
+   * Since the nested iteration does not make use of an initial guess, dst is only overwritten if
+   * it is zero, i.e., a warm-started solve keeps its initial guess.
+   */
+  template<class OtherVectorType>
+  void
+  full_multigrid(OtherVectorType & dst, OtherVectorType const & src) const
+  {
+    if(dst.linfty_norm() != 0.0)
+      return;
+
+#if ENABLE_TIMING
+    dealii::Timer timer;
+#endif
+
+    // restrict right-hand side to all levels
+    defect[maxlevel].copy_locally_owned_data_from(src);
+    for(unsigned int level = maxlevel; level > minlevel; --level)
+    {
+      defect[level - 1] = 0.0;
+      transfer.restrict_and_add(level, defect[level - 1], defect[level]);
+    }
+
+    // solve coarse problem
+    (*coarse)(minlevel, solution[minlevel], defect[minlevel]);
+
+    // nested iteration: prolongate solution of coarser level as initial guess and apply cycles
+    for(unsigned int level = minlevel + 1; level <= maxlevel; ++level)
+    {
+      solution[level] = 0.0;
+      transfer.prolongate_and_add(level, solution[level], solution[level - 1]);
+
+      for(unsigned int i = 0; i < cycle_data.full_multigrid_cycles; ++i)
+        cycle(level, cycle_data.type, true);
+    }
+
+    dst.copy_locally_owned_data_from(solution[maxlevel]);
+
+#if ENABLE_TIMING
+    timer_tree->insert({"Multigrid", "full multigrid"}, timer.wall_time());
+#endif
+  }
+
   template<class OtherVectorType>
   double
   calculate_residual(OtherVectorType & residual) const
@@ -167,10 +229,23 @@ public:
 
 private:
   /**
-   * Implements the V-cycle
+   * Returns true if the coarse-grid correction from level to level-1 is Krylov-accelerated.
+   */
+  bool
+  use_krylov_acceleration(unsigned int const level) const
+  {
+    return cycle_data.krylov_acceleration and level - 1 > minlevel and
+           (maxlevel - level) % cycle_data.krylov_acceleration_interval == 0;
+  }
+
+  /**
+   * Implements the V-, W-, and F-cycles. If multigrid_is_a_solver is false, the initial guess
+   * solution[level] is assumed to be zero.
    */
   void
-  v_cycle(unsigned int const level, bool const multigrid_is_a_solver) const
+  cycle(unsigned int const   level,
+        MultigridCycle const type,
+        bool const           multigrid_is_a_solver) const
   {
 #if ENABLE_TIMING
     dealii::Timer timer;
@@ -214,6 +289,7 @@ private:
       // restriction
       (*matrix)[level]->vmult_interface_down(t[level], solution[level]);
       t[level].sadd(-1.0, 1.0, defect[level]);
+      defect[level - 1] = 0.0;
       transfer.restrict_and_add(level, defect[level - 1], t[level]);
 
 #if ENABLE_TIMING
@@ -221,7 +297,36 @@ private:
 #endif
 
       // coarse grid correction
-      v_cycle(level - 1, false);
+      if(use_krylov_acceleration(level))
+      {
+        krylov_accelerated_coarse_grid_correction(level, type);
+      }
+      else
+      {
+        if(type == MultigridCycle::V)
+        {
+          cycle(level - 1, MultigridCycle::V, false);
+        }
+        else if(type == MultigridCycle::W)
+        {
+          cycle(level - 1, MultigridCycle::W, false);
+
+          // a second visit of the coarsest level would only repeat the coarse solve
+          if(level - 1 > minlevel)
+            cycle(level - 1, MultigridCycle::W, true);
+        }
+        else if(type == MultigridCycle::F)
+        {
+          cycle(level - 1, MultigridCycle::F, false);
+
+          if(level - 1 > minlevel)
+            cycle(level - 1, MultigridCycle::V, true);
+        }
+        else
+        {
+          AssertThrow(false, dealii::ExcMessage("Specified multigrid cycle not implemented."));
+        }
+      }
 
 #if ENABLE_TIMING
       timer.restart();
@@ -239,6 +344,74 @@ private:
     }
   }
 
+  /**
+   * Coarse-grid correction from level to level-1 computed by two iterations of the flexible
+   * conjugate gradient method preconditioned by a cycle on level-1 (K-cycle, see Notay,
+   * Vassilevski, Numer. Linear Algebra Appl. 15 (2008)). On input, defect[level-1] contains the
+   * restricted residual, on output solution[level-1] contains the coarse-grid correction.
+   */
+  void
+  krylov_accelerated_coarse_grid_correction(unsigned int const   level,
+                                            MultigridCycle const type) const
+  {
+    unsigned int const coarse_level = level - 1;
+
+    VectorType & r = defect[coarse_level];
+    VectorType & x = solution[coarse_level];
+    VectorType & c = kcycle_c[coarse_level];
+    VectorType & v = kcycle_v[coarse_level];
+    VectorType & w = kcycle_w[coarse_level];
+
+    // first iteration: c = B r, v = A c
+    cycle(coarse_level, type, false);
+    c = x;
+    (*matrix)[coarse_level]->vmult(v, c);
+
+    double const rho_1   = c * v;
+    double const alpha_1 = c * r;
+
+    if(rho_1 <= 0.0)
+    {
+      // fall back to the unaccelerated correction x = c
+      return;
+    }
+
+    // r_tilde = r - alpha_1 / rho_1 * v
+    VectorType & r_tilde = kcycle_r[coarse_level];
+    r_tilde              = r;
+    r_tilde.add(-alpha_1 / rho_1, v);
+
+    double const norm_r       = r.l2_norm();
+    double const norm_r_tilde = r_tilde.l2_norm();
+
+    if(norm_r_tilde <= cycle_data.krylov_acceleration_tolerance * norm_r)
+    {
+      x.equ(alpha_1 / rho_1, c);
+      return;
+    }
+
+    // second iteration: d = B r_tilde, w = A d. The right-hand side of the coarse level is
+    // overwritten by r_tilde, which is no longer needed after the coarse-grid correction.
+    r.swap(r_tilde);
+    cycle(coarse_level, type, false);
+    VectorType & d = x;
+    (*matrix)[coarse_level]->vmult(w, d);
+
+    double const gamma   = d * v;
+    double const beta    = d * w;
+    double const alpha_2 = d * r;
+    double const rho_2   = beta - gamma * gamma / rho_1;
+
+    if(rho_2 <= 0.0)
+    {
+      x.equ(alpha_1 / rho_1, c);
+      return;
+    }
+
+    // x = (alpha_1 / rho_1 - gamma * alpha_2 / (rho_1 * rho_2)) c + alpha_2 / rho_2 d
+    x.sadd(alpha_2 / rho_2, alpha_1 / rho_1 - gamma * alpha_2 / (rho_1 * rho_2), c);
+  }
+
   /**
    * Coarsest level.
    */
@@ -265,6 +438,11 @@ private:
    */
   mutable dealii::MGLevelObject<VectorType> t;
 
+  /**
+   * Auxiliary vectors of the K-cycle (only allocated on levels where needed).
+   */
+  mutable dealii::MGLevelObject<VectorType> kcycle_c, kcycle_v, kcycle_w, kcycle_r;
+
   /**
    * The matrix for each level.
    */
@@ -287,7 +465,7 @@ private:
 
   MPI_Comm const mpi_comm;
 
-  unsigned int const n_cycles;
+  CycleData const cycle_data;
 
   std::shared_ptr<TimerTree> timer_tree;
 };
@@ -117,6 +117,30 @@ enum_to_string(PSequenceType const enum_type)
   return string_type;
 }
 
+std::string
+enum_to_string(MultigridCycle const enum_type)
+{
+  std::string string_type;
+
+  switch(enum_type)
+  {
+    case MultigridCycle::V:
+      string_type = "V-cycle";
+      break;
+    case MultigridCycle::W:
+      string_type = "W-cycle";
+      break;
+    case MultigridCycle::F:
+      string_type = "F-cycle";
+      break;
+    default:
+      AssertThrow(false, dealii::ExcMessage("Not implemented."));
+      break;
+  }
+
+  return string_type;
+}
+
 std::string
 enum_to_string(MultigridSmoother const enum_type)
 {
@@ -157,6 +181,9 @@ enum_to_string(AMGType const enum_type)
     case AMGType::BoomerAMG:
       string_type = "BoomerAMG";
       break;
+    case AMGType::Native:
+      string_type = "Native";
+      break;
     default:
       AssertThrow(false, dealii::ExcMessage("Not implemented."));
       break;
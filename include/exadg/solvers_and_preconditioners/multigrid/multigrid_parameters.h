@@ -71,6 +71,16 @@ enum class PSequenceType
 std::string
 enum_to_string(PSequenceType const enum_type);
 
+enum class MultigridCycle
+{
+  V,
+  W,
+  F
+};
+
+std::string
+enum_to_string(MultigridCycle const enum_type);
+
 enum class MultigridSmoother
 {
   Chebyshev,
@@ -85,7 +95,8 @@ enum_to_string(MultigridSmoother const enum_type);
 enum class AMGType
 {
   ML,
-  BoomerAMG
+  BoomerAMG,
+  Native
 };
 
 std::string
@@ -114,6 +125,63 @@ enum class MultigridCoarseGridPreconditioner
 std::string
 enum_to_string(MultigridCoarseGridPreconditioner const enum_type);
 
+/*
+ * Parameters of the native smoothed aggregation algebraic multigrid method, which does not depend
+ * on external libraries (see amg/smoothed_aggregation_amg.h).
+ */
+struct NativeAMGData
+{
+  NativeAMGData()
+    : strong_threshold(0.08),
+      prolongator_damping(4. / 3.),
+      max_levels(20),
+      coarse_size(1000),
+      smoother_degree(2),
+      smoothing_range(20.),
+      eig_cg_n_iterations(20),
+      coarse_smoother_degree(10),
+      n_cycles(1)
+  {
+  }
+
+  void
+  print(dealii::ConditionalOStream const & pcout) const
+  {
+    print_parameter(pcout, "    Strong threshold", strong_threshold);
+    print_parameter(pcout, "    Prolongator damping", prolongator_damping);
+    print_parameter(pcout, "    Maximum number of levels", max_levels);
+    print_parameter(pcout, "    Coarse size", coarse_size);
+    print_parameter(pcout, "    Smoother degree (Chebyshev)", smoother_degree);
+    print_parameter(pcout, "    Smoothing range", smoothing_range);
+    print_parameter(pcout, "    Iterations eigenvalue estimation", eig_cg_n_iterations);
+    print_parameter(pcout, "    Coarse smoother degree", coarse_smoother_degree);
+    print_parameter(pcout, "    Number of cycles", n_cycles);
+  }
+
+  // threshold theta of the strength-of-connection criterion |a_ij| >= theta sqrt(|a_ii a_jj|)
+  double strong_threshold;
+
+  // the damping of the prolongator smoothing is omega = prolongator_damping / lambda_max
+  double prolongator_damping;
+
+  // maximum number of levels of the hierarchy
+  unsigned int max_levels;
+
+  // coarsening stops once the global number of unknowns is below this value
+  unsigned int coarse_size;
+
+  // Chebyshev smoother used for pre- and post-smoothing on all levels except the coarsest one
+  unsigned int smoother_degree;
+  double       smoothing_range;
+  unsigned int eig_cg_n_iterations;
+
+  // the coarsest level is solved approximately by a Chebyshev iteration of high degree
+  unsigned int coarse_smoother_degree;
+
+  // number of V-cycles per application of the preconditioner
+  unsigned int n_cycles;
+};
+
 struct AMGData
 {
   AMGData()
@@ -162,6 +230,10 @@ struct AMGData
       print_parameter(pcout, "    Smoother type coarse", (int)boomer_data.relaxation_type_coarse);
 #endif
     }
+    else if(amg_type == AMGType::Native)
+    {
+      native_data.print(pcout);
+    }
     else
     {
       AssertThrow(false, dealii::ExcNotImplemented());
@@ -170,6 +242,8 @@ struct AMGData
 
   AMGType amg_type;
 
+  NativeAMGData native_data;
+
 #ifdef DEAL_II_WITH_TRILINOS
   dealii::TrilinosWrappers::PreconditionAMG::AdditionalData ml_data;
 #endif
@@ -278,11 +352,91 @@ struct CoarseGridData
 };
 
 
+struct CycleData
+{
+  CycleData()
+    : type(MultigridCycle::V),
+      krylov_acceleration(false),
+      krylov_acceleration_interval(1),
+      krylov_acceleration_tolerance(0.25),
+      full_multigrid(false),
+      full_multigrid_cycles(1)
+  {
+  }
+
+  void
+  print(dealii::ConditionalOStream const & pcout) const
+  {
+    print_parameter(pcout, "Multigrid cycle", enum_to_string(type));
+    print_parameter(pcout, "Krylov acceleration (K-cycle)", krylov_acceleration);
+
+    if(krylov_acceleration)
+    {
+      print_parameter(pcout, "Krylov acceleration interval", krylov_acceleration_interval);
+      print_parameter(pcout, "Krylov acceleration tolerance", krylov_acceleration_tolerance);
+    }
+
+    print_parameter(pcout, "Full multigrid initial guess", full_multigrid);
+
+    if(full_multigrid)
+    {
+      print_parameter(pcout, "Full multigrid cycles per level", full_multigrid_cycles);
+    }
+  }
+
+  /*
+   *  Checks the cycle against the Krylov solver preconditioned by multigrid. The K-cycle requires
+   *  a flexible solver, and full multigrid requires a solver that calls apply_full_multigrid().
+   */
+  void
+  check(bool const flexible_solver, bool const full_multigrid_supported) const
+  {
+    if(krylov_acceleration)
+    {
+      AssertThrow(flexible_solver,
+                  dealii::ExcMessage("The K-cycle is a nonlinear preconditioner and requires a "
+                                     "flexible Krylov solver (e.g. FGMRES)."));
+    }
+
+    AssertThrow(full_multigrid_supported or not(full_multigrid),
+                dealii::ExcMessage("Full multigrid is not supported by this solver."));
+  }
+
+  // Type of cycle: V-cycle visits each coarse level once, W-cycle twice, and the F-cycle applies
+  // an F-cycle followed by a V-cycle for the coarse-grid correction.
+  MultigridCycle type;
+
+  // K-cycle: the coarse-grid correction is replaced by two iterations of a flexible conjugate
+  // gradient method preconditioned by the cycle on the next coarser level (Notay & Vassilevski).
+  // Since the resulting preconditioner is a nonlinear operator, it should be combined with a
+  // flexible outer Krylov solver (e.g. FGMRES).
+  bool krylov_acceleration;
+
+  // Krylov acceleration is applied to the coarse-grid correction of every
+  // krylov_acceleration_interval-th level, counted from the finest level. The correction to
+  // the coarsest level is never accelerated.
+  unsigned int krylov_acceleration_interval;
+
+  // The second inner iteration of the K-cycle is skipped if the first one already reduced the
+  // norm of the coarse residual by this factor.
+  double krylov_acceleration_tolerance;
+
+  // Full multigrid (nested iteration): the right-hand side is restricted to all levels, the
+  // coarse problem is solved, and the solution is prolongated level by level applying
+  // full_multigrid_cycles cycles on each level. The result is used as initial guess of the
+  // outer Krylov solver, but only if the initial guess provided by the caller is zero (e.g., a
+  // solution extrapolated in time is not overwritten).
+  bool full_multigrid;
+
+  unsigned int full_multigrid_cycles;
+};
+
 struct MultigridData
 {
   MultigridData()
     : type(MultigridType::hMG),
       p_sequence(PSequenceType::Bisect),
+      cycle_data(CycleData()),
       smoother_data(SmootherData()),
       coarse_problem(CoarseGridData())
   {
@@ -298,6 +452,8 @@ struct MultigridData
       print_parameter(pcout, "p-sequence", enum_to_string(p_sequence));
     }
 
+    cycle_data.print(pcout);
+
     smoother_data.print(pcout);
 
     coarse_problem.print(pcout);
@@ -318,6 +474,9 @@ struct MultigridData
   // Sequence of polynomial degrees during p-multigrid
   PSequenceType p_sequence;
 
+  // Multigrid cycle (V/W/F, K-cycle, full multigrid)
+  CycleData cycle_data;
+
   // Smoother data
   SmootherData smoother_data;
 
@@ -715,6 +715,14 @@ MultigridPreconditionerBase<dim, Number>::solve(VectorType & dst, VectorType con
   return multigrid_algorithm->solve(dst, src);
 }
 
+template<int dim, typename Number>
+void
+MultigridPreconditionerBase<dim, Number>::apply_full_multigrid(VectorType &       dst,
+                                                               VectorType const & src) const
+{
+  multigrid_algorithm->full_multigrid(dst, src);
+}
+
 template<int dim, typename Number>
 void
 MultigridPreconditionerBase<dim, Number>::apply_smoother_on_fine_level(
@@ -1028,9 +1036,13 @@ template<int dim, typename Number>
 void
 MultigridPreconditionerBase<dim, Number>::initialize_multigrid_algorithm()
 {
-  this
-    ->multigrid_algorithm = std::make_shared<MultigridAlgorithm<VectorTypeMG, Operator, Smoother>>(
-    this->operators, *this->coarse_grid_solver, *this->transfers, this->smoothers, this->mpi_comm);
+  this->multigrid_algorithm =
+    std::make_shared<MultigridAlgorithm<VectorTypeMG, Operator, Smoother>>(this->operators,
+                                                                           *coarse_grid_solver,
+                                                                           *this->transfers,
+                                                                           this->smoothers,
+                                                                           this->mpi_comm,
+                                                                           this->data.cycle_data);
 }
 
 template<int dim, typename Number>
@@ -117,6 +117,13 @@ public:
   unsigned int
   solve(VectorType & dst, VectorType const & src) const;
 
+  /*
+   * Full multigrid (nested iteration) in order to compute an initial guess dst for the problem
+   * with right-hand side src. A nonzero dst is left unchanged.
+   */
+  void
+  apply_full_multigrid(VectorType & dst, VectorType const & src) const;
+
   /*
    * This function applies the smoother on the fine level as a means to test the
    * multigrid ingredients.
@@ -22,8 +22,15 @@
 #ifndef INCLUDE_SOLVERS_AND_PRECONDITIONERS_NEWTON_SOLVER_H_
 #define INCLUDE_SOLVERS_AND_PRECONDITIONERS_NEWTON_SOLVER_H_
 
+// C/C++
+#include <algorithm>
+#include <cmath>
+#include <tuple>
+
 // deal.II
 #include <deal.II/base/exceptions.h>
+#include <deal.II/lac/la_parallel_block_vector.h>
+#include <deal.II/lac/la_parallel_vector.h>
 
 // ExaDG
 #include <exadg/solvers_and_preconditioners/newton/newton_solver_data.h>
@@ -32,6 +39,79 @@ namespace ExaDG
 {
 namespace Newton
 {
+namespace internal
+{
+/*
+ * Returns true if the work vector does not have the parallel layout of the given vector and has
+ * to be reinitialized. Vectors of equal size may still be distributed differently, e.g. after
+ * repartitioning, so that the partitioners are compared.
+ */
+template<typename Number>
+bool
+layout_differs(dealii::LinearAlgebra::distributed::Vector<Number> const & work_vector,
+               dealii::LinearAlgebra::distributed::Vector<Number> const & vector)
+{
+  if(work_vector.get_partitioner() == vector.get_partitioner())
+    return false;
+
+  return work_vector.size() != vector.size() or
+         not work_vector.partitioners_are_compatible(*vector.get_partitioner());
+}
+
+template<typename Number>
+bool
+layout_differs(dealii::LinearAlgebra::distributed::BlockVector<Number> const & work_vector,
+               dealii::LinearAlgebra::distributed::BlockVector<Number> const & vector)
+{
+  if(work_vector.n_blocks() != vector.n_blocks())
+    return true;
+
+  for(unsigned int b = 0; b < vector.n_blocks(); ++b)
+    if(layout_differs(work_vector.block(b), vector.block(b)))
+      return true;
+
+  return false;
+}
+
+/*
+ * Overrides the relative tolerance of a linear solver during the lifetime of this object. The
+ * relative tolerance of the solver data is restored by the destructor, i.e., also if the Newton
+ * solver is left via an exception.
+ */
+template<typename LinearSolver>
+class RelativeToleranceOverride
+{
+public:
+  RelativeToleranceOverride(LinearSolver & linear_solver_in, bool const active_in)
+    : linear_solver(linear_solver_in), active(active_in)
+  {
+  }
+
+  ~RelativeToleranceOverride()
+  {
+    if(active)
+      linear_solver.set_relative_tolerance(-1.0);
+  }
+
+  void
+  set(double const rel_tol) const
+  {
+    if(active)
+      linear_solver.set_relative_tolerance(rel_tol);
+  }
+
+private:
+  LinearSolver & linear_solver;
+  bool const     active;
+};
+} // namespace internal
+
+/*
+ * Damped (inexact) Newton solver. The work vectors are owned by the solver and are only
+ * reinitialized if the layout of the solution vector changes, and the line search operates
+ * in place on the solution vector. If the line search fails, the solution of the last accepted
+ * Newton step is restored before the exception is thrown.
+ */
 template<typename VectorType,
          typename NonlinearOperator,
          typename LinearOperator,
@@ -48,6 +128,8 @@ public:
       linear_operator(linear_operator_in),
       linear_solver(linear_solver_in)
   {
+    AssertThrow(solver_data.line_search_reduction > 0.0 and solver_data.line_search_reduction < 1.0,
+                dealii::ExcMessage("Line search step reduction has to be in (0,1)."));
   }
 
   std::tuple<unsigned int /* Newton iter */, unsigned int /* accumulated linear iter */>
@@ -55,10 +137,11 @@ public:
   {
     unsigned int newton_iterations = 0, linear_iterations = 0;
 
-    VectorType residual, increment, temporary;
-    residual.reinit(solution);
-    increment.reinit(solution);
-    temporary.reinit(solution);
+    if(internal::layout_differs(residual, solution))
+    {
+      residual.reinit(solution);
+      increment.reinit(solution);
+    }
 
     // evaluate residual using initial guess of solution
     nonlinear_operator.evaluate_residual(residual, solution);
@@ -66,6 +149,14 @@ public:
     double norm_r   = residual.l2_norm();
     double norm_r_0 = norm_r;
 
+    statistics.clear();
+    statistics.initial_residual_norm = norm_r;
+
+    double forcing_term = solver_data.forcing_term_initial;
+
+    internal::RelativeToleranceOverride<LinearSolver> tolerance_override(
+      linear_solver, solver_data.use_inexact_newton);
+
     while(norm_r > this->solver_data.abs_tol && norm_r / norm_r_0 > solver_data.rel_tol &&
           newton_iterations < solver_data.max_iter)
     {
@@ -85,41 +176,61 @@ public:
       // update the preconditioner
       linear_solver.update_preconditioner(update_now);
 
-      // solve linear problem
+      // solve linear problem (the initial residual of the linear solver is the nonlinear
+      // residual since the increment is zero, so that the forcing term is a relative tolerance)
+      tolerance_override.set(forcing_term);
+
       unsigned int const n_iter_linear = linear_solver.solve(increment, residual);
 
-      // damped Newton scheme
-      double             omega         = 1.0; // damping factor (begin with 1)
-      double             norm_r_damp   = 1.0; // norm of residual using temporary solution
-      unsigned int       n_iter_damp   = 0;   // counts iteration of damping scheme
-      unsigned int const max_iter_damp = 10;  // max iterations of damping scheme
-      double const       tau           = 0.5; // a parameter (has to be smaller than 1)
-      do
+      // damped Newton scheme: backtracking line search in place on the solution vector
+      double       omega       = 1.0; // damping factor (begin with 1)
+      double       omega_old   = 0.0; // damping factor already added to the solution
+      double       norm_r_damp = 1.0; // norm of residual using damped solution
+      unsigned int n_iter_damp = 0;   // counts iteration of damping scheme
+      bool         accepted    = false;
+      while(not accepted && n_iter_damp < solver_data.max_iter_line_search)
       {
         // add increment to solution vector but scale by a factor omega <= 1
-        temporary = solution;
-        temporary.add(omega, increment);
+        solution.add(omega - omega_old, increment);
+        omega_old = omega;
 
-        // evaluate residual using the temporary solution
-        nonlinear_operator.evaluate_residual(residual, temporary);
+        // evaluate residual using the damped solution
+        nonlinear_operator.evaluate_residual(residual, solution);
 
-        // calculate norm of residual (for temporary solution)
+        // calculate norm of residual (for damped solution)
         norm_r_damp = residual.l2_norm();
 
-        // reduce step length
-        omega = omega / 2.0;
-
         // increment counter
         n_iter_damp++;
-      } while(norm_r_damp >= (1.0 - tau * omega) * norm_r && n_iter_damp < max_iter_damp);
 
-      AssertThrow(norm_r_damp < (1.0 - tau * omega) * norm_r,
+        accepted = norm_r_damp < (1.0 - solver_data.sufficient_decrease * omega) * norm_r;
+
+        // reduce step length
+        if(not accepted)
+          omega *= solver_data.line_search_reduction;
+      }
+
+      // undo the damped update, so that the caller gets back the solution of the last accepted step
+      if(not accepted)
+        solution.add(-omega_old, increment);
+
+      AssertThrow(accepted,
                   dealii::ExcMessage("Damped Newton iteration did not converge. "
                                      "Maximum number of iterations exceeded!"));
 
-      // update solution and residual
-      solution = temporary;
-      norm_r   = norm_r_damp;
+      Statistics::Iteration iteration;
+      iteration.residual_norm     = norm_r_damp;
+      iteration.forcing_term      = solver_data.use_inexact_newton ? forcing_term : -1.0;
+      iteration.linear_iterations = n_iter_linear;
+      iteration.step_length       = omega;
+      iteration.n_steps           = n_iter_damp;
+      statistics.iterations.push_back(iteration);
+
+      if(solver_data.use_inexact_newton)
+        forcing_term = compute_forcing_term(forcing_term, norm_r_damp, norm_r);
+
+      // update residual norm
+      norm_r = norm_r_damp;
 
       // increment iteration counter
       ++newton_iterations;
@@ -142,11 +253,50 @@ public:
     return std::tuple<unsigned int, unsigned int>(newton_iterations, linear_iterations);
   }
 
+  /*
+   * Returns the statistics of the last call to solve().
+   */
+  Statistics const &
+  get_statistics() const
+  {
+    return statistics;
+  }
+
 private:
+  /*
+   * Eisenstat-Walker forcing term (choice 2) with the safeguards proposed by Eisenstat and Walker
+   * (avoid a too fast decrease of the forcing term) and Kelley (avoid oversolving in the last
+   * iteration, i.e., solving the linear problem more accurately than required by the absolute
+   * tolerance of the Newton solver).
+   */
+  double
+  compute_forcing_term(double const forcing_term_old,
+                       double const norm_r_new,
+                       double const norm_r_old) const
+  {
+    double const gamma = solver_data.forcing_term_gamma;
+    double const alpha = solver_data.forcing_term_alpha;
+
+    double forcing_term = gamma * std::pow(norm_r_new / norm_r_old, alpha);
+
+    double const safeguard = gamma * std::pow(forcing_term_old, alpha);
+    if(safeguard > 0.1)
+      forcing_term = std::max(forcing_term, safeguard);
+
+    forcing_term = std::max(forcing_term, 0.5 * solver_data.abs_tol / norm_r_new);
+
+    return std::min(forcing_term, solver_data.forcing_term_max);
+  }
+
   SolverData          solver_data;
   NonlinearOperator & nonlinear_operator;
   LinearOperator &    linear_operator;
   LinearSolver &      linear_solver;
+
+  // work vectors
+  VectorType residual, increment;
+
+  Statistics statistics;
 };
 
 } // namespace Newton
@@ -22,6 +22,10 @@
 #ifndef INCLUDE_SOLVERS_AND_PRECONDITIONERS_NEWTON_SOLVER_DATA_H_
 #define INCLUDE_SOLVERS_AND_PRECONDITIONERS_NEWTON_SOLVER_DATA_H_
 
+// C/C++
+#include <iomanip>
+#include <vector>
+
 // deal.II
 #include <deal.II/base/conditional_ostream.h>
 
@@ -34,12 +38,33 @@ namespace Newton
 {
 struct SolverData
 {
-  SolverData() : max_iter(100), abs_tol(1.e-12), rel_tol(1.e-12)
+  SolverData()
+    : max_iter(100),
+      abs_tol(1.e-12),
+      rel_tol(1.e-12),
+      use_inexact_newton(false),
+      forcing_term_initial(0.1),
+      forcing_term_max(0.9),
+      forcing_term_gamma(0.9),
+      forcing_term_alpha(2.0),
+      max_iter_line_search(10),
+      line_search_reduction(0.5),
+      sufficient_decrease(0.25)
   {
   }
 
   SolverData(unsigned int const max_iter_, double const abs_tol_, double const rel_tol_)
-    : max_iter(max_iter_), abs_tol(abs_tol_), rel_tol(rel_tol_)
+    : max_iter(max_iter_),
+      abs_tol(abs_tol_),
+      rel_tol(rel_tol_),
+      use_inexact_newton(false),
+      forcing_term_initial(0.1),
+      forcing_term_max(0.9),
+      forcing_term_gamma(0.9),
+      forcing_term_alpha(2.0),
+      max_iter_line_search(10),
+      line_search_reduction(0.5),
+      sufficient_decrease(0.25)
   {
   }
 
@@ -49,11 +74,103 @@ struct SolverData
     print_parameter(pcout, "Maximum number of iterations", max_iter);
     print_parameter(pcout, "Absolute solver tolerance", abs_tol);
     print_parameter(pcout, "Relative solver tolerance", rel_tol);
+    print_parameter(pcout, "Inexact Newton (Eisenstat-Walker)", use_inexact_newton);
+    if(use_inexact_newton)
+    {
+      print_parameter(pcout, "Initial forcing term", forcing_term_initial);
+      print_parameter(pcout, "Maximum forcing term", forcing_term_max);
+      print_parameter(pcout, "Forcing term gamma", forcing_term_gamma);
+      print_parameter(pcout, "Forcing term alpha", forcing_term_alpha);
+    }
+    print_parameter(pcout, "Maximum number of line search steps", max_iter_line_search);
+    print_parameter(pcout, "Line search step reduction", line_search_reduction);
+    print_parameter(pcout, "Sufficient decrease parameter", sufficient_decrease);
   }
 
   unsigned int max_iter;
   double       abs_tol;
   double       rel_tol;
+
+  /*
+   * Inexact Newton method: The linearized problem is only solved up to a relative tolerance
+   * (forcing term) eta_k that is adapted to the convergence of the nonlinear residual according to
+   * choice 2 of
+   *
+   *   Eisenstat, S.C., Walker, H.F. (1996). Choosing the forcing terms in an inexact Newton method.
+   *   SIAM Journal on Scientific Computing, 17(1), 16-32,
+   *
+   * i.e., eta_k = gamma * (|r_k| / |r_{k-1}|)^alpha with safeguards. If the inexact Newton method
+   * is not used, the relative tolerance of the linear solver is used in all Newton iterations.
+   */
+  bool         use_inexact_newton;
+  double       forcing_term_initial;
+  double       forcing_term_max;
+  double       forcing_term_gamma;
+  double       forcing_term_alpha;
+
+  /*
+   * Backtracking line search: the step length omega is reduced by the factor line_search_reduction
+   * until the sufficient decrease condition |r(u + omega du)| < (1 - sufficient_decrease * omega)
+   * |r(u)| is fulfilled.
+   */
+  unsigned int max_iter_line_search;
+  double       line_search_reduction;
+  double       sufficient_decrease;
+};
+
+/*
+ * Statistics of the iterations of the last nonlinear solve.
+ */
+struct Statistics
+{
+  struct Iteration
+  {
+    Iteration()
+      : residual_norm(0.0), forcing_term(0.0), linear_iterations(0), step_length(1.0), n_steps(0)
+    {
+    }
+
+    // norm of the nonlinear residual at the end of the iteration
+    double       residual_norm;
+    // relative tolerance of the linear solver
+    double       forcing_term;
+    unsigned int linear_iterations;
+    // step length and number of residual evaluations of the line search
+    double       step_length;
+    unsigned int n_steps;
+  };
+
+  void
+  clear()
+  {
+    initial_residual_norm = 0.0;
+    iterations.clear();
+  }
+
+  void
+  print(dealii::ConditionalOStream const & pcout) const
+  {
+    // clang-format off
+    pcout << std::endl
+          << "  Iter.  Residual      Forcing term  Lin. iter.  Step length" << std::endl
+          << "  " << std::setw(5) << std::left << 0
+          << "  " << std::setw(12) << std::scientific << std::setprecision(4) << std::left << initial_residual_norm
+          << std::endl;
+    for(unsigned int i = 0; i < iterations.size(); ++i)
+    {
+      pcout << "  " << std::setw(5) << std::left << i + 1
+            << "  " << std::setw(12) << std::scientific << std::setprecision(4) << std::left << iterations[i].residual_norm
+            << "  " << std::setw(12) << std::scientific << std::setprecision(4) << std::left << iterations[i].forcing_term
+            << "  " << std::setw(10) << std::left << iterations[i].linear_iterations
+            << "  " << std::setw(11) << std::fixed << std::setprecision(4) << std::left << iterations[i].step_length
+            << std::endl;
+    }
+    pcout << std::flush;
+    // clang-format on
+  }
+
+  double                 initial_residual_norm;
+  std::vector<Iteration> iterations;
 };
 
 struct UpdateData
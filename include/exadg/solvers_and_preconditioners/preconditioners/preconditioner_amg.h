@@ -28,6 +28,8 @@
 #include <deal.II/lac/trilinos_precondition.h>
 #include <deal.II/lac/trilinos_sparse_matrix.h>
 
+#include <exadg/solvers_and_preconditioners/amg/smoothed_aggregation_amg.h>
+#include <exadg/solvers_and_preconditioners/amg/sparse_matrix_csr.h>
 #include <exadg/solvers_and_preconditioners/multigrid/multigrid_parameters.h>
 #include <exadg/solvers_and_preconditioners/preconditioners/preconditioner_base.h>
 #include <exadg/solvers_and_preconditioners/utilities/petsc_operation.h>
@@ -256,8 +258,72 @@ private:
 };
 #endif
 
+/*
+ * Wrapper class for the native smoothed aggregation AMG, which is available independently of
+ * Trilinos and PETSc.
+ */
+template<typename Operator, typename Number>
+class PreconditionerNativeAMG : public PreconditionerBase<Number>
+{
+private:
+  typedef dealii::LinearAlgebra::distributed::Vector<Number> VectorType;
+
+public:
+  // distributed sparse system matrix
+  SparseMatrixCSR system_matrix;
+
+  // amg preconditioner for access by Krylov solvers operating on the system matrix
+  SmoothedAggregationAMG amg;
+
+  PreconditionerNativeAMG(Operator const & op, NativeAMGData const & native_data = NativeAMGData())
+    : pde_operator(op), native_data(native_data)
+  {
+    // initialize system matrix
+    pde_operator.init_system_matrix(system_matrix,
+                                    op.get_matrix_free().get_dof_handler().get_communicator());
+
+    // calculate_matrix
+    pde_operator.calculate_system_matrix(system_matrix);
+
+    // setup of multigrid hierarchy
+    amg.initialize(system_matrix, native_data);
+  }
+
+  SparseMatrixCSR const &
+  get_system_matrix()
+  {
+    return system_matrix;
+  }
+
+  void
+  update() override
+  {
+    // clear content of matrix since the next calculate_system_matrix-commands add their result
+    system_matrix = 0.0;
+
+    // re-calculate matrix
+    pde_operator.calculate_system_matrix(system_matrix);
+
+    // setup of multigrid hierarchy
+    amg.initialize(system_matrix, native_data);
+  }
+
+  void
+  vmult(VectorType & dst, VectorType const & src) const override
+  {
+    amg.vmult(dst, src);
+  }
+
+private:
+  // reference to matrix-free operator
+  Operator const & pde_operator;
+
+  NativeAMGData native_data;
+};
+
 /**
- * Implementation of AMG preconditioner unifying PreconditionerML and PreconditionerBoomerAMG.
+ * Implementation of AMG preconditioner unifying PreconditionerML, PreconditionerBoomerAMG, and
+ * PreconditionerNativeAMG.
  */
 template<typename Operator, typename Number>
 class PreconditionerAMG : public PreconditionerBase<Number>
@@ -291,6 +357,11 @@ public:
       AssertThrow(false, dealii::ExcMessage("deal.II is not compiled with Trilinos!"));
 #endif
     }
+    else if(data.amg_type == AMGType::Native)
+    {
+      preconditioner_amg =
+        std::make_shared<PreconditionerNativeAMG<Operator, double>>(pde_operator, data.native_data);
+    }
     else
     {
       AssertThrow(false, dealii::ExcNotImplemented());
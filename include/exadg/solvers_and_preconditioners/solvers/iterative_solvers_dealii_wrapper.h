@@ -29,6 +29,8 @@
 #include <deal.II/lac/solver_gmres.h>
 
 // ExaDG
+#include <exadg/solvers_and_preconditioners/solvers/krylov_recycling.h>
+#include <exadg/solvers_and_preconditioners/solvers/solution_history_projection.h>
 #include <exadg/utilities/timer_tree.h>
 
 namespace ExaDG
@@ -39,7 +41,15 @@ template<typename VectorType>
 class SolverBase
 {
 public:
-  SolverBase() : l2_0(1.0), l2_n(1.0), n(0), rho(0.0), n10(0)
+  SolverBase()
+    : l2_0(1.0),
+      l2_n(1.0),
+      n(0),
+      rho(0.0),
+      n10(0),
+      n_saved_iterations(0.0),
+      l2_reference(0.0),
+      relative_tolerance(-1.0)
   {
     timer_tree = std::make_shared<TimerTree>();
   }
@@ -54,6 +64,26 @@ public:
   virtual void
   update_preconditioner(bool const update_preconditioner) const = 0;
 
+  /*
+   * Discards the stored solutions of the solution history projection, e.g. after the operator has
+   * changed.
+   */
+  void
+  reset_solution_history() const
+  {
+    solution_history.reset();
+  }
+
+  /*
+   * Overrides the relative tolerance specified in the solver data for subsequent solves, e.g. by
+   * an inexact Newton solver. A negative value restores the relative tolerance of the solver data.
+   */
+  void
+  set_relative_tolerance(double const rel_tol) const
+  {
+    relative_tolerance = rel_tol;
+  }
+
   template<typename Control>
   void
   compute_performance_metrics(Control const & solver_control) const
@@ -77,6 +107,16 @@ public:
     return timer_tree;
   }
 
+  /*
+   * Memory consumption in bytes of the vectors that are kept by the solver from one solve to the
+   * next (e.g. recycled Krylov subspaces).
+   */
+  virtual std::size_t
+  memory_consumption() const
+  {
+    return 0;
+  }
+
   // performance metrics
   mutable double       l2_0; // norm of initial residual
   mutable double       l2_n; // norm of final residual
@@ -84,8 +124,83 @@ public:
   mutable double       rho;  // average convergence rate
   mutable double       n10;  // number of iterations needed to reduce the residual by 1e10
 
+  // estimated number of iterations saved by the solution history projection in the last solve
+  mutable double n_saved_iterations;
+
 protected:
+  /*
+   * Returns the relative tolerance set by set_relative_tolerance() if specified, and the relative
+   * tolerance of the solver data otherwise.
+   */
+  double
+  get_relative_tolerance(double const rel_tol_solver_data) const
+  {
+    return relative_tolerance >= 0.0 ? relative_tolerance : rel_tol_solver_data;
+  }
+
+  /*
+   * Creates the solver control. If the solution history projection is enabled, the initial guess
+   * dst is improved and the relative tolerance refers to the residual of the initial guess provided
+   * by the caller, so that the improved initial guess results in a reduced number of iterations.
+   */
+  template<typename Operator>
+  dealii::ReductionControl
+  create_solver_control(Operator const &   op,
+                        VectorType &       dst,
+                        VectorType const & rhs,
+                        unsigned int const max_iter,
+                        double const       abs_tol,
+                        double const       rel_tol) const
+  {
+    if(solution_history.enabled())
+    {
+      VectorType residual;
+      l2_reference = solution_history.compute_initial_guess(op, dst, rhs, residual);
+
+      return dealii::ReductionControl(max_iter, std::max(abs_tol, rel_tol * l2_reference), 0.0);
+    }
+    else
+    {
+      return dealii::ReductionControl(max_iter, abs_tol, rel_tol);
+    }
+  }
+
+  /*
+   * Appends the solution to the solution history and estimates the number of saved iterations
+   * from the average convergence rate of the current solve.
+   */
+  template<typename Operator>
+  void
+  update_solution_history(Operator const &              op,
+                          VectorType const &            dst,
+                          dealii::SolverControl const & solver_control) const
+  {
+    if(not solution_history.enabled())
+      return;
+
+    solution_history.update(op, dst);
+
+    n_saved_iterations = 0.0;
+
+    double const       initial_value = solver_control.initial_value();
+    unsigned int const n_steps       = solver_control.last_step();
+    if(n_steps > 0 && initial_value > 0.0 && l2_reference > initial_value)
+    {
+      double const rate = std::pow(solver_control.last_value() / initial_value, 1.0 / n_steps);
+      if(rate > 0.0 && rate < 1.0)
+        n_saved_iterations = std::log(l2_reference / initial_value) / (-std::log(rate));
+    }
+  }
+
   std::shared_ptr<TimerTree> timer_tree;
+
+  mutable SolutionHistoryProjection<VectorType> solution_history;
+
+  // norm of the residual of the initial guess provided by the caller of solve()
+  mutable double l2_reference;
+
+  // relative tolerance overriding the one of the solver data (negative = not specified)
+  mutable double relative_tolerance;
 };
 
 struct SolverDataCG
@@ -95,7 +210,8 @@ struct SolverDataCG
       solver_tolerance_abs(1.e-20),
       solver_tolerance_rel(1.e-6),
       use_preconditioner(false),
-      compute_performance_metrics(false)
+      compute_performance_metrics(false),
+      solution_history_size(0)
   {
   }
 
@@ -104,6 +220,8 @@ struct SolverDataCG
   double       solver_tolerance_rel;
   bool         use_preconditioner;
   bool         compute_performance_metrics;
+  // number of previous solutions used to compute the initial guess (0 = disabled)
+  unsigned int solution_history_size;
 };
 
 template<typename Operator, typename Preconditioner, typename VectorType>
@@ -117,6 +235,7 @@ public:
       preconditioner(preconditioner_in),
       solver_data(solver_data_in)
   {
+    this->solution_history.reinit(solver_data.solution_history_size);
   }
 
   void
@@ -133,9 +252,13 @@ public:
   {
     dealii::Timer timer;
 
-    dealii::ReductionControl solver_control(solver_data.max_iter,
-                                            solver_data.solver_tolerance_abs,
-                                            solver_data.solver_tolerance_rel);
+    dealii::ReductionControl solver_control =
+      this->create_solver_control(underlying_operator,
+                                  dst,
+                                  rhs,
+                                  solver_data.max_iter,
+                                  solver_data.solver_tolerance_abs,
+                                  this->get_relative_tolerance(solver_data.solver_tolerance_rel));
 
     dealii::SolverCG<VectorType> solver(solver_control);
 
@@ -154,6 +277,8 @@ public:
     if(solver_data.compute_performance_metrics)
       this->compute_performance_metrics(solver_control);
 
+    this->update_solution_history(underlying_operator, dst, solver_control);
+
     this->timer_tree->insert({"SolverCG"}, timer.wall_time());
 
     return solver_control.last_step();
@@ -200,7 +325,8 @@ struct SolverDataGMRES
       use_preconditioner(false),
       max_n_tmp_vectors(30),
       compute_eigenvalues(false),
-      compute_performance_metrics(false)
+      compute_performance_metrics(false),
+      solution_history_size(0)
   {
   }
 
@@ -211,6 +337,8 @@ struct SolverDataGMRES
   unsigned int max_n_tmp_vectors;
   bool         compute_eigenvalues;
   bool         compute_performance_metrics;
+  // number of previous solutions used to compute the initial guess (0 = disabled)
+  unsigned int solution_history_size;
 };
 
 template<typename Operator, typename Preconditioner, typename VectorType>
@@ -226,6 +354,7 @@ public:
       solver_data(solver_data_in),
       mpi_comm(mpi_comm_in)
   {
+    this->solution_history.reinit(solver_data.solution_history_size);
   }
 
   virtual ~SolverGMRES()
@@ -246,9 +375,13 @@ public:
   {
     dealii::Timer timer;
 
-    dealii::ReductionControl solver_control(solver_data.max_iter,
-                                            solver_data.solver_tolerance_abs,
-                                            solver_data.solver_tolerance_rel);
+    dealii::ReductionControl solver_control =
+      this->create_solver_control(underlying_operator,
+                                  dst,
+                                  rhs,
+                                  solver_data.max_iter,
+                                  solver_data.solver_tolerance_abs,
+                                  this->get_relative_tolerance(solver_data.solver_tolerance_rel));
 
     typename dealii::SolverGMRES<VectorType>::AdditionalData additional_data;
     additional_data.max_n_tmp_vectors     = solver_data.max_n_tmp_vectors;
@@ -279,6 +412,8 @@ public:
     if(solver_data.compute_performance_metrics)
       this->compute_performance_metrics(solver_control);
 
+    this->update_solution_history(underlying_operator, dst, solver_control);
+
     this->timer_tree->insert({"SolverGMRES"}, timer.wall_time());
 
     return solver_control.last_step();
@@ -308,7 +443,8 @@ struct SolverDataFGMRES
       solver_tolerance_rel(1.e-6),
       use_preconditioner(false),
       max_n_tmp_vectors(30),
-      compute_performance_metrics(false)
+      compute_performance_metrics(false),
+      solution_history_size(0)
   {
   }
 
@@ -318,6 +454,8 @@ struct SolverDataFGMRES
   bool         use_preconditioner;
   unsigned int max_n_tmp_vectors;
   bool         compute_performance_metrics;
+  // number of previous solutions used to compute the initial guess (0 = disabled)
+  unsigned int solution_history_size;
 };
 
 template<typename Operator, typename Preconditioner, typename VectorType>
@@ -331,6 +469,7 @@ public:
       preconditioner(preconditioner_in),
       solver_data(solver_data_in)
   {
+    this->solution_history.reinit(solver_data.solution_history_size);
   }
 
   virtual ~SolverFGMRES()
@@ -351,9 +490,13 @@ public:
   {
     dealii::Timer timer;
 
-    dealii::ReductionControl solver_control(solver_data.max_iter,
-                                            solver_data.solver_tolerance_abs,
-                                            solver_data.solver_tolerance_rel);
+    dealii::ReductionControl solver_control =
+      this->create_solver_control(underlying_operator,
+                                  dst,
+                                  rhs,
+                                  solver_data.max_iter,
+                                  solver_data.solver_tolerance_abs,
+                                  this->get_relative_tolerance(solver_data.solver_tolerance_rel));
 
     typename dealii::SolverFGMRES<VectorType>::AdditionalData additional_data;
     additional_data.max_basis_size = solver_data.max_n_tmp_vectors;
@@ -376,6 +519,8 @@ public:
     if(solver_data.compute_performance_metrics)
       this->compute_performance_metrics(solver_control);
 
+    this->update_solution_history(underlying_operator, dst, solver_control);
+
     this->timer_tree->insert({"SolverFGMRES"}, timer.wall_time());
 
     return solver_control.last_step();
@@ -394,6 +539,255 @@ private:
   Preconditioner &       preconditioner;
   SolverDataFGMRES const solver_data;
 };
+
+struct SolverDataDeflatedCG
+{
+  SolverDataDeflatedCG()
+    : max_iter(1e4),
+      solver_tolerance_abs(1.e-20),
+      solver_tolerance_rel(1.e-6),
+      use_preconditioner(false),
+      recycle_space_size(10),
+      max_n_tmp_vectors(30),
+      compute_performance_metrics(false)
+  {
+  }
+
+  unsigned int max_iter;
+  double       solver_tolerance_abs;
+  double       solver_tolerance_rel;
+  bool         use_preconditioner;
+  // dimension of the deflation space recycled between linear solves
+  unsigned int recycle_space_size;
+  // number of search directions stored to update the deflation space
+  unsigned int max_n_tmp_vectors;
+  bool         compute_performance_metrics;
+};
+
+/*
+ * Conjugate gradient solver with a deflation space that is recycled from one linear solve to the
+ * next, see DeflatedCG. The relative tolerance refers to the residual of the initial guess
+ * provided by the caller, i.e., before the projection onto the deflation space.
+ */
+template<typename Operator, typename Preconditioner, typename VectorType>
+class SolverDeflatedCG : public SolverBase<VectorType>
+{
+public:
+  SolverDeflatedCG(Operator const &             underlying_operator_in,
+                   Preconditioner &             preconditioner_in,
+                   SolverDataDeflatedCG const & solver_data_in)
+    : underlying_operator(underlying_operator_in),
+      preconditioner(preconditioner_in),
+      solver_data(solver_data_in),
+      n_solves(0)
+  {
+    recycling_solver.reinit(solver_data.recycle_space_size, solver_data.max_n_tmp_vectors);
+  }
+
+  void
+  update_preconditioner(bool const update_preconditioner) const override
+  {
+    if(solver_data.use_preconditioner and update_preconditioner)
+    {
+      preconditioner.update();
+    }
+  }
+
+  unsigned int
+  solve(VectorType & dst, VectorType const & rhs) const override
+  {
+    dealii::Timer timer;
+
+    double const l2_reference = recycling_solver.setup(underlying_operator, dst, rhs);
+
+    double const tolerance =
+      std::max(solver_data.solver_tolerance_abs,
+               this->get_relative_tolerance(solver_data.solver_tolerance_rel) * l2_reference);
+
+    dealii::ReductionControl solver_control(solver_data.max_iter, tolerance, 0.0);
+
+    if(solver_data.use_preconditioner == false)
+    {
+      recycling_solver.solve(underlying_operator,
+                             dst,
+                             dealii::PreconditionIdentity(),
+                             solver_control);
+    }
+    else
+    {
+      recycling_solver.solve(underlying_operator, dst, preconditioner, solver_control);
+    }
+
+    AssertThrow(std::isfinite(solver_control.last_value()),
+                dealii::ExcMessage("Solver contained NaN of Inf values"));
+
+    if(solver_data.compute_performance_metrics)
+      this->compute_performance_metrics(solver_control);
+
+    this->timer_tree->insert({"SolverDeflatedCG"}, timer.wall_time());
+
+    ++n_solves;
+
+    return solver_control.last_step();
+  }
+
+  std::shared_ptr<TimerTree>
+  get_timings() const override
+  {
+    // the solver entry only exists if solve() has been called
+    if(solver_data.use_preconditioner and n_solves > 0)
+      this->timer_tree->insert({"SolverDeflatedCG"}, preconditioner.get_timings());
+
+    return this->timer_tree;
+  }
+
+  std::size_t
+  memory_consumption() const override
+  {
+    return recycling_solver.memory_consumption();
+  }
+
+  unsigned int
+  n_recycled_vectors() const
+  {
+    return recycling_solver.n_recycled_vectors();
+  }
+
+private:
+  Operator const &           underlying_operator;
+  Preconditioner &           preconditioner;
+  SolverDataDeflatedCG const solver_data;
+
+  mutable DeflatedCG<VectorType> recycling_solver;
+
+  // number of calls of solve()
+  mutable unsigned int n_solves;
+};
+
+struct SolverDataGCRODR
+{
+  SolverDataGCRODR()
+    : max_iter(1e4),
+      solver_tolerance_abs(1.e-20),
+      solver_tolerance_rel(1.e-6),
+      use_preconditioner(false),
+      recycle_space_size(10),
+      max_n_tmp_vectors(30),
+      compute_performance_metrics(false)
+  {
+  }
+
+  unsigned int max_iter;
+  double       solver_tolerance_abs;
+  double       solver_tolerance_rel;
+  bool         use_preconditioner;
+  // dimension of the subspace recycled between linear solves
+  unsigned int recycle_space_size;
+  // length of the Arnoldi cycles (in addition to the recycled subspace)
+  unsigned int max_n_tmp_vectors;
+  bool         compute_performance_metrics;
+};
+
+/*
+ * Flexible GCRO-DR solver with a subspace that is recycled from one linear solve to the next, see
+ * GCRODR. As FGMRES, the solver uses right preconditioning and can be combined with variable
+ * preconditioners. The relative tolerance refers to the residual of the initial guess provided by
+ * the caller, i.e., before the projection onto the recycled subspace.
+ */
+template<typename Operator, typename Preconditioner, typename VectorType>
+class SolverGCRODR : public SolverBase<VectorType>
+{
+public:
+  SolverGCRODR(Operator const &         underlying_operator_in,
+               Preconditioner &         preconditioner_in,
+               SolverDataGCRODR const & solver_data_in)
+    : underlying_operator(underlying_operator_in),
+      preconditioner(preconditioner_in),
+      solver_data(solver_data_in),
+      n_solves(0)
+  {
+    recycling_solver.reinit(solver_data.recycle_space_size, solver_data.max_n_tmp_vectors);
+  }
+
+  void
+  update_preconditioner(bool const update_preconditioner) const override
+  {
+    if(solver_data.use_preconditioner and update_preconditioner)
+    {
+      preconditioner.update();
+    }
+  }
+
+  unsigned int
+  solve(VectorType & dst, VectorType const & rhs) const override
+  {
+    dealii::Timer timer;
+
+    double const l2_reference = recycling_solver.setup(underlying_operator, dst, rhs);
+
+    double const tolerance =
+      std::max(solver_data.solver_tolerance_abs,
+               this->get_relative_tolerance(solver_data.solver_tolerance_rel) * l2_reference);
+
+    dealii::ReductionControl solver_control(solver_data.max_iter, tolerance, 0.0);
+
+    if(solver_data.use_preconditioner == false)
+    {
+      recycling_solver.solve(underlying_operator,
+                             dst,
+                             dealii::PreconditionIdentity(),
+                             solver_control);
+    }
+    else
+    {
+      recycling_solver.solve(underlying_operator, dst, preconditioner, solver_control);
+    }
+
+    AssertThrow(std::isfinite(solver_control.last_value()),
+                dealii::ExcMessage("Solver contained NaN of Inf values"));
+
+    if(solver_data.compute_performance_metrics)
+      this->compute_performance_metrics(solver_control);
+
+    this->timer_tree->insert({"SolverGCRODR"}, timer.wall_time());
+
+    ++n_solves;
+
+    return solver_control.last_step();
+  }
+
+  std::shared_ptr<TimerTree>
+  get_timings() const override
+  {
+    // the solver entry only exists if solve() has been called
+    if(solver_data.use_preconditioner and n_solves > 0)
+      this->timer_tree->insert({"SolverGCRODR"}, preconditioner.get_timings());
+
+    return this->timer_tree;
+  }
+
+  std::size_t
+  memory_consumption() const override
+  {
+    return recycling_solver.memory_consumption();
+  }
+
+  unsigned int
+  n_recycled_vectors() const
+  {
+    return recycling_solver.n_recycled_vectors();
+  }
+
+private:
+  Operator const &       underlying_operator;
+  Preconditioner &       preconditioner;
+  SolverDataGCRODR const solver_data;
+
+  mutable GCRODR<VectorType> recycling_solver;
+
+  // number of calls of solve()
+  mutable unsigned int n_solves;
+};
 } // namespace Krylov
 
 } // namespace ExaDG
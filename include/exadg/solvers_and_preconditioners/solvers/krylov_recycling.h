@@ -0,0 +1,696 @@
+/*  ______________________________________________________________________
+ *
+ *  ExaDG - High-Order Discontinuous Galerkin for the Exa-Scale
+ *
+ *  Copyright (C) 2021 by the ExaDG authors
+ *
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *  ______________________________________________________________________
+ */
+
+#ifndef INCLUDE_EXADG_SOLVERS_AND_PRECONDITIONERS_SOLVERS_KRYLOV_RECYCLING_H_
+#define INCLUDE_EXADG_SOLVERS_AND_PRECONDITIONERS_SOLVERS_KRYLOV_RECYCLING_H_
+
+// C/C++
+#include <algorithm>
+#include <cmath>
+#include <complex>
+#include <memory>
+#include <numeric>
+#include <vector>
+
+// deal.II
+#include <deal.II/lac/full_matrix.h>
+#include <deal.II/lac/lapack_full_matrix.h>
+#include <deal.II/lac/solver_control.h>
+#include <deal.II/lac/vector.h>
+
+namespace ExaDG
+{
+namespace Krylov
+{
+namespace internal
+{
+template<typename VectorType>
+std::size_t
+memory_consumption(std::vector<std::shared_ptr<VectorType>> const & vectors)
+{
+  std::size_t memory = 0;
+  for(auto const & vector : vectors)
+    memory += vector->memory_consumption();
+
+  return memory;
+}
+
+/*
+ * Computes dst = sum_j coefficients(j) * vectors[j].
+ */
+template<typename VectorType>
+std::shared_ptr<VectorType>
+linear_combination(std::vector<std::shared_ptr<VectorType>> const & vectors,
+                   dealii::Vector<double> const &                   coefficients)
+{
+  std::shared_ptr<VectorType> dst = std::make_shared<VectorType>();
+  dst->reinit(*vectors[0]);
+  for(unsigned int j = 0; j < vectors.size(); ++j)
+    dst->add(coefficients(j), *vectors[j]);
+
+  return dst;
+}
+} // namespace internal
+
+/*
+ * Deflated preconditioned conjugate gradient method for sequences of symmetric positive definite
+ * linear systems, see
+ *
+ *   Saad, Y., Yeung, M., Erhel, J., Guyomarc'h, F. (2000). A deflated version of the conjugate
+ *   gradient algorithm. SIAM Journal on Scientific Computing, 21(5), 1909-1926.
+ *
+ * The search directions are kept A-orthogonal to a deflation space W. The deflation space is
+ * recycled between consecutive linear solves: After each solve, W is replaced by the Ritz vectors
+ * of A belonging to the smallest Ritz values in the space spanned by W and the first search
+ * directions of the current solve. Since the operator may change between solves (e.g. in Newton
+ * iterations), A W is recomputed at the beginning of every solve, which requires one operator
+ * evaluation per vector of the deflation space.
+ */
+template<typename VectorType>
+class DeflatedCG
+{
+public:
+  DeflatedCG() : recycle_space_size(0), max_n_directions(0)
+  {
+  }
+
+  void
+  reinit(unsigned int const recycle_space_size_in, unsigned int const max_n_directions_in)
+  {
+    recycle_space_size = recycle_space_size_in;
+    max_n_directions   = max_n_directions_in;
+    reset();
+  }
+
+  /*
+   * Discards the deflation space.
+   */
+  void
+  reset()
+  {
+    W.clear();
+    AW.clear();
+    P.clear();
+    AP.clear();
+  }
+
+  unsigned int
+  n_recycled_vectors() const
+  {
+    return W.size();
+  }
+
+  /*
+   * Memory consumption of the deflation space, the stored search directions, and the work vectors
+   * in bytes.
+   */
+  std::size_t
+  memory_consumption() const
+  {
+    return internal::memory_consumption(W) + internal::memory_consumption(AW) +
+           internal::memory_consumption(P) + internal::memory_consumption(AP) +
+           r.memory_consumption() + z.memory_consumption() + p.memory_consumption() +
+           q.memory_consumption();
+  }
+
+  /*
+   * Adapts the deflation space to the operator A and projects the initial guess x, so that the
+   * residual is orthogonal to the deflation space. Returns the norm of the residual of the initial
+   * guess provided by the caller.
+   */
+  template<typename Operator>
+  double
+  setup(Operator const & A, VectorType & x, VectorType const & b)
+  {
+    // A-orthonormalize the deflation space by modified Gram-Schmidt
+    std::vector<std::shared_ptr<VectorType>> W_new, AW_new;
+    for(unsigned int i = 0; i < W.size(); ++i)
+    {
+      std::shared_ptr<VectorType> w  = W[i];
+      std::shared_ptr<VectorType> Aw = std::make_shared<VectorType>();
+      Aw->reinit(*w, true);
+      A.vmult(*Aw, *w);
+
+      double const norm_initial = std::sqrt(std::abs(*w * *Aw));
+      for(unsigned int j = 0; j < W_new.size(); ++j)
+      {
+        double const alpha = *W_new[j] * *Aw;
+        w->add(-alpha, *W_new[j]);
+        Aw->add(-alpha, *AW_new[j]);
+      }
+
+      double const norm = std::sqrt(std::abs(*w * *Aw));
+      if(norm > 1.e-10 * norm_initial && norm > 0.0)
+      {
+        *w /= norm;
+        *Aw /= norm;
+        W_new.push_back(w);
+        AW_new.push_back(Aw);
+      }
+    }
+    W  = W_new;
+    AW = AW_new;
+
+    r.reinit(x, true);
+    A.vmult(r, x);
+    r.sadd(-1.0, 1.0, b);
+
+    double const l2_reference = r.l2_norm();
+
+    // x <- x + W (W^T A W)^{-1} W^T r with W^T A W = I
+    for(unsigned int i = 0; i < W.size(); ++i)
+    {
+      double const alpha = *W[i] * r;
+      x.add(alpha, *W[i]);
+      r.add(-alpha, *AW[i]);
+    }
+
+    return l2_reference;
+  }
+
+  /*
+   * Solves the linear system for the right-hand side passed to setup(), which has to be called
+   * before.
+   */
+  template<typename Operator, typename Preconditioner>
+  void
+  solve(Operator const &        A,
+        VectorType &            x,
+        Preconditioner const &  preconditioner,
+        dealii::SolverControl & solver_control)
+  {
+    z.reinit(x, true);
+    p.reinit(x, true);
+    q.reinit(x, true);
+
+    P.clear();
+    AP.clear();
+
+    dealii::SolverControl::State state = solver_control.check(0, r.l2_norm());
+
+    if(state == dealii::SolverControl::iterate)
+    {
+      preconditioner.vmult(z, r);
+      p = z;
+      project_onto_complement(p, z);
+
+      double       r_times_z = r * z;
+      unsigned int step      = 0;
+
+      while(state == dealii::SolverControl::iterate)
+      {
+        A.vmult(q, p);
+
+        double const p_times_q = p * q;
+        AssertThrow(p_times_q > 0.0,
+                    dealii::ExcMessage("Operator of deflated CG solver is not positive definite."));
+
+        // store the A-normalized search direction for the update of the deflation space
+        if(P.size() < max_n_directions)
+        {
+          P.push_back(std::make_shared<VectorType>(p));
+          AP.push_back(std::make_shared<VectorType>(q));
+          *P.back() /= std::sqrt(p_times_q);
+          *AP.back() /= std::sqrt(p_times_q);
+        }
+
+        double const alpha = r_times_z / p_times_q;
+        x.add(alpha, p);
+        r.add(-alpha, q);
+
+        state = solver_control.check(++step, r.l2_norm());
+        if(state != dealii::SolverControl::iterate)
+          break;
+
+        preconditioner.vmult(z, r);
+
+        double const r_times_z_new = r * z;
+        double const beta          = r_times_z_new / r_times_z;
+        r_times_z                  = r_times_z_new;
+
+        p.sadd(beta, 1.0, z);
+        project_onto_complement(p, z);
+      }
+    }
+
+    update_recycle_space();
+
+    AssertThrow(state == dealii::SolverControl::success,
+                dealii::SolverControl::NoConvergence(solver_control.last_step(),
+                                                     solver_control.last_value()));
+  }
+
+private:
+  /*
+   * Computes p <- p - W (W^T A W)^{-1} (A W)^T z.
+   */
+  void
+  project_onto_complement(VectorType & p, VectorType const & z) const
+  {
+    for(unsigned int i = 0; i < W.size(); ++i)
+      p.add(-(*AW[i] * z), *W[i]);
+  }
+
+  /*
+   * Rayleigh-Ritz procedure in the space Z = [W, P]: The generalized eigenvalue problem
+   * Z^T Z y = mu Z^T A Z y is solved and the Ritz vectors Z y of the largest mu = 1/theta, i.e. of
+   * the smallest Ritz values theta, form the new deflation space.
+   */
+  void
+  update_recycle_space()
+  {
+    if(recycle_space_size == 0 or P.empty())
+      return;
+
+    std::vector<std::shared_ptr<VectorType>> Z(W), AZ(AW);
+    Z.insert(Z.end(), P.begin(), P.end());
+    AZ.insert(AZ.end(), AP.begin(), AP.end());
+
+    unsigned int const n = Z.size();
+
+    dealii::LAPACKFullMatrix<double> gram_matrix(n, n), projected_operator(n, n);
+    for(unsigned int i = 0; i < n; ++i)
+    {
+      for(unsigned int j = 0; j <= i; ++j)
+      {
+        gram_matrix(i, j) = gram_matrix(j, i) = *Z[i] * *Z[j];
+        projected_operator(i, j) = projected_operator(j, i) =
+          0.5 * (*Z[i] * *AZ[j] + *Z[j] * *AZ[i]);
+      }
+    }
+
+    std::vector<dealii::Vector<double>> eigenvectors(n, dealii::Vector<double>(n));
+    gram_matrix.compute_generalized_eigenvalues_symmetric(projected_operator, eigenvectors);
+
+    std::vector<unsigned int> indices(n);
+    std::iota(indices.begin(), indices.end(), 0);
+    std::sort(indices.begin(), indices.end(), [&](unsigned int const a, unsigned int const b) {
+      return gram_matrix.eigenvalue(a).real() > gram_matrix.eigenvalue(b).real();
+    });
+
+    std::vector<std::shared_ptr<VectorType>> W_new;
+    for(unsigned int i = 0; i < std::min(recycle_space_size, n); ++i)
+      W_new.push_back(internal::linear_combination(Z, eigenvectors[indices[i]]));
+
+    W = W_new;
+    AW.clear();
+    P.clear();
+    AP.clear();
+  }
+
+  unsigned int recycle_space_size;
+  unsigned int max_n_directions;
+
+  // deflation space and A W
+  std::vector<std::shared_ptr<VectorType>> W, AW;
+
+  // A-normalized search directions of the current solve and A P
+  std::vector<std::shared_ptr<VectorType>> P, AP;
+
+  VectorType r, z, p, q;
+};
+
+/*
+ * Flexible GCRO-DR method (generalized conjugate residual with inner orthogonalization and deflated
+ * restarting) for sequences of general linear systems, see
+ *
+ *   Parks, M.L., de Sturler, E., Mackey, G., Johnson, D.D., Maiti, S. (2006). Recycling Krylov
+ *   subspaces for sequences of linear systems. SIAM Journal on Scientific Computing, 28(5),
+ *   1651-1674.
+ *
+ * A recycle space U with C = A U, C^T C = I, is carried from one linear solve to the next. The
+ * initial residual is projected onto the complement of range(C) and right-preconditioned Arnoldi
+ * cycles of length m are performed for the operator (I - C C^T) A, where the preconditioned
+ * vectors are stored as in FGMRES so that variable preconditioners (e.g. multigrid with Krylov
+ * coarse-grid solvers) are supported. At the end of every solve, the recycle space is replaced by
+ * the k harmonic Ritz vectors of A belonging to the harmonic Ritz values of smallest magnitude in
+ * the space spanned by U and the preconditioned vectors of the last Arnoldi cycle. The recycle
+ * space is kept fixed within a solve. Since the operator may change between solves, C = A U is
+ * recomputed at the beginning of every solve, which requires k operator evaluations.
+ */
+template<typename VectorType>
+class GCRODR
+{
+public:
+  GCRODR() : recycle_space_size(0), max_basis_size(30)
+  {
+  }
+
+  void
+  reinit(unsigned int const recycle_space_size_in, unsigned int const max_basis_size_in)
+  {
+    recycle_space_size = recycle_space_size_in;
+    max_basis_size     = max_basis_size_in;
+    reset();
+  }
+
+  /*
+   * Discards the recycle space.
+   */
+  void
+  reset()
+  {
+    U.clear();
+    C.clear();
+  }
+
+  unsigned int
+  n_recycled_vectors() const
+  {
+    return U.size();
+  }
+
+  /*
+   * Memory consumption of the recycle space, the Krylov basis, and the work vectors in bytes.
+   */
+  std::size_t
+  memory_consumption() const
+  {
+    return internal::memory_consumption(U) + internal::memory_consumption(C) +
+           internal::memory_consumption(V) + internal::memory_consumption(Z) +
+           r.memory_consumption();
+  }
+
+  /*
+   * Adapts the recycle space to the operator A and projects the initial guess x, so that the
+   * residual is orthogonal to range(C). Returns the norm of the residual of the initial guess
+   * provided by the caller.
+   */
+  template<typename Operator>
+  double
+  setup(Operator const & A, VectorType & x, VectorType const & b)
+  {
+    // C = A U with C^T C = I by modified Gram-Schmidt, applying the same transformation to U
+    std::vector<std::shared_ptr<VectorType>> U_new, C_new;
+    for(unsigned int i = 0; i < U.size(); ++i)
+    {
+      std::shared_ptr<VectorType> u = U[i];
+      std::shared_ptr<VectorType> c = std::make_shared<VectorType>();
+      c->reinit(*u, true);
+      A.vmult(*c, *u);
+
+      double const norm_initial = c->l2_norm();
+      for(unsigned int j = 0; j < C_new.size(); ++j)
+      {
+        double const alpha = *C_new[j] * *c;
+        c->add(-alpha, *C_new[j]);
+        u->add(-alpha, *U_new[j]);
+      }
+
+      double const norm = c->l2_norm();
+      if(norm > 1.e-10 * norm_initial && norm > 0.0)
+      {
+        *c /= norm;
+        *u /= norm;
+        U_new.push_back(u);
+        C_new.push_back(c);
+      }
+    }
+    U = U_new;
+    C = C_new;
+
+    r.reinit(x, true);
+    A.vmult(r, x);
+    r.sadd(-1.0, 1.0, b);
+
+    double const l2_reference = r.l2_norm();
+
+    // x <- x + U C^T r, r <- (I - C C^T) r
+    for(unsigned int i = 0; i < C.size(); ++i)
+    {
+      double const alpha = *C[i] * r;
+      x.add(alpha, *U[i]);
+      r.add(-alpha, *C[i]);
+    }
+
+    return l2_reference;
+  }
+
+  /*
+   * Solves the linear system for the right-hand side passed to setup(), which has to be called
+   * before.
+   */
+  template<typename Operator, typename Preconditioner>
+  void
+  solve(Operator const &        A,
+        VectorType &            x,
+        Preconditioner const &  preconditioner,
+        dealii::SolverControl & solver_control)
+  {
+    unsigned int const m = max_basis_size;
+    unsigned int const k = C.size();
+
+    if(V.size() != m + 1)
+    {
+      V.resize(m + 1);
+      Z.resize(m);
+      for(auto & v : V)
+        v = std::make_shared<VectorType>();
+      for(auto & v : Z)
+        v = std::make_shared<VectorType>();
+    }
+    for(auto & v : V)
+      v->reinit(x, true);
+    for(auto & v : Z)
+      v->reinit(x, true);
+
+    // Arnoldi relation A Z = C B + V H, and the Hessenberg matrix H reduced to upper triangular
+    // form R by Givens rotations
+    dealii::FullMatrix<double> H(m + 1, m), B(k, m), R(m + 1, m);
+    dealii::Vector<double>     g(m + 1), cs(m), sn(m), y(m);
+
+    double beta = r.l2_norm();
+
+    dealii::SolverControl::State state = solver_control.check(0, beta);
+
+    unsigned int step      = 0;
+    unsigned int dim       = 0;
+    bool         breakdown = false;
+
+    while(state == dealii::SolverControl::iterate)
+    {
+      H         = 0.0;
+      B         = 0.0;
+      R         = 0.0;
+      g         = 0.0;
+      g(0)      = beta;
+      breakdown = false;
+
+      V[0]->equ(1.0 / beta, r);
+
+      for(dim = 0; dim < m and state == dealii::SolverControl::iterate and not breakdown;)
+      {
+        unsigned int const j = dim;
+
+        preconditioner.vmult(*Z[j], *V[j]);
+        A.vmult(*V[j + 1], *Z[j]);
+
+        for(unsigned int i = 0; i < k; ++i)
+        {
+          B(i, j) = *C[i] * *V[j + 1];
+          V[j + 1]->add(-B(i, j), *C[i]);
+        }
+
+        for(unsigned int i = 0; i <= j; ++i)
+        {
+          H(i, j) = *V[i] * *V[j + 1];
+          V[j + 1]->add(-H(i, j), *V[i]);
+        }
+
+        H(j + 1, j) = V[j + 1]->l2_norm();
+        if(H(j + 1, j) > 1.e-14 * std::abs(H(j, j)))
+          *V[j + 1] /= H(j + 1, j);
+        else
+          breakdown = true;
+
+        // apply previous Givens rotations to the new column and compute the new rotation
+        for(unsigned int i = 0; i <= j + 1; ++i)
+          R(i, j) = H(i, j);
+        for(unsigned int i = 0; i < j; ++i)
+        {
+          double const tmp = cs(i) * R(i, j) + sn(i) * R(i + 1, j);
+          R(i + 1, j)      = -sn(i) * R(i, j) + cs(i) * R(i + 1, j);
+          R(i, j)          = tmp;
+        }
+
+        double const denominator = std::sqrt(R(j, j) * R(j, j) + R(j + 1, j) * R(j + 1, j));
+        cs(j)                    = R(j, j) / denominator;
+        sn(j)                    = R(j + 1, j) / denominator;
+        R(j, j)                  = denominator;
+        R(j + 1, j)              = 0.0;
+
+        g(j + 1) = -sn(j) * g(j);
+        g(j)     = cs(j) * g(j);
+
+        ++dim;
+        state = solver_control.check(++step, std::abs(g(j + 1)));
+      }
+
+      // solve least-squares problem by back substitution
+      for(int i = dim - 1; i >= 0; --i)
+      {
+        y(i) = g(i);
+        for(unsigned int l = i + 1; l < dim; ++l)
+          y(i) -= R(i, l) * y(l);
+        y(i) /= R(i, i);
+      }
+
+      // x <- x + Z y - U B y (since A U = C)
+      for(unsigned int j = 0; j < dim; ++j)
+        x.add(y(j), *Z[j]);
+      for(unsigned int i = 0; i < k; ++i)
+      {
+        double B_times_y = 0.0;
+        for(unsigned int j = 0; j < dim; ++j)
+          B_times_y += B(i, j) * y(j);
+        x.add(-B_times_y, *U[i]);
+      }
+
+      // r <- V (beta e_1 - H y)
+      r.equ(beta, *V[0]);
+      for(unsigned int i = 0; i <= dim; ++i)
+      {
+        double H_times_y = 0.0;
+        for(unsigned int j = 0; j < dim; ++j)
+          H_times_y += H(i, j) * y(j);
+        r.add(-H_times_y, *V[i]);
+      }
+
+      beta = r.l2_norm();
+
+      if(breakdown and state == dealii::SolverControl::iterate)
+        state = solver_control.check(step, beta);
+    }
+
+    if(dim > 0 and not breakdown)
+      update_recycle_space(dim, H, B);
+
+    AssertThrow(state == dealii::SolverControl::success,
+                dealii::SolverControl::NoConvergence(solver_control.last_step(),
+                                                     solver_control.last_value()));
+  }
+
+private:
+  /*
+   * Harmonic Ritz procedure in the space spanned by W = [U, Z]: With A W = [C, V] G, the
+   * generalized eigenvalue problem G^T G y = theta G^T T y with T = [C, V]^T W is solved in the
+   * form (G^T G)^{-1} G^T T y = mu y with mu = 1/theta. The new recycle space is spanned by the
+   * vectors W y of the k eigenvalues mu of largest magnitude (real and imaginary parts in case of
+   * complex conjugate pairs).
+   */
+  void
+  update_recycle_space(unsigned int const                 dim,
+                       dealii::FullMatrix<double> const & H,
+                       dealii::FullMatrix<double> const & B)
+  {
+    if(recycle_space_size == 0)
+      return;
+
+    unsigned int const k = C.size();
+    unsigned int const n = k + dim;
+
+    // A W = CV G with W = [U, Z] and CV = [C, V]
+    std::vector<std::shared_ptr<VectorType>> W(U), CV(C);
+    W.insert(W.end(), Z.begin(), Z.begin() + dim);
+    CV.insert(CV.end(), V.begin(), V.begin() + dim + 1);
+
+    // G = [I B; 0 H]
+    dealii::FullMatrix<double> G(n + 1, n);
+    for(unsigned int i = 0; i < k; ++i)
+    {
+      G(i, i) = 1.0;
+      for(unsigned int j = 0; j < dim; ++j)
+        G(i, k + j) = B(i, j);
+    }
+    for(unsigned int i = 0; i <= dim; ++i)
+      for(unsigned int j = 0; j < dim; ++j)
+        G(k + i, k + j) = H(i, j);
+
+    dealii::FullMatrix<double> T(n + 1, n);
+    for(unsigned int i = 0; i < n + 1; ++i)
+      for(unsigned int j = 0; j < n; ++j)
+        T(i, j) = *CV[i] * *W[j];
+
+    dealii::FullMatrix<double> GtG(n, n), GtT(n, n);
+    G.Tmmult(GtG, G);
+    G.Tmmult(GtT, T);
+
+    dealii::LAPACKFullMatrix<double> inverse(n, n), rhs(n, n), matrix(n, n);
+    inverse = GtG;
+    rhs     = GtT;
+    inverse.invert();
+    inverse.mmult(matrix, rhs);
+
+    matrix.compute_eigenvalues(true, false);
+    dealii::FullMatrix<std::complex<double>> const eigenvectors = matrix.get_right_eigenvectors();
+
+    std::vector<unsigned int> indices(n);
+    std::iota(indices.begin(), indices.end(), 0);
+    std::sort(indices.begin(), indices.end(), [&](unsigned int const a, unsigned int const b) {
+      return std::abs(matrix.eigenvalue(a)) > std::abs(matrix.eigenvalue(b));
+    });
+
+    std::vector<dealii::Vector<double>> coefficients;
+    for(unsigned int i = 0; i < n and coefficients.size() < recycle_space_size; ++i)
+    {
+      std::complex<double> const mu = matrix.eigenvalue(indices[i]);
+
+      // the complex conjugate eigenvector is represented by the real and imaginary part of its
+      // partner
+      if(mu.imag() < -1.e-12 * std::abs(mu))
+        continue;
+
+      dealii::Vector<double> real_part(n), imaginary_part(n);
+      for(unsigned int l = 0; l < n; ++l)
+      {
+        real_part(l)      = eigenvectors(l, indices[i]).real();
+        imaginary_part(l) = eigenvectors(l, indices[i]).imag();
+      }
+
+      coefficients.push_back(real_part);
+      if(mu.imag() > 1.e-12 * std::abs(mu) and coefficients.size() < recycle_space_size)
+        coefficients.push_back(imaginary_part);
+    }
+
+    std::vector<std::shared_ptr<VectorType>> U_new;
+    for(auto const & c : coefficients)
+      U_new.push_back(internal::linear_combination(W, c));
+
+    U = U_new;
+    C.clear();
+  }
+
+  unsigned int recycle_space_size;
+  unsigned int max_basis_size;
+
+  // recycle space and C = A U
+  std::vector<std::shared_ptr<VectorType>> U, C;
+
+  // Krylov basis and preconditioned vectors of the current Arnoldi cycle
+  std::vector<std::shared_ptr<VectorType>> V, Z;
+
+  VectorType r;
+};
+
+} // namespace Krylov
+} // namespace ExaDG
+
+#endif /* INCLUDE_EXADG_SOLVERS_AND_PRECONDITIONERS_SOLVERS_KRYLOV_RECYCLING_H_ */
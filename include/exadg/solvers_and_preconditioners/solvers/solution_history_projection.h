@@ -0,0 +1,161 @@
+/*  ______________________________________________________________________
+ *
+ *  ExaDG - High-Order Discontinuous Galerkin for the Exa-Scale
+ *
+ *  Copyright (C) 2021 by the ExaDG authors
+ *
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *  ______________________________________________________________________
+ */
+
+#ifndef INCLUDE_EXADG_SOLVERS_AND_PRECONDITIONERS_SOLVERS_SOLUTION_HISTORY_PROJECTION_H_
+#define INCLUDE_EXADG_SOLVERS_AND_PRECONDITIONERS_SOLVERS_SOLUTION_HISTORY_PROJECTION_H_
+
+// C/C++
+#include <cmath>
+#include <memory>
+#include <vector>
+
+namespace ExaDG
+{
+/*
+ * Initial guess for sequences of linear systems A x^n = b^n with slowly varying right-hand sides
+ * based on the solutions of previous systems, see
+ *
+ *   Fischer, P.F. (1998). Projection techniques for iterative solution of Ax=b with successive
+ *   right-hand sides. Computer Methods in Applied Mechanics and Engineering, 163, 193-204.
+ *
+ * An A-orthonormal basis x_1, ..., x_N of the last N solutions is stored together with the
+ * vectors A x_k. Given an initial guess x_0 (e.g. from extrapolation in time), the error of the
+ * initial guess is projected onto the span of the basis in the A-norm,
+ *
+ *   x_0 <- x_0 + sum_k (x_k^T r_0) x_k, with r_0 = b - A x_0,
+ *
+ * which minimizes the A-norm of the error over x_0 + span{x_1, ..., x_N}. After the solution of
+ * the linear system, the new solution is A-orthogonalized against the basis (modified Gram-Schmidt)
+ * and appended. Once N vectors are stored, the basis is restarted with the latest solution.
+ *
+ * The method requires two operator evaluations per linear solve and 2N vectors of storage. The
+ * A-orthogonality is only exact for symmetric operators that do not change in time. For operators
+ * that change slowly, the initial guess remains a good approximation.
+ */
+template<typename VectorType>
+class SolutionHistoryProjection
+{
+public:
+  SolutionHistoryProjection() : max_size(0)
+  {
+  }
+
+  void
+  reinit(unsigned int const max_size_in)
+  {
+    max_size = max_size_in;
+    reset();
+  }
+
+  bool
+  enabled() const
+  {
+    return max_size > 0;
+  }
+
+  unsigned int
+  size() const
+  {
+    return basis.size();
+  }
+
+  /*
+   * Discards the stored solutions, e.g. in case the operator has changed significantly.
+   */
+  void
+  reset()
+  {
+    basis.clear();
+    basis_operator.clear();
+  }
+
+  /*
+   * Improves the initial guess in dst. The vector residual is overwritten with the residual of the
+   * initial guess provided by the caller, whose norm is returned.
+   */
+  template<typename Operator>
+  double
+  compute_initial_guess(Operator const &   op,
+                        VectorType &       dst,
+                        VectorType const & rhs,
+                        VectorType &       residual) const
+  {
+    residual.reinit(dst, true);
+    op.vmult(residual, dst);
+    residual.sadd(-1.0, 1.0, rhs);
+
+    double const residual_norm = residual.l2_norm();
+
+    for(unsigned int k = 0; k < basis.size(); ++k)
+      dst.add(*basis[k] * residual, *basis[k]);
+
+    return residual_norm;
+  }
+
+  /*
+   * Appends the solution of the linear system to the basis.
+   */
+  template<typename Operator>
+  void
+  update(Operator const & op, VectorType const & solution)
+  {
+    if(basis.size() == max_size)
+      reset();
+
+    std::shared_ptr<VectorType> x  = std::make_shared<VectorType>(solution);
+    std::shared_ptr<VectorType> Ax = std::make_shared<VectorType>();
+    Ax->reinit(solution, true);
+    op.vmult(*Ax, *x);
+
+    double const norm_solution = std::sqrt(std::abs(*x * *Ax));
+
+    // modified Gram-Schmidt in the A-inner product
+    for(unsigned int k = 0; k < basis.size(); ++k)
+    {
+      double const alpha = *basis[k] * *Ax;
+      x->add(-alpha, *basis[k]);
+      Ax->add(-alpha, *basis_operator[k]);
+    }
+
+    double const norm = std::sqrt(std::abs(*x * *Ax));
+
+    // skip solutions that are (numerically) contained in the span of the basis
+    if(norm <= 1.e-10 * norm_solution || norm == 0.0)
+      return;
+
+    *x /= norm;
+    *Ax /= norm;
+
+    basis.push_back(x);
+    basis_operator.push_back(Ax);
+  }
+
+private:
+  unsigned int max_size;
+
+  // A-orthonormal basis x_k and the vectors A x_k
+  std::vector<std::shared_ptr<VectorType>> basis;
+  std::vector<std::shared_ptr<VectorType>> basis_operator;
+};
+
+} // namespace ExaDG
+
+#endif /* INCLUDE_EXADG_SOLVERS_AND_PRECONDITIONERS_SOLVERS_SOLUTION_HISTORY_PROJECTION_H_ */
@@ -32,7 +32,13 @@ namespace ExaDG
 {
 struct SolverData
 {
-  SolverData() : max_iter(1e3), abs_tol(1e-20), rel_tol(1e-6), max_krylov_size(30)
+  SolverData()
+    : max_iter(1e3),
+      abs_tol(1e-20),
+      rel_tol(1e-6),
+      max_krylov_size(30),
+      solution_history_size(0),
+      recycle_space_size(0)
   {
   }
 
@@ -40,7 +46,12 @@ struct SolverData
              double const       abs_tol_,
              double const       rel_tol_,
              unsigned int const max_krylov_size_ = 30)
-    : max_iter(max_iter_), abs_tol(abs_tol_), rel_tol(rel_tol_), max_krylov_size(max_krylov_size_)
+    : max_iter(max_iter_),
+      abs_tol(abs_tol_),
+      rel_tol(rel_tol_),
+      max_krylov_size(max_krylov_size_),
+      solution_history_size(0),
+      recycle_space_size(0)
   {
   }
 
@@ -51,13 +62,25 @@ struct SolverData
     print_parameter(pcout, "Absolute solver tolerance", abs_tol);
     print_parameter(pcout, "Relative solver tolerance", rel_tol);
     print_parameter(pcout, "Maximum size of Krylov space", max_krylov_size);
+    if(solution_history_size > 0)
+      print_parameter(pcout, "Size of solution history", solution_history_size);
+    if(recycle_space_size > 0)
+      print_parameter(pcout, "Size of recycle space", recycle_space_size);
   }
 
   unsigned int max_iter;
   double       abs_tol;
   double       rel_tol;
-  // only relevant for GMRES type solvers
+  // only relevant for GMRES type solvers (for the deflated CG solver, this is the number of stored
+  // search directions)
   unsigned int max_krylov_size;
+  // Number of previous solutions used to compute an initial guess by projection onto the space
+  // spanned by these solutions (0 = disabled). Only relevant for Krylov solvers that support
+  // this option.
+  unsigned int solution_history_size;
+  // Dimension of the subspace recycled from one linear solve to the next. Only relevant for Krylov
+  // solvers with subspace recycling (deflated CG, GCRO-DR).
+  unsigned int recycle_space_size;
 };
 } // namespace ExaDG
 
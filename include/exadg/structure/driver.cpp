@@ -26,6 +26,7 @@
 
 // ExaDG
 #include <exadg/functions_and_boundary_conditions/verify_boundary_conditions.h>
+#include <exadg/postprocessor/asynchronous_file_writer.h>
 #include <exadg/structure/driver.h>
 #include <exadg/utilities/print_solver_results.h>
 #include <exadg/utilities/throughput_parameters.h>
@@ -90,8 +91,17 @@ Driver<dim, Number>::setup()
     // initialize time integrator/driver
     if(application->get_parameters().problem_type == ProblemType::Unsteady)
     {
-      time_integrator = std::make_shared<TimeIntGenAlpha<dim, Number>>(
-        pde_operator, postprocessor, application->get_parameters(), mpi_comm, is_test);
+      if(application->get_parameters().temporal_discretization ==
+         TemporalDiscretization::CentralDifference)
+      {
+        time_integrator = std::make_shared<TimeIntCentralDifference<dim, Number>>(
+          pde_operator, postprocessor, application->get_parameters(), mpi_comm, is_test);
+      }
+      else
+      {
+        time_integrator = std::make_shared<TimeIntGenAlpha<dim, Number>>(
+          pde_operator, postprocessor, application->get_parameters(), mpi_comm, is_test);
+      }
       time_integrator->setup(application->get_parameters().restarted_simulation);
     }
     else if(application->get_parameters().problem_type == ProblemType::Steady)
@@ -111,7 +121,8 @@ Driver<dim, Number>::setup()
       AssertThrow(false, dealii::ExcMessage("Not implemented."));
     }
 
-    pde_operator->setup_solver();
+    if(not(application->get_parameters().involves_explicit_time_integration()))
+      pde_operator->setup_solver();
   }
 
   timer_tree.insert({"Elasticity", "Setup"}, timer.wall_time());
@@ -139,6 +150,9 @@ Driver<dim, Number>::solve() const
   {
     AssertThrow(false, dealii::ExcMessage("Not implemented."));
   }
+
+  // make sure that all output files have been written
+  AsynchronousFileWriter::get_instance().flush();
 }
 
 template<int dim, typename Number>
@@ -164,6 +178,14 @@ Driver<dim, Number>::print_performance_results(double const total_time) const
     time_integrator->print_iterations();
   }
 
+  // memory of Krylov solvers with subspace recycling
+  double const memory_linear_solver = dealii::Utilities::MPI::sum(
+    (double)pde_operator->get_memory_consumption_linear_solver(), mpi_comm);
+  if(memory_linear_solver > 0.0)
+    print_solver_memory_consumption(pcout,
+                                    memory_linear_solver,
+                                    pde_operator->get_number_of_dofs());
+
   timer_tree.insert({"Elasticity"}, total_time);
 
   if(application->get_parameters().problem_type == ProblemType::Unsteady)
@@ -227,6 +249,12 @@ Driver<dim, Number>::apply_operator(std::string const & operator_type_string,
   OperatorType operator_type;
   string_to_enum(operator_type, operator_type_string);
 
+  AssertThrow((operator_type == OperatorType::Linear) !=
+                application->get_parameters().large_deformation,
+              dealii::ExcMessage("OperatorType Linear requires large_deformation = false, "
+                                 "OperatorType Nonlinear/Linearized requires "
+                                 "large_deformation = true."));
+
   dealii::LinearAlgebra::distributed::Vector<Number> dst, src, linearization;
   pde_operator->initialize_dof_vector(src);
   pde_operator->initialize_dof_vector(dst);
@@ -279,6 +307,42 @@ Driver<dim, Number>::apply_operator(std::string const & operator_type_string,
           << "DoFs/sec:        " << throughput << std::endl
           << "DoFs/(sec*core): " << throughput/(double)N_mpi_processes << std::endl;
     // clang-format on
+
+    if(application->get_parameters().large_deformation &&
+       operator_type == OperatorType::Linearized &&
+       application->get_parameters().cache_linearization)
+    {
+      // The measurement above includes setting the point of linearization, i.e., filling the
+      // cache. Within the linear solver, the point of linearization is set once per Newton
+      // iteration while the linearized operator is applied in every iteration. This case is
+      // reported separately with the cache already filled outside of the timed region.
+      pde_operator->set_solution_linearization(linearization);
+
+      std::function<void(void)> const operator_evaluation_cached = [&](void) {
+        pde_operator->apply_linearized_operator(dst, src, 1.0, 0.0);
+      };
+
+      double const wall_time_cached =
+        measure_operator_evaluation_time(operator_evaluation_cached,
+                                         application->get_parameters().degree,
+                                         n_repetitions_inner,
+                                         n_repetitions_outer,
+                                         mpi_comm);
+
+      double const throughput_cached = (double)dofs / wall_time_cached;
+
+      double const memory = dealii::Utilities::MPI::sum(
+        (double)pde_operator->get_memory_consumption_linearization_cache(), mpi_comm);
+
+      // clang-format off
+      pcout << std::endl
+            << "Cache filled outside of timed region:" << std::endl
+            << "DoFs/sec:        " << throughput_cached << std::endl
+            << "DoFs/(sec*core): " << throughput_cached/(double)N_mpi_processes << std::endl
+            << "Cache [MB]:      " << memory / 1.e6 << std::endl
+            << "Cache [B/DoF]:   " << memory / (double)dofs << std::endl;
+      // clang-format on
+    }
   }
 
   pcout << std::endl << " ... done." << std::endl << std::endl;
@@ -32,6 +32,7 @@
 #include <exadg/structure/spatial_discretization/operator.h>
 #include <exadg/structure/time_integration/driver_quasi_static_problems.h>
 #include <exadg/structure/time_integration/driver_steady_problems.h>
+#include <exadg/structure/time_integration/time_int_central_difference.h>
 #include <exadg/structure/time_integration/time_int_gen_alpha.h>
 #include <exadg/structure/user_interface/application_base.h>
 #include <exadg/utilities/print_general_infos.h>
@@ -43,6 +44,7 @@ namespace Structure
 {
 enum class OperatorType
 {
+  Linear,
   Nonlinear,
   Linearized
 };
@@ -55,6 +57,7 @@ enum_to_string(OperatorType const enum_type)
   switch(enum_type)
   {
     // clang-format off
+    case OperatorType::Linear:     string_type = "Linear";     break;
     case OperatorType::Nonlinear:  string_type = "Nonlinear";  break;
     case OperatorType::Linearized: string_type = "Linearized"; break;
     default: AssertThrow(false, dealii::ExcMessage("Not implemented.")); break;
@@ -68,7 +71,8 @@ inline void
 string_to_enum(OperatorType & enum_type, std::string const string_type)
 {
   // clang-format off
-  if     (string_type == "Nonlinear")  enum_type = OperatorType::Nonlinear;
+  if     (string_type == "Linear")     enum_type = OperatorType::Linear;
+  else if(string_type == "Nonlinear")  enum_type = OperatorType::Nonlinear;
   else if(string_type == "Linearized") enum_type = OperatorType::Linearized;
   else AssertThrow(false, dealii::ExcMessage("Unknown operator type. Not implemented."));
   // clang-format on
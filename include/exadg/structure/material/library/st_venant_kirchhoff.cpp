@@ -55,6 +55,11 @@ StVenantKirchhoff<dim, Number>::StVenantKirchhoff(
                           this,
                           dummy,
                           dummy);
+
+    // only one value is accessed per cell in case of cellwise constant coefficients
+    f0_coefficients.compress();
+    f1_coefficients.compress();
+    f2_coefficients.compress();
   }
 }
 
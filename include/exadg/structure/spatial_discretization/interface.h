@@ -22,8 +22,12 @@
 #ifndef INCLUDE_EXADG_STRUCTURE_SPATIAL_DISCRETIZATION_INTERFACE_H_
 #define INCLUDE_EXADG_STRUCTURE_SPATIAL_DISCRETIZATION_INTERFACE_H_
 
+// deal.II
 #include <deal.II/lac/la_parallel_vector.h>
 
+// ExaDG
+#include <exadg/solvers_and_preconditioners/newton/newton_solver_data.h>
+
 namespace ExaDG
 {
 namespace Structure
@@ -61,6 +65,24 @@ public:
   virtual void
   apply_mass_operator(VectorType & dst, VectorType const & src) const = 0;
 
+  /*
+   * Explicit time integration: computes the acceleration for a given displacement and returns
+   * the number of iterations of the mass solver (zero for a lumped mass matrix).
+   */
+  virtual unsigned int
+  evaluate_acceleration(VectorType &       acceleration,
+                        VectorType const & displacement,
+                        double const       time) const = 0;
+
+  /*
+   * Explicit time integration: estimates the critical time step size for a given displacement.
+   */
+  virtual double
+  calculate_critical_time_step(VectorType const & displacement, double const time) const = 0;
+
+  virtual void
+  set_constrained_values(VectorType & displacement, double const time) const = 0;
+
   virtual void
   compute_rhs_linear(VectorType & dst, double const time) const = 0;
 
@@ -76,6 +98,12 @@ public:
                VectorType const & rhs,
                double const       factor,
                double const       time) const = 0;
+
+  /*
+   * Statistics of the Newton iterations of the last call to solve_nonlinear().
+   */
+  virtual Newton::Statistics const &
+  get_newton_statistics() const = 0;
 };
 
 } // namespace Interface
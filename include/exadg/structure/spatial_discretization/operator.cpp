@@ -19,6 +19,9 @@
  *  ______________________________________________________________________
  */
 
+// C/C++
+#include <random>
+
 // deal.II
 #include <deal.II/fe/fe_q.h>
 #include <deal.II/fe/fe_simplex_p.h>
@@ -304,7 +307,10 @@ Operator<dim, Number>::setup_operators()
   operator_data.density             = param.density;
   if(param.large_deformation)
   {
-    operator_data.pull_back_traction = param.pull_back_traction;
+    operator_data.pull_back_traction                   = param.pull_back_traction;
+    operator_data.cache_linearization                  = param.cache_linearization;
+    operator_data.cache_linearization_single_precision = param.cache_linearization_single_precision;
+    operator_data.cache_linearization_symmetric_stress = param.cache_linearization_symmetric_stress;
   }
   else
   {
@@ -323,10 +329,18 @@ Operator<dim, Number>::setup_operators()
   // mass operator and related solver for inversion
   if(param.problem_type == ProblemType::Unsteady)
   {
+    // For explicit time integration with consistent mass matrix, the mass matrix is inverted
+    // for the unconstrained degrees of freedom only, i.e. the Dirichlet constraints are applied.
+    bool const explicit_consistent_mass =
+      param.temporal_discretization == TemporalDiscretization::CentralDifference and
+      param.mass_matrix_type == MassMatrixType::Consistent;
+
     MassOperatorData<dim> mass_data;
-    mass_data.dof_index  = get_dof_index_mass();
+    mass_data.dof_index  = explicit_consistent_mass ? get_dof_index() : get_dof_index_mass();
     mass_data.quad_index = get_quad_index();
-    mass_operator.initialize(*matrix_free, constraints_mass, mass_data);
+    mass_operator.initialize(*matrix_free,
+                             explicit_consistent_mass ? affine_constraints : constraints_mass,
+                             mass_data);
 
     mass_operator.set_scaling_factor(param.density);
 
@@ -358,6 +372,24 @@ Operator<dim, Number>::setup_operators()
     typedef Krylov::SolverCG<MassOperator<dim, dim, Number>, PreconditionerBase<Number>, VectorType>
       CG;
     mass_solver = std::make_shared<CG>(mass_operator, *mass_preconditioner, solver_data);
+
+    // row-sum lumped mass matrix for explicit time integration
+    if(param.temporal_discretization == TemporalDiscretization::CentralDifference and
+       param.mass_matrix_type == MassMatrixType::Lumped)
+    {
+      VectorType ones;
+      initialize_dof_vector(ones);
+      initialize_dof_vector(lumped_mass_inverse);
+      ones = 1.0;
+      mass_operator.apply(lumped_mass_inverse, ones);
+
+      for(unsigned int i = 0; i < lumped_mass_inverse.locally_owned_size(); ++i)
+      {
+        AssertThrow(lumped_mass_inverse.local_element(i) > 0.0,
+                    dealii::ExcMessage("Lumped mass matrix is not positive."));
+        lumped_mass_inverse.local_element(i) = 1.0 / lumped_mass_inverse.local_element(i);
+      }
+    }
   }
 
   // setup rhs operator
@@ -561,6 +593,68 @@ Operator<dim, Number>::initialize_solver()
         std::make_shared<FGMRES>(elasticity_operator_linear, *preconditioner, solver_data);
     }
   }
+  else if(param.solver == Solver::DeflatedCG)
+  {
+    // initialize solver_data
+    Krylov::SolverDataDeflatedCG solver_data;
+    solver_data.solver_tolerance_abs = param.solver_data.abs_tol;
+    solver_data.solver_tolerance_rel = param.solver_data.rel_tol;
+    solver_data.max_iter             = param.solver_data.max_iter;
+    solver_data.recycle_space_size   = param.solver_data.recycle_space_size;
+    solver_data.max_n_tmp_vectors    = param.solver_data.max_krylov_size;
+
+    if(param.preconditioner != Preconditioner::None)
+      solver_data.use_preconditioner = true;
+
+    // initialize solver
+    if(param.large_deformation)
+    {
+      typedef Krylov::
+        SolverDeflatedCG<NonLinearOperator<dim, Number>, PreconditionerBase<Number>, VectorType>
+          DeflatedCG;
+      linear_solver =
+        std::make_shared<DeflatedCG>(elasticity_operator_nonlinear, *preconditioner, solver_data);
+    }
+    else
+    {
+      typedef Krylov::
+        SolverDeflatedCG<LinearOperator<dim, Number>, PreconditionerBase<Number>, VectorType>
+          DeflatedCG;
+      linear_solver =
+        std::make_shared<DeflatedCG>(elasticity_operator_linear, *preconditioner, solver_data);
+    }
+  }
+  else if(param.solver == Solver::GCRODR)
+  {
+    // initialize solver_data
+    Krylov::SolverDataGCRODR solver_data;
+    solver_data.solver_tolerance_abs = param.solver_data.abs_tol;
+    solver_data.solver_tolerance_rel = param.solver_data.rel_tol;
+    solver_data.max_iter             = param.solver_data.max_iter;
+    solver_data.recycle_space_size   = param.solver_data.recycle_space_size;
+    solver_data.max_n_tmp_vectors    = param.solver_data.max_krylov_size;
+
+    if(param.preconditioner != Preconditioner::None)
+      solver_data.use_preconditioner = true;
+
+    // initialize solver
+    if(param.large_deformation)
+    {
+      typedef Krylov::
+        SolverGCRODR<NonLinearOperator<dim, Number>, PreconditionerBase<Number>, VectorType>
+          GCRODR;
+      linear_solver =
+        std::make_shared<GCRODR>(elasticity_operator_nonlinear, *preconditioner, solver_data);
+    }
+    else
+    {
+      typedef Krylov::
+        SolverGCRODR<LinearOperator<dim, Number>, PreconditionerBase<Number>, VectorType>
+          GCRODR;
+      linear_solver =
+        std::make_shared<GCRODR>(elasticity_operator_linear, *preconditioner, solver_data);
+    }
+  }
   else
   {
     AssertThrow(false, dealii::ExcMessage("Specified solver is not implemented!"));
@@ -626,6 +720,96 @@ Operator<dim, Number>::compute_initial_acceleration(VectorType &       accelerat
                                                     double const       time) const
 {
   VectorType rhs(acceleration);
+  evaluate_force_vector(rhs, displacement, time);
+
+  // invert mass operator to get acceleration
+  mass_solver->solve(acceleration, rhs);
+}
+
+template<int dim, typename Number>
+unsigned int
+Operator<dim, Number>::evaluate_acceleration(VectorType &       acceleration,
+                                             VectorType const & displacement,
+                                             double const       time) const
+{
+  VectorType rhs(acceleration);
+  evaluate_force_vector(rhs, displacement, time);
+
+  // The acceleration of constrained degrees of freedom is not needed since the displacement is
+  // prescribed directly.
+  set_constrained_values_to_zero(rhs);
+
+  unsigned int const iterations = apply_inverse_mass_operator(acceleration, rhs);
+
+  set_constrained_values_to_zero(acceleration);
+
+  return iterations;
+}
+
+template<int dim, typename Number>
+double
+Operator<dim, Number>::calculate_critical_time_step(VectorType const & displacement,
+                                                    double const       time) const
+{
+  // power iteration for the largest eigenvalue of M^{-1} K
+  VectorType x, Kx;
+  initialize_dof_vector(x);
+  initialize_dof_vector(Kx);
+
+  // random start vector to ensure a component in the direction of the eigenvector
+  unsigned int const seed = dealii::Utilities::MPI::this_mpi_process(mpi_comm);
+
+  std::mt19937                           generator(seed);
+  std::uniform_real_distribution<double> distribution(0.0, 1.0);
+  for(unsigned int i = 0; i < x.locally_owned_size(); ++i)
+    x.local_element(i) = distribution(generator);
+  set_constrained_values_to_zero(x);
+
+  unsigned int const max_iter = 100;
+  double const       rel_tol  = 1.e-4;
+
+  double lambda_max = 0.0;
+  for(unsigned int k = 0; k < max_iter; ++k)
+  {
+    x /= x.l2_norm();
+
+    apply_stiffness_operator(Kx, x, displacement, time);
+    apply_inverse_mass_operator(x, Kx);
+
+    double const lambda = x.l2_norm();
+
+    bool const converged = std::abs(lambda - lambda_max) < rel_tol * lambda;
+
+    lambda_max = lambda;
+
+    if(converged)
+      break;
+  }
+
+  AssertThrow(lambda_max > 0.0,
+              dealii::ExcMessage("Could not estimate the highest eigenfrequency."));
+
+  // The power iteration approaches lambda_max from below, i.e., the critical time step size is
+  // overestimated slightly. This is covered by the safety factor cfl_number < 1.
+  return 2.0 / std::sqrt(lambda_max);
+}
+
+template<int dim, typename Number>
+void
+Operator<dim, Number>::set_constrained_values(VectorType & displacement, double const time) const
+{
+  if(param.large_deformation)
+    elasticity_operator_nonlinear.set_constrained_values(displacement, time);
+  else
+    elasticity_operator_linear.set_constrained_values(displacement, time);
+}
+
+template<int dim, typename Number>
+void
+Operator<dim, Number>::evaluate_force_vector(VectorType &       rhs,
+                                             VectorType const & displacement,
+                                             double const       time) const
+{
   rhs = 0.0;
 
   if(param.large_deformation) // nonlinear case
@@ -669,9 +853,58 @@ Operator<dim, Number>::compute_initial_acceleration(VectorType &       accelerat
       body_force_operator.evaluate_add(rhs, displacement, time);
     }
   }
+}
 
-  // invert mass operator to get acceleration
-  mass_solver->solve(acceleration, rhs);
+template<int dim, typename Number>
+void
+Operator<dim, Number>::apply_stiffness_operator(VectorType &       dst,
+                                                VectorType const & src,
+                                                VectorType const & displacement,
+                                                double const       time) const
+{
+  if(param.large_deformation)
+  {
+    elasticity_operator_nonlinear.set_solution_linearization(displacement);
+    elasticity_operator_nonlinear.set_scaling_factor_mass_operator(0.0);
+    elasticity_operator_nonlinear.set_time(time);
+    elasticity_operator_nonlinear.vmult(dst, src);
+  }
+  else
+  {
+    elasticity_operator_linear.set_scaling_factor_mass_operator(0.0);
+    elasticity_operator_linear.set_time(time);
+    elasticity_operator_linear.vmult(dst, src);
+  }
+
+  set_constrained_values_to_zero(dst);
+}
+
+template<int dim, typename Number>
+void
+Operator<dim, Number>::set_constrained_values_to_zero(VectorType & vector) const
+{
+  if(param.large_deformation)
+    elasticity_operator_nonlinear.set_constrained_values_to_zero(vector);
+  else
+    elasticity_operator_linear.set_constrained_values_to_zero(vector);
+}
+
+template<int dim, typename Number>
+unsigned int
+Operator<dim, Number>::apply_inverse_mass_operator(VectorType & dst, VectorType const & src) const
+{
+  if(param.temporal_discretization == TemporalDiscretization::CentralDifference and
+     param.mass_matrix_type == MassMatrixType::Lumped)
+  {
+    dst = src;
+    dst.scale(lumped_mass_inverse);
+
+    return 0;
+  }
+  else
+  {
+    return mass_solver->solve(dst, src);
+  }
 }
 
 template<int dim, typename Number>
@@ -815,6 +1048,16 @@ Operator<dim, Number>::solve_nonlinear(VectorType &       sol,
   return iter;
 }
 
+template<int dim, typename Number>
+Newton::Statistics const &
+Operator<dim, Number>::get_newton_statistics() const
+{
+  AssertThrow(newton_solver.get() != 0,
+              dealii::ExcMessage("Newton solver has not been initialized."));
+
+  return newton_solver->get_statistics();
+}
+
 template<int dim, typename Number>
 unsigned int
 Operator<dim, Number>::solve_linear(VectorType &       sol,
@@ -831,6 +1074,20 @@ Operator<dim, Number>::solve_linear(VectorType &       sol,
   VectorType & rhs_mutable = const_cast<VectorType &>(rhs);
   elasticity_operator_linear.set_constrained_values(rhs_mutable, time);
 
+  // compute initial guess by full multigrid (nested iteration)
+  if(param.preconditioner == Preconditioner::Multigrid and
+     param.multigrid_data.cycle_data.full_multigrid)
+  {
+    typedef MultigridPreconditioner<dim, Number> Multigrid;
+
+    std::shared_ptr<Multigrid> mg_preconditioner =
+      std::dynamic_pointer_cast<Multigrid>(preconditioner);
+
+    mg_preconditioner->apply_full_multigrid(sol, rhs_mutable);
+
+    elasticity_operator_linear.set_constrained_values(sol, time);
+  }
+
   // solve linear system of equations
   unsigned int const iterations = linear_solver->solve(sol, rhs_mutable);
 
@@ -871,6 +1128,23 @@ Operator<dim, Number>::get_number_of_dofs() const
   return dof_handler.n_dofs();
 }
 
+template<int dim, typename Number>
+std::size_t
+Operator<dim, Number>::get_memory_consumption_linearization_cache() const
+{
+  return elasticity_operator_nonlinear.get_memory_consumption_linearization_cache();
+}
+
+template<int dim, typename Number>
+std::size_t
+Operator<dim, Number>::get_memory_consumption_linear_solver() const
+{
+  if(linear_solver.get() != 0)
+    return linear_solver->memory_consumption();
+  else
+    return 0;
+}
+
 template class Operator<2, float>;
 template class Operator<2, double>;
 
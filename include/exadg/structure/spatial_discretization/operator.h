@@ -220,6 +220,35 @@ public:
   void
   apply_mass_operator(VectorType & dst, VectorType const & src) const;
 
+  /*
+   * Explicit time integration: computes the acceleration
+   *
+   *  a = M^{-1} (f_ext(t) - f_int(d)) ,
+   *
+   * where M is the lumped or consistent mass matrix depending on the parameter
+   * mass_matrix_type. The acceleration is zero for constrained degrees of freedom, whose values
+   * are set directly in the displacement vector.
+   */
+  unsigned int
+  evaluate_acceleration(VectorType &       acceleration,
+                        VectorType const & displacement,
+                        double const       time) const;
+
+  /*
+   * Explicit time integration: returns the critical time step size 2 / omega_max of the central
+   * difference scheme. The highest eigenfrequency omega_max = sqrt(lambda_max(M^{-1} K)) is
+   * estimated by a power iteration, where K is the stiffness matrix linearized at the given
+   * displacement in case of nonlinear problems.
+   */
+  double
+  calculate_critical_time_step(VectorType const & displacement, double const time) const;
+
+  /*
+   * Sets the constrained degrees of freedom to the Dirichlet boundary values at the given time.
+   */
+  void
+  set_constrained_values(VectorType & displacement, double const time) const;
+
   /*
    * This function calculates the right-hand side of the linear system
    * of equations for linear elasticity problems.
@@ -275,6 +304,9 @@ public:
                double const       factor,
                double const       time) const;
 
+  Newton::Statistics const &
+  get_newton_statistics() const;
+
   /*
    * Setters and getters.
    */
@@ -290,6 +322,14 @@ public:
   dealii::types::global_dof_index
   get_number_of_dofs() const;
 
+  // memory consumption in bytes of the cached linearization state (only nonlinear problems)
+  std::size_t
+  get_memory_consumption_linearization_cache() const;
+
+  // memory consumption in bytes of the vectors kept by the linear solver between solves
+  std::size_t
+  get_memory_consumption_linear_solver() const;
+
   // Multiphysics coupling via "Cached" boundary conditions
   std::shared_ptr<ContainerInterfaceData<1, dim, double>>
   get_container_interface_data_neumann();
@@ -335,6 +375,32 @@ private:
   void
   setup_operators();
 
+  /*
+   * Computes the force vector f_ext(t) - f_int(d) appearing on the right-hand side of the
+   * momentum equation M a = f_ext(t) - f_int(d).
+   */
+  void
+  evaluate_force_vector(VectorType & rhs, VectorType const & displacement, double const time) const;
+
+  /*
+   * Applies the stiffness matrix (linearized at the given displacement for nonlinear problems) to
+   * src, where the constrained degrees of freedom are set to zero.
+   */
+  void
+  apply_stiffness_operator(VectorType &       dst,
+                           VectorType const & src,
+                           VectorType const & displacement,
+                           double const       time) const;
+
+  void
+  set_constrained_values_to_zero(VectorType & vector) const;
+
+  /*
+   * Applies the inverse (lumped or consistent) mass matrix for explicit time integration.
+   */
+  unsigned int
+  apply_inverse_mass_operator(VectorType & dst, VectorType const & src) const;
+
   /*
    * Initializes preconditioner.
    */
@@ -408,6 +474,9 @@ private:
   // problems and in the residual for nonlinear problems.
   MassOperator<dim, dim, Number> mass_operator;
 
+  // inverse of the lumped mass matrix (only relevant for explicit time integration)
+  VectorType lumped_mass_inverse;
+
   /*
    * Solution of nonlinear systems of equations
    */
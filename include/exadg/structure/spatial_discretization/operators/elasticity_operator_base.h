@@ -37,6 +37,9 @@ struct OperatorData : public OperatorBaseData
   OperatorData()
     : OperatorBaseData(),
       pull_back_traction(false),
+      cache_linearization(false),
+      cache_linearization_single_precision(false),
+      cache_linearization_symmetric_stress(false),
       unsteady(false),
       density(1.0),
       n_q_points_1d(2),
@@ -52,6 +55,14 @@ struct OperatorData : public OperatorBaseData
   // is pulled back to the reference configuration, t_0 = da/dA t.
   bool pull_back_traction;
 
+  // These parameters are only relevant for the nonlinear operator. When set to true, the
+  // deformation gradient and the 2nd Piola-Kirchhoff stress at the point of linearization are
+  // stored for all quadrature points, see LinearizationCache. The storage can optionally be
+  // compressed by using single precision and by exploiting the symmetry of the stress tensor.
+  bool cache_linearization;
+  bool cache_linearization_single_precision;
+  bool cache_linearization_symmetric_stress;
+
   // activates mass operator in operator evaluation for unsteady problems
   bool unsteady;
 
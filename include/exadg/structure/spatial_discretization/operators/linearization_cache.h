@@ -0,0 +1,183 @@
+/*  ______________________________________________________________________
+ *
+ *  ExaDG - High-Order Discontinuous Galerkin for the Exa-Scale
+ *
+ *  Copyright (C) 2021 by the ExaDG authors
+ *
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *  ______________________________________________________________________
+ */
+
+#ifndef INCLUDE_EXADG_STRUCTURE_SPATIAL_DISCRETIZATION_OPERATORS_LINEARIZATION_CACHE_H_
+#define INCLUDE_EXADG_STRUCTURE_SPATIAL_DISCRETIZATION_OPERATORS_LINEARIZATION_CACHE_H_
+
+// deal.II
+#include <deal.II/base/aligned_vector.h>
+#include <deal.II/base/tensor.h>
+#include <deal.II/base/vectorization.h>
+
+namespace ExaDG
+{
+namespace Structure
+{
+/*
+ * Stores the deformation gradient F and the 2nd Piola-Kirchhoff stress S at the point of
+ * linearization for all cell batches and quadrature points. The data is stored contiguously
+ * per cell batch in the order [q][component][lane], so that a cell batch is read linearly when
+ * applying the linearized operator.
+ *
+ * Two options reduce the memory footprint (and hence the memory traffic):
+ *  - single_precision: the data is stored in float, also if Number = double,
+ *  - symmetric_stress: only the dim*(dim+1)/2 independent components of the symmetric tensor
+ *    S are stored.
+ */
+template<int dim, typename Number>
+class LinearizationCache
+{
+private:
+  typedef dealii::VectorizedArray<Number> scalar;
+  typedef dealii::Tensor<2, dim, scalar>  tensor;
+
+  static unsigned int constexpr n_lanes         = scalar::size();
+  static unsigned int constexpr n_components_F  = dim * dim;
+  static unsigned int constexpr n_components_S  = dim * dim;
+  static unsigned int constexpr n_components_Ss = dim * (dim + 1) / 2;
+
+public:
+  LinearizationCache()
+    : n_q_points(0), single_precision(false), symmetric_stress(false), n_components(0)
+  {
+  }
+
+  void
+  reinit(unsigned int const n_cell_batches,
+         unsigned int const n_q_points_in,
+         bool const         single_precision_in,
+         bool const         symmetric_stress_in)
+  {
+    n_q_points       = n_q_points_in;
+    single_precision = single_precision_in;
+    symmetric_stress = symmetric_stress_in;
+    n_components     = n_components_F + (symmetric_stress ? n_components_Ss : n_components_S);
+
+    std::size_t const size = std::size_t(n_cell_batches) * n_q_points * n_components * n_lanes;
+
+    if(single_precision)
+    {
+      data_float.resize_fast(size);
+      data.clear();
+    }
+    else
+    {
+      data.resize_fast(size);
+      data_float.clear();
+    }
+  }
+
+  void
+  set(unsigned int const cell, unsigned int const q, tensor const & F, tensor const & S)
+  {
+    if(single_precision)
+      write(data_float, cell, q, F, S);
+    else
+      write(data, cell, q, F, S);
+  }
+
+  void
+  get(unsigned int const cell, unsigned int const q, tensor & F, tensor & S) const
+  {
+    if(single_precision)
+      read(data_float, cell, q, F, S);
+    else
+      read(data, cell, q, F, S);
+  }
+
+  /*
+   * Memory consumption in bytes.
+   */
+  std::size_t
+  memory_consumption() const
+  {
+    return data.memory_consumption() + data_float.memory_consumption();
+  }
+
+private:
+  std::size_t
+  offset(unsigned int const cell, unsigned int const q) const
+  {
+    return (std::size_t(cell) * n_q_points + q) * n_components * n_lanes;
+  }
+
+  template<typename StorageNumber>
+  void
+  write(dealii::AlignedVector<StorageNumber> & storage,
+        unsigned int const                     cell,
+        unsigned int const                     q,
+        tensor const &                         F,
+        tensor const &                         S) const
+  {
+    StorageNumber * ptr = storage.data() + offset(cell, q);
+
+    for(unsigned int i = 0; i < dim; ++i)
+      for(unsigned int j = 0; j < dim; ++j, ptr += n_lanes)
+        for(unsigned int v = 0; v < n_lanes; ++v)
+          ptr[v] = F[i][j][v];
+
+    for(unsigned int i = 0; i < dim; ++i)
+      for(unsigned int j = (symmetric_stress ? i : 0); j < dim; ++j, ptr += n_lanes)
+        for(unsigned int v = 0; v < n_lanes; ++v)
+          ptr[v] = S[i][j][v];
+  }
+
+  template<typename StorageNumber>
+  void
+  read(dealii::AlignedVector<StorageNumber> const & storage,
+       unsigned int const                           cell,
+       unsigned int const                           q,
+       tensor &                                     F,
+       tensor &                                     S) const
+  {
+    StorageNumber const * ptr = storage.data() + offset(cell, q);
+
+    for(unsigned int i = 0; i < dim; ++i)
+      for(unsigned int j = 0; j < dim; ++j, ptr += n_lanes)
+        for(unsigned int v = 0; v < n_lanes; ++v)
+          F[i][j][v] = ptr[v];
+
+    for(unsigned int i = 0; i < dim; ++i)
+      for(unsigned int j = (symmetric_stress ? i : 0); j < dim; ++j, ptr += n_lanes)
+        for(unsigned int v = 0; v < n_lanes; ++v)
+          S[i][j][v] = ptr[v];
+
+    if(symmetric_stress)
+    {
+      for(unsigned int i = 0; i < dim; ++i)
+        for(unsigned int j = 0; j < i; ++j)
+          S[i][j] = S[j][i];
+    }
+  }
+
+  unsigned int n_q_points;
+  bool         single_precision;
+  bool         symmetric_stress;
+  unsigned int n_components;
+
+  dealii::AlignedVector<Number> data;
+  dealii::AlignedVector<float>  data_float;
+};
+
+} // namespace Structure
+} // namespace ExaDG
+
+#endif /* INCLUDE_EXADG_STRUCTURE_SPATIAL_DISCRETIZATION_OPERATORS_LINEARIZATION_CACHE_H_ */
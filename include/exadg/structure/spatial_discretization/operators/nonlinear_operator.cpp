@@ -39,6 +39,20 @@ NonLinearOperator<dim, Number>::initialize(
   integrator_lin = std::make_shared<IntegratorCell>(*this->matrix_free);
   this->matrix_free->initialize_dof_vector(displacement_lin, data.dof_index);
   displacement_lin.update_ghost_values();
+
+  if(this->operator_data.cache_linearization)
+  {
+    IntegratorCell integrator(*this->matrix_free,
+                              this->operator_data.dof_index,
+                              this->operator_data.quad_index);
+
+    linearization_cache.reinit(this->matrix_free->n_cell_batches(),
+                               integrator.n_q_points,
+                               this->operator_data.cache_linearization_single_precision,
+                               this->operator_data.cache_linearization_symmetric_stress);
+
+    update_linearization_cache();
+  }
 }
 
 template<int dim, typename Number>
@@ -86,6 +100,9 @@ NonLinearOperator<dim, Number>::set_solution_linearization(VectorType const & ve
   {
     displacement_lin = vector;
     displacement_lin.update_ghost_values();
+
+    if(this->operator_data.cache_linearization)
+      update_linearization_cache();
   }
 }
 
@@ -96,6 +113,26 @@ NonLinearOperator<dim, Number>::get_solution_linearization() const
   return displacement_lin;
 }
 
+template<int dim, typename Number>
+std::size_t
+NonLinearOperator<dim, Number>::get_memory_consumption_linearization_cache() const
+{
+  return linearization_cache.memory_consumption();
+}
+
+template<int dim, typename Number>
+void
+NonLinearOperator<dim, Number>::update_linearization_cache() const
+{
+  Number dummy = 0.0;
+
+  this->matrix_free->cell_loop(&This::cell_loop_linearization_cache,
+                               this,
+                               dummy,
+                               displacement_lin,
+                               false /* no zeroing of dst */);
+}
+
 template<int dim, typename Number>
 void
 NonLinearOperator<dim, Number>::reinit_cell_nonlinear(IntegratorCell &   integrator,
@@ -248,6 +285,10 @@ NonLinearOperator<dim, Number>::reinit_cell(unsigned int const cell) const
 {
   Base::reinit_cell(cell);
 
+  // the linearization state is read from the cache in do_cell_integral() in this case
+  if(this->operator_data.cache_linearization)
+    return;
+
   integrator_lin->reinit(cell);
 
   integrator_lin->read_dof_values_plain(displacement_lin);
@@ -260,26 +301,34 @@ NonLinearOperator<dim, Number>::do_cell_integral(IntegratorCell & integrator) co
 {
   std::shared_ptr<Material<dim, Number>> material = this->material_handler.get_material();
 
+  unsigned int const cell = integrator.get_current_cell_index();
+
   // loop over all quadrature points
   for(unsigned int q = 0; q < integrator.n_q_points; ++q)
   {
     // kinematics
     tensor const Grad_delta = integrator.get_gradient(q);
 
-    tensor const F_lin = get_F<dim, Number>(integrator_lin->get_gradient(q));
+    // deformation gradient and 2nd Piola-Kirchhoff stresses at the point of linearization
+    tensor F_lin, S_lin;
+    if(this->operator_data.cache_linearization)
+    {
+      linearization_cache.get(cell, q, F_lin, S_lin);
+    }
+    else
+    {
+      F_lin = get_F<dim, Number>(integrator_lin->get_gradient(q));
 
-    // Green-Lagrange strains
-    tensor const E_lin = get_E<dim, Number>(F_lin);
+      // Green-Lagrange strains
+      tensor const E_lin = get_E<dim, Number>(F_lin);
 
-    // 2nd Piola-Kirchhoff stresses
-    tensor const S_lin = material->evaluate_stress(E_lin, integrator.get_current_cell_index(), q);
+      S_lin = material->evaluate_stress(E_lin, cell, q);
+    }
 
     // directional derivative of 1st Piola-Kirchhoff stresses P
 
     // 1. elastic and initial displacement stiffness contributions
-    tensor delta_P =
-      F_lin *
-      material->apply_C(transpose(F_lin) * Grad_delta, integrator.get_current_cell_index(), q);
+    tensor delta_P = F_lin * material->apply_C(transpose(F_lin) * Grad_delta, cell, q);
 
     // 2. geometric (or initial stress) stiffness contribution
     delta_P += Grad_delta * S_lin;
@@ -333,6 +382,47 @@ NonLinearOperator<dim, Number>::cell_loop_valid_deformation(
   }
 }
 
+template<int dim, typename Number>
+void
+NonLinearOperator<dim, Number>::cell_loop_linearization_cache(
+  dealii::MatrixFree<dim, Number> const & matrix_free,
+  Number &                                dst,
+  VectorType const &                      src,
+  Range const &                           range) const
+{
+  (void)dst;
+
+  IntegratorCell integrator(matrix_free,
+                            this->operator_data.dof_index,
+                            this->operator_data.quad_index);
+
+  for(auto cell = range.first; cell < range.second; ++cell)
+  {
+    reinit_cell_nonlinear(integrator, cell);
+
+    std::shared_ptr<Material<dim, Number>> material = this->material_handler.get_material();
+
+    integrator.read_dof_values_plain(src);
+
+    integrator.evaluate(dealii::EvaluationFlags::gradients);
+
+    // loop over all quadrature points
+    for(unsigned int q = 0; q < integrator.n_q_points; ++q)
+    {
+      // material deformation gradient
+      tensor const F = get_F<dim, Number>(integrator.get_gradient(q));
+
+      // Green-Lagrange strains
+      tensor const E = get_E<dim, Number>(F);
+
+      // 2nd Piola-Kirchhoff stresses
+      tensor const S = material->evaluate_stress(E, cell, q);
+
+      linearization_cache.set(cell, q, F, S);
+    }
+  }
+}
+
 template class NonLinearOperator<2, float>;
 template class NonLinearOperator<2, double>;
 
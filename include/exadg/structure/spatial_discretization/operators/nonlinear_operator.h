@@ -23,6 +23,7 @@
 #define INCLUDE_STRUCTURE_SPATIAL_DISCRETIZATION_NONLINEAR_OPERATOR_H_
 
 #include <exadg/structure/spatial_discretization/operators/elasticity_operator_base.h>
+#include <exadg/structure/spatial_discretization/operators/linearization_cache.h>
 
 namespace ExaDG
 {
@@ -73,6 +74,13 @@ public:
   VectorType const &
   get_solution_linearization() const;
 
+  /*
+   * Memory consumption of the cached linearization state in bytes (zero if the linearization is
+   * not cached).
+   */
+  std::size_t
+  get_memory_consumption_linearization_cache() const;
+
 private:
   /*
    * Non-linear operator.
@@ -183,9 +191,23 @@ private:
                               VectorType const &                      src,
                               Range const &                           range) const;
 
+  /*
+   * Computes F(d_lin) and S(d_lin) at all quadrature points and stores them in the
+   * linearization cache. Like for cell_loop_valid_deformation, dst is a dummy argument.
+   */
+  void
+  cell_loop_linearization_cache(dealii::MatrixFree<dim, Number> const & matrix_free,
+                                Number &                                dst,
+                                VectorType const &                      src,
+                                Range const &                           range) const;
+
+  void
+  update_linearization_cache() const;
 
   mutable std::shared_ptr<IntegratorCell> integrator_lin;
   mutable VectorType                      displacement_lin;
+
+  mutable LinearizationCache<dim, Number> linearization_cache;
 };
 
 } // namespace Structure
@@ -267,8 +267,13 @@ DriverQuasiStatic<dim, Number>::solve_step(double const load_factor,
   unsigned int const N_iter_linear    = std::get<1>(iter);
 
   if(not(is_test))
+  {
     print_solver_info_nonlinear(pcout, N_iter_nonlinear, N_iter_linear, timer.wall_time());
 
+    if(param.newton_solver_data.use_inexact_newton)
+      pde_operator->get_newton_statistics().print(pcout);
+  }
+
   return iter;
 }
 
@@ -117,7 +117,12 @@ DriverSteady<dim, Number>::do_solve()
     unsigned int const N_iter_linear    = std::get<1>(iter);
 
     if(not(is_test))
+    {
       print_solver_info_nonlinear(pcout, N_iter_nonlinear, N_iter_linear, timer.wall_time());
+
+      if(param.newton_solver_data.use_inexact_newton)
+        pde_operator->get_newton_statistics().print(pcout);
+    }
   }
   else // linear problem
   {
@@ -0,0 +1,182 @@
+/*  ______________________________________________________________________
+ *
+ *  ExaDG - High-Order Discontinuous Galerkin for the Exa-Scale
+ *
+ *  Copyright (C) 2021 by the ExaDG authors
+ *
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *  ______________________________________________________________________
+ */
+
+#include <exadg/structure/postprocessor/postprocessor_base.h>
+#include <exadg/structure/spatial_discretization/interface.h>
+#include <exadg/structure/time_integration/time_int_central_difference.h>
+#include <exadg/structure/user_interface/parameters.h>
+#include <exadg/utilities/print_solver_results.h>
+
+namespace ExaDG
+{
+namespace Structure
+{
+template<int dim, typename Number>
+TimeIntCentralDifference<dim, Number>::TimeIntCentralDifference(
+  std::shared_ptr<Interface::Operator<Number>> operator_,
+  std::shared_ptr<PostProcessorBase<Number>>   postprocessor_,
+  Parameters const &                           param_,
+  MPI_Comm const &                             mpi_comm_,
+  bool const                                   is_test_)
+  : Base(operator_, postprocessor_, param_, mpi_comm_, is_test_),
+    critical_time_step(std::numeric_limits<double>::max())
+{
+}
+
+template<int dim, typename Number>
+void
+TimeIntCentralDifference<dim, Number>::setup(bool const do_restart)
+{
+  Base::setup(do_restart);
+
+  // The critical time step size is estimated for the initial displacement. For problems with
+  // large deformations, the stiffness (and hence the critical time step size) might change in
+  // time, which has to be taken into account by a safety factor (CFL number).
+  critical_time_step =
+    this->pde_operator->calculate_critical_time_step(this->displacement_n, this->get_time());
+
+  if(this->param.calculation_of_time_step_size == TimeStepCalculation::CriticalTimeStep)
+  {
+    this->set_current_time_step_size(this->param.cfl_number * critical_time_step /
+                                     std::pow(2.0, this->refine_steps_time));
+  }
+
+  // The time step size is constant and the critical time step size is not updated during the
+  // simulation, so that it suffices to check the stability limit once.
+  AssertThrow(this->get_time_step_size() <= critical_time_step,
+              dealii::ExcMessage("The time step size " +
+                                 std::to_string(this->get_time_step_size()) +
+                                 " exceeds the critical time step size " +
+                                 std::to_string(critical_time_step) +
+                                 " of the explicit central difference scheme."));
+
+  this->pcout << std::endl << "Explicit time integration:" << std::endl << std::endl;
+  print_parameter(this->pcout, "Critical time step size", critical_time_step);
+  print_parameter(this->pcout, "Time step size", this->get_time_step_size());
+}
+
+template<int dim, typename Number>
+void
+TimeIntCentralDifference<dim, Number>::compute_initial_acceleration(bool const do_restart)
+{
+  if(not(do_restart))
+  {
+    // a_0 = M^{-1} (f_ext(t_0) - f_int(d_0))
+    this->pde_operator->evaluate_acceleration(this->acceleration_n,
+                                              this->displacement_n,
+                                              this->get_time());
+  }
+}
+
+template<int dim, typename Number>
+void
+TimeIntCentralDifference<dim, Number>::do_timestep_solve()
+{
+  dealii::Timer timer;
+  timer.restart();
+
+  double const dt = this->get_time_step_size();
+
+  // d_{n+1} = d_n + dt * v_n + dt^2/2 * a_n
+  this->displacement_np = this->displacement_n;
+  this->displacement_np.add(dt, this->velocity_n, 0.5 * dt * dt, this->acceleration_n);
+  this->pde_operator->set_constrained_values(this->displacement_np, this->get_next_time());
+
+  // a_{n+1} = M^{-1} (f_ext(t_{n+1}) - f_int(d_{n+1}))
+  unsigned int const iter = this->pde_operator->evaluate_acceleration(this->acceleration_np,
+                                                                      this->displacement_np,
+                                                                      this->get_next_time());
+
+  // v_{n+1} = v_n + dt/2 * (a_n + a_{n+1})
+  this->velocity_np = this->velocity_n;
+  this->velocity_np.add(0.5 * dt, this->acceleration_n, 0.5 * dt, this->acceleration_np);
+
+  this->iterations.first += 1;
+  std::get<1>(this->iterations.second) += iter;
+
+  if(this->store_solution)
+    this->displacement_last_iter = this->displacement_np;
+
+  if(this->print_solver_info() and not(this->is_test))
+  {
+    this->pcout << std::endl << "Explicit central difference step:";
+    if(this->param.mass_matrix_type == MassMatrixType::Consistent)
+      print_solver_info_linear(this->pcout, iter, timer.wall_time());
+    else
+      print_wall_time(this->pcout, timer.wall_time());
+  }
+
+  this->timer_tree->insert({"Timeloop", "Solve"}, timer.wall_time());
+}
+
+template<int dim, typename Number>
+void
+TimeIntCentralDifference<dim, Number>::set_displacement(VectorType const & displacement)
+{
+  this->displacement_np = displacement;
+
+  // velocity_np, acceleration_np depend on displacement_np, so we need to
+  // update these vectors as well
+  this->pde_operator->evaluate_acceleration(this->acceleration_np,
+                                            this->displacement_np,
+                                            this->get_next_time());
+
+  double const dt = this->get_time_step_size();
+
+  this->velocity_np = this->velocity_n;
+  this->velocity_np.add(0.5 * dt, this->acceleration_n, 0.5 * dt, this->acceleration_np);
+}
+
+template<int dim, typename Number>
+double
+TimeIntCentralDifference<dim, Number>::get_critical_time_step() const
+{
+  return critical_time_step;
+}
+
+template<int dim, typename Number>
+void
+TimeIntCentralDifference<dim, Number>::print_iterations() const
+{
+  if(this->param.mass_matrix_type == MassMatrixType::Consistent)
+  {
+    std::vector<std::string> names = {"Mass solver iterations"};
+    std::vector<double>      iterations_avg(1);
+
+    iterations_avg[0] = (double)std::get<1>(this->iterations.second) /
+                        std::max(1., (double)this->iterations.first);
+
+    print_list_of_iterations(this->pcout, names, iterations_avg);
+  }
+  else
+  {
+    this->pcout << "  Lumped mass matrix, no iterations." << std::endl;
+  }
+}
+
+template class TimeIntCentralDifference<2, float>;
+template class TimeIntCentralDifference<3, float>;
+
+template class TimeIntCentralDifference<2, double>;
+template class TimeIntCentralDifference<3, double>;
+
+} // namespace Structure
+} // namespace ExaDG
@@ -0,0 +1,88 @@
+/*  ______________________________________________________________________
+ *
+ *  ExaDG - High-Order Discontinuous Galerkin for the Exa-Scale
+ *
+ *  Copyright (C) 2021 by the ExaDG authors
+ *
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *  ______________________________________________________________________
+ */
+
+
+#ifndef INCLUDE_EXADG_STRUCTURE_TIME_INTEGRATION_TIME_INT_CENTRAL_DIFFERENCE_H_
+#define INCLUDE_EXADG_STRUCTURE_TIME_INTEGRATION_TIME_INT_CENTRAL_DIFFERENCE_H_
+
+// ExaDG
+#include <exadg/structure/time_integration/time_int_gen_alpha.h>
+
+namespace ExaDG
+{
+namespace Structure
+{
+/*
+ * Explicit central difference scheme for structural dynamics
+ *
+ *  d_{n+1} = d_n + dt * v_n + dt^2/2 * a_n ,
+ *  a_{n+1} = M^{-1} (f_ext(t_{n+1}) - f_int(d_{n+1})) ,
+ *  v_{n+1} = v_n + dt/2 * (a_n + a_{n+1}) ,
+ *
+ * which is the explicit member (beta = 0, gamma = 1/2) of the Newmark family of methods. Hence,
+ * it shares the interface of TimeIntGenAlpha, so that it can be used wherever the implicit
+ * scheme is used (e.g. as structure field solver in partitioned FSI). Only the inverse of the
+ * (lumped or consistent) mass matrix is required, no (non-)linear systems of equations have to
+ * be solved. The scheme is stable for time step sizes dt <= 2 / omega_max, where omega_max is
+ * the highest eigenfrequency of the discrete problem.
+ */
+template<int dim, typename Number>
+class TimeIntCentralDifference : public TimeIntGenAlpha<dim, Number>
+{
+private:
+  typedef TimeIntGenAlpha<dim, Number> Base;
+
+  typedef typename Base::VectorType VectorType;
+
+public:
+  TimeIntCentralDifference(std::shared_ptr<Interface::Operator<Number>> operator_,
+                           std::shared_ptr<PostProcessorBase<Number>>   postprocessor_,
+                           Parameters const &                           param_,
+                           MPI_Comm const &                             mpi_comm_,
+                           bool const                                   is_test_);
+
+  void
+  setup(bool const do_restart) final;
+
+  void
+  compute_initial_acceleration(bool const do_restart) final;
+
+  void
+  print_iterations() const final;
+
+  void
+  set_displacement(VectorType const & displacement) final;
+
+  double
+  get_critical_time_step() const;
+
+private:
+  void
+  do_timestep_solve() final;
+
+  // critical time step size estimated for the initial displacement
+  double critical_time_step;
+};
+
+} // namespace Structure
+} // namespace ExaDG
+
+#endif /* INCLUDE_EXADG_STRUCTURE_TIME_INTEGRATION_TIME_INT_CENTRAL_DIFFERENCE_H_ */
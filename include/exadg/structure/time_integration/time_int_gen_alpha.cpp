@@ -166,6 +166,9 @@ TimeIntGenAlpha<dim, Number>::do_timestep_solve()
     {
       this->pcout << std::endl << "Solve nonlinear elasticity problem:";
       print_solver_info_nonlinear(pcout, std::get<0>(iter), std::get<1>(iter), timer.wall_time());
+
+      if(this->param.newton_solver_data.use_inexact_newton)
+        pde_operator->get_newton_statistics().print(pcout);
     }
   }
   else // linear case
@@ -50,7 +50,7 @@ class Parameters;
 template<int dim, typename Number>
 class TimeIntGenAlpha : public TimeIntGenAlphaBase<Number>
 {
-private:
+protected:
   typedef dealii::LinearAlgebra::distributed::Vector<Number> VectorType;
 
 public:
@@ -61,16 +61,16 @@ public:
                   bool const                                   is_test_);
 
   void
-  setup(bool const do_restart) final;
+  setup(bool const do_restart) override;
 
   /*
    * This function needs to be called before the first time step is performed. In case of a restart,
    * the vector acceleration_n is read from restart files and nothing has to be done here.
    */
-  void
+  virtual void
   compute_initial_acceleration(bool const do_restart);
 
-  void
+  virtual void
   print_iterations() const;
 
   void
@@ -88,7 +88,7 @@ public:
   VectorType const &
   get_velocity_np();
 
-  void
+  virtual void
   set_displacement(VectorType const & displacement);
 
   /**
@@ -99,21 +99,9 @@ public:
   void
   advance_one_timestep_partitioned_solve(bool const use_extrapolation);
 
-private:
-  void
-  do_timestep_solve() final;
-
-  void
-  prepare_vectors_for_next_timestep() final;
-
-  void
-  do_write_restart(std::string const & filename) const final;
-
-  void
-  do_read_restart(std::ifstream & in) final;
-
+protected:
   void
-  postprocessing() const final;
+  do_timestep_solve() override;
 
   bool
   print_solver_info() const final;
@@ -146,6 +134,19 @@ private:
     unsigned int /* number of calls */,
     std::tuple<unsigned long long, unsigned long long> /* iteration counts {Newton, linear}*/>
     iterations;
+
+private:
+  void
+  prepare_vectors_for_next_timestep() final;
+
+  void
+  do_write_restart(std::string const & filename) const final;
+
+  void
+  do_read_restart(std::ifstream & in) final;
+
+  void
+  postprocessing() const final;
 };
 
 } // namespace Structure
@@ -124,7 +124,68 @@ enum_to_string(MaterialType const enum_type)
 /*                                                                                    */
 /**************************************************************************************/
 
-// there are currently no enums for this section
+std::string
+enum_to_string(TemporalDiscretization const enum_type)
+{
+  std::string string_type;
+
+  switch(enum_type)
+  {
+    case TemporalDiscretization::GenAlpha:
+      string_type = "GenAlpha";
+      break;
+    case TemporalDiscretization::CentralDifference:
+      string_type = "CentralDifference";
+      break;
+    default:
+      AssertThrow(false, dealii::ExcMessage("Not implemented."));
+      break;
+  }
+
+  return string_type;
+}
+
+std::string
+enum_to_string(TimeStepCalculation const enum_type)
+{
+  std::string string_type;
+
+  switch(enum_type)
+  {
+    case TimeStepCalculation::UserSpecified:
+      string_type = "UserSpecified";
+      break;
+    case TimeStepCalculation::CriticalTimeStep:
+      string_type = "CriticalTimeStep";
+      break;
+    default:
+      AssertThrow(false, dealii::ExcMessage("Not implemented."));
+      break;
+  }
+
+  return string_type;
+}
+
+std::string
+enum_to_string(MassMatrixType const enum_type)
+{
+  std::string string_type;
+
+  switch(enum_type)
+  {
+    case MassMatrixType::Consistent:
+      string_type = "Consistent";
+      break;
+    case MassMatrixType::Lumped:
+      string_type = "Lumped";
+      break;
+    default:
+      AssertThrow(false, dealii::ExcMessage("Not implemented."));
+      break;
+  }
+
+  return string_type;
+}
 
 
 
@@ -160,6 +221,12 @@ enum_to_string(Solver const enum_type)
     case Solver::FGMRES:
       string_type = "FGMRES";
       break;
+    case Solver::DeflatedCG:
+      string_type = "DeflatedCG";
+      break;
+    case Solver::GCRODR:
+      string_type = "GCRODR";
+      break;
     default:
       AssertThrow(false, dealii::ExcMessage("Not implemented."));
       break;
@@ -84,7 +84,58 @@ enum_to_string(MaterialType const enum_type);
 /*                                                                                    */
 /**************************************************************************************/
 
-// there are currently no enums for this section
+/*
+ *  Temporal discretization method for unsteady problems:
+ *
+ *  GenAlpha: implicit generalized-alpha family of methods, see GenAlphaType
+ *
+ *  CentralDifference: explicit central difference scheme, which requires the inversion of
+ *  the mass matrix only and no solution of (non-)linear systems of equations. The scheme is
+ *  conditionally stable and the time step size is restricted by the highest eigenfrequency
+ *  of the discrete problem.
+ */
+enum class TemporalDiscretization
+{
+  GenAlpha,
+  CentralDifference
+};
+
+std::string
+enum_to_string(TemporalDiscretization const enum_type);
+
+/*
+ * Calculation of time step size
+ *
+ * UserSpecified: time_step_size is used
+ *
+ * CriticalTimeStep: the time step size is set to cfl_number times the critical time step size
+ * of the explicit scheme (only relevant for explicit time integration)
+ */
+enum class TimeStepCalculation
+{
+  UserSpecified,
+  CriticalTimeStep
+};
+
+std::string
+enum_to_string(TimeStepCalculation const enum_type);
+
+/*
+ * Type of mass matrix for explicit time integration
+ *
+ * Consistent: the consistent mass matrix is inverted iteratively (matrix-free CG solver)
+ *
+ * Lumped: row-sum lumped (diagonal) mass matrix, which coincides with the mass matrix obtained
+ * by Gauss-Lobatto quadrature collocated with the nodes of the shape functions on affine meshes
+ */
+enum class MassMatrixType
+{
+  Consistent,
+  Lumped
+};
+
+std::string
+enum_to_string(MassMatrixType const enum_type);
 
 
 
@@ -106,12 +157,17 @@ enum_to_string(MaterialType const enum_type);
 
 /*
  *   Solver for linear system of equations
+ *
+ *   DeflatedCG and GCRODR recycle a subspace from one linear solve to the next, which reduces
+ *   the number of iterations for sequences of similar linear systems (e.g. Newton iterations).
  */
 enum class Solver
 {
   Undefined,
   CG,
-  FGMRES
+  FGMRES,
+  DeflatedCG,
+  GCRODR
 };
 
 std::string
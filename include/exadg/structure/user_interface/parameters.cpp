@@ -47,8 +47,12 @@ Parameters::Parameters()
     time_step_size(1.0),
     max_number_of_time_steps(std::numeric_limits<unsigned int>::max()),
     n_refine_time(0),
+    temporal_discretization(TemporalDiscretization::GenAlpha),
     gen_alpha_type(GenAlphaType::GenAlpha),
     spectral_radius(1.0),
+    calculation_of_time_step_size(TimeStepCalculation::UserSpecified),
+    cfl_number(0.9),
+    mass_matrix_type(MassMatrixType::Lumped),
     solver_info_data(SolverInfoData()),
     restarted_simulation(false),
     restart_data(RestartData()),
@@ -62,6 +66,9 @@ Parameters::Parameters()
 
     // SOLVER
     newton_solver_data(Newton::SolverData(1e4, 1.e-12, 1.e-6)),
+    cache_linearization(false),
+    cache_linearization_single_precision(false),
+    cache_linearization_symmetric_stress(false),
     solver(Solver::Undefined),
     solver_data(SolverData(1e4, 1.e-12, 1.e-6, 100)),
     preconditioner(Preconditioner::AMG),
@@ -93,13 +100,39 @@ Parameters::check() const
                 dealii::ExcMessage("Restart has not been implemented."));
   }
 
+  // TEMPORAL DISCRETIZATION
+  if(involves_explicit_time_integration())
+  {
+    if(calculation_of_time_step_size == TimeStepCalculation::CriticalTimeStep)
+      AssertThrow(cfl_number > 0.0 and cfl_number <= 1.0,
+                  dealii::ExcMessage("cfl_number has to be in (0,1]."));
+  }
+  else
+  {
+    AssertThrow(calculation_of_time_step_size == TimeStepCalculation::UserSpecified,
+                dealii::ExcMessage("The time step size can only be calculated automatically "
+                                   "for explicit time integration."));
+  }
+
   // SPATIAL DISCRETIZATION
   grid.check();
 
   AssertThrow(degree > 0, dealii::ExcMessage("Polynomial degree must be larger than zero."));
 
   // SOLVER
-  AssertThrow(solver != Solver::Undefined, dealii::ExcMessage("Parameter must be defined."));
+  if(not(involves_explicit_time_integration()))
+    AssertThrow(solver != Solver::Undefined, dealii::ExcMessage("Parameter must be defined."));
+
+  if(solver == Solver::DeflatedCG or solver == Solver::GCRODR)
+    AssertThrow(solver_data.recycle_space_size > 0,
+                dealii::ExcMessage("Size of recycle space has to be larger than zero."));
+
+  if(preconditioner == Preconditioner::Multigrid)
+  {
+    // full multigrid is only applied to linear problems, not within the Newton solver
+    multigrid_data.cycle_data.check(solver == Solver::FGMRES or solver == Solver::GCRODR,
+                                    not(large_deformation) /* full_multigrid_supported */);
+  }
 }
 
 bool
@@ -111,6 +144,13 @@ Parameters::involves_h_multigrid() const
     return false;
 }
 
+bool
+Parameters::involves_explicit_time_integration() const
+{
+  return problem_type == ProblemType::Unsteady and
+         temporal_discretization == TemporalDiscretization::CentralDifference;
+}
+
 void
 Parameters::print(dealii::ConditionalOStream const & pcout, std::string const & name) const
 {
@@ -177,8 +217,21 @@ Parameters::print_parameters_temporal_discretization(dealii::ConditionalOStream
     print_parameter(pcout, "End time", end_time);
     print_parameter(pcout, "Max. number of time steps", max_number_of_time_steps);
     print_parameter(pcout, "Temporal refinements", n_refine_time);
-    print_parameter(pcout, "Time integration type", enum_to_string(gen_alpha_type));
-    print_parameter(pcout, "Spectral radius", spectral_radius);
+    print_parameter(pcout, "Temporal discretization", enum_to_string(temporal_discretization));
+    if(temporal_discretization == TemporalDiscretization::GenAlpha)
+    {
+      print_parameter(pcout, "Time integration type", enum_to_string(gen_alpha_type));
+      print_parameter(pcout, "Spectral radius", spectral_radius);
+    }
+    else if(temporal_discretization == TemporalDiscretization::CentralDifference)
+    {
+      print_parameter(pcout,
+                      "Calculation of time step size",
+                      enum_to_string(calculation_of_time_step_size));
+      if(calculation_of_time_step_size == TimeStepCalculation::CriticalTimeStep)
+        print_parameter(pcout, "CFL number", cfl_number);
+      print_parameter(pcout, "Mass matrix", enum_to_string(mass_matrix_type));
+    }
     solver_info_data.print(pcout);
     if(restarted_simulation)
       restart_data.print(pcout);
@@ -205,6 +258,13 @@ Parameters::print_parameters_solver(dealii::ConditionalOStream const & pcout) co
   {
     pcout << std::endl << "Newton:" << std::endl;
     newton_solver_data.print(pcout);
+
+    print_parameter(pcout, "Cache linearization", cache_linearization);
+    if(cache_linearization)
+    {
+      print_parameter(pcout, "Single precision storage", cache_linearization_single_precision);
+      print_parameter(pcout, "Symmetric storage of stresses", cache_linearization_symmetric_stress);
+    }
   }
 
   // linear solver
@@ -49,6 +49,11 @@ public:
   bool
   involves_h_multigrid() const;
 
+  // explicit time integration does not require the solution of systems of equations
+  // (except for the inverse of a consistent mass matrix)
+  bool
+  involves_explicit_time_integration() const;
+
   void
   print(dealii::ConditionalOStream const & pcout, std::string const & name) const;
 
@@ -144,11 +149,26 @@ public:
   // number of refinements for temporal discretization
   unsigned int n_refine_time;
 
+  // description: see enum declaration
+  TemporalDiscretization temporal_discretization;
+
   GenAlphaType gen_alpha_type;
 
   // spectral radius rho_infty for generalized alpha time integration scheme
   double spectral_radius;
 
+  // explicit time integration (CentralDifference)
+
+  // description: see enum declaration
+  TimeStepCalculation calculation_of_time_step_size;
+
+  // time step size = cfl_number * critical time step size, where the critical time step size
+  // 2 / omega_max is obtained from an estimate of the highest eigenfrequency omega_max
+  double cfl_number;
+
+  // description: see enum declaration
+  MassMatrixType mass_matrix_type;
+
   // configure printing of solver performance (wall time, number of iterations)
   SolverInfoData solver_info_data;
 
@@ -184,6 +204,18 @@ public:
   // Newton solver data (only relevant for nonlinear problems)
   Newton::SolverData newton_solver_data;
 
+  // Only relevant for nonlinear problems: store the deformation gradient and the stresses at the
+  // point of linearization for all quadrature points instead of recomputing them in every
+  // application of the linearized operator. This trades memory for arithmetic work and avoids
+  // the evaluation of the constitutive law within the linear solver.
+  bool cache_linearization;
+
+  // store the cached quantities in single precision (also for Number = double)
+  bool cache_linearization_single_precision;
+
+  // store only the independent components of the symmetric 2nd Piola-Kirchhoff stress tensor
+  bool cache_linearization_symmetric_stress;
+
   // description: see enum declaration
   Solver solver;
 
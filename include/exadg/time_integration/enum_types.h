@@ -47,6 +47,29 @@ enum class GenAlphaType
 std::string
 enum_to_string(GenAlphaType const enum_type);
 
+/*
+ *  Temporal discretization method of the sub-steps of operator-integration-factor (OIF) splitting:
+ *
+ *    Explicit Runge-Kutta methods
+ */
+enum class TimeIntegratorOIF
+{
+  Undefined,
+  ExplRK1Stage1,
+  ExplRK2Stage2,
+  ExplRK3Stage3,
+  ExplRK4Stage4,
+  ExplRK3Stage4Reg2C,
+  ExplRK3Stage7Reg2, // optimized for maximum time step sizes in DG context
+  ExplRK4Stage5Reg2C,
+  ExplRK4Stage8Reg2, // optimized for maximum time step sizes in DG context
+  ExplRK4Stage5Reg3C,
+  ExplRK5Stage9Reg2S
+};
+
+std::string
+enum_to_string(TimeIntegratorOIF const enum_type);
+
 } // namespace ExaDG
 
 #endif /* INCLUDE_EXADG_TIME_INTEGRATION_ENUM_TYPES_H_ */
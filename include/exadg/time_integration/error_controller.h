@@ -0,0 +1,249 @@
+/*  ______________________________________________________________________
+ *
+ *  ExaDG - High-Order Discontinuous Galerkin for the Exa-Scale
+ *
+ *  Copyright (C) 2021 by the ExaDG authors
+ *
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *  ______________________________________________________________________
+ */
+
+#ifndef INCLUDE_EXADG_TIME_INTEGRATION_ERROR_CONTROLLER_H_
+#define INCLUDE_EXADG_TIME_INTEGRATION_ERROR_CONTROLLER_H_
+
+// C/C++
+#include <algorithm>
+#include <cmath>
+
+// deal.II
+#include <deal.II/base/conditional_ostream.h>
+#include <deal.II/base/mpi.h>
+
+// ExaDG
+#include <exadg/utilities/print_functions.h>
+
+namespace ExaDG
+{
+struct ErrorControllerData
+{
+  ErrorControllerData()
+    : active(false),
+      relative_tolerance(1.e-4),
+      absolute_tolerance(1.e-6),
+      safety_factor(0.9),
+      min_factor(0.2),
+      max_factor(5.0),
+      max_rejections(50)
+  {
+  }
+
+  void
+  print(dealii::ConditionalOStream const & pcout) const
+  {
+    print_parameter(pcout, "Error-controlled time stepping", active);
+
+    if(active)
+    {
+      print_parameter(pcout, "Relative tolerance", relative_tolerance);
+      print_parameter(pcout, "Absolute tolerance", absolute_tolerance);
+      print_parameter(pcout, "Safety factor", safety_factor);
+      print_parameter(pcout, "Minimum factor", min_factor);
+      print_parameter(pcout, "Maximum factor", max_factor);
+    }
+  }
+
+  // time step size selection based on a temporal error estimate (embedded Runge-Kutta method or
+  // predictor-corrector estimate of BDF schemes)
+  bool active;
+
+  // tolerances of the weighted error norm, see ErrorController
+  double relative_tolerance;
+  double absolute_tolerance;
+
+  // the new time step size is multiplied by the safety factor and the change of the time step
+  // size is limited to the interval [min_factor, max_factor]
+  double safety_factor;
+  double min_factor;
+  double max_factor;
+
+  // maximum number of subsequent rejections of a time step
+  unsigned int max_rejections;
+};
+
+/*
+ * PI controller for the time step size of embedded Runge-Kutta methods, see
+ *
+ *   Hairer, E., Wanner, G. (1996). Solving Ordinary Differential Equations II. Springer, Section
+ *   IV.2.
+ *
+ * The error is measured in the norm
+ *
+ *   err = sqrt(1/N sum_i (e_i / (atol + rtol * max(|u_n,i|, |u_n+1,i|)))^2),
+ *
+ * where e is the difference between the solutions of the two methods of the pair. A time step is
+ * accepted if err <= 1. The new time step size is
+ *
+ *   dt_new = dt * safety * err^(-alpha) * err_old^(beta)
+ *
+ * with beta = 0.4/k, alpha = 1/k - 0.75 beta, where k-1 is the order of the embedded method and
+ * err_old the error of the last accepted time step. After a rejected time step, the time step size
+ * is reduced using the elementary controller (beta = 0) and is not increased.
+ */
+class ErrorController
+{
+public:
+  ErrorController()
+    : alpha(0.0),
+      beta(0.0),
+      error_last_accepted(1.0),
+      last_step_rejected(false),
+      n_accepted(0),
+      n_rejected(0),
+      sum_time_steps(0.0)
+  {
+  }
+
+  void
+  reinit(ErrorControllerData const & data_in, unsigned int const order_embedded)
+  {
+    data = data_in;
+
+    set_order_embedded(order_embedded);
+
+    error_last_accepted = 1.0;
+    last_step_rejected  = false;
+  }
+
+  /*
+   * Adjusts the exponents of the controller to the order of the embedded method, e.g., when the
+   * order of a multistep method increases during the start-up phase. In contrast to reinit(), the
+   * history of the controller is retained.
+   */
+  void
+  set_order_embedded(unsigned int const order_embedded)
+  {
+    double const k = order_embedded + 1.0;
+
+    beta  = 0.4 / k;
+    alpha = 1.0 / k - 0.75 * beta;
+  }
+
+  bool
+  is_active() const
+  {
+    return data.active;
+  }
+
+  ErrorControllerData const &
+  get_data() const
+  {
+    return data;
+  }
+
+  /*
+   * Weighted root mean square norm of the error estimate, see above.
+   */
+  template<typename VectorType>
+  double
+  calculate_error_norm(VectorType const & error,
+                       VectorType const & solution_old,
+                       VectorType const & solution_new) const
+  {
+    double sum = 0.0;
+    for(unsigned int i = 0; i < error.locally_owned_size(); ++i)
+    {
+      double const scale =
+        data.absolute_tolerance +
+        data.relative_tolerance * std::max(std::abs(double(solution_old.local_element(i))),
+                                           std::abs(double(solution_new.local_element(i))));
+      double const e = error.local_element(i) / scale;
+
+      sum += e * e;
+    }
+
+    sum = dealii::Utilities::MPI::sum(sum, error.get_mpi_communicator());
+
+    return std::sqrt(sum / error.size());
+  }
+
+  /*
+   * Decides whether a time step of size time_step with the given error is accepted and returns
+   * the time step size of the next attempt (rejected time step) or of the next time step
+   * (accepted time step), respectively.
+   */
+  bool
+  accept(double const error, double const time_step, double & new_time_step)
+  {
+    // avoid division by zero for vanishing errors
+    double const err = std::max(error, 1.e-10);
+
+    if(err <= 1.0)
+    {
+      double factor =
+        data.safety_factor * std::pow(err, -alpha) * std::pow(error_last_accepted, beta);
+      factor = std::min(data.max_factor, std::max(data.min_factor, factor));
+
+      if(last_step_rejected)
+        factor = std::min(factor, 1.0);
+
+      new_time_step = time_step * factor;
+
+      error_last_accepted = err;
+      last_step_rejected  = false;
+
+      ++n_accepted;
+      sum_time_steps += time_step;
+
+      return true;
+    }
+    else
+    {
+      double const factor = data.safety_factor * std::pow(err, -(alpha + 0.75 * beta));
+
+      new_time_step = time_step * std::max(data.min_factor, factor);
+
+      last_step_rejected = true;
+
+      ++n_rejected;
+
+      return false;
+    }
+  }
+
+  void
+  print_statistics(dealii::ConditionalOStream const & pcout) const
+  {
+    pcout << std::endl << "Error-controlled time stepping:" << std::endl;
+    print_parameter(pcout, "Accepted time steps", n_accepted);
+    print_parameter(pcout, "Rejected time steps", n_rejected);
+    if(n_accepted > 0)
+      print_parameter(pcout, "Average time step size", sum_time_steps / n_accepted);
+  }
+
+private:
+  ErrorControllerData data;
+
+  double alpha, beta;
+
+  double error_last_accepted;
+  bool   last_step_rejected;
+
+  // statistics
+  unsigned int n_accepted, n_rejected;
+  double       sum_time_steps;
+};
+
+} // namespace ExaDG
+
+#endif /* INCLUDE_EXADG_TIME_INTEGRATION_ERROR_CONTROLLER_H_ */
@@ -22,13 +22,17 @@
 #ifndef INCLUDE_CONVECTION_DIFFUSION_EXPLICIT_RUNGE_KUTTA_H_
 #define INCLUDE_CONVECTION_DIFFUSION_EXPLICIT_RUNGE_KUTTA_H_
 
+// C/C++
+#include <vector>
+
 namespace ExaDG
 {
 template<typename Operator, typename VectorType>
 class ExplicitTimeIntegrator
 {
 public:
-  ExplicitTimeIntegrator(std::shared_ptr<Operator> operator_in) : underlying_operator(operator_in)
+  ExplicitTimeIntegrator(std::shared_ptr<Operator> operator_in)
+    : underlying_operator(operator_in), error_estimate(nullptr)
   {
   }
 
@@ -42,8 +46,42 @@ public:
   virtual unsigned int
   get_order() const = 0;
 
+  /*
+   * Order of the embedded method, or 0 if the method has no embedded method.
+   */
+  virtual unsigned int
+  get_order_embedded() const
+  {
+    return 0;
+  }
+
+  /*
+   * For methods with an embedded method: if a vector is provided, solve_timestep() additionally
+   * computes the difference between the solutions of the main and the embedded method as an
+   * estimate of the local error.
+   */
+  void
+  set_error_estimate(VectorType * error_estimate_in)
+  {
+    error_estimate = error_estimate_in;
+  }
+
 protected:
+  void
+  add_to_error_estimate(bool const first_stage, double const factor, VectorType const & k) const
+  {
+    if(error_estimate == nullptr)
+      return;
+
+    if(first_stage)
+      error_estimate->equ(factor, k);
+    else
+      error_estimate->add(factor, k);
+  }
+
   std::shared_ptr<Operator> underlying_operator;
+
+  VectorType * error_estimate;
 };
 
 /*
@@ -195,6 +233,48 @@ private:
 
 
 
+/*
+ *  Time step of a low-storage Runge-Kutta method with two registers of type 2R+ (see below)
+ *  for the coefficients a_{i+1,i} (a), b_i (b), and c_i (c), where the operator fuses the
+ *  application of the inverse mass operator and the vector updates of each stage into a single
+ *  loop, see evaluate_and_update_stage() of the operator. In stage i, the operator computes
+ *
+ *    k_i   = M^{-1} L(u_i),
+ *    u_i+1 = u_p + a_{i+1,i} * dt * k_i,
+ *    u_p   = u_p + b_i * dt * k_i,
+ *
+ *  with the registers u_i (vec_n) and u_p (vec_np), while vec_tmp holds k_i.
+ */
+template<typename Operator, typename VectorType>
+void
+solve_timestep_low_storage_reg2_fused(Operator const &            underlying_operator,
+                                      VectorType &                vec_np,
+                                      VectorType &                vec_n,
+                                      VectorType &                vec_tmp,
+                                      double const                time,
+                                      double const                time_step,
+                                      std::vector<double> const & a,
+                                      std::vector<double> const & b,
+                                      std::vector<double> const & c)
+{
+  unsigned int const stages = b.size();
+
+  vec_np = vec_n; /* = u_p */
+
+  for(unsigned int s = 0; s < stages; ++s)
+  {
+    bool const last_stage = (s == stages - 1);
+
+    underlying_operator.evaluate_and_update_stage(vec_np,
+                                                  vec_n,
+                                                  vec_tmp,
+                                                  time + c[s] * time_step,
+                                                  last_stage ? 0.0 : a[s] * time_step,
+                                                  b[s] * time_step,
+                                                  not(last_stage));
+  }
+}
+
 /****************************************************************************************
  *                                                                                      *
  *  Low-storage, explicit Runge-Kutta methods according to                              *
@@ -228,14 +308,16 @@ private:
 /*
  *  Low storage Runge-Kutta method of order 3 with 4 stages and 2 registers according to
  *  Kennedy et al. (2000), where this method is denoted as RK3(2)4[2R+]C,
- *  see Table 1 on page 189 for the coefficients.
+ *  see Table 1 on page 189 for the coefficients. The embedded method of order 2 (coefficients
+ *  bh_i) provides an estimate of the local error, see set_error_estimate().
  */
 template<typename Operator, typename VectorType>
 class LowStorageRK3Stage4Reg2C : public ExplicitTimeIntegrator<Operator, VectorType>
 {
 public:
-  LowStorageRK3Stage4Reg2C(std::shared_ptr<Operator> const operator_in)
-    : ExplicitTimeIntegrator<Operator, VectorType>(operator_in)
+  LowStorageRK3Stage4Reg2C(std::shared_ptr<Operator> const operator_in,
+                           bool const                      fused_stages_in = false)
+    : ExplicitTimeIntegrator<Operator, VectorType>(operator_in), fused_stages(fused_stages_in)
   {
   }
 
@@ -271,31 +353,57 @@ public:
     double const b3 = 57731312506979. / 19404895981398.;
     double const b4 = -101169746363290. / 37734290219643.;
 
+    double const bh1 = 15763415370699. / 46270243929542.;
+    double const bh2 = 514528521746. / 5659431552419.;
+    double const bh3 = 27030193851939. / 9429696342944.;
+    double const bh4 = -69544964788955. / 30262026368149.;
+
     double const c1 = 0.;
     double const c2 = a21;
     double const c3 = b1 + a32;
     double const c4 = b1 + b2 + a43;
 
+    if(fused_stages)
+    {
+      AssertThrow(this->error_estimate == nullptr,
+                  dealii::ExcMessage("The error estimate is not implemented for fused stages."));
+
+      solve_timestep_low_storage_reg2_fused(*this->underlying_operator,
+                                            vec_np,
+                                            vec_n,
+                                            vec_tmp1,
+                                            time,
+                                            time_step,
+                                            {a21, a32, a43},
+                                            {b1, b2, b3, b4},
+                                            {c1, c2, c3, c4});
+      return;
+    }
+
     // stage 1
     this->underlying_operator->evaluate(vec_tmp1, vec_n /* u_1 */, time + c1 * time_step);
+    this->add_to_error_estimate(true, (b1 - bh1) * time_step, vec_tmp1);
     vec_n.add(a21 * time_step, vec_tmp1); /* = u_2 */
     vec_np = vec_n;
     vec_np.add((b1 - a21) * time_step, vec_tmp1); /* = u_p */
 
     // stage 2
     this->underlying_operator->evaluate(vec_tmp1, vec_n /* u_2 */, time + c2 * time_step);
+    this->add_to_error_estimate(false, (b2 - bh2) * time_step, vec_tmp1);
     vec_np.add(a32 * time_step, vec_tmp1); /* = u_3 */
     vec_n = vec_np;
     vec_n.add((b2 - a32) * time_step, vec_tmp1); /* = u_p */
 
     // stage 3
     this->underlying_operator->evaluate(vec_tmp1, vec_np /* u_3 */, time + c3 * time_step);
+    this->add_to_error_estimate(false, (b3 - bh3) * time_step, vec_tmp1);
     vec_n.add(a43 * time_step, vec_tmp1); /* = u_4 */
     vec_np = vec_n;
     vec_np.add((b3 - a43) * time_step, vec_tmp1); /* = u_p */
 
     // stage 4
     this->underlying_operator->evaluate(vec_tmp1, vec_n /* u_3 */, time + c4 * time_step);
+    this->add_to_error_estimate(false, (b4 - bh4) * time_step, vec_tmp1);
     vec_np.add(b4 * time_step, vec_tmp1); /* = u_p */
   }
 
@@ -305,22 +413,32 @@ public:
     return 3;
   }
 
+  unsigned int
+  get_order_embedded() const final
+  {
+    return 2;
+  }
+
 private:
   VectorType vec_tmp1;
+
+  bool fused_stages;
 };
 
 
 /*
  *  Low storage Runge-Kutta method of order 4 with 5 stages and 2 registers according to
  *  Kennedy et al. (2000), where this method is denoted as RK4(3)5[2R+]C,
- *  see Table 1 on page 189 for the coefficients.
+ *  see Table 1 on page 189 for the coefficients. The embedded method of order 3 (coefficients
+ *  bh_i) provides an estimate of the local error, see set_error_estimate().
  */
 template<typename Operator, typename VectorType>
 class LowStorageRK4Stage5Reg2C : public ExplicitTimeIntegrator<Operator, VectorType>
 {
 public:
-  LowStorageRK4Stage5Reg2C(std::shared_ptr<Operator> const operator_in)
-    : ExplicitTimeIntegrator<Operator, VectorType>(operator_in)
+  LowStorageRK4Stage5Reg2C(std::shared_ptr<Operator> const operator_in,
+                           bool const                      fused_stages_in = false)
+    : ExplicitTimeIntegrator<Operator, VectorType>(operator_in), fused_stages(fused_stages_in)
   {
   }
 
@@ -359,38 +477,66 @@ public:
     double const b4 = 2114624349019. / 3568978502595.;
     double const b5 = 5198255086312. / 14908931495163.;
 
+    double const bh1 = 1016888040809. / 7410784769900.;
+    double const bh2 = 11231460423587. / 58533540763752.;
+    double const bh3 = -1563879915014. / 6823010717585.;
+    double const bh4 = 606302364029. / 971179775848.;
+    double const bh5 = 1097981568119. / 3980877426909.;
+
     double const c1 = 0.;
     double const c2 = a21;
     double const c3 = b1 + a32;
     double const c4 = b1 + b2 + a43;
     double const c5 = b1 + b2 + b3 + a54;
 
+    if(fused_stages)
+    {
+      AssertThrow(this->error_estimate == nullptr,
+                  dealii::ExcMessage("The error estimate is not implemented for fused stages."));
+
+      solve_timestep_low_storage_reg2_fused(*this->underlying_operator,
+                                            vec_np,
+                                            vec_n,
+                                            vec_tmp1,
+                                            time,
+                                            time_step,
+                                            {a21, a32, a43, a54},
+                                            {b1, b2, b3, b4, b5},
+                                            {c1, c2, c3, c4, c5});
+      return;
+    }
+
     // stage 1
     this->underlying_operator->evaluate(vec_tmp1, vec_n /* u_1 */, time + c1 * time_step);
+    this->add_to_error_estimate(true, (b1 - bh1) * time_step, vec_tmp1);
     vec_n.add(a21 * time_step, vec_tmp1); /* = u_2 */
     vec_np = vec_n;
     vec_np.add((b1 - a21) * time_step, vec_tmp1); /* = u_p */
 
     // stage 2
     this->underlying_operator->evaluate(vec_tmp1, vec_n /* u_2 */, time + c2 * time_step);
+    this->add_to_error_estimate(false, (b2 - bh2) * time_step, vec_tmp1);
     vec_np.add(a32 * time_step, vec_tmp1); /* = u_3 */
     vec_n = vec_np;
     vec_n.add((b2 - a32) * time_step, vec_tmp1); /* = u_p */
 
     // stage 3
     this->underlying_operator->evaluate(vec_tmp1, vec_np /* u_3 */, time + c3 * time_step);
+    this->add_to_error_estimate(false, (b3 - bh3) * time_step, vec_tmp1);
     vec_n.add(a43 * time_step, vec_tmp1); /* = u_4 */
     vec_np = vec_n;
     vec_np.add((b3 - a43) * time_step, vec_tmp1); /* = u_p */
 
     // stage 4
     this->underlying_operator->evaluate(vec_tmp1, vec_n /* u_3 */, time + c4 * time_step);
+    this->add_to_error_estimate(false, (b4 - bh4) * time_step, vec_tmp1);
     vec_np.add(a54 * time_step, vec_tmp1); /* = u_5 */
     vec_n = vec_np;
     vec_n.add((b4 - a54) * time_step, vec_tmp1); /* = u_p */
 
     // stage 5
     this->underlying_operator->evaluate(vec_tmp1, vec_np /* u_4 */, time + c5 * time_step);
+    this->add_to_error_estimate(false, (b5 - bh5) * time_step, vec_tmp1);
     vec_np = vec_n;
     vec_np.add(b5 * time_step, vec_tmp1);
   }
@@ -401,8 +547,16 @@ public:
     return 4;
   }
 
+  unsigned int
+  get_order_embedded() const final
+  {
+    return 3;
+  }
+
 private:
   VectorType vec_tmp1;
+
+  bool fused_stages;
 };
 
 /*
@@ -526,8 +680,9 @@ template<typename Operator, typename VectorType>
 class LowStorageRK5Stage9Reg2S : public ExplicitTimeIntegrator<Operator, VectorType>
 {
 public:
-  LowStorageRK5Stage9Reg2S(std::shared_ptr<Operator> const operator_in)
-    : ExplicitTimeIntegrator<Operator, VectorType>(operator_in)
+  LowStorageRK5Stage9Reg2S(std::shared_ptr<Operator> const operator_in,
+                           bool const                      fused_stages_in = false)
+    : ExplicitTimeIntegrator<Operator, VectorType>(operator_in), fused_stages(fused_stages_in)
   {
   }
 
@@ -585,6 +740,20 @@ public:
     double const c8 = b1 + b2 + b3 + b4 + b5 + b6 + a87;
     double const c9 = b1 + b2 + b3 + b4 + b5 + b6 + b7 + a98;
 
+    if(fused_stages)
+    {
+      solve_timestep_low_storage_reg2_fused(*this->underlying_operator,
+                                            vec_np,
+                                            vec_n,
+                                            vec_tmp1,
+                                            time,
+                                            time_step,
+                                            {a21, a32, a43, a54, a65, a76, a87, a98},
+                                            {b1, b2, b3, b4, b5, b6, b7, b8, b9},
+                                            {c1, c2, c3, c4, c5, c6, c7, c8, c9});
+      return;
+    }
+
     // stage 1
     this->underlying_operator->evaluate(vec_tmp1, vec_n /* u_1 */, time + c1 * time_step);
     vec_n.add(a21 * time_step, vec_tmp1); /* = u_2 */
@@ -647,6 +816,8 @@ public:
 
 private:
   VectorType vec_tmp1;
+
+  bool fused_stages;
 };
 
 
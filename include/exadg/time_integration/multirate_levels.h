@@ -0,0 +1,371 @@
+/*  ______________________________________________________________________
+ *
+ *  ExaDG - High-Order Discontinuous Galerkin for the Exa-Scale
+ *
+ *  Copyright (C) 2021 by the ExaDG authors
+ *
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *  ______________________________________________________________________
+ */
+
+#ifndef INCLUDE_EXADG_TIME_INTEGRATION_MULTIRATE_LEVELS_H_
+#define INCLUDE_EXADG_TIME_INTEGRATION_MULTIRATE_LEVELS_H_
+
+// C/C++
+#include <algorithm>
+#include <cmath>
+#include <functional>
+#include <limits>
+#include <vector>
+
+// deal.II
+#include <deal.II/base/mpi.h>
+#include <deal.II/distributed/tria.h>
+#include <deal.II/grid/grid_tools.h>
+#include <deal.II/lac/la_parallel_vector.h>
+#include <deal.II/matrix_free/matrix_free.h>
+
+namespace ExaDG
+{
+/*
+ * Assigns each active cell a time step level for multirate time integration: a cell on level l
+ * is advanced with the time step 2^l * dt_min, where dt_min is the smallest admissible time step
+ * of all cells. The admissible time step of a cell is given as a function of the element length
+ * (minimum vertex distance). The number of levels is limited by max_levels.
+ *
+ * The returned vector is indexed by active_cell_index() and is filled for locally owned and ghost
+ * cells.
+ */
+template<int dim>
+std::vector<unsigned int>
+calculate_time_step_levels(dealii::Triangulation<dim> const &          triangulation,
+                           std::function<double(double const)> const & time_step_of_length,
+                           unsigned int const                          max_levels,
+                           MPI_Comm const &                            mpi_comm)
+{
+  double time_step_min = std::numeric_limits<double>::max();
+  for(auto const & cell : triangulation.active_cell_iterators())
+  {
+    if(cell->is_locally_owned())
+      time_step_min = std::min(time_step_min, time_step_of_length(cell->minimum_vertex_distance()));
+  }
+  time_step_min = dealii::Utilities::MPI::min(time_step_min, mpi_comm);
+
+  std::vector<unsigned int> levels(triangulation.n_active_cells(), 0);
+  for(auto const & cell : triangulation.active_cell_iterators())
+  {
+    if(cell->is_locally_owned() or cell->is_ghost())
+    {
+      double const ratio = time_step_of_length(cell->minimum_vertex_distance()) / time_step_min;
+
+      // the small tolerance accounts for round-off errors in case of uniform meshes
+      unsigned int const level = static_cast<unsigned int>(std::floor(std::log2(ratio) + 1.e-12));
+
+      levels[cell->active_cell_index()] = std::min(level, max_levels - 1);
+    }
+  }
+
+  return levels;
+}
+
+/*
+ * Repartitions the triangulation such that the work of the multirate time integration is
+ * balanced: the costs of a cell are proportional to the number of time steps performed on its
+ * level within one (coarsest) time step. Only parallel::distributed::Triangulation objects are
+ * repartitioned, other triangulations are not touched.
+ */
+template<int dim>
+void
+balance_time_step_levels(dealii::Triangulation<dim> &                triangulation,
+                         std::function<double(double const)> const & time_step_of_length,
+                         unsigned int const                          max_levels,
+                         MPI_Comm const &                            mpi_comm)
+{
+  auto tria = dynamic_cast<dealii::parallel::distributed::Triangulation<dim> *>(&triangulation);
+
+  if(tria == nullptr)
+    return;
+
+  std::vector<unsigned int> const levels =
+    calculate_time_step_levels(triangulation, time_step_of_length, max_levels, mpi_comm);
+
+  unsigned int n_levels = 0;
+  for(unsigned int const level : levels)
+    n_levels = std::max(n_levels, level + 1);
+  n_levels = dealii::Utilities::MPI::max(n_levels, mpi_comm);
+
+  // deal.II adds a weight of 1000 to each cell, which corresponds to one time step
+  auto connection = tria->signals.cell_weight.connect(
+    [&](typename dealii::Triangulation<dim>::cell_iterator const & cell,
+        typename dealii::Triangulation<dim>::CellStatus const) -> unsigned int {
+      unsigned int const n_time_steps = 1u << (n_levels - 1 - levels[cell->active_cell_index()]);
+      return 1000 * (n_time_steps - 1);
+    });
+
+  tria->repartition();
+
+  connection.disconnect();
+}
+
+/*
+ * Time step levels of the cells of a MatrixFree object for multirate time integration.
+ *
+ * For each cell batch and face batch, the set of levels of the adjacent cells is stored as a bit
+ * mask. Operators skip the cell and face batches that are not adjacent to a cell of the currently
+ * active levels, see set_active_levels(). To avoid cell batches that mix levels, the levels should
+ * be passed as cell_vectorization_category to MatrixFree.
+ *
+ * Vector updates of the time integrator are restricted to the locally owned DoFs of the cells of
+ * one level (get_dof_ranges()) and to the DoFs of the cells of another level adjacent to these
+ * cells (get_halo_dof_ranges()), which are needed to evaluate the face integrals.
+ */
+template<typename Number>
+class MultirateLevels
+{
+public:
+  typedef dealii::LinearAlgebra::distributed::Vector<Number> VectorType;
+
+  typedef std::vector<std::pair<unsigned int, unsigned int>> Ranges;
+
+  MultirateLevels() : n_levels(1), active_levels(~0u)
+  {
+  }
+
+  template<int dim>
+  void
+  reinit(dealii::MatrixFree<dim, Number> const & matrix_free,
+         unsigned int const                      dof_index,
+         std::vector<unsigned int> const &       cell_levels)
+  {
+    unsigned int const n_lanes = dealii::VectorizedArray<Number>::size();
+
+    n_levels = 0;
+    for(unsigned int const level : cell_levels)
+      n_levels = std::max(n_levels, level + 1);
+    n_levels = dealii::Utilities::MPI::max(
+      n_levels, matrix_free.get_dof_handler(dof_index).get_communicator());
+
+    AssertThrow(n_levels <= 32,
+                dealii::ExcMessage("At most 32 time step levels are supported."));
+
+    // levels of the cell batches including ghost cells
+    unsigned int const n_cell_batches =
+      matrix_free.n_cell_batches() + matrix_free.n_ghost_cell_batches();
+
+    std::vector<unsigned int> lane_levels(n_cell_batches * n_lanes, 0);
+    cell_batch_mask.assign(n_cell_batches, 0);
+    for(unsigned int cell = 0; cell < n_cell_batches; ++cell)
+    {
+      for(unsigned int v = 0; v < matrix_free.n_active_entries_per_cell_batch(cell); ++v)
+      {
+        unsigned int const level =
+          cell_levels[matrix_free.get_cell_iterator(cell, v, dof_index)->active_cell_index()];
+
+        lane_levels[cell * n_lanes + v] = level;
+        cell_batch_mask[cell] |= (1u << level);
+      }
+    }
+
+    // levels of the cells adjacent to the face batches
+    unsigned int const n_face_batches = matrix_free.n_inner_face_batches() +
+                                        matrix_free.n_boundary_face_batches() +
+                                        matrix_free.n_ghost_inner_face_batches();
+
+    face_batch_mask.assign(n_face_batches, 0);
+    for(unsigned int face = 0; face < n_face_batches; ++face)
+    {
+      auto const & face_info = matrix_free.get_face_info(face);
+      for(unsigned int v = 0; v < n_lanes; ++v)
+      {
+        if(face_info.cells_interior[v] != dealii::numbers::invalid_unsigned_int)
+          face_batch_mask[face] |= (1u << lane_levels[face_info.cells_interior[v]]);
+        if(face_info.cells_exterior[v] != dealii::numbers::invalid_unsigned_int)
+          face_batch_mask[face] |= (1u << lane_levels[face_info.cells_exterior[v]]);
+      }
+    }
+
+    // DoF ranges of the locally owned cells
+    dealii::DoFHandler<dim> const & dof_handler = matrix_free.get_dof_handler(dof_index);
+    auto const & partitioner = matrix_free.get_vector_partitioner(dof_index);
+
+    std::vector<std::vector<unsigned int>>              dofs(n_levels);
+    std::vector<std::vector<std::vector<unsigned int>>> halo_dofs(
+      n_levels, std::vector<std::vector<unsigned int>>(n_levels));
+
+    std::vector<dealii::types::global_dof_index> dof_indices(
+      dof_handler.get_fe().n_dofs_per_cell());
+    for(auto const & cell : dof_handler.active_cell_iterators())
+    {
+      if(not cell->is_locally_owned())
+        continue;
+
+      unsigned int const level = cell_levels[cell->active_cell_index()];
+
+      cell->get_dof_indices(dof_indices);
+      for(auto const i : dof_indices)
+        dofs[level].push_back(partitioner->global_to_local(i));
+
+      // levels of the face neighbors (a superset in case of hanging nodes)
+      unsigned int neighbor_mask = 0;
+      for(unsigned int const f : cell->face_indices())
+      {
+        if(cell->at_boundary(f) and not cell->has_periodic_neighbor(f))
+          continue;
+
+        auto const neighbor = cell->neighbor_or_periodic_neighbor(f);
+        if(neighbor->has_children())
+        {
+          for(auto const & child :
+              dealii::GridTools::get_active_child_cells<dealii::DoFHandler<dim>>(neighbor))
+            neighbor_mask |= (1u << cell_levels[child->active_cell_index()]);
+        }
+        else
+        {
+          neighbor_mask |= (1u << cell_levels[neighbor->active_cell_index()]);
+        }
+      }
+
+      for(unsigned int l = 0; l < n_levels; ++l)
+      {
+        if(l != level and (neighbor_mask & (1u << l)))
+        {
+          for(auto const i : dof_indices)
+            halo_dofs[l][level].push_back(partitioner->global_to_local(i));
+        }
+      }
+    }
+
+    dof_ranges.resize(n_levels);
+    halo_dof_ranges.assign(n_levels, std::vector<Ranges>(n_levels));
+    for(unsigned int l = 0; l < n_levels; ++l)
+    {
+      dof_ranges[l] = compress_to_ranges(dofs[l]);
+      for(unsigned int j = 0; j < n_levels; ++j)
+        halo_dof_ranges[l][j] = compress_to_ranges(halo_dofs[l][j]);
+    }
+
+    set_all_levels_active();
+  }
+
+  unsigned int
+  get_n_levels() const
+  {
+    return n_levels;
+  }
+
+  /*
+   * Ratio of the time step of the coarsest level and the time step of the finest level.
+   */
+  unsigned int
+  get_time_step_ratio() const
+  {
+    return 1u << (n_levels - 1);
+  }
+
+  /*
+   * Activates the levels first, ..., last.
+   */
+  void
+  set_active_levels(unsigned int const first, unsigned int const last) const
+  {
+    AssertThrow(first <= last and last < n_levels, dealii::ExcMessage("Invalid levels."));
+
+    active_levels = 0;
+    for(unsigned int l = first; l <= last; ++l)
+      active_levels |= (1u << l);
+  }
+
+  void
+  set_all_levels_active() const
+  {
+    active_levels = ~0u;
+  }
+
+  bool
+  is_active_cell_batch(unsigned int const cell) const
+  {
+    return cell_batch_mask.empty() or (cell_batch_mask[cell] & active_levels);
+  }
+
+  bool
+  is_active_face_batch(unsigned int const face) const
+  {
+    return face_batch_mask.empty() or (face_batch_mask[face] & active_levels);
+  }
+
+  /*
+   * Local indices of the DoFs of the locally owned cells on the given level.
+   */
+  Ranges const &
+  get_dof_ranges(unsigned int const level) const
+  {
+    return dof_ranges[level];
+  }
+
+  /*
+   * Local indices of the DoFs of the locally owned cells on level level_neighbor that are
+   * adjacent to cells on the given level.
+   */
+  Ranges const &
+  get_halo_dof_ranges(unsigned int const level, unsigned int const level_neighbor) const
+  {
+    return halo_dof_ranges[level][level_neighbor];
+  }
+
+  /*
+   * Number of locally owned DoFs on the given level.
+   */
+  unsigned int
+  n_dofs(unsigned int const level) const
+  {
+    unsigned int n = 0;
+    for(auto const & range : dof_ranges[level])
+      n += range.second - range.first;
+    return n;
+  }
+
+private:
+  static Ranges
+  compress_to_ranges(std::vector<unsigned int> & indices)
+  {
+    std::sort(indices.begin(), indices.end());
+    indices.erase(std::unique(indices.begin(), indices.end()), indices.end());
+
+    Ranges ranges;
+    for(unsigned int const i : indices)
+    {
+      if(not ranges.empty() and ranges.back().second == i)
+        ++ranges.back().second;
+      else
+        ranges.emplace_back(i, i + 1);
+    }
+
+    return ranges;
+  }
+
+  unsigned int n_levels;
+
+  // bit masks of the levels of the cells adjacent to cell and face batches
+  std::vector<unsigned int> cell_batch_mask;
+  std::vector<unsigned int> face_batch_mask;
+
+  mutable unsigned int active_levels;
+
+  std::vector<Ranges>              dof_ranges;
+  std::vector<std::vector<Ranges>> halo_dof_ranges;
+};
+
+} // namespace ExaDG
+
+#endif /* INCLUDE_EXADG_TIME_INTEGRATION_MULTIRATE_LEVELS_H_ */
@@ -0,0 +1,262 @@
+/*  ______________________________________________________________________
+ *
+ *  ExaDG - High-Order Discontinuous Galerkin for the Exa-Scale
+ *
+ *  Copyright (C) 2021 by the ExaDG authors
+ *
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *  ______________________________________________________________________
+ */
+
+#ifndef INCLUDE_EXADG_TIME_INTEGRATION_MULTIRATE_RUNGE_KUTTA_H_
+#define INCLUDE_EXADG_TIME_INTEGRATION_MULTIRATE_RUNGE_KUTTA_H_
+
+// C/C++
+#include <vector>
+
+// deal.II
+#include <deal.II/lac/full_matrix.h>
+
+// ExaDG
+#include <exadg/time_integration/explicit_runge_kutta.h>
+#include <exadg/time_integration/multirate_levels.h>
+
+namespace ExaDG
+{
+/*
+ * Multirate (local time stepping) version of the classical, explicit Runge-Kutta methods of order
+ * 1-2. The cells are grouped into time step levels (see MultirateLevels), and the cells on level l
+ * are advanced with the time step 2^l * dt_0. The time step passed to solve_timestep() is the time
+ * step of the coarsest level, which is subdivided into 2^(L-1) substeps of size dt_0, where L is
+ * the number of levels. In each substep, all levels whose time steps start at the current time
+ * are advanced, starting with the coarsest one. Each stage evaluates the operator only on the
+ * cells and faces adjacent to the cells of the current level.
+ *
+ * The values of neighboring cells on other levels needed for the face integrals are obtained by
+ * linear interpolation in time between the old and the new solution (coarser levels, which have
+ * already been advanced), and by a first-order predictor using the time derivative at the
+ * beginning of the substep (finer levels). Note that this coupling is not conservative at the
+ * interfaces between levels, which is why the method is not offered for the compressible
+ * Navier-Stokes equations. Since the first-order predictor limits the order of accuracy of the
+ * coupling to two, only the methods of order 1-2 are available. Higher orders would require a
+ * conservative coupling based on the fluxes across the interfaces between levels.
+ */
+template<typename Operator, typename VectorType>
+class MultirateRungeKutta : public ExplicitTimeIntegrator<Operator, VectorType>
+{
+private:
+  typedef typename VectorType::value_type Number;
+
+  typedef typename MultirateLevels<Number>::Ranges Ranges;
+
+public:
+  MultirateRungeKutta(unsigned int const              order_in,
+                      std::shared_ptr<Operator> const operator_in,
+                      MultirateLevels<Number> const & levels_in)
+    : ExplicitTimeIntegrator<Operator, VectorType>(operator_in), order(order_in), levels(levels_in)
+  {
+    initialize_coeffs();
+
+    this->underlying_operator->initialize_dof_vector(vec_stage);
+    this->underlying_operator->initialize_dof_vector(vec_rhs);
+    this->underlying_operator->initialize_dof_vector(vec_start);
+
+    vec_k.resize(c.size());
+    for(auto & k : vec_k)
+      this->underlying_operator->initialize_dof_vector(k);
+
+    time_start.resize(levels.get_n_levels(), 0.0);
+    time_step_level.resize(levels.get_n_levels(), 0.0);
+  }
+
+  void
+  solve_timestep(VectorType & dst,
+                 VectorType & src,
+                 double const time,
+                 double const time_step) final
+  {
+    unsigned int const n_levels   = levels.get_n_levels();
+    unsigned int const n_substeps = levels.get_time_step_ratio();
+    unsigned int const n_stages   = c.size();
+
+    double const time_step_finest = time_step / n_substeps;
+    for(unsigned int l = 0; l < n_levels; ++l)
+      time_step_level[l] = time_step_finest * (1u << l);
+
+    dst = src;
+
+    // initialize all entries to meaningful values, also those not touched by the current level
+    vec_stage = src;
+
+    for(unsigned int k = 0; k < n_substeps; ++k)
+    {
+      double const time_k = time + k * time_step_finest;
+
+      // the levels 0, ..., m start a new time step at time_k
+      unsigned int m = 0;
+      while(m + 1 < n_levels and k % (1u << (m + 1)) == 0)
+        ++m;
+
+      // first stage of all levels starting a new time step
+      for(unsigned int l = 0; l <= m; ++l)
+      {
+        copy(vec_stage, dst, levels.get_dof_ranges(l));
+        for(unsigned int j = m + 1; j < n_levels; ++j)
+          interpolate(vec_stage, dst, levels.get_halo_dof_ranges(l, j), j, time_k);
+      }
+
+      levels.set_active_levels(0, m);
+      this->underlying_operator->evaluate(vec_rhs, vec_stage, time_k);
+      for(unsigned int l = 0; l <= m; ++l)
+        copy(vec_k[0], vec_rhs, levels.get_dof_ranges(l));
+
+      // remaining stages, starting with the coarsest level
+      for(unsigned int l = m + 1; l-- > 0;)
+      {
+        double const time_step_l = time_step_level[l];
+
+        levels.set_active_levels(l, l);
+
+        for(unsigned int s = 1; s < n_stages; ++s)
+        {
+          double const time_s = time_k + c[s] * time_step_l;
+
+          for(auto const & range : levels.get_dof_ranges(l))
+          {
+            for(unsigned int i = range.first; i < range.second; ++i)
+            {
+              Number value = dst.local_element(i);
+              for(unsigned int r = 0; r < s; ++r)
+                value += time_step_l * A(s, r) * vec_k[r].local_element(i);
+              vec_stage.local_element(i) = value;
+            }
+          }
+
+          // finer levels: predictor based on the time derivative at the beginning of the substep
+          for(unsigned int j = 0; j < l; ++j)
+          {
+            for(auto const & range : levels.get_halo_dof_ranges(l, j))
+              for(unsigned int i = range.first; i < range.second; ++i)
+                vec_stage.local_element(i) =
+                  dst.local_element(i) + (time_s - time_k) * vec_k[0].local_element(i);
+          }
+
+          // coarser levels: interpolation between the old and the new solution
+          for(unsigned int j = l + 1; j < n_levels; ++j)
+            interpolate(vec_stage, dst, levels.get_halo_dof_ranges(l, j), j, time_s);
+
+          this->underlying_operator->evaluate(vec_rhs, vec_stage, time_s);
+          copy(vec_k[s], vec_rhs, levels.get_dof_ranges(l));
+        }
+
+        // store the old solution for the interpolation on finer levels and perform the update
+        copy(vec_start, dst, levels.get_dof_ranges(l));
+        time_start[l] = time_k;
+
+        for(auto const & range : levels.get_dof_ranges(l))
+        {
+          for(unsigned int i = range.first; i < range.second; ++i)
+          {
+            Number value = dst.local_element(i);
+            for(unsigned int s = 0; s < n_stages; ++s)
+              value += time_step_l * b[s] * vec_k[s].local_element(i);
+            dst.local_element(i) = value;
+          }
+        }
+      }
+    }
+
+    levels.set_all_levels_active();
+  }
+
+  unsigned int
+  get_order() const final
+  {
+    return order;
+  }
+
+private:
+  void
+  initialize_coeffs()
+  {
+    if(order == 1) // explicit Euler method
+    {
+      A.reinit(1, 1);
+      b = {1.0};
+      c = {0.0};
+    }
+    else if(order == 2) // Runge-Kutta method of order 2 (explicit midpoint rule)
+    {
+      A.reinit(2, 2);
+      A(1, 0) = 0.5;
+      b       = {0.0, 1.0};
+      c       = {0.0, 0.5};
+    }
+    else
+    {
+      AssertThrow(false,
+                  dealii::ExcMessage("The multirate Runge-Kutta method is only implemented for "
+                                     "orders 1-2."));
+    }
+  }
+
+  static void
+  copy(VectorType & dst, VectorType const & src, Ranges const & ranges)
+  {
+    for(auto const & range : ranges)
+      for(unsigned int i = range.first; i < range.second; ++i)
+        dst.local_element(i) = src.local_element(i);
+  }
+
+  /*
+   * Linear interpolation in time between the old solution (vec_start) and the new solution of the
+   * given level.
+   */
+  void
+  interpolate(VectorType &       dst,
+              VectorType const & solution,
+              Ranges const &     ranges,
+              unsigned int const level,
+              double const       time) const
+  {
+    Number const factor = (time - time_start[level]) / time_step_level[level];
+
+    for(auto const & range : ranges)
+    {
+      for(unsigned int i = range.first; i < range.second; ++i)
+      {
+        Number const start   = vec_start.local_element(i);
+        dst.local_element(i) = start + factor * (solution.local_element(i) - start);
+      }
+    }
+  }
+
+  unsigned int const order;
+
+  MultirateLevels<Number> const & levels;
+
+  // Butcher table
+  dealii::FullMatrix<double> A;
+  std::vector<double>        b, c;
+
+  VectorType              vec_stage, vec_rhs, vec_start;
+  std::vector<VectorType> vec_k;
+
+  // start time and time step size of the current time step of each level
+  std::vector<double> time_start, time_step_level;
+};
+
+} // namespace ExaDG
+
+#endif /* INCLUDE_EXADG_TIME_INTEGRATION_MULTIRATE_RUNGE_KUTTA_H_ */
@@ -0,0 +1,135 @@
+/*  ______________________________________________________________________
+ *
+ *  ExaDG - High-Order Discontinuous Galerkin for the Exa-Scale
+ *
+ *  Copyright (C) 2021 by the ExaDG authors
+ *
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *  ______________________________________________________________________
+ */
+
+#ifndef INCLUDE_EXADG_TIME_INTEGRATION_OPERATOR_INTEGRATION_FACTOR_H_
+#define INCLUDE_EXADG_TIME_INTEGRATION_OPERATOR_INTEGRATION_FACTOR_H_
+
+// C/C++
+#include <memory>
+
+// deal.II
+#include <deal.II/base/exceptions.h>
+
+// ExaDG
+#include <exadg/time_integration/enum_types.h>
+#include <exadg/time_integration/explicit_runge_kutta.h>
+
+namespace ExaDG
+{
+/*
+ * Vector updates of a stage of a low-storage Runge-Kutta method with two registers, see
+ * solve_timestep_low_storage_reg2_fused(), for operators of the sub-steps of the
+ * operator-integration-factor splitting. The stages are never fused for the sub-steps, but the
+ * low-storage Runge-Kutta methods require the function evaluate_and_update_stage() of the
+ * operator, which is implemented by calling this function.
+ */
+template<typename Operator, typename VectorType>
+void
+evaluate_and_update_stage_oif(Operator const & oif_operator,
+                              VectorType &     solution,
+                              VectorType &     vec_ri,
+                              VectorType &     vec_ki,
+                              double const     evaluation_time,
+                              double const     factor_ri,
+                              double const     factor_solution,
+                              bool const       update_ri)
+{
+  oif_operator.evaluate(vec_ki, vec_ri, evaluation_time);
+
+  if(update_ri)
+  {
+    vec_ri = solution;
+    vec_ri.add(factor_ri, vec_ki);
+  }
+
+  solution.add(factor_solution, vec_ki);
+}
+
+/*
+ * Creates the explicit Runge-Kutta method of the sub-steps of the operator-integration-factor
+ * splitting.
+ */
+template<typename Operator, typename VectorType>
+std::shared_ptr<ExplicitTimeIntegrator<Operator, VectorType>>
+create_time_integrator_oif(TimeIntegratorOIF const          time_integrator_oif,
+                           std::shared_ptr<Operator> const oif_operator)
+{
+  std::shared_ptr<ExplicitTimeIntegrator<Operator, VectorType>> time_integrator;
+
+  if(time_integrator_oif == TimeIntegratorOIF::ExplRK1Stage1)
+  {
+    time_integrator =
+      std::make_shared<ExplicitRungeKuttaTimeIntegrator<Operator, VectorType>>(1, oif_operator);
+  }
+  else if(time_integrator_oif == TimeIntegratorOIF::ExplRK2Stage2)
+  {
+    time_integrator =
+      std::make_shared<ExplicitRungeKuttaTimeIntegrator<Operator, VectorType>>(2, oif_operator);
+  }
+  else if(time_integrator_oif == TimeIntegratorOIF::ExplRK3Stage3)
+  {
+    time_integrator =
+      std::make_shared<ExplicitRungeKuttaTimeIntegrator<Operator, VectorType>>(3, oif_operator);
+  }
+  else if(time_integrator_oif == TimeIntegratorOIF::ExplRK4Stage4)
+  {
+    time_integrator =
+      std::make_shared<ExplicitRungeKuttaTimeIntegrator<Operator, VectorType>>(4, oif_operator);
+  }
+  else if(time_integrator_oif == TimeIntegratorOIF::ExplRK3Stage4Reg2C)
+  {
+    time_integrator =
+      std::make_shared<LowStorageRK3Stage4Reg2C<Operator, VectorType>>(oif_operator);
+  }
+  else if(time_integrator_oif == TimeIntegratorOIF::ExplRK4Stage5Reg2C)
+  {
+    time_integrator =
+      std::make_shared<LowStorageRK4Stage5Reg2C<Operator, VectorType>>(oif_operator);
+  }
+  else if(time_integrator_oif == TimeIntegratorOIF::ExplRK4Stage5Reg3C)
+  {
+    time_integrator =
+      std::make_shared<LowStorageRK4Stage5Reg3C<Operator, VectorType>>(oif_operator);
+  }
+  else if(time_integrator_oif == TimeIntegratorOIF::ExplRK5Stage9Reg2S)
+  {
+    time_integrator =
+      std::make_shared<LowStorageRK5Stage9Reg2S<Operator, VectorType>>(oif_operator);
+  }
+  else if(time_integrator_oif == TimeIntegratorOIF::ExplRK3Stage7Reg2)
+  {
+    time_integrator = std::make_shared<LowStorageRKTD<Operator, VectorType>>(oif_operator, 3, 7);
+  }
+  else if(time_integrator_oif == TimeIntegratorOIF::ExplRK4Stage8Reg2)
+  {
+    time_integrator = std::make_shared<LowStorageRKTD<Operator, VectorType>>(oif_operator, 4, 8);
+  }
+  else
+  {
+    AssertThrow(false, dealii::ExcMessage("Not implemented."));
+  }
+
+  return time_integrator;
+}
+
+} // namespace ExaDG
+
+#endif /* INCLUDE_EXADG_TIME_INTEGRATION_OPERATOR_INTEGRATION_FACTOR_H_ */
@@ -19,6 +19,7 @@
  *  ______________________________________________________________________
  */
 
+#include <exadg/postprocessor/asynchronous_file_writer.h>
 #include <exadg/time_integration/time_int_base.h>
 #include <iostream>
 
@@ -63,6 +64,9 @@ TimeIntBase::timeloop()
   {
     advance_one_timestep();
   }
+
+  // make sure that all output files have been written
+  AsynchronousFileWriter::get_instance().flush();
 }
 
 void
@@ -197,6 +201,9 @@ TimeIntBase::write_restart() const
           << std::endl
           << " Writing restart file at time t = " << this->get_time() << ":" << std::endl;
 
+    // a restarted simulation relies on the output written so far
+    AsynchronousFileWriter::get_instance().flush();
+
     std::string const filename = restart_filename(restart_data.filename, mpi_comm);
 
     rename_restart_files(filename);
@@ -24,15 +24,16 @@
 namespace ExaDG
 {
 template<typename Number>
-TimeIntBDFBase<Number>::TimeIntBDFBase(double const        start_time_,
-                                       double const        end_time_,
-                                       unsigned int const  max_number_of_time_steps_,
-                                       unsigned int const  order_,
-                                       bool const          start_with_low_order_,
-                                       bool const          adaptive_time_stepping_,
-                                       RestartData const & restart_data_,
-                                       MPI_Comm const &    mpi_comm_,
-                                       bool const          is_test_)
+TimeIntBDFBase<Number>::TimeIntBDFBase(double const                start_time_,
+                                       double const                end_time_,
+                                       unsigned int const          max_number_of_time_steps_,
+                                       unsigned int const          order_,
+                                       bool const                  start_with_low_order_,
+                                       bool const                  adaptive_time_stepping_,
+                                       RestartData const &         restart_data_,
+                                       MPI_Comm const &            mpi_comm_,
+                                       bool const                  is_test_,
+                                       ErrorControllerData const & error_controller_data_)
   : TimeIntBase(start_time_,
                 end_time_,
                 max_number_of_time_steps_,
@@ -43,9 +44,15 @@ TimeIntBDFBase<Number>::TimeIntBDFBase(double const        start_time_,
     bdf(order_, start_with_low_order_),
     extra(order_, start_with_low_order_),
     start_with_low_order(start_with_low_order_),
-    adaptive_time_stepping(adaptive_time_stepping_),
-    time_steps(order_, -1.0)
+    adaptive_time_stepping(adaptive_time_stepping_ or error_controller_data_.active),
+    time_steps(order_, -1.0),
+    error_controller_data(error_controller_data_),
+    time_step_error_control(std::numeric_limits<double>::max())
 {
+  // The predictor obtained by extrapolation with order k is a method of order k-1 embedded into
+  // the BDF scheme of order k. The order is adjusted to the current order of the scheme in each
+  // time step, see do_error_control().
+  error_controller.reinit(error_controller_data, get_current_order() - 1);
 }
 
 template<typename Number>
@@ -229,6 +236,9 @@ template<typename Number>
 void
 TimeIntBDFBase<Number>::do_timestep_post_solve()
 {
+  if(error_controller.is_active())
+    do_error_control();
+
   prepare_vectors_for_next_timestep();
 
   time += time_steps[0];
@@ -238,6 +248,13 @@ TimeIntBDFBase<Number>::do_timestep_post_solve()
   {
     push_back_time_step_sizes();
     time_steps[0] = recalculate_time_step_size();
+
+    if(error_controller.is_active())
+    {
+      // do not step beyond the end time
+      time_steps[0] = std::min(time_steps[0], time_step_error_control);
+      time_steps[0] = std::min(time_steps[0], end_time - time);
+    }
   }
 
   if(restart_data.write_restart == true)
@@ -249,6 +266,114 @@ TimeIntBDFBase<Number>::do_timestep_post_solve()
   {
     output_remaining_time();
   }
+
+  if(error_controller.is_active() and (this->print_solver_info() or this->finished()))
+  {
+    error_controller.print_statistics(this->pcout);
+  }
+}
+
+template<typename Number>
+void
+TimeIntBDFBase<Number>::do_error_control()
+{
+  // the error estimate is of lower order during the start-up phase with low order methods
+  error_controller.set_order_embedded(get_current_order() - 1);
+
+  unsigned int n_rejections = 0;
+  while(true)
+  {
+    double     time_step_new = time_steps[0];
+    bool const accepted =
+      error_controller.accept(calculate_error_norm(), time_steps[0], time_step_new);
+
+    if(accepted)
+    {
+      // limit the increase of the time step size to retain zero-stability
+      time_step_error_control = std::min(time_step_new, get_max_time_step_ratio() * time_steps[0]);
+      break;
+    }
+
+    ++n_rejections;
+    AssertThrow(n_rejections <= error_controller_data.max_rejections,
+                dealii::ExcMessage("Maximum number of rejected time steps exceeded."));
+
+    // The solutions at previous instants of time are only updated once the time step is accepted,
+    // so that the time step can be repeated with a smaller time step size.
+    time_steps[0] = time_step_new;
+    update_time_integrator_constants();
+    do_timestep_solve();
+  }
+}
+
+template<typename Number>
+double
+TimeIntBDFBase<Number>::calculate_error_norm()
+{
+  VectorType const & solution_np = get_solution_np_error_estimation();
+
+  if(error_estimate.size() != solution_np.size())
+    error_estimate.reinit(solution_np, true);
+
+  // error estimate = solution - predictor, where the predictor is of the current order of the
+  // scheme
+  error_estimate = solution_np;
+  for(unsigned int i = 0; i < get_current_order(); ++i)
+    error_estimate.add(-extra.get_beta(i), get_solution_error_estimation(i));
+
+  return error_controller.calculate_error_norm(error_estimate,
+                                               get_solution_error_estimation(0),
+                                               solution_np);
+}
+
+template<typename Number>
+unsigned int
+TimeIntBDFBase<Number>::get_current_order() const
+{
+  if(start_with_low_order)
+    return std::min(time_step_number, order);
+  else
+    return order;
+}
+
+template<typename Number>
+double
+TimeIntBDFBase<Number>::get_max_time_step_ratio() const
+{
+  // BDF2: zero-stable for ratios below 1 + sqrt(2), see Grigorieff (1983). The values for BDF3 and
+  // BDF4 are conservative estimates.
+  if(order == 1)
+    return std::numeric_limits<double>::max();
+  else if(order == 2)
+    return 2.4;
+  else if(order == 3)
+    return 1.4;
+  else
+    return 1.1;
+}
+
+template<typename Number>
+bool
+TimeIntBDFBase<Number>::preconditioner_update_required(bool const regular_update,
+                                                       double &   time_step_last_update) const
+{
+  double const relative_tolerance = 0.1;
+
+  // the preconditioner has been set up with the initial time step size
+  if(time_step_last_update <= 0.0)
+    time_step_last_update = time_steps[0];
+
+  bool update = regular_update;
+  if(error_controller.is_active())
+  {
+    double const change = std::abs(time_steps[0] - time_step_last_update);
+    update              = update or change > relative_tolerance * time_step_last_update;
+  }
+
+  if(update)
+    time_step_last_update = time_steps[0];
+
+  return update;
 }
 
 template<typename Number>
@@ -22,11 +22,17 @@
 #ifndef INCLUDE_EXADG_TIME_INTEGRATION_TIME_INT_BDF_BASE_H_
 #define INCLUDE_EXADG_TIME_INTEGRATION_TIME_INT_BDF_BASE_H_
 
+// C/C++
+#include <algorithm>
+#include <cmath>
+
 // deal.II
 #include <deal.II/lac/la_parallel_vector.h>
 
 // ExaDG
 #include <exadg/time_integration/bdf_time_integration.h>
+#include <exadg/time_integration/error_controller.h>
+#include <exadg/time_integration/explicit_runge_kutta.h>
 #include <exadg/time_integration/extrapolation_scheme.h>
 #include <exadg/time_integration/time_int_base.h>
 
@@ -41,15 +47,16 @@ public:
   /*
    * Constructor.
    */
-  TimeIntBDFBase(double const        start_time_,
-                 double const        end_time_,
-                 unsigned int const  max_number_of_time_steps_,
-                 unsigned const      order_,
-                 bool const          start_with_low_order_,
-                 bool const          adaptive_time_stepping_,
-                 RestartData const & restart_data_,
-                 MPI_Comm const &    mpi_comm_,
-                 bool const          is_test_);
+  TimeIntBDFBase(double const                start_time_,
+                 double const                end_time_,
+                 unsigned int const          max_number_of_time_steps_,
+                 unsigned const              order_,
+                 bool const                  start_with_low_order_,
+                 bool const                  adaptive_time_stepping_,
+                 RestartData const &         restart_data_,
+                 MPI_Comm const &            mpi_comm_,
+                 bool const                  is_test_,
+                 ErrorControllerData const & error_controller_data_ = ErrorControllerData());
 
   /*
    * Destructor.
@@ -136,6 +143,31 @@ protected:
   virtual double
   calculate_time_step_size() = 0;
 
+  /*
+   * Operator-integration-factor (OIF) splitting: calculates sum_i (alpha_i/dt * u_tilde_i), where
+   * u_tilde_i is the solution of the pure convection problem at time t_{n+1}, obtained by
+   * integrating from t_{n-i} to t_{n+1} with initial value u_tilde_i(t_{n-i}) = solutions[i]. The
+   * explicit time integrator performs sub-steps whose size is the time step size dt scaled by the
+   * ratio cfl_oif/cfl.
+   */
+  template<typename Operator>
+  void
+  calculate_sum_alphai_ui_oif_substepping(
+    VectorType &                                   sum_alphai_ui,
+    ExplicitTimeIntegrator<Operator, VectorType> & integrator,
+    std::vector<VectorType const *> const &        solutions,
+    double const                                   cfl,
+    double const                                   cfl_oif);
+
+  /*
+   * Returns whether a preconditioner depending on the time step size has to be updated in the
+   * current time step. In case of error-controlled time stepping, the preconditioner is updated in
+   * addition to the regular updates if the time step size deviates by more than 10 percent from
+   * the time step size of the last update, which is stored in time_step_last_update.
+   */
+  bool
+  preconditioner_update_required(bool const regular_update, double & time_step_last_update) const;
+
   /*
    * Order of time integration scheme.
    */
@@ -156,7 +188,7 @@ protected:
   bool const start_with_low_order;
 
   /*
-   * Use adaptive time stepping?
+   * Use adaptive time stepping? This is also the case for error-controlled time stepping.
    */
   bool const adaptive_time_stepping;
 
@@ -247,13 +279,116 @@ private:
   virtual double
   recalculate_time_step_size() const = 0;
 
+  /*
+   * Estimates the temporal error of the current time step as the difference between the solution
+   * at the end of the time step and the predictor obtained by extrapolation of the solutions at
+   * previous instants of time, and repeats the time step with a smaller time step size as long as
+   * the error estimate is not accepted by the error controller.
+   */
+  void
+  do_error_control();
+
+  double
+  calculate_error_norm();
+
+  /*
+   * Solution at the end of the current time step and at previous instants of time t_{n-i} used for
+   * the estimation of the temporal error (has to be implemented by derived classes).
+   */
+  virtual VectorType const &
+  get_solution_np_error_estimation() const = 0;
+
+  virtual VectorType const &
+  get_solution_error_estimation(unsigned int const i /* t_{n-i} */) const = 0;
+
+  /*
+   * Order of the scheme in the current time step, which is lower than the order of the scheme
+   * during the start-up phase if the time integration starts with low order methods.
+   */
+  unsigned int
+  get_current_order() const;
+
+  /*
+   * Largest ratio of subsequent time step sizes for which the variable step size BDF scheme of
+   * the given order is zero-stable.
+   */
+  double
+  get_max_time_step_ratio() const;
+
   /*
    * returns whether solver info has to be written in the current time step.
    */
   virtual bool
   print_solver_info() const = 0;
+
+  // error-controlled time stepping
+  ErrorControllerData const error_controller_data;
+  ErrorController           error_controller;
+
+  // time step size of the next time step selected by the error controller
+  double time_step_error_control;
+
+  // difference between solution and predictor
+  VectorType error_estimate;
+
+  // solution vectors of the OIF sub-stepping
+  VectorType solution_tilde_m, solution_tilde_mp;
 };
 
+template<typename Number>
+template<typename Operator>
+void
+TimeIntBDFBase<Number>::calculate_sum_alphai_ui_oif_substepping(
+  VectorType &                                   sum_alphai_ui,
+  ExplicitTimeIntegrator<Operator, VectorType> & integrator,
+  std::vector<VectorType const *> const &        solutions,
+  double const                                   cfl,
+  double const                                   cfl_oif)
+{
+  AssertThrow(solutions.size() == order,
+              dealii::ExcMessage("Invalid number of solution vectors for OIF sub-stepping."));
+
+  if(not solution_tilde_m.partitioners_are_globally_compatible(*sum_alphai_ui.get_partitioner()))
+  {
+    solution_tilde_m.reinit(sum_alphai_ui, true);
+    solution_tilde_mp.reinit(sum_alphai_ui, true);
+  }
+
+  // maximum sub-step size according to the CFL number of the explicit time integrator
+  double const time_step_oif_max = time_steps[0] * cfl_oif / cfl;
+
+  sum_alphai_ui = 0.0;
+
+  for(unsigned int i = 0; i < order; ++i)
+  {
+    // vanishes for the former solutions not involved when starting with a low order method
+    double const alpha_i = bdf.get_alpha(i);
+    if(alpha_i == 0.0)
+      continue;
+
+    // integrate over the time interval t_{n-i} <= t <= t_{n+1}
+    double const start_time = get_previous_time(i);
+    double const interval   = get_next_time() - start_time;
+
+    unsigned int const n_substeps =
+      std::max(1, int(std::ceil(interval / time_step_oif_max * (1.0 - 1.e-12))));
+    double const time_step_oif = interval / n_substeps;
+
+    solution_tilde_m = *solutions[i];
+    for(unsigned int m = 0; m < n_substeps; ++m)
+    {
+      integrator.solve_timestep(solution_tilde_mp,
+                                solution_tilde_m,
+                                start_time + m * time_step_oif,
+                                time_step_oif);
+
+      solution_tilde_mp.swap(solution_tilde_m);
+    }
+
+    sum_alphai_ui.add(alpha_i / time_steps[0], solution_tilde_m);
+  }
+}
+
 } // namespace ExaDG
 
 #endif /* INCLUDE_EXADG_TIME_INTEGRATION_TIME_INT_BDF_BASE_H_ */
@@ -24,13 +24,14 @@
 namespace ExaDG
 {
 template<typename Number>
-TimeIntExplRKBase<Number>::TimeIntExplRKBase(double const &      start_time_,
-                                             double const &      end_time_,
-                                             unsigned int const  max_number_of_time_steps_,
-                                             RestartData const & restart_data_,
-                                             bool const          adaptive_time_stepping_,
-                                             MPI_Comm const &    mpi_comm_,
-                                             bool const          is_test_)
+TimeIntExplRKBase<Number>::TimeIntExplRKBase(double const &              start_time_,
+                                             double const &              end_time_,
+                                             unsigned int const          max_number_of_time_steps_,
+                                             RestartData const &         restart_data_,
+                                             bool const                  adaptive_time_stepping_,
+                                             MPI_Comm const &            mpi_comm_,
+                                             bool const                  is_test_,
+                                             ErrorControllerData const & error_controller_data_)
   : TimeIntBase(start_time_,
                 end_time_,
                 max_number_of_time_steps_,
@@ -38,10 +39,26 @@ TimeIntExplRKBase<Number>::TimeIntExplRKBase(double const &      start_time_,
                 mpi_comm_,
                 is_test_),
     time_step(1.0),
-    adaptive_time_stepping(adaptive_time_stepping_)
+    adaptive_time_stepping(adaptive_time_stepping_),
+    error_controller_data(error_controller_data_),
+    time_step_next(1.0)
 {
 }
 
+template<typename Number>
+void
+TimeIntExplRKBase<Number>::initialize_error_controller(unsigned int const order_embedded)
+{
+  if(error_controller_data.active)
+  {
+    AssertThrow(order_embedded > 0,
+                dealii::ExcMessage("Error-controlled time stepping requires a Runge-Kutta method "
+                                   "with an embedded method."));
+  }
+
+  error_controller.reinit(error_controller_data, order_embedded);
+}
+
 template<typename Number>
 double
 TimeIntExplRKBase<Number>::get_time_step_size() const
@@ -68,6 +85,12 @@ TimeIntExplRKBase<Number>::setup(bool const do_restart)
   // initialize global solution vectors (allocation)
   initialize_vectors();
 
+  if(error_controller.is_active())
+  {
+    error_estimate.reinit(solution_n);
+    solution_backup.reinit(solution_n);
+  }
+
   if(do_restart)
   {
     // The solution vectors and the current time and the time step size have to be read from restart
@@ -108,6 +131,12 @@ TimeIntExplRKBase<Number>::do_timestep_post_solve()
     this->time_step = recalculate_time_step_size();
   }
 
+  if(error_controller.is_active())
+  {
+    // do not step beyond the end time
+    this->time_step = std::min(time_step_next, this->end_time - this->time);
+  }
+
   if(this->restart_data.write_restart == true)
   {
     this->write_restart();
@@ -117,6 +146,11 @@ TimeIntExplRKBase<Number>::do_timestep_post_solve()
   {
     this->output_remaining_time();
   }
+
+  if(error_controller.is_active() and (this->print_solver_info() or this->finished()))
+  {
+    error_controller.print_statistics(this->pcout);
+  }
 }
 
 template<typename Number>
@@ -26,6 +26,8 @@
 #include <deal.II/lac/la_parallel_vector.h>
 
 // ExaDG
+#include <exadg/time_integration/error_controller.h>
+#include <exadg/time_integration/explicit_runge_kutta.h>
 #include <exadg/time_integration/time_int_base.h>
 
 namespace ExaDG
@@ -36,13 +38,14 @@ class TimeIntExplRKBase : public TimeIntBase
 public:
   typedef dealii::LinearAlgebra::distributed::Vector<Number> VectorType;
 
-  TimeIntExplRKBase(double const &      start_time_,
-                    double const &      end_time_,
-                    unsigned int const  max_number_of_time_steps_,
-                    RestartData const & restart_data_,
-                    bool const          adaptive_time_stepping_,
-                    MPI_Comm const &    mpi_comm_,
-                    bool const          is_test_);
+  TimeIntExplRKBase(double const &              start_time_,
+                    double const &              end_time_,
+                    unsigned int const          max_number_of_time_steps_,
+                    RestartData const &         restart_data_,
+                    bool const                  adaptive_time_stepping_,
+                    MPI_Comm const &            mpi_comm_,
+                    bool const                  is_test_,
+                    ErrorControllerData const & error_controller_data_ = ErrorControllerData());
 
   void
   setup(bool const do_restart) final;
@@ -63,6 +66,22 @@ protected:
   // use adaptive time stepping?
   bool const adaptive_time_stepping;
 
+  /*
+   * Initializes the error-controlled time stepping for an embedded Runge-Kutta method of the given
+   * order (to be called by derived classes in initialize_time_integrator()).
+   */
+  void
+  initialize_error_controller(unsigned int const order_embedded);
+
+  /*
+   * Computes solution_np from solution_n. In case of error-controlled time stepping, the time step
+   * is repeated with a smaller time step size until the error estimate of the embedded method is
+   * accepted, and the time step size of the next time step is selected by the PI controller.
+   */
+  template<typename Operator>
+  void
+  solve_timestep(ExplicitTimeIntegrator<Operator, VectorType> & integrator);
+
 private:
   void
   do_timestep_pre_solve(bool const print_header) final;
@@ -99,8 +118,62 @@ private:
 
   void
   do_read_restart(std::ifstream & in) final;
+
+  // error-controlled time stepping
+  ErrorControllerData const error_controller_data;
+  ErrorController           error_controller;
+
+  // time step size of the next time step selected by the error controller
+  double time_step_next;
+
+  // error estimate of the embedded method and copy of solution_n to repeat rejected time steps
+  VectorType error_estimate, solution_backup;
 };
 
+template<typename Number>
+template<typename Operator>
+void
+TimeIntExplRKBase<Number>::solve_timestep(ExplicitTimeIntegrator<Operator, VectorType> & integrator)
+{
+  if(not error_controller.is_active())
+  {
+    integrator.solve_timestep(solution_np, solution_n, this->time, time_step);
+    return;
+  }
+
+  integrator.set_error_estimate(&error_estimate);
+
+  // The low-storage Runge-Kutta methods overwrite the solution at the old time. A copy is
+  // therefore required in every time step, both to compute the error norm and to repeat rejected
+  // time steps, for which the solution at the old time is restored from this copy.
+  solution_backup = solution_n;
+
+  unsigned int n_rejections = 0;
+  while(true)
+  {
+    integrator.solve_timestep(solution_np, solution_n, this->time, time_step);
+
+    double       time_step_new = time_step;
+    double const error =
+      error_controller.calculate_error_norm(error_estimate, solution_backup, solution_np);
+
+    bool const accepted = error_controller.accept(error, time_step, time_step_new);
+
+    if(accepted)
+    {
+      time_step_next = time_step_new;
+      break;
+    }
+
+    ++n_rejections;
+    AssertThrow(n_rejections <= error_controller_data.max_rejections,
+                dealii::ExcMessage("Maximum number of rejected time steps exceeded."));
+
+    solution_n = solution_backup;
+    time_step  = time_step_new;
+  }
+}
+
 } // namespace ExaDG
 
 #endif /* INCLUDE_EXADG_TIME_INTEGRATION_TIME_INT_EXPLICIT_RUNGE_KUTTA_BASE_H_ */
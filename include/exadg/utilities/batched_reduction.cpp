@@ -0,0 +1,148 @@
+/*  ______________________________________________________________________
+ *
+ *  ExaDG - High-Order Discontinuous Galerkin for the Exa-Scale
+ *
+ *  Copyright (C) 2021 by the ExaDG authors
+ *
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *  ______________________________________________________________________
+ */
+
+// ExaDG
+#include <exadg/utilities/batched_reduction.h>
+
+namespace ExaDG
+{
+namespace
+{
+MPI_Op
+get_mpi_operation(ReductionOperation const operation)
+{
+  if(operation == ReductionOperation::Sum)
+    return MPI_SUM;
+  else if(operation == ReductionOperation::Min)
+    return MPI_MIN;
+  else
+    return MPI_MAX;
+}
+} // namespace
+
+BatchedReduction::BatchedReduction(MPI_Comm const & comm) : mpi_comm(comm), is_started(false)
+{
+  requests.fill(MPI_REQUEST_NULL);
+}
+
+BatchedReduction::~BatchedReduction()
+{
+  // complete a pending reduction without calling the callbacks, since the objects they refer to
+  // might already have been destroyed
+  if(is_started)
+    MPI_Waitall(requests.size(), requests.data(), MPI_STATUSES_IGNORE);
+}
+
+unsigned int
+BatchedReduction::add(std::vector<double> const & values, ReductionOperation const op)
+{
+  AssertThrow(!is_started,
+              dealii::ExcMessage("Contributions can not be added while a reduction is pending."));
+
+  unsigned int const index = locations.size();
+
+  std::vector<double> & buffer = send_buffers[static_cast<unsigned int>(op)];
+  for(double const value : values)
+  {
+    locations.emplace_back(op, buffer.size());
+    buffer.push_back(value);
+  }
+
+  return index;
+}
+
+unsigned int
+BatchedReduction::add(double const value, ReductionOperation const op)
+{
+  return add(std::vector<double>(1, value), op);
+}
+
+void
+BatchedReduction::on_completion(std::function<void(BatchedReduction const &)> const & callback)
+{
+  AssertThrow(!is_started,
+              dealii::ExcMessage("Callbacks can not be added while a reduction is pending."));
+
+  callbacks.push_back(callback);
+}
+
+double
+BatchedReduction::get(unsigned int const index) const
+{
+  AssertIndexRange(index, locations.size());
+
+  return receive_buffers[static_cast<unsigned int>(locations[index].first)]
+                        [locations[index].second];
+}
+
+void
+BatchedReduction::start()
+{
+  AssertThrow(!is_started, dealii::ExcMessage("Reduction has already been started."));
+
+  is_started = true;
+
+  // one reduction per operation, all processes have registered the same contributions
+  for(unsigned int i = 0; i < send_buffers.size(); ++i)
+  {
+    receive_buffers[i].resize(send_buffers[i].size());
+
+    if(send_buffers[i].empty())
+      continue;
+
+    int const ierr = MPI_Iallreduce(send_buffers[i].data(),
+                                    receive_buffers[i].data(),
+                                    send_buffers[i].size(),
+                                    MPI_DOUBLE,
+                                    get_mpi_operation(static_cast<ReductionOperation>(i)),
+                                    mpi_comm,
+                                    &requests[i]);
+    AssertThrowMPI(ierr);
+  }
+}
+
+void
+BatchedReduction::finish()
+{
+  AssertThrow(is_started, dealii::ExcMessage("Reduction has not been started."));
+
+  int const ierr = MPI_Waitall(requests.size(), requests.data(), MPI_STATUSES_IGNORE);
+  AssertThrowMPI(ierr);
+
+  is_started = false;
+
+  for(auto const & callback : callbacks)
+    callback(*this);
+
+  callbacks.clear();
+  locations.clear();
+  for(auto & buffer : send_buffers)
+    buffer.clear();
+}
+
+void
+BatchedReduction::resolve()
+{
+  start();
+  finish();
+}
+
+} // namespace ExaDG
@@ -0,0 +1,125 @@
+/*  ______________________________________________________________________
+ *
+ *  ExaDG - High-Order Discontinuous Galerkin for the Exa-Scale
+ *
+ *  Copyright (C) 2021 by the ExaDG authors
+ *
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *  ______________________________________________________________________
+ */
+
+#ifndef INCLUDE_EXADG_UTILITIES_BATCHED_REDUCTION_H_
+#define INCLUDE_EXADG_UTILITIES_BATCHED_REDUCTION_H_
+
+// C/C++
+#include <array>
+#include <functional>
+#include <utility>
+#include <vector>
+
+// deal.II
+#include <deal.II/base/mpi.h>
+
+namespace ExaDG
+{
+enum class ReductionOperation
+{
+  Sum,
+  Min,
+  Max
+};
+
+/**
+ * Batches the global reductions of scalar quantities, e.g. the integrals computed by several
+ * postprocessing tools in the same time step, into a single MPI_Allreduce. Instead of reducing
+ * each quantity with a blocking collective operation, the local contributions are registered with
+ * add() together with a callback that consumes the global values. All contributions are reduced
+ * at once by resolve(), or by start() and finish() in order to overlap the (non-blocking)
+ * reduction with other work. Sums, minima and maxima can be mixed within one batch, resulting in
+ * one MPI_Iallreduce per type of operation.
+ *
+ * All processes of the communicator have to register the same sequence of contributions.
+ */
+class BatchedReduction
+{
+public:
+  BatchedReduction(MPI_Comm const & comm);
+
+  /**
+   * Completes a pending reduction without calling the callbacks.
+   */
+  ~BatchedReduction();
+
+  /**
+   * Registers process-local contributions and returns the index of the first value, which can be
+   * used to access the global values via get() once the reduction has been completed.
+   */
+  unsigned int
+  add(std::vector<double> const & local_values,
+      ReductionOperation const    operation = ReductionOperation::Sum);
+
+  unsigned int
+  add(double const local_value, ReductionOperation const operation = ReductionOperation::Sum);
+
+  /**
+   * Registers a function that is called with the reduced values once the reduction is completed.
+   * Callbacks are called in the order of registration.
+   */
+  void
+  on_completion(std::function<void(BatchedReduction const &)> const & callback);
+
+  /**
+   * Global value of a registered contribution. Only valid within the callbacks.
+   */
+  double
+  get(unsigned int const index) const;
+
+  /**
+   * Starts the non-blocking reduction of all registered contributions.
+   */
+  void
+  start();
+
+  /**
+   * Waits for the reduction to complete, calls the callbacks and clears the batch so that new
+   * contributions can be registered afterwards.
+   */
+  void
+  finish();
+
+  /**
+   * Reduces all registered contributions (blocking), i.e., start() followed by finish().
+   */
+  void
+  resolve();
+
+private:
+  MPI_Comm const mpi_comm;
+
+  // type of operation and position in the buffers of this operation for each registered value
+  std::vector<std::pair<ReductionOperation, unsigned int>> locations;
+
+  std::vector<std::function<void(BatchedReduction const &)>> callbacks;
+
+  // one buffer per type of operation, indexed by ReductionOperation
+  std::array<std::vector<double>, 3> send_buffers;
+  std::array<std::vector<double>, 3> receive_buffers;
+
+  bool                       is_started;
+  std::array<MPI_Request, 3> requests;
+};
+
+} // namespace ExaDG
+
+#endif /* INCLUDE_EXADG_UTILITIES_BATCHED_REDUCTION_H_ */
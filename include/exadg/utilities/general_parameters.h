@@ -33,11 +33,18 @@ struct GeneralParameters
   {
   }
 
-  GeneralParameters(std::string const & input_file)
+  /*
+   * In-transit analysis is only available for solvers setting supports_in_transit_analysis.
+   */
+  GeneralParameters(std::string const & input_file, bool const supports_in_transit_analysis = false)
   {
     dealii::ParameterHandler prm;
     add_parameters(prm);
     prm.parse_input(input_file, "", true, true);
+
+    AssertThrow(n_analysis_ranks == 0 or supports_in_transit_analysis,
+                dealii::ExcMessage("In-transit analysis (AnalysisRanks > 0) is not implemented "
+                                   "for this solver."));
   }
 
   void
@@ -60,6 +67,11 @@ struct GeneralParameters
                         "Set to true if the program is run as a test.",
                         dealii::Patterns::Bool(),
                         false);
+      prm.add_parameter("AnalysisRanks",
+                        n_analysis_ranks,
+                        "Number of MPI ranks dedicated to in-transit analysis.",
+                        dealii::Patterns::Integer(0),
+                        false);
     prm.leave_subsection();
     // clang-format on
   }
@@ -69,6 +81,10 @@ struct GeneralParameters
   unsigned int dim = 2;
 
   bool is_test = false;
+
+  // the last n_analysis_ranks MPI ranks do not take part in the simulation but perform the
+  // in-transit analysis, see InTransitAnalysis
+  unsigned int n_analysis_ranks = 0;
 };
 
 } // namespace ExaDG
@@ -183,6 +183,38 @@ print_solver_info_linear(dealii::ConditionalOStream const & pcout,
   // clang-format on
 }
 
+/*
+ * Estimated number of iterations saved by the projection of the initial guess onto the solution
+ * history, see SolutionHistoryProjection.
+ */
+inline void
+print_solver_info_solution_history(dealii::ConditionalOStream const & pcout,
+                                   double const                       n_saved_iterations)
+{
+  // clang-format off
+  pcout << "  Iter. saved:  " << std::setw(12) << std::fixed << std::setprecision(1) << std::right << n_saved_iterations << std::endl
+        << std::flush;
+  // clang-format on
+}
+
+/*
+ * Memory of the vectors kept by a Krylov solver from one linear solve to the next (e.g. recycled
+ * subspaces), summed over all MPI processes.
+ */
+inline void
+print_solver_memory_consumption(dealii::ConditionalOStream const &    pcout,
+                                double const                          memory,
+                                dealii::types::global_dof_index const n_dofs)
+{
+  // clang-format off
+  pcout << std::endl
+        << "Memory of recycled Krylov subspace:" << std::endl
+        << "  Memory [MB]             = " << std::scientific << std::setprecision(2) << memory / 1.e6 << std::endl
+        << "  Memory [B/DoF]          = " << std::scientific << std::setprecision(2) << memory / (double)n_dofs << std::endl
+        << std::flush;
+  // clang-format on
+}
+
 inline void
 print_wall_time(dealii::ConditionalOStream const & pcout, double const wall_time)
 
@@ -0,0 +1,163 @@
+/*  ______________________________________________________________________
+ *
+ *  ExaDG - High-Order Discontinuous Galerkin for the Exa-Scale
+ *
+ *  Copyright (C) 2021 by the ExaDG authors
+ *
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *  ______________________________________________________________________
+ */
+
+// C++
+#include <iostream>
+
+// deal.II
+#include <deal.II/base/mpi.h>
+#include <deal.II/base/vectorization.h>
+
+// ExaDG
+#include <exadg/operators/variable_coefficients.h>
+
+namespace ExaDG
+{
+typedef dealii::VectorizedArray<double> scalar;
+
+template<typename Number>
+unsigned int
+count_constant_rows(CoefficientTable<Number> const & table)
+{
+  unsigned int n_constant = 0;
+  for(unsigned int row = 0; row < table.size(); ++row)
+    if(table.is_constant(row))
+      ++n_constant;
+
+  return n_constant;
+}
+
+/*
+ * Rows in which all quadrature points share the same value (possibly different for the lanes of
+ * the vectorized array) are detected by compress().
+ */
+void
+test_constant_detection()
+{
+  std::cout << std::endl
+            << "CoefficientTable: detection of constant rows" << std::endl
+            << std::endl;
+
+  CoefficientTable<double> table;
+  table.reinit(3 /* rows */, 4 /* points */, false /* single precision */);
+  table.fill(2.0);
+
+  std::cout << "Constant rows after fill(): " << count_constant_rows(table) << std::endl;
+
+  // a single quadrature point with a different value
+  table.set(1, 2, dealii::make_vectorized_array<double>(3.0));
+
+  // the same value in all quadrature points, but different values for the lanes
+  scalar value;
+  for(unsigned int v = 0; v < scalar::size(); ++v)
+    value[v] = v;
+  for(unsigned int q = 0; q < 4; ++q)
+    table.set(2, q, value);
+
+  std::cout << "Constant rows after set(): " << count_constant_rows(table) << std::endl;
+
+  table.compress();
+
+  std::cout << "Constant rows after compress(): " << count_constant_rows(table) << std::endl
+            << "Row 1 constant: " << (table.is_constant(1) ? "true" : "false") << std::endl
+            << "Row 2 constant: " << (table.is_constant(2) ? "true" : "false") << std::endl;
+
+  bool correct = table.get(0, 3)[0] == 2.0 and table.get(1, 0)[0] == 2.0 and
+                 table.get(1, 2)[0] == 3.0;
+  for(unsigned int v = 0; v < scalar::size(); ++v)
+    correct = correct and table.get(2, 3)[v] == double(v);
+
+  std::cout << "Values correct: " << (correct ? "true" : "false") << std::endl;
+}
+
+/*
+ * Coefficients stored in single precision for Number = double.
+ */
+void
+test_single_precision()
+{
+  std::cout << std::endl << "CoefficientTable: single precision storage" << std::endl << std::endl;
+
+  double const value = 1.0 / 3.0;
+
+  CoefficientTable<double> table;
+  table.reinit(2 /* rows */, 4 /* points */, true /* single precision */);
+  table.fill(1.0);
+  for(unsigned int q = 0; q < 4; ++q)
+    table.set(1, q, dealii::make_vectorized_array<double>(value));
+  table.compress();
+
+  double const stored = table.get(1, 3)[0];
+
+  std::cout << "Value rounded to single precision: "
+            << (stored == double(float(value)) and stored != value ? "true" : "false")
+            << std::endl
+            << "Constant rows after compress(): " << count_constant_rows(table) << std::endl;
+
+  CoefficientTable<double> table_double;
+  table_double.reinit(100 /* rows */, 27 /* points */, false /* single precision */);
+
+  CoefficientTable<double> table_float;
+  table_float.reinit(100 /* rows */, 27 /* points */, true /* single precision */);
+
+  std::cout << "Memory of single precision table smaller: "
+            << (table_float.memory_consumption() < table_double.memory_consumption() ? "true" :
+                                                                                        "false")
+            << std::endl;
+}
+
+} // namespace ExaDG
+
+int
+main(int argc, char ** argv)
+{
+  try
+  {
+    dealii::Utilities::MPI::MPI_InitFinalize mpi(argc, argv, 1);
+
+    ExaDG::test_constant_detection();
+
+    ExaDG::test_single_precision();
+  }
+  catch(std::exception & exc)
+  {
+    std::cerr << std::endl
+              << std::endl
+              << "----------------------------------------------------" << std::endl;
+    std::cerr << "Exception on processing: " << std::endl
+              << exc.what() << std::endl
+              << "Aborting!" << std::endl
+              << "----------------------------------------------------" << std::endl;
+    return 1;
+  }
+  catch(...)
+  {
+    std::cerr << std::endl
+              << std::endl
+              << "----------------------------------------------------" << std::endl;
+    std::cerr << "Unknown exception!" << std::endl
+              << "Aborting!" << std::endl
+              << "----------------------------------------------------" << std::endl;
+    return 1;
+  }
+
+  return 0;
+}
@@ -0,0 +1,208 @@
+/*  ______________________________________________________________________
+ *
+ *  ExaDG - High-Order Discontinuous Galerkin for the Exa-Scale
+ *
+ *  Copyright (C) 2021 by the ExaDG authors
+ *
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *  ______________________________________________________________________
+ */
+
+// C++
+#include <algorithm>
+#include <cmath>
+#include <functional>
+#include <iostream>
+#include <vector>
+
+// deal.II
+#include <deal.II/base/function.h>
+#include <deal.II/base/mpi.h>
+#include <deal.II/base/quadrature_lib.h>
+#include <deal.II/dofs/dof_handler.h>
+#include <deal.II/fe/fe_dgq.h>
+#include <deal.II/fe/mapping_q.h>
+#include <deal.II/grid/grid_generator.h>
+#include <deal.II/grid/tria.h>
+#include <deal.II/lac/affine_constraints.h>
+#include <deal.II/lac/lapack_full_matrix.h>
+#include <deal.II/matrix_free/matrix_free.h>
+#include <deal.II/numerics/vector_tools.h>
+
+// ExaDG
+#include <exadg/operators/mass_operator.h>
+#include <exadg/postprocessor/incremental_pod_calculation.h>
+
+namespace ExaDG
+{
+int const dim = 2;
+
+typedef dealii::LinearAlgebra::distributed::Vector<double> VectorType;
+
+/*
+ * Computes the POD of snapshots that are linear combinations of n_fields polynomial fields, which
+ * are represented exactly in the finite element space. The singular values of the incremental POD
+ * are compared to those of a direct SVD, which are obtained as the square roots of the eigenvalues
+ * of the mass-weighted Gram matrix of the snapshots (method of snapshots). The singular values
+ * not retained by the incremental POD vanish.
+ */
+void
+test_pod(dealii::MatrixFree<dim, double> const &   matrix_free,
+         dealii::AffineConstraints<double> const & constraints,
+         dealii::Mapping<dim> const &              mapping,
+         unsigned int const                        n_fields,
+         unsigned int const                        max_rank)
+{
+  std::cout << std::endl
+            << "POD of snapshots spanning " << n_fields << " dimensions with maximum rank "
+            << max_rank << ":" << std::endl;
+
+  std::vector<std::function<double(dealii::Point<dim> const &)>> const fields = {
+    [](dealii::Point<dim> const &) { return 1.0; },
+    [](dealii::Point<dim> const & p) { return p[0]; },
+    [](dealii::Point<dim> const & p) { return p[1] * p[1]; },
+    [](dealii::Point<dim> const & p) { return p[0] * p[1]; },
+    [](dealii::Point<dim> const & p) { return p[0] * p[0] - p[1]; }};
+
+  dealii::DoFHandler<dim> const & dof_handler = matrix_free.get_dof_handler();
+
+  unsigned int const n_snapshots = 8;
+
+  std::vector<VectorType> snapshots(n_snapshots);
+  for(unsigned int k = 0; k < n_snapshots; ++k)
+  {
+    matrix_free.initialize_dof_vector(snapshots[k]);
+
+    auto const snapshot = [&](dealii::Point<dim> const & p) {
+      double value = 0.0;
+      for(unsigned int j = 0; j < n_fields; ++j)
+        value += std::sin(1.0 + 0.7 * (k + 1) * (j + 1)) * fields[j](p);
+      return value;
+    };
+
+    dealii::VectorTools::interpolate(mapping,
+                                     dof_handler,
+                                     dealii::ScalarFunctionFromFunctionObject<dim>(snapshot),
+                                     snapshots[k]);
+  }
+
+  IncrementalPODData data;
+  data.time_control_data.is_active = true;
+  data.time_control_data.end_time  = 0.1 * (n_snapshots - 1);
+  data.directory                   = "./";
+  data.max_rank                    = max_rank;
+
+  IncrementalPODCalculator<dim, 1, double> pod_calculator(MPI_COMM_WORLD);
+  pod_calculator.setup(matrix_free, constraints, 0, 0, dof_handler, mapping, data);
+
+  for(unsigned int k = 0; k < n_snapshots; ++k)
+    pod_calculator.evaluate(snapshots[k], 0.1 * k, true);
+
+  // direct SVD
+  MassOperator<dim, 1, double> mass_operator;
+  mass_operator.initialize(matrix_free, constraints, MassOperatorData<dim>());
+
+  dealii::LAPACKFullMatrix<double> gram(n_snapshots, n_snapshots);
+  VectorType                       mass_times_snapshot;
+  matrix_free.initialize_dof_vector(mass_times_snapshot);
+  for(unsigned int l = 0; l < n_snapshots; ++l)
+  {
+    mass_operator.apply(mass_times_snapshot, snapshots[l]);
+    for(unsigned int k = 0; k < n_snapshots; ++k)
+      gram(k, l) = snapshots[k] * mass_times_snapshot;
+  }
+  gram.compute_svd();
+
+  std::vector<double> const & singular_values = pod_calculator.get_singular_values();
+  unsigned int const          rank            = pod_calculator.get_rank();
+
+  double const tolerance = 1.e-6 * std::sqrt(gram.singular_value(0));
+
+  bool match = (singular_values.size() == rank);
+  for(unsigned int i = 0; i < n_snapshots; ++i)
+  {
+    double const singular_value_direct = std::sqrt(std::max(gram.singular_value(i), 0.0));
+    double const singular_value        = i < rank ? singular_values[i] : 0.0;
+
+    match = match && std::abs(singular_value - singular_value_direct) < tolerance;
+  }
+
+  std::cout << "Rank: " << rank << std::endl
+            << "Singular values match direct SVD: " << (match ? "true" : "false") << std::endl;
+}
+
+void
+test()
+{
+  dealii::Triangulation<dim> triangulation;
+  dealii::GridGenerator::hyper_cube(triangulation);
+  triangulation.refine_global(2);
+
+  dealii::FE_DGQ<dim>     fe(2);
+  dealii::DoFHandler<dim> dof_handler(triangulation);
+  dof_handler.distribute_dofs(fe);
+
+  dealii::MappingQ<dim> mapping(1);
+
+  dealii::AffineConstraints<double> constraints;
+  constraints.close();
+
+  typename dealii::MatrixFree<dim, double>::AdditionalData additional_data;
+  additional_data.mapping_update_flags =
+    dealii::update_values | dealii::update_JxW_values | dealii::update_quadrature_points;
+
+  dealii::MatrixFree<dim, double> matrix_free;
+  matrix_free.reinit(mapping, dof_handler, constraints, dealii::QGauss<1>(3), additional_data);
+
+  // the snapshots span a three-dimensional space, i.e., the maximum rank is reached exactly
+  test_pod(matrix_free, constraints, mapping, 3, 3);
+
+  test_pod(matrix_free, constraints, mapping, 5, 10);
+}
+
+} // namespace ExaDG
+
+int
+main(int argc, char ** argv)
+{
+  try
+  {
+    dealii::Utilities::MPI::MPI_InitFinalize mpi(argc, argv, 1);
+
+    ExaDG::test();
+  }
+  catch(std::exception & exc)
+  {
+    std::cerr << std::endl
+              << std::endl
+              << "----------------------------------------------------" << std::endl;
+    std::cerr << "Exception on processing: " << std::endl
+              << exc.what() << std::endl
+              << "Aborting!" << std::endl
+              << "----------------------------------------------------" << std::endl;
+    return 1;
+  }
+  catch(...)
+  {
+    std::cerr << std::endl
+              << std::endl
+              << "----------------------------------------------------" << std::endl;
+    std::cerr << "Unknown exception!" << std::endl
+              << "Aborting!" << std::endl
+              << "----------------------------------------------------" << std::endl;
+    return 1;
+  }
+
+  return 0;
+}
@@ -0,0 +1,252 @@
+/*  ______________________________________________________________________
+ *
+ *  ExaDG - High-Order Discontinuous Galerkin for the Exa-Scale
+ *
+ *  Copyright (C) 2021 by the ExaDG authors
+ *
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *  ______________________________________________________________________
+ */
+
+// C++
+#include <algorithm>
+#include <cmath>
+#include <cstdio>
+#include <fstream>
+#include <iostream>
+#include <string>
+#include <vector>
+
+// deal.II
+#include <deal.II/base/function.h>
+#include <deal.II/base/mpi.h>
+#include <deal.II/dofs/dof_handler.h>
+#include <deal.II/fe/fe_q.h>
+#include <deal.II/grid/grid_generator.h>
+#include <deal.II/grid/tria.h>
+#include <deal.II/lac/vector.h>
+#include <deal.II/numerics/data_out.h>
+#include <deal.II/numerics/vector_tools.h>
+
+#include <hdf5.h>
+
+// ExaDG
+#include <exadg/postprocessor/write_hdf5.h>
+
+namespace ExaDG
+{
+/*
+ * Reads a data set of an HDF5 file, converting the stored values to the type T of the vector.
+ * Returns the number of bytes per stored value in addition.
+ */
+template<typename T>
+std::vector<T>
+read_data_set(std::string const & filename,
+              std::string const & name,
+              hid_t const         memory_type,
+              std::size_t &       stored_bytes)
+{
+  hid_t const file     = H5Fopen(filename.c_str(), H5F_ACC_RDONLY, H5P_DEFAULT);
+  hid_t const data_set = H5Dopen2(file, name.c_str(), H5P_DEFAULT);
+  hid_t const space    = H5Dget_space(data_set);
+  hid_t const type     = H5Dget_type(data_set);
+
+  std::vector<T> data(H5Sget_simple_extent_npoints(space));
+  H5Dread(data_set, memory_type, H5S_ALL, H5S_ALL, H5P_DEFAULT, data.data());
+  stored_bytes = H5Tget_size(type);
+
+  H5Tclose(type);
+  H5Sclose(space);
+  H5Dclose(data_set);
+  H5Fclose(file);
+
+  return data;
+}
+
+void
+print_file(std::string const & filename)
+{
+  std::cout << std::endl << "Content of " << filename << ":" << std::endl;
+
+  std::ifstream file(filename);
+  std::string   line;
+  while(std::getline(file, line))
+    std::cout << line << std::endl;
+}
+
+/*
+ * Writes a continuous field on a uniformly refined square in HDF5 format and reads the data sets
+ * back. The field data of the single precision output deviates from the double precision values
+ * by the rounding error of single precision, while the node coordinates are always exact.
+ */
+void
+test_hdf5_round_trip(dealii::DataOutBase::DataOutFilter const & data_filter,
+                     bool const                                 single_precision,
+                     unsigned int const                         compression_level)
+{
+  std::cout << std::endl
+            << "HDF5 round trip with single_precision = " << single_precision
+            << " and compression_level = " << compression_level << std::endl;
+
+  std::string const filename = "round_trip.h5";
+
+  write_hdf5_file(
+    data_filter, filename, 2, 2, single_precision, compression_level, MPI_COMM_WORLD);
+
+  std::size_t stored_bytes = 0;
+
+  std::vector<double> nodes_expected;
+  data_filter.fill_node_data(nodes_expected);
+  std::vector<double> const nodes =
+    read_data_set<double>(filename, "nodes", H5T_NATIVE_DOUBLE, stored_bytes);
+  std::cout << "Nodes: " << nodes.size() / 2 << ", exact: "
+            << (nodes == nodes_expected ? "true" : "false") << std::endl;
+
+  std::vector<unsigned int> cells_expected;
+  data_filter.fill_cell_data(0, cells_expected);
+  std::vector<unsigned int> const cells =
+    read_data_set<unsigned int>(filename, "cells", H5T_NATIVE_UINT, stored_bytes);
+  std::cout << "Cells: " << cells.size() / 4 << ", exact: "
+            << (cells == cells_expected ? "true" : "false") << std::endl;
+
+  std::string const         name = data_filter.get_data_set_name(0);
+  std::vector<double> const u =
+    read_data_set<double>(filename, name, H5T_NATIVE_DOUBLE, stored_bytes);
+
+  double const * u_expected = data_filter.get_data_set_data(0);
+  double         max_error  = 0.0;
+  for(unsigned int i = 0; i < u.size(); ++i)
+    max_error = std::max(max_error, std::abs(u[i] - u_expected[i]));
+
+  std::cout << "Field " << name << ": " << stored_bytes
+            << " bytes per value, exact: " << (max_error == 0.0 ? "true" : "false")
+            << ", error below 1e-6: " << (max_error < 1.e-6 ? "true" : "false") << std::endl;
+}
+
+/*
+ * The XDMF time series is continued after a restart from the second output step, which is written
+ * again together with the following output steps. Each XDMF file holds its own time series.
+ */
+void
+test_xdmf_time_series(dealii::DataOutBase::DataOutFilter const & data_filter)
+{
+  std::cout << std::endl << "XDMF time series with restart" << std::endl;
+
+  std::string const xdmf_filename       = "solution.xdmf";
+  std::string const xdmf_filename_other = "other.xdmf";
+  std::remove(xdmf_filename.c_str());
+  std::remove(xdmf_filename_other.c_str());
+
+  auto const add_output_step = [&](std::string const & xdmf, unsigned int const counter) {
+    add_to_xdmf_time_series(data_filter,
+                            xdmf,
+                            "solution_" + dealii::Utilities::int_to_string(counter, 4) + ".h5",
+                            0.5 * counter,
+                            2,
+                            2,
+                            false,
+                            MPI_COMM_WORLD);
+  };
+
+  // simulation before the restart
+  for(unsigned int counter = 0; counter < 3; ++counter)
+    add_output_step(xdmf_filename, counter);
+
+  add_output_step(xdmf_filename_other, 0);
+
+  // simulation restarted at time 0.5
+  for(unsigned int counter = 1; counter < 3; ++counter)
+    add_output_step(xdmf_filename, counter);
+
+  print_file(xdmf_filename);
+  print_file(xdmf_filename_other);
+}
+
+void
+test()
+{
+  std::cout << std::endl << "XDMF attribute types:" << std::endl;
+  for(unsigned int const n_components : {1, 2, 3, 4, 6, 9})
+    std::cout << n_components << " components: " << get_xdmf_attribute_type(n_components)
+              << std::endl;
+
+  dealii::Triangulation<2> triangulation;
+  dealii::GridGenerator::hyper_cube(triangulation);
+  triangulation.refine_global(1);
+
+  dealii::FE_Q<2>       fe(1);
+  dealii::DoFHandler<2> dof_handler(triangulation);
+  dof_handler.distribute_dofs(fe);
+
+  // the values are not representable in single precision
+  dealii::Vector<double> u(dof_handler.n_dofs());
+  dealii::VectorTools::interpolate(dof_handler,
+                                   dealii::ScalarFunctionFromFunctionObject<2>(
+                                     [](dealii::Point<2> const & p) {
+                                       return 1.0 / 3.0 + p[0] + 2.0 * p[1];
+                                     }),
+                                   u);
+
+  dealii::DataOut<2> data_out;
+  data_out.attach_dof_handler(dof_handler);
+  data_out.add_data_vector(u, "u");
+  data_out.build_patches();
+
+  dealii::DataOutBase::DataOutFilter data_filter(
+    dealii::DataOutBase::DataOutFilterFlags(false /* filter_duplicate_vertices */,
+                                            true /* xdmf_hdf5_output */));
+  data_out.write_filtered_data(data_filter);
+
+  test_hdf5_round_trip(data_filter, false, 0);
+  test_hdf5_round_trip(data_filter, false, 6);
+  test_hdf5_round_trip(data_filter, true, 6);
+
+  test_xdmf_time_series(data_filter);
+}
+
+} // namespace ExaDG
+
+int
+main(int argc, char ** argv)
+{
+  try
+  {
+    dealii::Utilities::MPI::MPI_InitFinalize mpi(argc, argv, 1);
+
+    ExaDG::test();
+  }
+  catch(std::exception & exc)
+  {
+    std::cerr << std::endl
+              << std::endl
+              << "----------------------------------------------------" << std::endl;
+    std::cerr << "Exception on processing: " << std::endl
+              << exc.what() << std::endl
+              << "Aborting!" << std::endl
+              << "----------------------------------------------------" << std::endl;
+    return 1;
+  }
+  catch(...)
+  {
+    std::cerr << std::endl
+              << std::endl
+              << "----------------------------------------------------" << std::endl;
+    std::cerr << "Unknown exception!" << std::endl
+              << "Aborting!" << std::endl
+              << "----------------------------------------------------" << std::endl;
+    return 1;
+  }
+
+  return 0;
+}
@@ -0,0 +1,248 @@
+/*  ______________________________________________________________________
+ *
+ *  ExaDG - High-Order Discontinuous Galerkin for the Exa-Scale
+ *
+ *  Copyright (C) 2021 by the ExaDG authors
+ *
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *  ______________________________________________________________________
+ */
+
+/*
+ * Solves a sequence of slowly changing linear systems, as they arise for example in Newton
+ * iterations, with the recycling Krylov solvers and compares them to the solvers without recycling:
+ * Deflated CG is compared to CG for a shifted Laplacian (symmetric positive definite), and GCRO-DR
+ * is compared to FGMRES with the same maximum basis size for a convection-diffusion operator
+ * (nonsymmetric).
+ */
+
+// C++
+#include <cmath>
+#include <iostream>
+#include <vector>
+
+// deal.II
+#include <deal.II/base/logstream.h>
+#include <deal.II/base/mpi.h>
+#include <deal.II/lac/precondition.h>
+#include <deal.II/lac/solver_cg.h>
+#include <deal.II/lac/solver_control.h>
+#include <deal.II/lac/solver_gmres.h>
+#include <deal.II/lac/vector.h>
+
+// ExaDG
+#include <exadg/solvers_and_preconditioners/solvers/krylov_recycling.h>
+
+namespace ExaDG
+{
+typedef dealii::Vector<double> VectorType;
+
+unsigned int const size        = 500;
+unsigned int const n_systems   = 4;
+unsigned int const max_iter    = 10000;
+double const       rel_tol     = 1.e-10;
+double const       tol_compare = 1.e-6;
+
+/*
+ * Tridiagonal Toeplitz matrix, corresponding to a central finite difference discretization of
+ * -u'' + a u' + c u with homogeneous Dirichlet boundary conditions multiplied by h^2, where
+ * convection = a h and shift = c h^2.
+ */
+class TridiagonalOperator
+{
+public:
+  TridiagonalOperator(double const shift, double const convection)
+    : lower(-1.0 - 0.5 * convection), diagonal(2.0 + shift), upper(-1.0 + 0.5 * convection)
+  {
+  }
+
+  void
+  vmult(VectorType & dst, VectorType const & src) const
+  {
+    for(unsigned int i = 0; i < src.size(); ++i)
+    {
+      dst(i) = diagonal * src(i);
+      if(i > 0)
+        dst(i) += lower * src(i - 1);
+      if(i + 1 < src.size())
+        dst(i) += upper * src(i + 1);
+    }
+  }
+
+private:
+  double const lower, diagonal, upper;
+};
+
+/*
+ * The operator and the right-hand side change slightly from one system to the next.
+ */
+TridiagonalOperator
+get_operator(unsigned int const system, double const convection)
+{
+  return TridiagonalOperator(1.e-3 * (1.0 + 0.1 * system), convection);
+}
+
+VectorType
+get_rhs(unsigned int const system)
+{
+  VectorType b(size);
+  for(unsigned int i = 0; i < size; ++i)
+    b(i) = 1.0 + 0.1 * system * std::sin(0.1 * i);
+
+  return b;
+}
+
+double
+relative_difference(VectorType const & x, VectorType const & x_reference)
+{
+  VectorType difference = x;
+  difference.add(-1.0, x_reference);
+
+  return difference.l2_norm() / x_reference.l2_norm();
+}
+
+/*
+ * Prints the results of a sequence of solves. The recycling solver has to give the same solutions
+ * and needs to require fewer iterations than the solver without recycling once a recycle space is
+ * available, i.e. from the second system on.
+ */
+void
+print_results(std::vector<unsigned int> const & n_iter,
+              std::vector<unsigned int> const & n_iter_recycling,
+              std::vector<double> const &       differences)
+{
+  bool same_solutions = true;
+  for(double const difference : differences)
+    same_solutions = same_solutions and difference < tol_compare;
+
+  bool fewer_iterations = true;
+  for(unsigned int system = 1; system < n_systems; ++system)
+    fewer_iterations = fewer_iterations and n_iter_recycling[system] < n_iter[system];
+
+  std::cout << "Same solutions: " << (same_solutions ? "true" : "false") << std::endl;
+  std::cout << "Fewer iterations with recycling from the second system on: "
+            << (fewer_iterations ? "true" : "false") << std::endl;
+}
+
+void
+test_deflated_cg()
+{
+  std::cout << std::endl
+            << "Deflated CG vs. CG, symmetric positive definite systems:" << std::endl
+            << std::endl;
+
+  Krylov::DeflatedCG<VectorType> deflated_cg;
+  deflated_cg.reinit(10 /* recycle space size */, 50 /* max. number of stored directions */);
+
+  std::vector<unsigned int> n_iter, n_iter_recycling;
+  std::vector<double>       differences;
+
+  for(unsigned int system = 0; system < n_systems; ++system)
+  {
+    TridiagonalOperator const A = get_operator(system, 0.0);
+    VectorType const          b = get_rhs(system);
+
+    VectorType                   x(size);
+    dealii::SolverControl        control(max_iter, rel_tol * b.l2_norm());
+    dealii::SolverCG<VectorType> solver(control);
+    solver.solve(A, x, b, dealii::PreconditionIdentity());
+    n_iter.push_back(control.last_step());
+
+    VectorType            x_recycling(size);
+    double const          l2_reference = deflated_cg.setup(A, x_recycling, b);
+    dealii::SolverControl control_recycling(max_iter, rel_tol * l2_reference);
+    deflated_cg.solve(A, x_recycling, dealii::PreconditionIdentity(), control_recycling);
+    n_iter_recycling.push_back(control_recycling.last_step());
+
+    differences.push_back(relative_difference(x_recycling, x));
+  }
+
+  print_results(n_iter, n_iter_recycling, differences);
+}
+
+void
+test_gcrodr()
+{
+  std::cout << std::endl << "GCRO-DR vs. FGMRES, nonsymmetric systems:" << std::endl << std::endl;
+
+  unsigned int const max_basis_size = 30;
+
+  Krylov::GCRODR<VectorType> gcrodr;
+  gcrodr.reinit(10 /* recycle space size */, max_basis_size);
+
+  std::vector<unsigned int> n_iter, n_iter_recycling;
+  std::vector<double>       differences;
+
+  for(unsigned int system = 0; system < n_systems; ++system)
+  {
+    TridiagonalOperator const A = get_operator(system, 0.5);
+    VectorType const          b = get_rhs(system);
+
+    VectorType                       x(size);
+    dealii::SolverControl            control(max_iter, rel_tol * b.l2_norm());
+    dealii::SolverFGMRES<VectorType> solver(
+      control, dealii::SolverFGMRES<VectorType>::AdditionalData(max_basis_size));
+    solver.solve(A, x, b, dealii::PreconditionIdentity());
+    n_iter.push_back(control.last_step());
+
+    VectorType            x_recycling(size);
+    double const          l2_reference = gcrodr.setup(A, x_recycling, b);
+    dealii::SolverControl control_recycling(max_iter, rel_tol * l2_reference);
+    gcrodr.solve(A, x_recycling, dealii::PreconditionIdentity(), control_recycling);
+    n_iter_recycling.push_back(control_recycling.last_step());
+
+    differences.push_back(relative_difference(x_recycling, x));
+  }
+
+  print_results(n_iter, n_iter_recycling, differences);
+}
+
+} // namespace ExaDG
+
+int
+main(int argc, char ** argv)
+{
+  try
+  {
+    dealii::Utilities::MPI::MPI_InitFinalize mpi(argc, argv, 1);
+
+    dealii::deallog.depth_console(0);
+
+    ExaDG::test_deflated_cg();
+    ExaDG::test_gcrodr();
+  }
+  catch(std::exception & exc)
+  {
+    std::cerr << std::endl
+              << std::endl
+              << "----------------------------------------------------" << std::endl;
+    std::cerr << "Exception on processing: " << std::endl
+              << exc.what() << std::endl
+              << "Aborting!" << std::endl
+              << "----------------------------------------------------" << std::endl;
+    return 1;
+  }
+  catch(...)
+  {
+    std::cerr << std::endl
+              << std::endl
+              << "----------------------------------------------------" << std::endl;
+    std::cerr << "Unknown exception!" << std::endl
+              << "Aborting!" << std::endl
+              << "----------------------------------------------------" << std::endl;
+    return 1;
+  }
+
+  return 0;
+}
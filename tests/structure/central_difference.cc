@@ -0,0 +1,367 @@
+/*  ______________________________________________________________________
+ *
+ *  ExaDG - High-Order Discontinuous Galerkin for the Exa-Scale
+ *
+ *  Copyright (C) 2021 by the ExaDG authors
+ *
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *  ______________________________________________________________________
+ */
+
+// C++
+#include <algorithm>
+#include <cmath>
+#include <iostream>
+#include <memory>
+#include <vector>
+
+// deal.II
+#include <deal.II/base/mpi.h>
+#include <deal.II/base/numbers.h>
+#include <deal.II/lac/la_parallel_vector.h>
+
+// ExaDG
+#include <exadg/structure/postprocessor/postprocessor_base.h>
+#include <exadg/structure/spatial_discretization/interface.h>
+#include <exadg/structure/time_integration/time_int_central_difference.h>
+#include <exadg/structure/user_interface/parameters.h>
+
+namespace ExaDG
+{
+typedef double                                             Number;
+typedef dealii::LinearAlgebra::distributed::Vector<Number> VectorType;
+
+double const PI    = dealii::numbers::PI;
+double const OMEGA = 2.0 * PI; // period T = 1
+
+/*
+ * Single-DoF oscillator m * d'' + k * d = 0 with m = 1, k = OMEGA^2, and initial conditions
+ * d(0) = 1, v(0) = 0. The exact solution is d(t) = cos(OMEGA t). The central difference scheme
+ * yields d_n = cos(n theta) with cos(theta) = 1 - (OMEGA dt)^2 / 2 and is stable for
+ * dt <= 2 / OMEGA.
+ */
+class OscillatorOperator : public Structure::Interface::Operator<Number>
+{
+public:
+  void
+  initialize_dof_vector(VectorType & src) const final
+  {
+    src.reinit(1);
+  }
+
+  void
+  prescribe_initial_displacement(VectorType & displacement, double const time) const final
+  {
+    (void)time;
+    displacement = 1.0;
+  }
+
+  void
+  prescribe_initial_velocity(VectorType & velocity, double const time) const final
+  {
+    (void)time;
+    velocity = 0.0;
+  }
+
+  void
+  compute_initial_acceleration(VectorType &       acceleration,
+                               VectorType const & displacement,
+                               double const       time) const final
+  {
+    evaluate_acceleration(acceleration, displacement, time);
+  }
+
+  void
+  apply_mass_operator(VectorType & dst, VectorType const & src) const final
+  {
+    dst = src;
+  }
+
+  unsigned int
+  evaluate_acceleration(VectorType &       acceleration,
+                        VectorType const & displacement,
+                        double const       time) const final
+  {
+    (void)time;
+    acceleration.equ(-OMEGA * OMEGA, displacement);
+    return 0;
+  }
+
+  double
+  calculate_critical_time_step(VectorType const & displacement, double const time) const final
+  {
+    (void)displacement;
+    (void)time;
+    return 2.0 / OMEGA;
+  }
+
+  void
+  set_constrained_values(VectorType & displacement, double const time) const final
+  {
+    (void)displacement;
+    (void)time;
+  }
+
+  void
+  compute_rhs_linear(VectorType & dst, double const time) const final
+  {
+    (void)dst;
+    (void)time;
+    AssertThrow(false, dealii::ExcMessage("Not needed for explicit time integration."));
+  }
+
+  std::tuple<unsigned int, unsigned int>
+  solve_nonlinear(VectorType &       sol,
+                  VectorType const & rhs,
+                  double const       factor,
+                  double const       time,
+                  bool const         update_preconditioner) const final
+  {
+    (void)sol;
+    (void)rhs;
+    (void)factor;
+    (void)time;
+    (void)update_preconditioner;
+    AssertThrow(false, dealii::ExcMessage("Not needed for explicit time integration."));
+    return std::tuple<unsigned int, unsigned int>(0, 0);
+  }
+
+  unsigned int
+  solve_linear(VectorType &       sol,
+               VectorType const & rhs,
+               double const       factor,
+               double const       time) const final
+  {
+    (void)sol;
+    (void)rhs;
+    (void)factor;
+    (void)time;
+    AssertThrow(false, dealii::ExcMessage("Not needed for explicit time integration."));
+    return 0;
+  }
+
+  Newton::Statistics const &
+  get_newton_statistics() const final
+  {
+    return statistics;
+  }
+
+private:
+  Newton::Statistics statistics;
+};
+
+/*
+ * Stores the displacement of every time step.
+ */
+class OscillatorPostProcessor : public Structure::PostProcessorBase<Number>
+{
+public:
+  void
+  do_postprocessing(VectorType const &     solution,
+                    double const           time,
+                    types::time_step const time_step_number) final
+  {
+    (void)time_step_number;
+    times.push_back(time);
+    displacements.push_back(solution(0));
+  }
+
+  std::vector<double> times;
+  std::vector<double> displacements;
+};
+
+std::shared_ptr<OscillatorPostProcessor>
+run(Structure::Parameters const & param)
+{
+  std::shared_ptr<OscillatorOperator> pde_operator = std::make_shared<OscillatorOperator>();
+  std::shared_ptr<OscillatorPostProcessor> postprocessor =
+    std::make_shared<OscillatorPostProcessor>();
+
+  Structure::TimeIntCentralDifference<2, Number> time_integrator(
+    pde_operator, postprocessor, param, MPI_COMM_WORLD, true /* is_test */);
+
+  time_integrator.setup(false);
+  time_integrator.compute_initial_acceleration(false);
+
+  while(not(time_integrator.finished()))
+  {
+    time_integrator.advance_one_timestep_pre_solve(false);
+    time_integrator.advance_one_timestep_solve();
+    time_integrator.advance_one_timestep_post_solve();
+  }
+
+  return postprocessor;
+}
+
+Structure::Parameters
+create_parameters()
+{
+  Structure::Parameters param;
+  param.problem_type            = Structure::ProblemType::Unsteady;
+  param.temporal_discretization = Structure::TemporalDiscretization::CentralDifference;
+  param.mass_matrix_type        = Structure::MassMatrixType::Lumped;
+  param.start_time              = 0.0;
+
+  return param;
+}
+
+/*
+ * Five periods with a time step size well below the critical time step size. The period measured
+ * from the zero crossings of the displacement is compared to the analytical period T = 1.
+ */
+void
+test_period()
+{
+  std::cout << std::endl
+            << "Central difference scheme: period of single-DoF oscillator" << std::endl;
+
+  Structure::Parameters param = create_parameters();
+  param.end_time              = 5.0;
+  param.time_step_size        = 0.05;
+
+  std::shared_ptr<OscillatorPostProcessor> postprocessor = run(param);
+
+  std::vector<double> const & t = postprocessor->times;
+  std::vector<double> const & d = postprocessor->displacements;
+
+  // the discrete solution is d_n = cos(n theta)
+  double const theta = std::acos(1.0 - 0.5 * std::pow(OMEGA * param.time_step_size, 2.0));
+  double       error = 0.0;
+  for(unsigned int n = 0; n < d.size(); ++n)
+    error = std::max(error, std::abs(d[n] - std::cos(n * theta)));
+
+  // zero crossings (linear interpolation)
+  std::vector<double> crossings;
+  for(unsigned int n = 1; n < d.size(); ++n)
+    if((d[n - 1] > 0.0) != (d[n] > 0.0))
+      crossings.push_back(t[n - 1] + (t[n] - t[n - 1]) * d[n - 1] / (d[n - 1] - d[n]));
+
+  double const period =
+    2.0 * (crossings.back() - crossings.front()) / (double)(crossings.size() - 1);
+
+  // leading-order period error of the central difference scheme; the interpolation of the zero
+  // crossings adds a higher-order contribution, so only the agreement within 5% is checked
+  double const period_error          = (period - 1.0) / 1.0;
+  double const period_error_expected = -std::pow(OMEGA * param.time_step_size, 2.0) / 24.0;
+
+  std::cout << std::endl
+            << "Number of time steps = " << d.size() - 1 << std::endl
+            << "Number of zero crossings = " << crossings.size() << std::endl
+            << "Deviation from cos(n theta) below 1e-12: " << (error < 1.e-12 ? "true" : "false")
+            << std::endl
+            << "Relative period error within 5% of -(omega dt)^2/24: "
+            << (std::abs(period_error - period_error_expected) <
+                    0.05 * std::abs(period_error_expected) ?
+                  "true" :
+                  "false")
+            << std::endl;
+}
+
+/*
+ * Time step size slightly below the critical time step size: the amplitude remains bounded.
+ */
+void
+test_stable()
+{
+  std::cout << std::endl
+            << "Central difference scheme: time step size below critical time step size"
+            << std::endl;
+
+  Structure::Parameters param         = create_parameters();
+  param.end_time                      = 1.e6;
+  param.max_number_of_time_steps      = 1000;
+  param.calculation_of_time_step_size = Structure::TimeStepCalculation::CriticalTimeStep;
+  param.cfl_number                    = 0.99;
+
+  std::shared_ptr<OscillatorPostProcessor> postprocessor = run(param);
+
+  double max_displacement = 0.0;
+  for(double const & d : postprocessor->displacements)
+    max_displacement = std::max(max_displacement, std::abs(d));
+
+  std::cout << std::endl
+            << "Number of time steps = " << postprocessor->displacements.size() - 1 << std::endl
+            << "Displacement bounded by initial amplitude: "
+            << (max_displacement <= 1.0 + 1.e-8 ? "true" : "false") << std::endl;
+}
+
+/*
+ * Time step size above the critical time step size: the setup of the time integrator fails.
+ */
+void
+test_unstable()
+{
+  std::cout << std::endl
+            << "Central difference scheme: time step size above critical time step size"
+            << std::endl;
+
+  Structure::Parameters param         = create_parameters();
+  param.end_time                      = 1.e6;
+  param.max_number_of_time_steps      = 1000;
+  param.calculation_of_time_step_size = Structure::TimeStepCalculation::CriticalTimeStep;
+  param.cfl_number                    = 1.01;
+
+  bool rejected = false;
+  try
+  {
+    run(param);
+  }
+  catch(dealii::ExceptionBase const &)
+  {
+    rejected = true;
+  }
+
+  std::cout << std::endl
+            << "Time step size rejected: " << (rejected ? "true" : "false") << std::endl;
+}
+
+} // namespace ExaDG
+
+int
+main(int argc, char ** argv)
+{
+  try
+  {
+    dealii::Utilities::MPI::MPI_InitFinalize mpi(argc, argv, 1);
+
+    ExaDG::test_period();
+
+    ExaDG::test_stable();
+
+    ExaDG::test_unstable();
+  }
+  catch(std::exception & exc)
+  {
+    std::cerr << std::endl
+              << std::endl
+              << "----------------------------------------------------" << std::endl;
+    std::cerr << "Exception on processing: " << std::endl
+              << exc.what() << std::endl
+              << "Aborting!" << std::endl
+              << "----------------------------------------------------" << std::endl;
+    return 1;
+  }
+  catch(...)
+  {
+    std::cerr << std::endl
+              << std::endl
+              << "----------------------------------------------------" << std::endl;
+    std::cerr << "Unknown exception!" << std::endl
+              << "Aborting!" << std::endl
+              << "----------------------------------------------------" << std::endl;
+    return 1;
+  }
+
+  return 0;
+}
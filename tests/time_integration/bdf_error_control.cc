@@ -0,0 +1,258 @@
+/*  ______________________________________________________________________
+ *
+ *  ExaDG - High-Order Discontinuous Galerkin for the Exa-Scale
+ *
+ *  Copyright (C) 2021 by the ExaDG authors
+ *
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *  ______________________________________________________________________
+ */
+
+// C++
+#include <cmath>
+#include <iostream>
+#include <limits>
+#include <map>
+#include <string>
+#include <vector>
+
+// deal.II
+#include <deal.II/base/mpi.h>
+#include <deal.II/lac/la_parallel_vector.h>
+
+// ExaDG
+#include <exadg/time_integration/push_back_vectors.h>
+#include <exadg/time_integration/time_int_bdf_base.h>
+
+namespace ExaDG
+{
+typedef double                                             Number;
+typedef dealii::LinearAlgebra::distributed::Vector<Number> VectorType;
+
+double const LAMBDA        = 1.0;
+double const END_TIME      = 2.0;
+double const TIME_STEP_MAX = 0.1;
+
+/*
+ * BDF time integration of the scalar problem u' = -LAMBDA * u with u(0) = 1, whose exact solution
+ * is u(t) = exp(-LAMBDA t). The time step size is selected by the error controller, limited by
+ * TIME_STEP_MAX, which also serves as the initial time step size. The initial time step size is far
+ * too large for the tolerances, so that the first time step is rejected several times. The last
+ * time step is shortened to end exactly at END_TIME.
+ */
+class ExponentialDecayBDF : public TimeIntBDFBase<Number>
+{
+public:
+  ExponentialDecayBDF(unsigned int const order, ErrorControllerData const & error_controller_data)
+    : TimeIntBDFBase<Number>(0.0,
+                             END_TIME,
+                             std::numeric_limits<unsigned int>::max(),
+                             order,
+                             true /* start_with_low_order */,
+                             false /* adaptive_time_stepping */,
+                             RestartData(),
+                             MPI_COMM_WORLD,
+                             true /* is_test */,
+                             error_controller_data),
+      solution(order)
+  {
+  }
+
+  double
+  get_relative_error() const
+  {
+    double const exact = std::exp(-LAMBDA * this->get_time());
+    return std::abs(solution[0](0) - exact) / exact;
+  }
+
+  // number of solutions of the linear system of equations per time step, i.e., one plus the number
+  // of rejections of this time step
+  std::map<unsigned int, unsigned int> n_solves;
+
+private:
+  void
+  allocate_vectors() final
+  {
+    for(VectorType & vector : solution)
+      vector.reinit(1);
+    solution_np.reinit(1);
+  }
+
+  void
+  initialize_current_solution() final
+  {
+    solution[0] = 1.0;
+  }
+
+  void
+  initialize_former_solutions() final
+  {
+    AssertThrow(false, dealii::ExcMessage("Not needed when starting with a low order method."));
+  }
+
+  void
+  setup_derived() final
+  {
+  }
+
+  double
+  calculate_time_step_size() final
+  {
+    return TIME_STEP_MAX;
+  }
+
+  double
+  recalculate_time_step_size() const final
+  {
+    return TIME_STEP_MAX;
+  }
+
+  void
+  do_timestep_solve() final
+  {
+    // (gamma0 u_{n+1} - sum_i alpha_i u_{n-i}) / dt = - LAMBDA u_{n+1}
+    double rhs = 0.0;
+    for(unsigned int i = 0; i < order; ++i)
+      rhs += bdf.get_alpha(i) * solution[i](0);
+
+    solution_np(0) = rhs / (bdf.get_gamma0() + LAMBDA * time_steps[0]);
+
+    ++n_solves[this->get_time_step_number()];
+  }
+
+  void
+  prepare_vectors_for_next_timestep() final
+  {
+    push_back(solution);
+    solution[0].swap(solution_np);
+  }
+
+  VectorType const &
+  get_solution_np_error_estimation() const final
+  {
+    return solution_np;
+  }
+
+  VectorType const &
+  get_solution_error_estimation(unsigned int const i) const final
+  {
+    return solution[i];
+  }
+
+  bool
+  print_solver_info() const final
+  {
+    return false;
+  }
+
+  void
+  postprocessing() const final
+  {
+  }
+
+  void
+  read_restart_vectors(boost::archive::binary_iarchive & ia) final
+  {
+    (void)ia;
+    AssertThrow(false, dealii::ExcMessage("Not implemented."));
+  }
+
+  void
+  write_restart_vectors(boost::archive::binary_oarchive & oa) const final
+  {
+    (void)oa;
+    AssertThrow(false, dealii::ExcMessage("Not implemented."));
+  }
+
+  std::vector<VectorType> solution;
+  VectorType              solution_np;
+};
+
+/*
+ * During the start-up phase, the error estimate is of the current (lower) order of the scheme. Once
+ * the first time step has been adjusted to the tolerances, the smooth solution has to be integrated
+ * without further rejections.
+ */
+void
+test(unsigned int const order)
+{
+  std::cout << std::endl
+            << "BDF" << order << " with error control starting with low order methods" << std::endl;
+
+  ErrorControllerData error_controller_data;
+  error_controller_data.active = true;
+
+  ExponentialDecayBDF time_integrator(order, error_controller_data);
+
+  time_integrator.setup(false);
+
+  while(not(time_integrator.finished()))
+  {
+    time_integrator.advance_one_timestep_pre_solve(false);
+    time_integrator.advance_one_timestep_solve();
+    time_integrator.advance_one_timestep_post_solve();
+  }
+
+  unsigned int n_rejections_after_first_step = 0;
+  for(auto const & n : time_integrator.n_solves)
+    if(n.first > 1)
+      n_rejections_after_first_step += n.second - 1;
+
+  std::cout << std::endl
+            << "Rejected time steps after the first time step: " << n_rejections_after_first_step
+            << std::endl
+            << "End time reached exactly: "
+            << (std::abs(time_integrator.get_time() - END_TIME) < 1.e-12 ? "true" : "false")
+            << std::endl
+            << "Relative error at end time below 1e-4: "
+            << (time_integrator.get_relative_error() < 1.e-4 ? "true" : "false") << std::endl;
+}
+
+} // namespace ExaDG
+
+int
+main(int argc, char ** argv)
+{
+  try
+  {
+    dealii::Utilities::MPI::MPI_InitFinalize mpi(argc, argv, 1);
+
+    ExaDG::test(2);
+
+    ExaDG::test(3);
+  }
+  catch(std::exception & exc)
+  {
+    std::cerr << std::endl
+              << std::endl
+              << "----------------------------------------------------" << std::endl;
+    std::cerr << "Exception on processing: " << std::endl
+              << exc.what() << std::endl
+              << "Aborting!" << std::endl
+              << "----------------------------------------------------" << std::endl;
+    return 1;
+  }
+  catch(...)
+  {
+    std::cerr << std::endl
+              << std::endl
+              << "----------------------------------------------------" << std::endl;
+    std::cerr << "Unknown exception!" << std::endl
+              << "Aborting!" << std::endl
+              << "----------------------------------------------------" << std::endl;
+    return 1;
+  }
+
+  return 0;
+}
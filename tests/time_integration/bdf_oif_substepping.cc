@@ -0,0 +1,316 @@
+/*  ______________________________________________________________________
+ *
+ *  ExaDG - High-Order Discontinuous Galerkin for the Exa-Scale
+ *
+ *  Copyright (C) 2021 by the ExaDG authors
+ *
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *  ______________________________________________________________________
+ */
+
+// C++
+#include <cmath>
+#include <iostream>
+#include <limits>
+#include <memory>
+#include <vector>
+
+// deal.II
+#include <deal.II/base/mpi.h>
+#include <deal.II/lac/la_parallel_vector.h>
+
+// ExaDG
+#include <exadg/time_integration/enum_types.h>
+#include <exadg/time_integration/operator_integration_factor.h>
+#include <exadg/time_integration/push_back_vectors.h>
+#include <exadg/time_integration/time_int_bdf_base.h>
+
+namespace ExaDG
+{
+typedef double                                             Number;
+typedef dealii::LinearAlgebra::distributed::Vector<Number> VectorType;
+
+double const OMEGA     = 1.0;
+double const END_TIME  = 80.0;
+double const TIME_STEP = 4.0;
+double const CFL       = OMEGA * TIME_STEP;
+
+/*
+ * Rotation u' = OMEGA (-u_1, u_0) as a model of a convective term, whose eigenvalues +/- i OMEGA
+ * are purely imaginary.
+ */
+class RotationOperator
+{
+public:
+  void
+  initialize_dof_vector(VectorType & src) const
+  {
+    src.reinit(2);
+  }
+
+  void
+  evaluate(VectorType & dst, VectorType const & src, double const evaluation_time) const
+  {
+    (void)evaluation_time;
+
+    dst(0) = -OMEGA * src(1);
+    dst(1) = OMEGA * src(0);
+
+    ++n_evaluations;
+  }
+
+  void
+  evaluate_and_update_stage(VectorType & solution,
+                            VectorType & vec_ri,
+                            VectorType & vec_ki,
+                            double const evaluation_time,
+                            double const factor_ri,
+                            double const factor_solution,
+                            bool const   update_ri) const
+  {
+    evaluate_and_update_stage_oif(
+      *this, solution, vec_ri, vec_ki, evaluation_time, factor_ri, factor_solution, update_ri);
+  }
+
+  mutable unsigned int n_evaluations = 0;
+};
+
+/*
+ * BDF2 time integration of the rotation with u(0) = (1, 0) and the exact solution
+ * u(t) = (cos(OMEGA t), sin(OMEGA t)), treating the operator explicitly by the
+ * operator-integration-factor (OIF) splitting with the classical Runge-Kutta method for the
+ * sub-steps. The time step size corresponds to a CFL number of OMEGA * TIME_STEP = 4, beyond the
+ * stability limit 2.83 of the classical Runge-Kutta method on the imaginary axis.
+ */
+class RotationBDFOIF : public TimeIntBDFBase<Number>
+{
+public:
+  RotationBDFOIF(double const cfl_oif_in)
+    : TimeIntBDFBase<Number>(0.0,
+                             END_TIME,
+                             std::numeric_limits<unsigned int>::max(),
+                             2 /* order */,
+                             false /* start_with_low_order */,
+                             false /* adaptive_time_stepping */,
+                             RestartData(),
+                             MPI_COMM_WORLD,
+                             true /* is_test */),
+      cfl_oif(cfl_oif_in),
+      solution(2),
+      rotation(std::make_shared<RotationOperator>())
+  {
+  }
+
+  double
+  get_error() const
+  {
+    double const t = this->get_time();
+    return std::sqrt(std::pow(solution[0](0) - std::cos(OMEGA * t), 2) +
+                     std::pow(solution[0](1) - std::sin(OMEGA * t), 2));
+  }
+
+  double
+  get_amplitude() const
+  {
+    return solution[0].l2_norm();
+  }
+
+  // number of sub-steps per time step summed over the sub-step integrations of all former solutions
+  double
+  get_average_number_of_substeps() const
+  {
+    return rotation->n_evaluations / 4.0 / this->get_number_of_time_steps();
+  }
+
+private:
+  void
+  allocate_vectors() final
+  {
+    for(VectorType & vector : solution)
+      rotation->initialize_dof_vector(vector);
+    rotation->initialize_dof_vector(solution_np);
+    rotation->initialize_dof_vector(sum_alphai_ui);
+  }
+
+  void
+  initialize_current_solution() final
+  {
+    solution[0](0) = std::cos(OMEGA * this->get_time());
+    solution[0](1) = std::sin(OMEGA * this->get_time());
+  }
+
+  void
+  initialize_former_solutions() final
+  {
+    solution[1](0) = std::cos(OMEGA * this->get_previous_time(1));
+    solution[1](1) = std::sin(OMEGA * this->get_previous_time(1));
+  }
+
+  void
+  setup_derived() final
+  {
+    time_integrator_oif = create_time_integrator_oif<RotationOperator, VectorType>(
+      TimeIntegratorOIF::ExplRK4Stage4, rotation);
+  }
+
+  double
+  calculate_time_step_size() final
+  {
+    return TIME_STEP;
+  }
+
+  double
+  recalculate_time_step_size() const final
+  {
+    return TIME_STEP;
+  }
+
+  void
+  do_timestep_solve() final
+  {
+    // the operator is integrated exactly apart from the sub-steps: gamma0 u_{n+1} = sum_i alpha_i
+    // u_tilde_i, where u_tilde_i is the solution u_{n-i} transported to t_{n+1}
+    this->calculate_sum_alphai_ui_oif_substepping(
+      sum_alphai_ui, *time_integrator_oif, {&solution[0], &solution[1]}, CFL, cfl_oif);
+
+    solution_np.equ(time_steps[0] / bdf.get_gamma0(), sum_alphai_ui);
+  }
+
+  void
+  prepare_vectors_for_next_timestep() final
+  {
+    push_back(solution);
+    solution[0].swap(solution_np);
+  }
+
+  VectorType const &
+  get_solution_np_error_estimation() const final
+  {
+    return solution_np;
+  }
+
+  VectorType const &
+  get_solution_error_estimation(unsigned int const i) const final
+  {
+    return solution[i];
+  }
+
+  bool
+  print_solver_info() const final
+  {
+    return false;
+  }
+
+  void
+  postprocessing() const final
+  {
+  }
+
+  void
+  read_restart_vectors(boost::archive::binary_iarchive & ia) final
+  {
+    (void)ia;
+    AssertThrow(false, dealii::ExcMessage("Not implemented."));
+  }
+
+  void
+  write_restart_vectors(boost::archive::binary_oarchive & oa) const final
+  {
+    (void)oa;
+    AssertThrow(false, dealii::ExcMessage("Not implemented."));
+  }
+
+  double const cfl_oif;
+
+  std::vector<VectorType> solution;
+  VectorType              solution_np;
+  VectorType              sum_alphai_ui;
+
+  std::shared_ptr<RotationOperator> rotation;
+
+  std::shared_ptr<ExplicitTimeIntegrator<RotationOperator, VectorType>> time_integrator_oif;
+};
+
+/*
+ * With sub-steps limited by cfl_oif within the stability region of the Runge-Kutta method, the
+ * time step size of the BDF scheme can exceed the stability limit of the explicit method, whereas
+ * one sub-step per time step (cfl_oif = CFL) is unstable. Since the BDF coefficients sum up to
+ * gamma0, the scheme reproduces the exact solution if the former solutions are transported
+ * exactly, so that the error only stems from the Runge-Kutta sub-steps. The number of sub-steps
+ * is CFL / cfl_oif for u_n and twice this number for u_{n-1}.
+ */
+void
+test(double const cfl_oif)
+{
+  std::cout << std::endl
+            << "BDF2 with OIF sub-stepping for CFL = " << CFL << " and CFL_OIF = " << cfl_oif
+            << std::endl;
+
+  RotationBDFOIF time_integrator(cfl_oif);
+
+  time_integrator.setup(false);
+
+  while(not(time_integrator.finished()))
+  {
+    time_integrator.advance_one_timestep_pre_solve(false);
+    time_integrator.advance_one_timestep_solve();
+    time_integrator.advance_one_timestep_post_solve();
+  }
+
+  std::cout << std::endl
+            << "Sub-steps per time step: " << time_integrator.get_average_number_of_substeps()
+            << std::endl
+            << "Amplitude bounded by initial amplitude: "
+            << (time_integrator.get_amplitude() <= 1.0 ? "true" : "false") << std::endl
+            << "Error at end time below 1e-1: "
+            << (time_integrator.get_error() < 1.e-1 ? "true" : "false") << std::endl;
+}
+
+} // namespace ExaDG
+
+int
+main(int argc, char ** argv)
+{
+  try
+  {
+    dealii::Utilities::MPI::MPI_InitFinalize mpi(argc, argv, 1);
+
+    ExaDG::test(0.5 /* cfl_oif */);
+
+    ExaDG::test(4.0 /* cfl_oif */);
+  }
+  catch(std::exception & exc)
+  {
+    std::cerr << std::endl
+              << std::endl
+              << "----------------------------------------------------" << std::endl;
+    std::cerr << "Exception on processing: " << std::endl
+              << exc.what() << std::endl
+              << "Aborting!" << std::endl
+              << "----------------------------------------------------" << std::endl;
+    return 1;
+  }
+  catch(...)
+  {
+    std::cerr << std::endl
+              << std::endl
+              << "----------------------------------------------------" << std::endl;
+    std::cerr << "Unknown exception!" << std::endl
+              << "Aborting!" << std::endl
+              << "----------------------------------------------------" << std::endl;
+    return 1;
+  }
+
+  return 0;
+}